@@ -0,0 +1 @@
+static const char *petscconfigureoptions = "--with-debugging=0 --with-fc=0 --with-fortran-bindings=0 --with-shared-libraries=1 --with-x=0 COPTFLAGS=-O1 PETSC_ARCH=arch-gate";
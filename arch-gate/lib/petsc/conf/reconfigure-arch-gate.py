@@ -0,0 +1,16 @@
+#!/root/.pyenv/versions/3.11.7/bin/python3
+if __name__ == '__main__':
+  import sys
+  import os
+  sys.path.insert(0, os.path.abspath('config'))
+  import configure
+  configure_options = [
+    '--with-debugging=0',
+    '--with-fc=0',
+    '--with-fortran-bindings=0',
+    '--with-shared-libraries=1',
+    '--with-x=0',
+    'COPTFLAGS=-O1',
+    'PETSC_ARCH=arch-gate',
+  ]
+  configure.petsc_configure(configure_options)
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/dt/dualspace/impls/lagrange/tests/output/ex1_0.out ex1_0.tmp > diff-runex1_0.out 2> diff-runex1_0.out
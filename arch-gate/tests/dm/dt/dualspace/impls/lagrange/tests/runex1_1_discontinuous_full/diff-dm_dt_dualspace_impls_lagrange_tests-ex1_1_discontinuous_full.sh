@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/dt/dualspace/impls/lagrange/tests/output/ex1_1_discontinuous_full.out ex1_1_discontinuous_full.tmp > diff-runex1_1_discontinuous_full.out 2> diff-runex1_1_discontinuous_full.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dim 1 -continuous 0 -trimmed 0  > ex1_1_discontinuous_full.tmp 2> runex1_1_discontinuous_full.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dim 2 -tensor 0 -continuous 0 -trimmed 0  > ex1_2_simplex_discontinuous_full.tmp 2> runex1_2_simplex_discontinuous_full.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dim 2 -tensor 1 -continuous 0 -trimmed 1  > ex1_2_tensor_discontinuous_trimmed.tmp 2> runex1_2_tensor_discontinuous_trimmed.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/dt/dualspace/impls/lagrange/tests/output/ex1_3_simplex_discontinuous_trimmed.out ex1_3_simplex_discontinuous_trimmed.tmp > diff-runex1_3_simplex_discontinuous_trimmed.out 2> diff-runex1_3_simplex_discontinuous_trimmed.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dim 3 -tensor 0 -continuous 0 -trimmed 1  > ex1_3_simplex_discontinuous_trimmed.tmp 2> runex1_3_simplex_discontinuous_trimmed.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dim 3 -tensor 1 -continuous 1 -trimmed 1  > ex1_3_tensor_continuous_trimmed.tmp 2> runex1_3_tensor_continuous_trimmed.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v DM_' -j /root/repo/src/dm/dt/dualspace/impls/lagrange/tutorials/output/ex2_0.out ex2_0.tmp > diff-runex2_0.out 2> diff-runex2_0.out
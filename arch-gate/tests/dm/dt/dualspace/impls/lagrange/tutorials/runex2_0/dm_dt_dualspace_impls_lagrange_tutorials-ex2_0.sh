@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -petscspace_degree 4 -petscdualspace_lagrange_node_type equispaced -petscdualspace_lagrange_node_endpoints 1 -dual_dm_view -dual_vec_view  > ex2_0.tmp 2> runex2_0.err
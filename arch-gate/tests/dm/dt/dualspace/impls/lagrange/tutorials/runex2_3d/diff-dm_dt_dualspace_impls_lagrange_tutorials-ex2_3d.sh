@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v DM_' -j /root/repo/src/dm/dt/dualspace/impls/lagrange/tutorials/output/ex2_3d.out ex2_3d.tmp > diff-runex2_3d.out 2> diff-runex2_3d.out
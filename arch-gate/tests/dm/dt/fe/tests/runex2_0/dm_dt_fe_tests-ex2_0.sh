@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -dm_plex_reference_cell_domain -dm_plex_cell triangular_prism -field_petscspace_degree 0  > ex2_0.tmp 2> runex2_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/dt/fe/tests/output/ex2_2.out ex2_2.tmp > diff-runex2_2.out 2> diff-runex2_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -dm_plex_reference_cell_domain -dm_plex_cell triangular_prism -field_petscspace_type sum -field_petscspace_variables 3 -field_petscspace_components 3 -field_petscspace_sum_spaces 2 -field_petscspace_sum_concatenate false -field_sumcomp_0_petscspace_variables 3 -field_sumcomp_0_petscspace_components 3 -field_sumcomp_0_petscspace_degree 1 -field_sumcomp_1_petscspace_variables 3 -field_sumcomp_1_petscspace_components 3 -field_sumcomp_1_petscspace_type wxy -field_petscdualspace_form_degree 0 -field_petscdualspace_order 1 -field_petscdualspace_components 3  > ex2_2.tmp 2> runex2_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/dt/fe/tests/output/ex3_p1_0.out ex3_p1_0.tmp > diff-runex3_p1_0.out 2> diff-runex3_p1_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -dm_plex_reference_cell_domain -dm_plex_cell triangle -petscspace_degree 1 -snes_error_if_not_converged -ksp_error_if_not_converged -pc_type lu  -func linear > ex3_p1_0.tmp 2> runex3_p1_0.err
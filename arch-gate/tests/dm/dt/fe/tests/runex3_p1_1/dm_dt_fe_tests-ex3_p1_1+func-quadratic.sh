@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -dm_plex_reference_cell_domain -dm_plex_cell triangle -petscspace_degree 1 -snes_error_if_not_converged -ksp_error_if_not_converged -pc_type lu -snes_convergence_estimate -convest_num_refine 2 -dm_refine 1  -func quadratic > ex3_p1_1.tmp 2> runex3_p1_1.err
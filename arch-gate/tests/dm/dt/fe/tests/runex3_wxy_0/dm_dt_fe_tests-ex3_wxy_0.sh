@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -dm_plex_reference_cell_domain -dm_plex_cell triangular_prism -petscspace_type sum -petscspace_variables 3 -petscspace_components 3 -petscspace_sum_spaces 2 -petscspace_sum_concatenate false -sumcomp_0_petscspace_variables 3 -sumcomp_0_petscspace_components 3 -sumcomp_0_petscspace_degree 1 -sumcomp_1_petscspace_variables 3 -sumcomp_1_petscspace_components 3 -sumcomp_1_petscspace_type wxy -petscdualspace_form_degree 0 -petscdualspace_order 1 -petscdualspace_components 3 -snes_error_if_not_converged -ksp_error_if_not_converged -pc_type lu -func constant  > ex3_wxy_0.tmp 2> runex3_wxy_0.err
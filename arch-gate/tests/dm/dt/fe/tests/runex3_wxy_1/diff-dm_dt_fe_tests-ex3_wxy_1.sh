@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/dt/fe/tests/output/ex3_wxy_1.out ex3_wxy_1.tmp > diff-runex3_wxy_1.out 2> diff-runex3_wxy_1.out
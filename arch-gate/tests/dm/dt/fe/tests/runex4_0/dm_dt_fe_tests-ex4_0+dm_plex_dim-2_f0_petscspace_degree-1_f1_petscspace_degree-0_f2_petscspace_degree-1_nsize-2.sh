@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex4 -petsc_ci -dm_plex_box_faces 3,3,3 -dm_plex_simplex 0 -petscpartitioner_type simple  -dm_plex_dim 2 -f0_petscspace_degree 1 -f1_petscspace_degree 0 -f2_petscspace_degree 1 > ex4_0.tmp 2> runex4_0.err
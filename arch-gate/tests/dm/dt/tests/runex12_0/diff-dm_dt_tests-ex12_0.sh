@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/dt/tests/output/ex12_0.out ex12_0.tmp > diff-runex12_0.out 2> diff-runex12_0.out
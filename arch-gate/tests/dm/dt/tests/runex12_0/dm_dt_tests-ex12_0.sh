@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex12 -petsc_ci   > ex12_0.tmp 2> runex12_0.err
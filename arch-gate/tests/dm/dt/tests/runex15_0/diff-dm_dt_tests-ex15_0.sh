@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/dt/tests/output/ex15_0.out ex15_0.tmp > diff-runex15_0.out 2> diff-runex15_0.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/dt/tests/output/ex16_0.out ex16_0.tmp > diff-runex16_0.out 2> diff-runex16_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex16 -petsc_ci   > ex16_0.tmp 2> runex16_0.err
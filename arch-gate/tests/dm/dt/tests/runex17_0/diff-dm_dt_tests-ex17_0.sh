@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/dt/tests/output/ex17_0.out ex17_0.tmp > diff-runex17_0.out 2> diff-runex17_0.out
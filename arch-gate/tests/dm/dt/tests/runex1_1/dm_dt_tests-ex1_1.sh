@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -degrees 1,2,3,4,5 -points 0,.2,-.5,.8,.9,1 -interval -.5,1  > ex1_1.tmp 2> runex1_1.err
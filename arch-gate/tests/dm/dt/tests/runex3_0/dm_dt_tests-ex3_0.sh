@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci   > ex3_0.tmp 2> runex3_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/dt/tests/output/ex4_0.out ex4_0.tmp > diff-runex4_0.out 2> diff-runex4_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex4 -petsc_ci   > ex4_0.tmp 2> runex4_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/dt/tests/output/ex5_0.out ex5_0.tmp > diff-runex5_0.out 2> diff-runex5_0.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/dt/tests/output/ex7_1234.out ex7_1234.tmp > diff-runex7_1234.out 2> diff-runex7_1234.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -verbose  > ex7_1234.tmp 2> runex7_1234.err
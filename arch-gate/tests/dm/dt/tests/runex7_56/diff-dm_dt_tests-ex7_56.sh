@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/dt/tests/output/ex7_56.out ex7_56.tmp > diff-runex7_56.out 2> diff-runex7_56.out
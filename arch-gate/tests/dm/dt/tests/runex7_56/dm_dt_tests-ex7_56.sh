@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -N 5,6  > ex7_56.tmp 2> runex7_56.err
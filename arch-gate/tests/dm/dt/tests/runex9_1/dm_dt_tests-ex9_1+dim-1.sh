@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex9 -petsc_ci   -dim 1 > ex9_1.tmp 2> runex9_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/field/tutorials/output/ex1_ds_tensor_3_2.out ex1_ds_tensor_3_2.tmp > diff-runex1_ds_tensor_3_2.out 2> diff-runex1_ds_tensor_3_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex1 -petsc_ci -dofv 2 -dofe 2 -ne 2  > ex1_1.tmp 2> runex1_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/network/tests/output/ex2_0.out ex2_0.tmp > diff-runex2_0.out 2> diff-runex2_0.out
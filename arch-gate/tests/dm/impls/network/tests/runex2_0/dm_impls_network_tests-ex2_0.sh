@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -ne 4  > ex2_0.tmp 2> runex2_0.err
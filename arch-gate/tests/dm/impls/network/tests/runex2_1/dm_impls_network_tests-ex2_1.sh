@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex2 -petsc_ci -ne 4 -petscpartitioner_type simple  > ex2_1.tmp 2> runex2_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex3 -petsc_ci -ne 5 -petscpartitioner_type simple  > ex3_1.tmp 2> runex3_1.err
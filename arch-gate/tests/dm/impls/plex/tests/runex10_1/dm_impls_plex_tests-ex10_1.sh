@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex10 -petsc_ci -dm_plex_simplex 0 -num_dof 1,0,0 -mat_view -dm_coord_space 0  > ex10_1.tmp 2> runex10_1.err
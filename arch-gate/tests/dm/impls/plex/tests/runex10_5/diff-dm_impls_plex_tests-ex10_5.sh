@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex10_5.out ex10_5.tmp > diff-runex10_5.out 2> diff-runex10_5.out
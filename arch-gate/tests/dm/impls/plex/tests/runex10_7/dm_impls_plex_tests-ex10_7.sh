@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex10 -petsc_ci -dm_plex_dim 3 -dm_plex_simplex 0 -dm_refine 1 -num_dof 1,0,0,0  > ex10_7.tmp 2> runex10_7.err
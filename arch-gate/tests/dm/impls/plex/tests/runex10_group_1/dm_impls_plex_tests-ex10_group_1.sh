@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex10 -petsc_ci -num_groups 1 -num_dof 1,0,0 -is_view -orig_mat_view -perm_mat_view  > ex10_group_1.tmp 2> runex10_group_1.err
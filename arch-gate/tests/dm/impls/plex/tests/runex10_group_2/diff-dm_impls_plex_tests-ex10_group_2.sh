@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex10_group_2.out ex10_group_2.tmp > diff-runex10_group_2.out 2> diff-runex10_group_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex11_gmsh_1.out ex11_gmsh_1.tmp > diff-runex11_gmsh_1.out 2> diff-runex11_gmsh_1.out
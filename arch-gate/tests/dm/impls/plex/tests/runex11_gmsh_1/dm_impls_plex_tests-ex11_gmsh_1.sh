@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex11 -petsc_ci -filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square.msh -petscpartitioner_type simple  > ex11_gmsh_1.tmp 2> runex11_gmsh_1.err
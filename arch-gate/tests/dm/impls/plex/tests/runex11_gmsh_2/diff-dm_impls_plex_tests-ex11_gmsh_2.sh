@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex11_gmsh_2.out ex11_gmsh_2.tmp > diff-runex11_gmsh_2.out 2> diff-runex11_gmsh_2.out
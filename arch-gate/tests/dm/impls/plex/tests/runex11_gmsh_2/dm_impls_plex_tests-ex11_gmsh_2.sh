@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex11 -petsc_ci -filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square.msh -petscpartitioner_type simple  > ex11_gmsh_2.tmp 2> runex11_gmsh_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex16_3_vtk.out ex16_3_vtk.tmp > diff-runex16_3_vtk.out 2> diff-runex16_3_vtk.out
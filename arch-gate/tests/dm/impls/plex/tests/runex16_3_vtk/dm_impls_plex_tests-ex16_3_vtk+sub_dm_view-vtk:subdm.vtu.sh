@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex16 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 4,4 -petscpartitioner_type simple -sub_dm_distribute 0 -sub_dm_plex_check_all -domain -height 0.625  -sub_dm_view vtk:subdm.vtu > ex16_3_vtk.tmp 2> runex16_3_vtk.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex17_hex.out ex17_hex.tmp > diff-runex17_hex.out 2> diff-runex17_hex.out
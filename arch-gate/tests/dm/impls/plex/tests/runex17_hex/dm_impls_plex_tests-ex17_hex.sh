@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex17 -petsc_ci -dm_plex_dim 3 -dm_plex_box_faces 3,3,3 -dm_plex_simplex 0  > ex17_hex.tmp 2> runex17_hex.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex17_hex_hash.out ex17_hex_hash.tmp > diff-runex17_hex_hash.out 2> diff-runex17_hex_hash.out
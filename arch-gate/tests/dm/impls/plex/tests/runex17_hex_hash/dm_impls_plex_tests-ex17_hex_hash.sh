@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex17 -petsc_ci -dm_plex_dim 3 -dm_plex_box_faces 3,3,3 -dm_plex_simplex 0 -dm_refine 1 -dm_plex_hash_location  > ex17_hex_hash.tmp 2> runex17_hex_hash.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex17_quad.out ex17_quad.tmp > diff-runex17_quad.out 2> diff-runex17_quad.out
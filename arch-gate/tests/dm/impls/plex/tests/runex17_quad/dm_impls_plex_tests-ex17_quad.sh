@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex17 -petsc_ci -dm_plex_box_faces 5,5 -dm_plex_simplex 0  > ex17_quad.tmp 2> runex17_quad.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex17 -petsc_ci -dm_plex_box_faces 5,5 -dm_plex_simplex 0 -dm_refine 2 -dm_plex_hash_location  > ex17_quad_hash.tmp 2> runex17_quad_hash.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex17_quad_overlap.out ex17_quad_overlap.tmp > diff-runex17_quad_overlap.out 2> diff-runex17_quad_overlap.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex17 -petsc_ci -centroids 0 -custom -dm_plex_simplex 0 -dm_plex_box_faces 21,21 -dm_distribute_overlap 4 -petscpartitioner_type simple  -dm_plex_hash_location 1 > ex17_quad_overlap.tmp 2> runex17_quad_overlap.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex17_seg.out ex17_seg.tmp > diff-runex17_seg.out 2> diff-runex17_seg.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex17 -petsc_ci -dm_plex_dim 1 -dm_plex_box_faces 10  > ex17_seg.tmp 2> runex17_seg.err
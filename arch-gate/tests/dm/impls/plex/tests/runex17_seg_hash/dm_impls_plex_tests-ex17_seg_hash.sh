@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex17 -petsc_ci -dm_plex_dim 1 -dm_plex_box_faces 10 -dm_refine 2 -dm_plex_hash_location  > ex17_seg_hash.tmp 2> runex17_seg_hash.err
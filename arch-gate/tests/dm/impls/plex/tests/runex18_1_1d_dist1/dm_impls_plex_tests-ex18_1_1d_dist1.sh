@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex18 -petsc_ci -dm_view ascii::ascii_info_detail -dm_plex_check_all -dim 1 -distribute 1  > ex18_1_1d_dist1.tmp 2> runex18_1_1d_dist1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex18_1_tri_dist0_interpolate-none.out ex18_1_tri_dist0_interpolate-none.tmp > diff-runex18_1_tri_dist0_interpolate-none.out 2> diff-runex18_1_tri_dist0_interpolate-none.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex18_1_tri_dist1_interpolate-after_distribute.out ex18_1_tri_dist1_interpolate-after_distribute.tmp > diff-runex18_1_tri_dist1_interpolate-after_distribute.out 2> diff-runex18_1_tri_dist1_interpolate-after_distribute.out
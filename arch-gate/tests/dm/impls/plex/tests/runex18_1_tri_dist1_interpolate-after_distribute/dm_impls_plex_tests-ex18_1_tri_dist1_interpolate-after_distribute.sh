@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex18 -petsc_ci -dm_view ascii::ascii_info_detail -dm_plex_check_all -distribute 1 -interpolate after_distribute  > ex18_1_tri_dist1_interpolate-after_distribute.tmp 2> runex18_1_tri_dist1_interpolate-after_distribute.err
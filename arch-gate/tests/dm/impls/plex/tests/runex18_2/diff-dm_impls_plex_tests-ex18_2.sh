@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex18_2.out ex18_2.tmp > diff-runex18_2.out 2> diff-runex18_2.out
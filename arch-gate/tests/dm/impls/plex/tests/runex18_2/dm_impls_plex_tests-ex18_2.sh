@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex18 -petsc_ci -testnum 1 -interpolate create -dm_plex_check_all -dm_view ascii::ascii_info_detail  > ex18_2.tmp 2> runex18_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex18_2a.out ex18_2a.tmp > diff-runex18_2a.out 2> diff-runex18_2a.out
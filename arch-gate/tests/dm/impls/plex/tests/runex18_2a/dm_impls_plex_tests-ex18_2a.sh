@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex18 -petsc_ci -testnum 1 -interpolate create -dm_plex_check_all -dm_plex_check_cones_conform_on_interfaces_verbose  > ex18_2a.tmp 2> runex18_2a.err
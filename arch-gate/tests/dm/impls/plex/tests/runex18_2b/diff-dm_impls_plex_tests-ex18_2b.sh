@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex18_2b.out ex18_2b.tmp > diff-runex18_2b.out 2> diff-runex18_2b.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex18 -petsc_ci -testnum 1 -interpolate create -dm_plex_check_all -test_expand_points 0,1,2,5,6  > ex18_2b.tmp 2> runex18_2b.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex18_2c.out ex18_2c.tmp > diff-runex18_2c.out 2> diff-runex18_2c.out
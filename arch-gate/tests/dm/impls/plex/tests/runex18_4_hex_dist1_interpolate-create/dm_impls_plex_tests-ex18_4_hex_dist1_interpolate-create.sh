@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex18 -petsc_ci -dim 3 -dm_view ascii::ascii_info_detail -dm_plex_check_all -cell_simplex 0 -distribute 1 -interpolate create  > ex18_4_hex_dist1_interpolate-create.tmp 2> runex18_4_hex_dist1_interpolate-create.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex18 -petsc_ci -dim 3 -dm_view ascii::ascii_info_detail -dm_plex_check_all -distribute 1 -interpolate after_distribute  > ex18_4_tet_dist1_interpolate-after_distribute.tmp 2> runex18_4_tet_dist1_interpolate-after_distribute.err
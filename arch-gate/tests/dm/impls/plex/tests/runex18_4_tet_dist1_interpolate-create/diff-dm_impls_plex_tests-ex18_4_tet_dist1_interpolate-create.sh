@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex18_4_tet_dist1_interpolate-create.out ex18_4_tet_dist1_interpolate-create.tmp > diff-runex18_4_tet_dist1_interpolate-create.out 2> diff-runex18_4_tet_dist1_interpolate-create.out
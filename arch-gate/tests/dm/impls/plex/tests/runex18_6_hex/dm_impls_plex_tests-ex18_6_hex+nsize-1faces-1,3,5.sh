@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex18 -petsc_ci -use_generator -dm_plex_check_all -distribute -interpolate none -cell_simplex 0  -faces 1,3,5 > ex18_6_hex.tmp 2> runex18_6_hex.err
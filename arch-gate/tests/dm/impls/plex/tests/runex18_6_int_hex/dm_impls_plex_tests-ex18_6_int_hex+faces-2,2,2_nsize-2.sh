@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex18 -petsc_ci -use_generator -dm_plex_check_all -distribute -interpolate create -cell_simplex 0  -faces 2,2,2 > ex18_6_int_hex.tmp 2> runex18_6_int_hex.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_coord_space 0 -dm_plex_dim 1 -dm_view ascii::ascii_info_detail -dm_plex_check_all -dm_plex_box_faces 5 -dm_plex_box_bd periodic  > ex1_1d_2.tmp 2> runex1_1d_2.err
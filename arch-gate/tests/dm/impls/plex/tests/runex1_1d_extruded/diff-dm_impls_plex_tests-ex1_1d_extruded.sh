@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_1d_extruded.out ex1_1d_extruded.tmp > diff-runex1_1d_extruded.out 2> diff-runex1_1d_extruded.out
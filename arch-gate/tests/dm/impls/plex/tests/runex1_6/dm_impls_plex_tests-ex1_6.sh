@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_coord_space 0 -dm_plex_simplex 0 -dm_view ascii::ascii_info_detail  > ex1_6.tmp 2> runex1_6.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex1 -petsc_ci -dm_plex_simplex 0 -ref_dm_refine 1 -dist_dm_distribute -petscpartitioner_type simple -dm_view ascii::ascii_latex  > ex1_8.tmp 2> runex1_8.err
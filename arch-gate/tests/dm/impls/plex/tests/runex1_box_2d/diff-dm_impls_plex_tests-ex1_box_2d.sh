@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_box_2d.out ex1_box_2d.tmp > diff-runex1_box_2d.out 2> diff-runex1_box_2d.out
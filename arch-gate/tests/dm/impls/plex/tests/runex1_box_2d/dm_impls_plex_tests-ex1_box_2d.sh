@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_plex_simplex 0 -ref_dm_refine 2 -dm_plex_check_all -dm_view  > ex1_box_2d.tmp 2> runex1_box_2d.err
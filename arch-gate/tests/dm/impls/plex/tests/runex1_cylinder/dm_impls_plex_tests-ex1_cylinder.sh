@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_plex_shape cylinder -dm_plex_check_all -dm_view -ref_dm_refine 1  > ex1_cylinder.tmp 2> runex1_cylinder.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_cylinder_per.out ex1_cylinder_per.tmp > diff-runex1_cylinder_per.out 2> diff-runex1_cylinder_per.out
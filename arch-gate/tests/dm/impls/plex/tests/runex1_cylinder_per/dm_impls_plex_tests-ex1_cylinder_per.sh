@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_plex_shape cylinder -dm_plex_check_all -dm_view -dm_plex_cylinder_bd periodic -ref_dm_refine 1 -ref_dm_refine_remap 0  > ex1_cylinder_per.tmp 2> runex1_cylinder_per.err
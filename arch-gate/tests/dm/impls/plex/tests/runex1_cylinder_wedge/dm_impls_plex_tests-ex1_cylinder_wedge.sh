@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_plex_shape cylinder -dm_plex_check_all -dm_view -dm_coord_space 0 -dm_plex_interpolate 0 -dm_plex_cell tensor_triangular_prism -dm_view vtk:  > ex1_cylinder_wedge.tmp 2> runex1_cylinder_wedge.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_cylinder_wedge.out ex1_cylinder_wedge_int.tmp > diff-runex1_cylinder_wedge_int.out 2> diff-runex1_cylinder_wedge_int.out
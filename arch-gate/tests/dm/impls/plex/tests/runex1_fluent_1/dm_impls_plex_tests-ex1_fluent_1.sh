@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex1 -petsc_ci -dm_plex_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square.cas -dist_dm_distribute -petscpartitioner_type simple -dm_view -final_diagnostics 0  > ex1_fluent_1.tmp 2> runex1_fluent_1.err
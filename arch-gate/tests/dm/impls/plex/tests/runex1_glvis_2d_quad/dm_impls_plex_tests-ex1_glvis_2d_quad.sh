@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_coord_space 0 -dm_plex_simplex 0 -dm_plex_box_faces 3,3 -dm_view glvis:  > ex1_glvis_2d_quad.tmp 2> runex1_glvis_2d_quad.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_glvis_3d_hex_per.out ex1_glvis_3d_hex_per.tmp > diff-runex1_glvis_3d_hex_per.out 2> diff-runex1_glvis_3d_hex_per.out
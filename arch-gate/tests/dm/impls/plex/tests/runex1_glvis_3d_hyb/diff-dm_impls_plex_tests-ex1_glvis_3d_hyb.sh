@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_glvis_3d_hyb.out ex1_glvis_3d_hyb.tmp > diff-runex1_glvis_3d_hyb.out 2> diff-runex1_glvis_3d_hyb.out
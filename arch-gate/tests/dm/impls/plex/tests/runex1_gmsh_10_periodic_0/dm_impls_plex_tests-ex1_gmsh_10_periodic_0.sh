@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_coord_space 0 -dm_plex_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square_periodic.msh -dm_view ::ascii_info_detail -dm_plex_check_all -dm_plex_gmsh_periodic 0  > ex1_gmsh_10_periodic_0.tmp 2> runex1_gmsh_10_periodic_0.err
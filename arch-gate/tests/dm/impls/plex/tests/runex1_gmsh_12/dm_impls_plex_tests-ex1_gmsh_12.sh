@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex1 -petsc_ci -dm_coord_space 0 -dm_plex_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square_bin_physnames.msh -viewer_binary_mpiio -dist_dm_distribute -petscpartitioner_type simple -dm_view -final_diagnostics 0  > ex1_gmsh_12.tmp 2> runex1_gmsh_12.err
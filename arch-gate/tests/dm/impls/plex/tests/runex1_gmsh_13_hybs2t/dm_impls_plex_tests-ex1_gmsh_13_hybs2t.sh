@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex1 -petsc_ci -dm_coord_space 0 -dm_plex_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/hybrid_triquad.msh -dist_dm_distribute -petscpartitioner_type simple -dm_view -ref_dm_refine 1 -ref_dm_plex_transform_type refine_tobox -dm_plex_check_all  > ex1_gmsh_13_hybs2t.tmp 2> runex1_gmsh_13_hybs2t.err
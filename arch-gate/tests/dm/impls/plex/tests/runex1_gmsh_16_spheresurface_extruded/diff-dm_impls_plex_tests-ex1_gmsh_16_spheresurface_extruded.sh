@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_gmsh_16_spheresurface_extruded.out ex1_gmsh_16_spheresurface_extruded.tmp > diff-runex1_gmsh_16_spheresurface_extruded.out 2> diff-runex1_gmsh_16_spheresurface_extruded.out
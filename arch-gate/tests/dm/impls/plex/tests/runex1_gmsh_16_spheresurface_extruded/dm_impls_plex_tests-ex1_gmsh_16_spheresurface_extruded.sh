@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex1 -petsc_ci -dm_coord_space 0 -dm_extrude 3 -dm_plex_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/surfacesphere_bin.msh -dm_plex_gmsh_spacedim 3 -dm_plex_check_all -dm_view -dist_dm_distribute -petscpartitioner_type simple  > ex1_gmsh_16_spheresurface_extruded.tmp 2> runex1_gmsh_16_spheresurface_extruded.err
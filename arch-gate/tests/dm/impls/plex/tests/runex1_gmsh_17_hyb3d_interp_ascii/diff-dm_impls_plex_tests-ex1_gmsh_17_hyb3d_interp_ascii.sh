@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_gmsh_17_hyb3d_interp_ascii.out ex1_gmsh_17_hyb3d_interp_ascii.tmp > diff-runex1_gmsh_17_hyb3d_interp_ascii.out 2> diff-runex1_gmsh_17_hyb3d_interp_ascii.out
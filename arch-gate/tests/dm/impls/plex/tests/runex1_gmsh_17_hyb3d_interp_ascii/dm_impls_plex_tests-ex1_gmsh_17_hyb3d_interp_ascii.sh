@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_plex_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/hybrid_hexwedge.msh -dm_view -dm_plex_check_all  > ex1_gmsh_17_hyb3d_interp_ascii.tmp 2> runex1_gmsh_17_hyb3d_interp_ascii.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_gmsh_1_box_label.out ex1_gmsh_1_box_label.tmp > diff-runex1_gmsh_1_box_label.out 2> diff-runex1_gmsh_1_box_label.out
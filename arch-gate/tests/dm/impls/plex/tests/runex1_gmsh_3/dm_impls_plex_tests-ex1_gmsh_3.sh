@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex1 -petsc_ci -dm_coord_space 0 -dm_view -dm_plex_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square.msh -dist_dm_distribute -petscpartitioner_type simple  > ex1_gmsh_3.tmp 2> runex1_gmsh_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_gmsh_3d_legacy.out ex1_gmsh_3d_ascii_v40.tmp > diff-runex1_gmsh_3d_ascii_v40.out 2> diff-runex1_gmsh_3d_ascii_v40.out
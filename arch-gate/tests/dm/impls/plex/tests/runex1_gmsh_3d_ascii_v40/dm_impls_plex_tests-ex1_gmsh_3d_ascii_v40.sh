@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_coord_space 0 -dm_view ::ascii_info_detail -dm_plex_check_all -dm_plex_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/gmsh-3d-ascii.msh4  > ex1_gmsh_3d_ascii_v40.tmp 2> runex1_gmsh_3d_ascii_v40.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_gmsh_3d_32.out ex1_gmsh_3d_ascii_v41_32.tmp > diff-runex1_gmsh_3d_ascii_v41_32.out 2> diff-runex1_gmsh_3d_ascii_v41_32.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex1 -petsc_ci -dm_coord_space 0 -dist_dm_distribute -petscpartitioner_type simple -dm_view ::ascii_info_detail -dm_plex_check_all -dm_plex_gmsh_mark_vertices -dm_plex_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/gmsh-3d-ascii-32.msh  > ex1_gmsh_3d_ascii_v41_32_np2.tmp 2> runex1_gmsh_3d_ascii_v41_32_np2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_gmsh_3d_legacy_v22_bin.out ex1_gmsh_3d_binary_v22.tmp > diff-runex1_gmsh_3d_binary_v22.out 2> diff-runex1_gmsh_3d_binary_v22.out
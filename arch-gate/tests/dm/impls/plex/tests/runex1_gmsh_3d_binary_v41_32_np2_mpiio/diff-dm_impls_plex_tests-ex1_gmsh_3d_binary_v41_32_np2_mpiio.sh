@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_gmsh_3d_32_np2.out ex1_gmsh_3d_binary_v41_32_np2_mpiio.tmp > diff-runex1_gmsh_3d_binary_v41_32_np2_mpiio.out 2> diff-runex1_gmsh_3d_binary_v41_32_np2_mpiio.out
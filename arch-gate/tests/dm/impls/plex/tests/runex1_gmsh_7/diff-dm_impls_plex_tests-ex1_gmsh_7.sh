@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_gmsh_7.out ex1_gmsh_7.tmp > diff-runex1_gmsh_7.out 2> diff-runex1_gmsh_7.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_gmsh_9_periodic_0.out ex1_gmsh_9_periodic_0.tmp > diff-runex1_gmsh_9_periodic_0.out 2> diff-runex1_gmsh_9_periodic_0.out
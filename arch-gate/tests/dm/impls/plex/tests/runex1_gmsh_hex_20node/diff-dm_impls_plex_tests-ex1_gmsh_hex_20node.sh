@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_gmsh_hex_20node.out ex1_gmsh_hex_20node.tmp > diff-runex1_gmsh_hex_20node.out 2> diff-runex1_gmsh_hex_20node.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_plex_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/gmsh-hex-20node.msh -dm_view -dm_plex_check_all -dm_plex_gmsh_mark_vertices  > ex1_gmsh_hex_20node.tmp 2> runex1_gmsh_hex_20node.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_plex_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/gmsh-qua-8node.msh -dm_view -dm_plex_check_all -dm_plex_gmsh_mark_vertices  > ex1_gmsh_quad_8node.tmp 2> runex1_gmsh_quad_8node.err
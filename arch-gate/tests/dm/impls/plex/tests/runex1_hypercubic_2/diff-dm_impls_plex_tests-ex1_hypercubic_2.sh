@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_hypercubic_2.out ex1_hypercubic_2.tmp > diff-runex1_hypercubic_2.out 2> diff-runex1_hypercubic_2.out
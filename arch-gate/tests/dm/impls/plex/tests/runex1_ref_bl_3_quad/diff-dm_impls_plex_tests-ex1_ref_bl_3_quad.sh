@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_ref_bl_3_quad.out ex1_ref_bl_3_quad.tmp > diff-runex1_ref_bl_3_quad.out 2> diff-runex1_ref_bl_3_quad.out
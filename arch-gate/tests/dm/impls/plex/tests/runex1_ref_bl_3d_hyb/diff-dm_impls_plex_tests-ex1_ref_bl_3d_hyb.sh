@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_ref_bl_3d_hyb.out ex1_ref_bl_3d_hyb.tmp > diff-runex1_ref_bl_3d_hyb.out 2> diff-runex1_ref_bl_3d_hyb.out
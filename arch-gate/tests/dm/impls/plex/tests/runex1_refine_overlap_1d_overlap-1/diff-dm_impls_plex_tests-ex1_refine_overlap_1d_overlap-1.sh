@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_refine_overlap_1d_overlap-1.out ex1_refine_overlap_1d_overlap-1.tmp > diff-runex1_refine_overlap_1d_overlap-1.out 2> diff-runex1_refine_overlap_1d_overlap-1.out
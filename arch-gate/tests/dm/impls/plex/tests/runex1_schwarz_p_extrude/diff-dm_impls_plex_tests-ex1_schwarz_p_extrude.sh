@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_schwarz_p_extrude.out ex1_schwarz_p_extrude.tmp > diff-runex1_schwarz_p_extrude.out 2> diff-runex1_schwarz_p_extrude.out
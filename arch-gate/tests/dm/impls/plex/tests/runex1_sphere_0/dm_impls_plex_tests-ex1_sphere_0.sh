@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_plex_shape sphere -dm_plex_check_all -dm_view  > ex1_sphere_0.tmp 2> runex1_sphere_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_sphere_1.out ex1_sphere_1.tmp > diff-runex1_sphere_1.out 2> diff-runex1_sphere_1.out
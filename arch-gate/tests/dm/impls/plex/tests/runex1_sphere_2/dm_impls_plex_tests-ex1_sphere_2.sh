@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_plex_shape sphere -dm_plex_check_all -dm_view -dm_plex_simplex 0  > ex1_sphere_2.tmp 2> runex1_sphere_2.err
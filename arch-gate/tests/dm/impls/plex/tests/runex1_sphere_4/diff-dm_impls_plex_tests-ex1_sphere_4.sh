@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_sphere_4.out ex1_sphere_4.tmp > diff-runex1_sphere_4.out 2> diff-runex1_sphere_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex1 -petsc_ci -dm_plex_shape sphere -dm_extrude 3 -dm_plex_transform_extrude_use_tensor 0 -dist_dm_distribute -petscpartitioner_type simple -dm_plex_check_all -dm_view ::ascii_info_detail -dm_plex_view_coord_system spherical  > ex1_spheresurface_extruded.tmp 2> runex1_spheresurface_extruded.err
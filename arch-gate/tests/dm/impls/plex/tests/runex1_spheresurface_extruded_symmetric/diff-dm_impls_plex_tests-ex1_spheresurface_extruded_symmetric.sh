@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex1_spheresurface_extruded_symmetric.out ex1_spheresurface_extruded_symmetric.tmp > diff-runex1_spheresurface_extruded_symmetric.out 2> diff-runex1_spheresurface_extruded_symmetric.out
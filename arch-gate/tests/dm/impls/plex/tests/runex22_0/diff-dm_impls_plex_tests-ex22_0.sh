@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex22_0.out ex22_0.tmp > diff-runex22_0.out 2> diff-runex22_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex22 -petsc_ci -petscspace_degree 2 -tensor_petscspace_degree 2  > ex22_0.tmp 2> runex22_0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex27 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 1,1 -field0_petscspace_degree 2 -field1_petscspace_degree 1 -field2_petscspace_degree 1 -dm_view -dof_view  > ex27_quad_pm.tmp 2> runex27_quad_pm.err
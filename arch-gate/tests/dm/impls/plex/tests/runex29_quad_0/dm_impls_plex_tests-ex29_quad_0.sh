@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex29 -petsc_ci -dm_plex_dim 3 -dm_plex_simplex 0 -post_dm_refine 2 -petscpartitioner_type simple -dm_view -pdm_view  > ex29_quad_0.tmp 2> runex29_quad_0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -dm_plex_simplex 0  > ex2_0.tmp 2> runex2_0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex32 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 3,1,0 -dm_plex_box_bd periodic,none -dm_view ::ascii_info_detail  > ex32_0.tmp 2> runex32_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex32_2.out ex32_2.tmp > diff-runex32_2.out 2> diff-runex32_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex32 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 6,2,0 -dm_plex_box_bd periodic,none -petscpartitioner_type simple -dm_view ::ascii_info_detail  > ex32_3.tmp 2> runex32_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex32 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 3,1,0 -dm_plex_box_bd periodic,none -dm_plex_periodic_cut -petscpartitioner_type simple -dm_view ::ascii_info_detail  > ex32_4.tmp 2> runex32_4.err
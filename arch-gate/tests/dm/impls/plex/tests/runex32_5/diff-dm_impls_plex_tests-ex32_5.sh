@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex32_5.out ex32_5.tmp > diff-runex32_5.out 2> diff-runex32_5.out
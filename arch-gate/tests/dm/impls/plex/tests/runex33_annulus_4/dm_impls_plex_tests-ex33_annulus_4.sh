@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex33 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 1,1 -petscfe_default_quadrature_order 2 -volume 2.35619449019235 -dm_coord_remap -dm_coord_map annulus -dm_refine 2 -dm_coord_petscspace_degree 2 -tol .00012  > ex33_annulus_4.tmp 2> runex33_annulus_4.err
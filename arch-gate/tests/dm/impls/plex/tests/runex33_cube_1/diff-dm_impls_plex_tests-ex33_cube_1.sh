@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex33_cube_1.out ex33_cube_1.tmp > diff-runex33_cube_1.out 2> diff-runex33_cube_1.out
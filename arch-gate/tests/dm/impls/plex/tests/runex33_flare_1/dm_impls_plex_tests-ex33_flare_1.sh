@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex33 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 1,1 -dm_plex_box_lower 1.,-1. -dm_plex_box_upper 3.,1. -dm_coord_petscspace_degree 1 -volume 8. -dm_coord_remap -dm_coord_map flare -dm_refine 2  > ex33_flare_1.tmp 2> runex33_flare_1.err
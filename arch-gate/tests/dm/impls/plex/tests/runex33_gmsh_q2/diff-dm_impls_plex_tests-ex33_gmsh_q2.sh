@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex33_gmsh_q2.out ex33_gmsh_q2.tmp > diff-runex33_gmsh_q2.out 2> diff-runex33_gmsh_q2.out
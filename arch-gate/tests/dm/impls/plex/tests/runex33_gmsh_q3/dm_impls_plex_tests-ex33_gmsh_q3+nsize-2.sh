@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex33 -petsc_ci -dm_plex_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/quads-q3.msh -dm_plex_gmsh_project -volume 1.0 -tol 1e-6  > ex33_gmsh_q3.tmp 2> runex33_gmsh_q3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex33_shear_3.out ex33_shear_3.tmp > diff-runex33_shear_3.out 2> diff-runex33_shear_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex33_shear_5.out ex33_shear_5.tmp > diff-runex33_shear_5.out 2> diff-runex33_shear_5.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex33_shell_4.out ex33_shell_4.tmp > diff-runex33_shell_4.out 2> diff-runex33_shell_4.out
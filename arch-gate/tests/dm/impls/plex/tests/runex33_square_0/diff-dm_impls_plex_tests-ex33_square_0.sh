@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex33_square_0.out ex33_square_0.tmp > diff-runex33_square_0.out 2> diff-runex33_square_0.out
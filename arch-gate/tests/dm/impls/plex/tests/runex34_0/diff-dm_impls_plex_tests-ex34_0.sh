@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex34_0.out ex34_0.tmp > diff-runex34_0.out 2> diff-runex34_0.out
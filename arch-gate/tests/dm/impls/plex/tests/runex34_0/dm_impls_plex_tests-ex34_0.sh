@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex34 -petsc_ci -interpolate -dm_view ascii::ascii_info_detail  > ex34_0.tmp 2> runex34_0.err
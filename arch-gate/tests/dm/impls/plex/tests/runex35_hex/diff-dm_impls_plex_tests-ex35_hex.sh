@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex35_hex.out ex35_hex.tmp > diff-runex35_hex.out 2> diff-runex35_hex.out
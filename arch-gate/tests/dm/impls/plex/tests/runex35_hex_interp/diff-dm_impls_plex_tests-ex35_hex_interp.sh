@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex35_hex_interp.out ex35_hex_interp.tmp > diff-runex35_hex_interp.out 2> diff-runex35_hex_interp.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex35_quad.out ex35_quad.tmp > diff-runex35_quad.out 2> diff-runex35_quad.out
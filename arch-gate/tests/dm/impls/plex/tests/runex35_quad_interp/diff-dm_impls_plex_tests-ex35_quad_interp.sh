@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex35_quad_interp.out ex35_quad_interp.tmp > diff-runex35_quad_interp.out 2> diff-runex35_quad_interp.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex35 -petsc_ci -malloc_requested_size -dm_plex_box_faces 5,5 -check_memory 0 -dm_plex_simplex 0 -dm_plex_interpolate 1  > ex35_quad_interp.tmp 2> runex35_quad_interp.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex36_0.out ex36_0.tmp > diff-runex36_0.out 2> diff-runex36_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex36 -petsc_ci -dm_plex_dim 3 -dm_plex_box_faces 8,1,1 -dm_plex_simplex 0 -dm_plex_adj_cone 1 -dm_plex_adj_closure 0 -petscpartitioner_type simple -dm_distribute_overlap 1 -overlap2 1  > ex36_0.tmp 2> runex36_0.err
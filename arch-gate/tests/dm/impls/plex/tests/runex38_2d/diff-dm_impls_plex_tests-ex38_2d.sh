@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex38_2d.out ex38_2d.tmp > diff-runex38_2d.out 2> diff-runex38_2d.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex38 -petsc_ci -dm_plex_simplex 0 -dm_plex_dim 2 -dm_plex_box_faces 3,3 -u_loc_vec_view  > ex38_2d.tmp 2> runex38_2d.err
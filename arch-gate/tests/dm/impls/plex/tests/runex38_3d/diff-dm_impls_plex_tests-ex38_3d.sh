@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex38_3d.out ex38_3d.tmp > diff-runex38_3d.out 2> diff-runex38_3d.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex38 -petsc_ci -dm_plex_simplex 0 -dm_plex_dim 3 -dm_plex_box_faces 3,3,3 -u_loc_vec_view  > ex38_3d.tmp 2> runex38_3d.err
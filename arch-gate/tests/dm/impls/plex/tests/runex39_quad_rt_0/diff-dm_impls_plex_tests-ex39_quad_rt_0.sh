@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex39_quad_rt_0.out ex39_quad_rt_0.tmp > diff-runex39_quad_rt_0.out 2> diff-runex39_quad_rt_0.out
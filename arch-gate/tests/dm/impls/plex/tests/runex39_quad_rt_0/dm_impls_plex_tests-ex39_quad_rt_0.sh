@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex39 -petsc_ci -dm_plex_simplex false -mesh_transform skew -divErr_petscspace_degree 1 -divErr_petscdualspace_lagrange_continuity false -snes_error_if_not_converged -ksp_rtol 1e-10 -ksp_error_if_not_converged -pc_type fieldsplit -pc_fieldsplit_detect_saddle_point -pc_fieldsplit_type schur -pc_fieldsplit_schur_precondition full -velocity_petscfe_default_quadrature_order 1 -velocity_petscspace_type sum -velocity_petscspace_variables 2 -velocity_petscspace_components 2 -velocity_petscspace_sum_spaces 2 -velocity_petscspace_sum_concatenate true -velocity_sumcomp_0_petscspace_variables 2 -velocity_sumcomp_0_petscspace_type tensor -velocity_sumcomp_0_petscspace_tensor_spaces 2 -velocity_sumcomp_0_petscspace_tensor_uniform false -velocity_sumcomp_0_tensorcomp_0_petscspace_degree 1 -velocity_sumcomp_0_tensorcomp_1_petscspace_degree 0 -velocity_sumcomp_1_petscspace_variables 2 -velocity_sumcomp_1_petscspace_type tensor -velocity_sumcomp_1_petscspace_tensor_spaces 2 -velocity_sumcomp_1_petscspace_tensor_uniform false -velocity_sumcomp_1_tensorcomp_0_petscspace_degree 0 -velocity_sumcomp_1_tensorcomp_1_petscspace_degree 1 -velocity_petscdualspace_form_degree -1 -velocity_petscdualspace_order 1 -velocity_petscdualspace_lagrange_trimmed true  > ex39_quad_rt_0.tmp 2> runex39_quad_rt_0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex3 -petsc_ci -dist_dm_distribute -test_fe_jacobian -test_injector -petscpartitioner_type simple -tree -dm_plex_simplex 0 -dm_plex_max_projection_height 1 -petscspace_type tensor -petscspace_degree 2 -qorder 2 -dm_view ascii::ASCII_INFO_DETAIL  > ex3_nonconforming_tensor_2.tmp 2> runex3_nonconforming_tensor_2.err
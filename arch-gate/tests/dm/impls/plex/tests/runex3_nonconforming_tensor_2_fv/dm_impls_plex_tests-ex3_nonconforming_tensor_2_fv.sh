@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex3 -petsc_ci -dist_dm_distribute -test_fv_grad -test_injector -petsclimiter_type none -petscpartitioner_type simple -tree -dm_plex_simplex 0 -num_comp 2  > ex3_nonconforming_tensor_2_fv.tmp 2> runex3_nonconforming_tensor_2_fv.err
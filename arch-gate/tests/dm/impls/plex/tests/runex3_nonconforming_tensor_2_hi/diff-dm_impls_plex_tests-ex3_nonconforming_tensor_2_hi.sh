@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex3_nonconforming_tensor_2_hi.out ex3_nonconforming_tensor_2_hi.tmp > diff-runex3_nonconforming_tensor_2_hi.out 2> diff-runex3_nonconforming_tensor_2_hi.out
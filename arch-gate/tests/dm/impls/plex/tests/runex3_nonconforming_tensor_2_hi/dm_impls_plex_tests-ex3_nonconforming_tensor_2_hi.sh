@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex3 -petsc_ci -dist_dm_distribute -test_fe_jacobian -petscpartitioner_type simple -tree -dm_plex_simplex 0 -dm_plex_max_projection_height 1 -petscspace_type tensor -petscspace_degree 4 -qorder 4  > ex3_nonconforming_tensor_2_hi.tmp 2> runex3_nonconforming_tensor_2_hi.err
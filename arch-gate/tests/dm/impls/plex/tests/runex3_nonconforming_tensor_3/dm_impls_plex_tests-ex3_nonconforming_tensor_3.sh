@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex3 -petsc_ci -dist_dm_distribute -test_fe_jacobian -petscpartitioner_type simple -tree -dm_plex_simplex 0 -dm_plex_dim 3 -dm_plex_box_faces 2,2,2 -dm_plex_max_projection_height 2 -petscspace_type tensor -petscspace_degree 1 -qorder 1 -dm_view ascii::ASCII_INFO_DETAIL  > ex3_nonconforming_tensor_3.tmp 2> runex3_nonconforming_tensor_3.err
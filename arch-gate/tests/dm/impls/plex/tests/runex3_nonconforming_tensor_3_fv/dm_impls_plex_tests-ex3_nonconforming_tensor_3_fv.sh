@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex3 -petsc_ci -dist_dm_distribute -test_fv_grad -test_injector -petsclimiter_type none -petscpartitioner_type simple -tree -dm_plex_simplex 0 -dm_plex_dim 3 -dm_plex_box_faces 2,2,2 -num_comp 3  > ex3_nonconforming_tensor_3_fv.tmp 2> runex3_nonconforming_tensor_3_fv.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex3_q1_2d_plex_2.out ex3_q1_2d_plex_2.tmp > diff-runex3_q1_2d_plex_2.out 2> diff-runex3_q1_2d_plex_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -dm_plex_simplex 0 -petscspace_degree 1 -qorder 1 -porder 1 -shear_coords  > ex3_q1_2d_plex_3.tmp 2> runex3_q1_2d_plex_3.err
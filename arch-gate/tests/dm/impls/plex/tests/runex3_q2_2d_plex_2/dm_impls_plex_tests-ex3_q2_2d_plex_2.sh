@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -dm_plex_simplex 0 -petscspace_degree 2 -qorder 2 -porder 2  > ex3_q2_2d_plex_2.tmp 2> runex3_q2_2d_plex_2.err
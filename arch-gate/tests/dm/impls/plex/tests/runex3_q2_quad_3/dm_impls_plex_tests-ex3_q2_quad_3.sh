@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -dm_plex_simplex 0 -petscspace_degree 2 -qorder 3 -porder 1  > ex3_q2_quad_3.tmp 2> runex3_q2_quad_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -dm_plex_simplex 0 -petscspace_degree 3 -qorder 3 -convergence  > ex3_q3_2d_0.tmp 2> runex3_q3_2d_0.err
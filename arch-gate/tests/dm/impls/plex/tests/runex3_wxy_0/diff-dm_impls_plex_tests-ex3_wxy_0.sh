@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex3_wxy_0.out ex3_wxy_0.tmp > diff-runex3_wxy_0.out 2> diff-runex3_wxy_0.out
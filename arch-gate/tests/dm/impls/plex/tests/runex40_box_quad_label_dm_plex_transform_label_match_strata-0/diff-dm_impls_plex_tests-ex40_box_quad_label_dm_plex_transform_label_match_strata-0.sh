@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex40_box_quad_label_dm_plex_transform_label_match_strata-0.out ex40_box_quad_label_dm_plex_transform_label_match_strata-0.tmp > diff-runex40_box_quad_label_dm_plex_transform_label_match_strata-0.out 2> diff-runex40_box_quad_label_dm_plex_transform_label_match_strata-0.out
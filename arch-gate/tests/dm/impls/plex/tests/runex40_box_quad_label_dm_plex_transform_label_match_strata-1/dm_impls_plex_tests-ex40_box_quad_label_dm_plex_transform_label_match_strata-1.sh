@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex40 -petsc_ci -dm_plex_box_faces 3,3 -dm_plex_simplex 0 -dm_refine 2 -dm_plex_check_all -dm_view -dm_plex_transform_label_match_strata 1  > ex40_box_quad_label_dm_plex_transform_label_match_strata-1.tmp 2> runex40_box_quad_label_dm_plex_transform_label_match_strata-1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex40_extrude_quad.out ex40_extrude_quad.tmp > diff-runex40_extrude_quad.out 2> diff-runex40_extrude_quad.out
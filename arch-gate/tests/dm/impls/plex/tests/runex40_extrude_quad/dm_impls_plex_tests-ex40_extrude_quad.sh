@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex40 -petsc_ci -dm_coord_space 0 -label_mesh -post_label_dm_extrude 2 -post_label_dm_plex_check_all -dm_view ::ascii_info_detail -dm_plex_simplex 0  > ex40_extrude_quad.tmp 2> runex40_extrude_quad.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex40_ref_pyramid.out ex40_ref_pyramid.tmp > diff-runex40_ref_pyramid.out 2> diff-runex40_ref_pyramid.out
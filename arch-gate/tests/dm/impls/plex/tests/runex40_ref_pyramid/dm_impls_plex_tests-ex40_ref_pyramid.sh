@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex40 -petsc_ci -dm_plex_reference_cell_domain -dm_plex_cell pyramid -dm_refine 2 -dm_plex_check_all  > ex40_ref_pyramid.tmp 2> runex40_ref_pyramid.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex40_ref_seg.out ex40_ref_seg.tmp > diff-runex40_ref_seg.out 2> diff-runex40_ref_seg.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex40 -petsc_ci -dm_coord_space 0 -dm_plex_transform_type refine_tobox -dm_plex_check_all -dm_plex_reference_cell_domain -dm_plex_cell tetrahedron -dm_refine 2  > ex40_ref_tet_tobox.tmp 2> runex40_ref_tet_tobox.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex40_ref_tquadp.out ex40_ref_tquadp.tmp > diff-runex40_ref_tquadp.out 2> diff-runex40_ref_tquadp.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex40_ref_ttrip_tobox.out ex40_ref_ttrip_tobox.tmp > diff-runex40_ref_ttrip_tobox.out 2> diff-runex40_ref_ttrip_tobox.out
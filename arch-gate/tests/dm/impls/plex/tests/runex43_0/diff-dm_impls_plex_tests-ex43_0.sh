@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex43_0.out ex43_0.tmp > diff-runex43_0.out 2> diff-runex43_0.out
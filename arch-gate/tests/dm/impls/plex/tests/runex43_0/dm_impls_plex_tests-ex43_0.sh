@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex43 -petsc_ci -sparse_localize 0 -dm_view ascii::ascii_info_detail  > ex43_0.tmp 2> runex43_0.err
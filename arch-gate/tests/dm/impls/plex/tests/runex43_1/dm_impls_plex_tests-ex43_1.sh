@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex43 -petsc_ci -sparse_localize 1 -dm_view ascii::ascii_info_detail  > ex43_1.tmp 2> runex43_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex44 -petsc_ci -dm_adaptor cellrefiner -dm_plex_transform_type extrude -dm_view -adapt_dm_view -dm_plex_simplex 0 -dm_plex_dim 3 -dm_plex_box_faces 2,2,2 -dm_plex_separate_marker -bd 1,3 -dm_plex_transform_extrude_thickness 0.5  > ex44_hex_adapt_0.tmp 2> runex44_hex_adapt_0.err
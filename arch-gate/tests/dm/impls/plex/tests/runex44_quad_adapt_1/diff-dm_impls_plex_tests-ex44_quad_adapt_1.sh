@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex44_quad_adapt_1.out ex44_quad_adapt_1.tmp > diff-runex44_quad_adapt_1.out 2> diff-runex44_quad_adapt_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex44 -petsc_ci -dm_adaptor cellrefiner -dm_plex_transform_type extrude -dm_view -adapt_dm_view -dm_plex_simplex 0 -dm_plex_box_faces 2,2 -bd 1 -dm_plex_transform_extrude_thickness 0.5 -petscpartitioner_type simple  > ex44_quad_adapt_1.tmp 2> runex44_quad_adapt_1.err
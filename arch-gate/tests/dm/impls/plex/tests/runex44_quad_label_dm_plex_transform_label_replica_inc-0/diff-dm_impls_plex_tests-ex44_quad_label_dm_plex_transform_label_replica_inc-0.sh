@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex44_quad_label_dm_plex_transform_label_replica_inc-0.out ex44_quad_label_dm_plex_transform_label_replica_inc-0.tmp > diff-runex44_quad_label_dm_plex_transform_label_replica_inc-0.out 2> diff-runex44_quad_label_dm_plex_transform_label_replica_inc-0.out
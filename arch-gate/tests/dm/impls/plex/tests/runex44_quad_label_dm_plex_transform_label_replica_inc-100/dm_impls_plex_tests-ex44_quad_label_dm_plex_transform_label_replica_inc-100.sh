@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex44 -petsc_ci -dm_plex_simplex 0 -dm_view -adapt_dm_view -dm_plex_check_all -dm_plex_transform_label_replica_inc 100  > ex44_quad_label_dm_plex_transform_label_replica_inc-100.tmp 2> runex44_quad_label_dm_plex_transform_label_replica_inc-100.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex44_quad_normal_0.out ex44_quad_normal_0.tmp > diff-runex44_quad_normal_0.out 2> diff-runex44_quad_normal_0.out
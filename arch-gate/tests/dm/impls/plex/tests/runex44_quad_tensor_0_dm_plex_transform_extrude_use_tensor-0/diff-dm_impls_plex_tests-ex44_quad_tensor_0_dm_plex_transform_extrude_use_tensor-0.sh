@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex44_quad_tensor_0_dm_plex_transform_extrude_use_tensor-0.out ex44_quad_tensor_0_dm_plex_transform_extrude_use_tensor-0.tmp > diff-runex44_quad_tensor_0_dm_plex_transform_extrude_use_tensor-0.out 2> diff-runex44_quad_tensor_0_dm_plex_transform_extrude_use_tensor-0.out
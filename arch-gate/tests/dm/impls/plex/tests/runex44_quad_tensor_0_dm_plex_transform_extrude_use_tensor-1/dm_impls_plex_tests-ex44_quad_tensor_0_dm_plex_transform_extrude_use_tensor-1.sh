@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex44 -petsc_ci -dm_plex_simplex 0 -dm_view -adapt_dm_view -dm_plex_check_all -dm_plex_transform_extrude_use_tensor 1  > ex44_quad_tensor_0_dm_plex_transform_extrude_use_tensor-1.tmp 2> runex44_quad_tensor_0_dm_plex_transform_extrude_use_tensor-1.err
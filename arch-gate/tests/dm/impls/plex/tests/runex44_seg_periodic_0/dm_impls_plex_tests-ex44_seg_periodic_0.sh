@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex44 -petsc_ci -dm_plex_dim 1 -dm_plex_box_faces 3 -dm_plex_transform_extrude_periodic -dm_plex_transform_extrude_use_tensor 0 -dm_view -adapt_dm_view -dm_plex_check_all  > ex44_seg_periodic_0.tmp 2> runex44_seg_periodic_0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex45 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 4,4 -dm_plex_reorder rcm -dm_view ::ascii_info_detail  > ex45_2.tmp 2> runex45_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex45_3.out ex45_3.tmp > diff-runex45_3.out 2> diff-runex45_3.out
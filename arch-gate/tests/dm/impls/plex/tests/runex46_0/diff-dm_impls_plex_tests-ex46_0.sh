@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex46_0.out ex46_0.tmp > diff-runex46_0.out 2> diff-runex46_0.out
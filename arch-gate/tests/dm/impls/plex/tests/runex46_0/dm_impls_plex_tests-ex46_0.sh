@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex46 -petsc_ci -num_refine 4 -petscspace_degree 3 -dm_plex_dim 1 -dm_plex_box_faces 5 -dm_plex_transform_type refine_1d -dm_plex_hash_location -dm_view  > ex46_0.tmp 2> runex46_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex47_0.out ex47_0.tmp > diff-runex47_0.out 2> diff-runex47_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex47 -petsc_ci -field -petscpartitioner_type simple -quadsmesh  > ex47_0.tmp 2> runex47_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex47_1.out ex47_1.tmp > diff-runex47_1.out 2> diff-runex47_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex47 -petsc_ci -field -petscpartitioner_type simple -box -dm_plex_simplex 0 -dm_plex_box_faces 2,5 -dm_distribute  > ex47_1.tmp 2> runex47_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex47_2.out ex47_2.tmp > diff-runex47_2.out 2> diff-runex47_2.out
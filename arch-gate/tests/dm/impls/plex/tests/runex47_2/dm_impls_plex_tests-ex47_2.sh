@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex47 -petsc_ci -field -petscpartitioner_type simple -prismsmesh  > ex47_2.tmp 2> runex47_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex47_3.out ex47_3.tmp > diff-runex47_3.out 2> diff-runex47_3.out
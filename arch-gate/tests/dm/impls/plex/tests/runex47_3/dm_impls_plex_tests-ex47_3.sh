@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex47 -petsc_ci -field -petscpartitioner_type simple -trisquadsmesh  > ex47_3.tmp 2> runex47_3.err
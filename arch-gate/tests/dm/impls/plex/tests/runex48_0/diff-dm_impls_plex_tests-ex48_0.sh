@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex48_0.out ex48_0.tmp > diff-runex48_0.out 2> diff-runex48_0.out
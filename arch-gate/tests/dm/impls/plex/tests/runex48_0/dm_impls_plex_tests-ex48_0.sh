@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex48 -petsc_ci -dm_plex_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/quads-q2.msh  > ex48_0.tmp 2> runex48_0.err
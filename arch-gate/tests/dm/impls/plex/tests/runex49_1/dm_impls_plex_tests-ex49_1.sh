@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex49 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_bd periodic,none -dm_plex_box_faces 3,3 -dm_sparse_localize 0 -petscspace_degree 1 -dm_view -offsets_view  > ex49_1.tmp 2> runex49_1.err
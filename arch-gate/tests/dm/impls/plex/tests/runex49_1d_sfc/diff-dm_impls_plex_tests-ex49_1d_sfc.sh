@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex49_1d_sfc.out ex49_1d_sfc.tmp > diff-runex49_1d_sfc.out 2> diff-runex49_1d_sfc.out
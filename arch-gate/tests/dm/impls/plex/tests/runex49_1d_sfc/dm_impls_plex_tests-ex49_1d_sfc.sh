@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex49 -petsc_ci -dm_plex_simplex 0 -dm_plex_dim 1 -dm_plex_shape zbox -dm_plex_box_faces 3 1 -dm_view -coord_ltog_view  > ex49_1d_sfc.tmp 2> runex49_1d_sfc.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex49 -petsc_ci -dm_plex_simplex 0 -dm_plex_dim 2 -dm_plex_shape zbox -dm_plex_box_faces 4,3 -dm_distribute 0 -petscspace_degree 1 -dm_view  > ex49_2d_sfc.tmp 2> runex49_2d_sfc.err
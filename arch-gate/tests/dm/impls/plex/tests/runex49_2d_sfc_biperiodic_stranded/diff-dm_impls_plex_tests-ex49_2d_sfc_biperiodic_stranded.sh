@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex49_2d_sfc_biperiodic_stranded.out ex49_2d_sfc_biperiodic_stranded.tmp > diff-runex49_2d_sfc_biperiodic_stranded.out 2> diff-runex49_2d_sfc_biperiodic_stranded.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex49_2d_sfc_biperiodic_stranded_dist.out ex49_2d_sfc_biperiodic_stranded_dist.tmp > diff-runex49_2d_sfc_biperiodic_stranded_dist.out 2> diff-runex49_2d_sfc_biperiodic_stranded_dist.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex49_2d_sfc_periodic.out ex49_2d_sfc_periodic.tmp > diff-runex49_2d_sfc_periodic.out 2> diff-runex49_2d_sfc_periodic.out
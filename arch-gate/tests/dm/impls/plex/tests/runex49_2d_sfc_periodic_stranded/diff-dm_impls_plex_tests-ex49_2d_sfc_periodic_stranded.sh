@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex49_2d_sfc_periodic_stranded.out ex49_2d_sfc_periodic_stranded.tmp > diff-runex49_2d_sfc_periodic_stranded.out 2> diff-runex49_2d_sfc_periodic_stranded.out
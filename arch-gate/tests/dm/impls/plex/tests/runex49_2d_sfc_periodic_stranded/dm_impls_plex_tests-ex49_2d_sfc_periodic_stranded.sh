@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex49 -petsc_ci -dm_plex_simplex 0 -dm_plex_dim 2 -dm_plex_shape zbox -dm_plex_box_faces 3,2 -petscspace_degree 1 -dm_view ::ascii_info_detail -closure_tensor -dm_distribute 0 -dm_plex_box_bd none,periodic  > ex49_2d_sfc_periodic_stranded.tmp 2> runex49_2d_sfc_periodic_stranded.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex49_cg_2d.out ex49_cg_2d.tmp > diff-runex49_cg_2d.out 2> diff-runex49_cg_2d.out
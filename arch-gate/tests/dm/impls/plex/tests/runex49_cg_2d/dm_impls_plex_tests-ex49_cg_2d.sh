@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex49 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_bd none,none -dm_plex_box_faces 3,3 -petscspace_degree 1 -dm_view -offsets_view  > ex49_cg_2d.tmp 2> runex49_cg_2d.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex4 -petsc_ci -dim 2 -cell_hybrid 0 -hyb_dm_plex_check_all -dm_plex_check_all -dm_refine 1  > ex4_1.tmp 2> runex4_1.err
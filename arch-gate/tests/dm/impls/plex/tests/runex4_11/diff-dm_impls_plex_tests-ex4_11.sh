@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex4_11.out ex4_11.tmp > diff-runex4_11.out 2> diff-runex4_11.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex4 -petsc_ci -dim 3 -cell_hybrid 0 -hyb_dm_plex_check_all -dm_plex_check_all -test_num 1 -dm_refine 1  > ex4_11.tmp 2> runex4_11.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex4_16.out ex4_16.tmp > diff-runex4_16.out 2> diff-runex4_16.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex4 -petsc_ci -dim 3 -hyb_dm_plex_check_all -in_dm_plex_check_all -dm_plex_check_all -dm_refine 1  > ex4_17.tmp 2> runex4_17.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex4_18.out ex4_18.tmp > diff-runex4_18.out 2> diff-runex4_18.out
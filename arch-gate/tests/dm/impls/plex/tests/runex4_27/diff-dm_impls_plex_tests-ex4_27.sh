@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex4_27.out ex4_27.tmp > diff-runex4_27.out 2> diff-runex4_27.out
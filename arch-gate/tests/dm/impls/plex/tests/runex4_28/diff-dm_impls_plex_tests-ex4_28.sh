@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex4_28.out ex4_28.tmp > diff-runex4_28.out 2> diff-runex4_28.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex4_29.out ex4_29.tmp > diff-runex4_29.out 2> diff-runex4_29.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex4 -petsc_ci -dim 1 -cell_hybrid 0 -hyb_dm_plex_check_all -dm_plex_check_all  > ex4_29.tmp 2> runex4_29.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex4_32.out ex4_32.tmp > diff-runex4_32.out 2> diff-runex4_32.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex4 -petsc_ci -dim 2 -hyb_dm_plex_check_all -in_dm_plex_check_all -dm_plex_check_all  > ex4_4.tmp 2> runex4_4.err
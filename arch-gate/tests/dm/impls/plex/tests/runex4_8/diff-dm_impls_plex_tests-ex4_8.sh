@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex4_8.out ex4_8.tmp > diff-runex4_8.out 2> diff-runex4_8.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex4 -petsc_ci -test_partition 0 -petscpartitioner_type simple -dm_view -hyb_dm_plex_check_all -in_dm_plex_check_all -dm_plex_check_all -dim 3 -dm_refine 1 -test_num 1  > ex4_hybint_3d_1.tmp 2> runex4_hybint_3d_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex50 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 2,2 -dm_view -point_numbering_view -petscpartitioner_type simple  > ex50_1.tmp 2> runex50_1.err
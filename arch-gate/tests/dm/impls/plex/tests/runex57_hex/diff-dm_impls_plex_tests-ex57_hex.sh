@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex57_hex.out ex57_hex.tmp > diff-runex57_hex.out 2> diff-runex57_hex.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex57 -petsc_ci -dm_plex_dim 3 -dm_plex_simplex 0  > ex57_hex.tmp 2> runex57_hex.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex57_quad.out ex57_quad.tmp > diff-runex57_quad.out 2> diff-runex57_quad.out
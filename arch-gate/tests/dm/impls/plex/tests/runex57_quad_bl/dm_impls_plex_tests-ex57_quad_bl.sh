@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex57 -petsc_ci -dm_plex_simplex 0 -dm_plex_dim 1 -dm_plex_box_faces 5 -dm_extrude 2 -cells 0,2,4,6,8 -first_dm_plex_transform_type refine_boundary_layer -first_dm_plex_transform_bl_splits 4 -ref_dm_view  > ex57_quad_bl.tmp 2> runex57_quad_bl.err
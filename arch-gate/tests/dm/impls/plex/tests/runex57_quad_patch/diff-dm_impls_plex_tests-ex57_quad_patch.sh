@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex57_quad_patch.out ex57_quad_patch.tmp > diff-runex57_quad_patch.out 2> diff-runex57_quad_patch.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex57 -petsc_ci -first_dm_plex_transform_type transform_filter -ref_dm_view -dm_plex_simplex 0 -dm_plex_box_faces 3,3 -cells 0,1,3,4  > ex57_quad_patch.tmp 2> runex57_quad_patch.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex57_sphere_extruded.out ex57_sphere_extruded.tmp > diff-runex57_sphere_extruded.out 2> diff-runex57_sphere_extruded.out
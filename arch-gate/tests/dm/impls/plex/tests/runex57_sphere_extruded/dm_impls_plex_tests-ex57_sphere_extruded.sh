@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex57 -petsc_ci -dm_plex_shape sphere -first_dm_plex_transform_type extrude -first_dm_plex_transform_extrude_layers 3 -first_dm_plex_transform_extrude_use_tensor 0  > ex57_sphere_extruded.tmp 2> runex57_sphere_extruded.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -orig_dm_plex_check_all -dm_plex_check_all -displacement_petscspace_degree 1 -faulttraction_petscspace_degree 1 -dim 3 -cell_simplex 0  > ex5_hex_0.tmp 2> runex5_hex_0.err
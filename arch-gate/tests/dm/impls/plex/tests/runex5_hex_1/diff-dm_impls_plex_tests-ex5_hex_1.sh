@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/_start//g" -e "s/f0_bd_u_neg//g" -e "s/f0_bd_u_pos//g" -e "s/f0_bd_l//g" -e "s/g0_bd_ul_neg//g" -e "s/g0_bd_ul_pos//g" -e "s/g0_bd_lu//g" -e "s~_ZL.*~~g"'  /root/repo/src/dm/impls/plex/tests/output/ex5_hex_1.out ex5_hex_1.tmp > diff-runex5_hex_1.out 2> diff-runex5_hex_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex5 -petsc_ci -orig_dm_plex_check_all -dm_plex_check_all -displacement_petscspace_degree 1 -faulttraction_petscspace_degree 1 -dim 2 -cell_simplex 0 -test_num 2  > ex5_quad_t2_0.tmp 2> runex5_quad_t2_0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -orig_dm_plex_check_all -dm_plex_check_all -displacement_petscspace_degree 1 -faulttraction_petscspace_degree 1 -local_section_view -local_solution_view -local_residual_view -local_jacobian_view -dim 3 -test_num 1  > ex5_tet_t1_0.tmp 2> runex5_tet_t1_0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -orig_dm_plex_check_all -dm_plex_check_all -displacement_petscspace_degree 1 -faulttraction_petscspace_degree 1 -local_section_view -local_solution_view -local_residual_view -local_jacobian_view -dim 2 -test_num 1 -dm_reorder_section -dm_reorder_section_type cohesive  > ex5_tri_t1_0_perm.tmp 2> runex5_tri_t1_0_perm.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex5 -petsc_ci -orig_dm_plex_check_all -dm_plex_check_all -displacement_petscspace_degree 1 -faulttraction_petscspace_degree 1 -dim 2 -test_num 4  > ex5_tri_t4_0.tmp 2> runex5_tri_t4_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex61_0.out ex61_0.tmp > diff-runex61_0.out 2> diff-runex61_0.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex65_ext_coord_space.out ex65_ext_coord_space.tmp > diff-runex65_ext_coord_space.out 2> diff-runex65_ext_coord_space.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex65 -petsc_ci -dm_plex_dim 1 -dm_plex_box_faces 1 -phase_1_dm_extrude 1 -phase_1_dm_plex_transform_extrude_use_tensor 0 -cdm_dm_petscds_view  > ex65_ext_coord_space.tmp 2> runex65_ext_coord_space.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex66_0.out ex66_0.tmp > diff-runex66_0.out 2> diff-runex66_0.out
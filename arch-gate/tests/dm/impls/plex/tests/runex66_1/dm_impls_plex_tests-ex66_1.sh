@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex66 -petsc_ci -interp_dm_plex_stratify_celltype -dm_view ::ascii_info_detail -interp_dm_view ::ascii_info_detail -test_num 1  > ex66_1.tmp 2> runex66_1.err
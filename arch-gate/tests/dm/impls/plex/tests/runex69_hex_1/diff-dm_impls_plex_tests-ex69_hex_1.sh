@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex69_hex_1.out ex69_hex_1.tmp > diff-runex69_hex_1.out 2> diff-runex69_hex_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex69 -petsc_ci -test_num 2 -dm_refine 1 -dm_plex_transform_type cohesive_extrude -dm_plex_transform_active fault -dm_view ::ascii_info_detail -coarse_dm_view ::ascii_info_detail -orientation_view -orientation_view_synchronized  > ex69_hex_2.tmp 2> runex69_hex_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex69 -petsc_ci -dm_plex_dim 3 -dm_plex_simplex 0 -dm_plex_box_faces 4,1,2 -dm_plex_box_upper 4.,1.,2. -dm_plex_cohesive_label_fault0 65,68 -dm_plex_cohesive_label_fault1 46 -f0_dm_refine 1 -f0_dm_plex_transform_type cohesive_extrude -f0_dm_plex_transform_active fault0 -f0_coarse_dm_view ::ascii_info_detail -f1_dm_refine 1 -f1_dm_plex_transform_type cohesive_extrude -f1_dm_plex_transform_active fault1 -f1_coarse_dm_view ::ascii_info_detail -dm_view ::ascii_info_detail  > ex69_hex_4.tmp 2> runex69_hex_4.err
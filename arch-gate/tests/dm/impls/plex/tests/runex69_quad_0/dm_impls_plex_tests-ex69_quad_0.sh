@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex69 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 2,1 -dm_refine 1 -dm_plex_transform_type cohesive_extrude -dm_plex_transform_active fault -dm_plex_cohesive_label_fault 13 -dm_view ::ascii_info_detail -coarse_dm_view ::ascii_info_detail  > ex69_quad_0.tmp 2> runex69_quad_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex69_quad_2.out ex69_quad_2.tmp > diff-runex69_quad_2.out 2> diff-runex69_quad_2.out
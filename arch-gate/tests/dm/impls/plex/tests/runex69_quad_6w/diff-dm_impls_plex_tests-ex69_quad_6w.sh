@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex69_quad_6w.out ex69_quad_6w.tmp > diff-runex69_quad_6w.out 2> diff-runex69_quad_6w.out
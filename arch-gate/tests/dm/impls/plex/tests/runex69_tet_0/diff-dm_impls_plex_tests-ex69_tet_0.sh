@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex69_tet_0.out ex69_tet_0.tmp > diff-runex69_tet_0.out 2> diff-runex69_tet_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex69 -petsc_ci -dm_plex_dim 3 -dm_plex_shape doublet -dm_refine 1 -dm_plex_transform_type cohesive_extrude -dm_plex_transform_active fault -dm_plex_cohesive_label_fault 7 -dm_view ::ascii_info_detail -coarse_dm_view ::ascii_info_detail -petscpartitioner_type simple  > ex69_tet_1.tmp 2> runex69_tet_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex6_0.out ex6_0.tmp > diff-runex6_0.out 2> diff-runex6_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -malloc_dump  > ex6_0.tmp 2> runex6_0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -malloc_dump -pend 10000  > ex6_1.tmp 2> runex6_1.err
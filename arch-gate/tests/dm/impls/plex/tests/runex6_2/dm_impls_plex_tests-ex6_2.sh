@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -malloc_dump -pend 10000 -fill 0.05  > ex6_2.tmp 2> runex6_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex6_3.out ex6_3.tmp > diff-runex6_3.out 2> diff-runex6_3.out
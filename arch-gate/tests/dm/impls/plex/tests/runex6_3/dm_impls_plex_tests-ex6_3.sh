@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -malloc_dump -pend 10000 -fill 0.25  > ex6_3.tmp 2> runex6_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex71_0.out ex71_0.tmp > diff-runex71_0.out 2> diff-runex71_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex71 -petsc_ci -dm_view ascii::ascii_info_detail -sanitize_submesh  > ex71_1.tmp 2> runex71_1.err
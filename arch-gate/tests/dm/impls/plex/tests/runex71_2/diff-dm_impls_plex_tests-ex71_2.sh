@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex71_2.out ex71_2.tmp > diff-runex71_2.out 2> diff-runex71_2.out
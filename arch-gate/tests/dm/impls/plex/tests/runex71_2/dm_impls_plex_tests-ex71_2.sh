@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex71 -petsc_ci -dm_view ascii::ascii_info_detail -ignore_label_halo  > ex71_2.tmp 2> runex71_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex72_cylinder_0.out ex72_cylinder_0.tmp > diff-runex72_cylinder_0.out 2> diff-runex72_cylinder_0.out
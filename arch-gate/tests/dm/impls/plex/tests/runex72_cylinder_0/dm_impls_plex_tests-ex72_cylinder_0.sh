@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex72 -petsc_ci -dm_plex_dim 3 -dm_plex_shape cylinder -dm_plex_cylinder_num_refine 1 -dm_refine 1 -dm_geom_model cylinder -exact_vol 3.141592653589 -vol_tol 1e-1  > ex72_cylinder_0.tmp 2> runex72_cylinder_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex73_q_2.out ex73_q_2.tmp > diff-runex73_q_2.out 2> diff-runex73_q_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex73 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 2,2 -field_petscspace_degree 4 -pot_petscspace_degree 4  -dm_plex_dim 2 > ex73_q_4.tmp 2> runex73_q_4.err
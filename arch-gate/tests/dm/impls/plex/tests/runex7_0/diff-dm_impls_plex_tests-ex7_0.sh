@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex7_0.out ex7_0.tmp > diff-runex7_0.out 2> diff-runex7_0.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex7_12.out ex7_12.tmp > diff-runex7_12.out 2> diff-runex7_12.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -dm_plex_check_all -use_generator -dm_plex_reference_cell_domain -dm_plex_cell pyramid -dm_plex_check_all  > ex7_12.tmp 2> runex7_12.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex7 -petsc_ci -dm_plex_interpolate_pre -dm_plex_check_all -petscpartitioner_type simple -dim 3 -simplex 0 -dm_view ascii::ascii_info_detail  > ex7_7.tmp 2> runex7_7.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -dm_plex_interpolate_pre -dm_plex_check_all -dim 2 -simplex 0 -testnum 1 -dm_view ascii::ascii_info_detail  > ex7_8.tmp 2> runex7_8.err
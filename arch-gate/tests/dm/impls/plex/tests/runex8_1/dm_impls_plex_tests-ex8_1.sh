@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex8 -petsc_ci -dm_view ascii::ascii_info_detail  > ex8_1.tmp 2> runex8_1.err
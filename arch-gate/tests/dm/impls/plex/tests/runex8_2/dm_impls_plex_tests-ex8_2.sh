@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex8 -petsc_ci -run_type hex_curved  > ex8_2.tmp 2> runex8_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex8 -petsc_ci -transform  > ex8_3.tmp 2> runex8_3.err
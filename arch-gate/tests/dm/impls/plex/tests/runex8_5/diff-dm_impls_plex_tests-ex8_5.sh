@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex8_5.out ex8_5.tmp > diff-runex8_5.out 2> diff-runex8_5.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex8_6.out ex8_6.tmp > diff-runex8_6.out 2> diff-runex8_6.out
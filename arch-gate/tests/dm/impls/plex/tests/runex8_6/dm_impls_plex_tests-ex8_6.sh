@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex8 -petsc_ci -run_type file -dm_plex_dim 1 -dm_plex_simplex 0 -dm_plex_box_faces 3 -dm_plex_box_lower -1.5 -dm_plex_box_upper 1.5 -dm_view ascii::ascii_info_detail -centroid -1.0,0.0,1.0 -vol 1.0,1.0,1.0  > ex8_6.tmp 2> runex8_6.err
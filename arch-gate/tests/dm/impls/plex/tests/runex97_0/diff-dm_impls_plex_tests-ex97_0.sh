@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex97_0.out ex97_0.tmp > diff-runex97_0.out 2> diff-runex97_0.out
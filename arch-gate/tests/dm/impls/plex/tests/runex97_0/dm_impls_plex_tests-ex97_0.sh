@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex97 -petsc_ci -i ${wPETSC_DIR}/share/petsc/datafiles/meshes/doublet-tet.msh -dm_view  > ex97_0.tmp 2> runex97_0.err
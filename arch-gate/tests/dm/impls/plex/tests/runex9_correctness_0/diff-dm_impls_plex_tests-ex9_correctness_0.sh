@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tests/output/ex9_correctness_0.out ex9_correctness_0.tmp > diff-runex9_correctness_0.out 2> diff-runex9_correctness_0.out
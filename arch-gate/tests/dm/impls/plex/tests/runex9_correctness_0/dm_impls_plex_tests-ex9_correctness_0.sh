@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex9 -petsc_ci -num_dof 1,0,0 -iterations 2 -print_times  > ex9_correctness_0.tmp 2> runex9_correctness_0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex9 -petsc_ci -num_dof 1,0,0 -iterations 2 -print_times -interpolate -dm_refine 2  > ex9_correctness_1.tmp 2> runex9_correctness_1.err
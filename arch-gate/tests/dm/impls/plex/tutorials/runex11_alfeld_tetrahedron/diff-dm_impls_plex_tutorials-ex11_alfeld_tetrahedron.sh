@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex11_alfeld_tetrahedron.out ex11_alfeld_tetrahedron.tmp > diff-runex11_alfeld_tetrahedron.out 2> diff-runex11_alfeld_tetrahedron.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex11_alfeld_triangle.out ex11_alfeld_triangle.tmp > diff-runex11_alfeld_triangle.out 2> diff-runex11_alfeld_triangle.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex11 -petsc_ci -dm_coord_space 0 -dm_plex_transform_type refine_alfeld -ref_arrangements -dm_plex_check_all -dm_plex_reference_cell_domain -dm_plex_cell triangle -ref_dm_view ::ascii_latex -dm_plex_view_numbers_depth 1,1,0 -dm_plex_view_colors_depth 1,1,0 -dm_plex_view_tikzscale 1.0  > ex11_alfeld_triangle.tmp 2> runex11_alfeld_triangle.err
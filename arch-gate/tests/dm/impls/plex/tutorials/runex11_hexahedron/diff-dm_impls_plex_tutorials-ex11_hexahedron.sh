@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex11_hexahedron.out ex11_hexahedron.tmp > diff-runex11_hexahedron.out 2> diff-runex11_hexahedron.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex11 -petsc_ci -dm_coord_space 0 -dm_plex_reference_cell_domain -gen_arrangements -gen_dm_view ::ascii_latex -dm_plex_view_tikzscale 0.5 -dm_plex_cell hexahedron -dm_plex_view_numbers_depth 1,0,0,0 -dm_plex_view_colors_depth 1,0,0,0 -dm_plex_view_tikzscale 0.3  > ex11_hexahedron.tmp 2> runex11_hexahedron.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex11_pyramid.out ex11_pyramid.tmp > diff-runex11_pyramid.out 2> diff-runex11_pyramid.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex11_quadrilateral.out ex11_quadrilateral.tmp > diff-runex11_quadrilateral.out 2> diff-runex11_quadrilateral.out
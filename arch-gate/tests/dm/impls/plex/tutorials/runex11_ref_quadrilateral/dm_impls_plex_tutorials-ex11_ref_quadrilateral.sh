@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex11 -petsc_ci -dm_coord_space 0 -dm_plex_reference_cell_domain -ref_arrangements -dm_plex_check_all -ref_dm_view ::ascii_latex -dm_plex_view_tikzscale 1.0 -dm_plex_cell quadrilateral -dm_plex_view_numbers_depth 1,1,0 -dm_plex_view_colors_depth 1,1,0  > ex11_ref_quadrilateral.tmp 2> runex11_ref_quadrilateral.err
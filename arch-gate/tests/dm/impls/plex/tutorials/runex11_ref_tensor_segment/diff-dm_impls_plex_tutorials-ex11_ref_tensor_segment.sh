@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex11_ref_tensor_segment.out ex11_ref_tensor_segment.tmp > diff-runex11_ref_tensor_segment.out 2> diff-runex11_ref_tensor_segment.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex11_ref_tensor_triangular_prism.out ex11_ref_tensor_triangular_prism.tmp > diff-runex11_ref_tensor_triangular_prism.out 2> diff-runex11_ref_tensor_triangular_prism.out
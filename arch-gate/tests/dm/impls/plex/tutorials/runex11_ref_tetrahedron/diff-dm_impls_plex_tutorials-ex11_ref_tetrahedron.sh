@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex11_ref_tetrahedron.out ex11_ref_tetrahedron.tmp > diff-runex11_ref_tetrahedron.out 2> diff-runex11_ref_tetrahedron.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex11_ref_triangle.out ex11_ref_triangle.tmp > diff-runex11_ref_triangle.out 2> diff-runex11_ref_triangle.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex11_sbr_triangle_1.out ex11_sbr_triangle_1.tmp > diff-runex11_sbr_triangle_1.out 2> diff-runex11_sbr_triangle_1.out
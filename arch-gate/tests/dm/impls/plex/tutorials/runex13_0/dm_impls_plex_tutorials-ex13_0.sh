@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex13 -petsc_ci -extent 1,2,3 -dm_view -refine 0  > ex13_0.tmp 2> runex13_0.err
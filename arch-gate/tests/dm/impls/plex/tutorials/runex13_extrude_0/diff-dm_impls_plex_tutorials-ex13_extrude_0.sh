@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex13_extrude_0.out ex13_extrude_0.tmp > diff-runex13_extrude_0.out 2> diff-runex13_extrude_0.out
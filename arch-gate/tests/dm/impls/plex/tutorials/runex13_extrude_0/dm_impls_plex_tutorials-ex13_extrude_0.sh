@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex13 -petsc_ci -extent 2,3,1 -dm_view -refine 0 -layers 3 -thickness .2  > ex13_extrude_0.tmp 2> runex13_extrude_0.err
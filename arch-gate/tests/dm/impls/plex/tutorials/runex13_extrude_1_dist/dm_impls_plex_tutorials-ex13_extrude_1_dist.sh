@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex13 -petsc_ci -extent 2,1,1 -dm_view -refine 1 -layers 3 -thickness .2  > ex13_extrude_1_dist.tmp 2> runex13_extrude_1_dist.err
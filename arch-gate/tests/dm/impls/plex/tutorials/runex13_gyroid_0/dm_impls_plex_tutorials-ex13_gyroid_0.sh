@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex13 -petsc_ci -extent 1,2,3 -dm_view -refine 0 -tps_type gyroid  > ex13_gyroid_0.tmp 2> runex13_gyroid_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex13_gyroid_1.out ex13_gyroid_1.tmp > diff-runex13_gyroid_1.out 2> diff-runex13_gyroid_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex13 -petsc_ci -extent 2,3,1 -dm_view -refine 1 -tps_type gyroid  > ex13_gyroid_1.tmp 2> runex13_gyroid_1.err
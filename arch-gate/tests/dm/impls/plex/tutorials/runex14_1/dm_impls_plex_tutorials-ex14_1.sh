@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex14 -petsc_ci -dm_plex_dim 1 -dm_plex_box_faces 3 -dm_refine_pre 1 -petscpartitioner_type simple -dm_distribute_overlap 1  > ex14_1.tmp 2> runex14_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex1_filter_0.out ex1_filter_0.tmp > diff-runex1_filter_0.out 2> diff-runex1_filter_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 3,3 -dm_plex_label_lower 0,1,2,3,4,6 -dm_refine 1 -dm_plex_transform_type transform_filter -dm_plex_transform_active lower -dm_view  > ex1_filter_0.tmp 2> runex1_filter_0.err
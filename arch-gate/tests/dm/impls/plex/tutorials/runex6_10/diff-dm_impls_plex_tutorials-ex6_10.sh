@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex6_10.out ex6_10.tmp > diff-runex6_10.out 2> diff-runex6_10.out
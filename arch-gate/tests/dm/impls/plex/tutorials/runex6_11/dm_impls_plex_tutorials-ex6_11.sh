@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -dm_plex_dim 3 -dm_plex_simplex 0 -dm_plex_box_faces 2,2,2 -num_fields 2 -num_components 1,2 -order 2,3  > ex6_11.tmp 2> runex6_11.err
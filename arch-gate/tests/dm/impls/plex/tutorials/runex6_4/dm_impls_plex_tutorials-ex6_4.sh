@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 2,2 -num_fields 2 -num_components 1,1 -order 2,2  > ex6_4.tmp 2> runex6_4.err
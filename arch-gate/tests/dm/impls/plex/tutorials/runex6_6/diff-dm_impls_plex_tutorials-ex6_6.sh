@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex6_6.out ex6_6.tmp > diff-runex6_6.out 2> diff-runex6_6.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex7 -petsc_ci -dm_plex_shape sphere -petscpartitioner_type simple -dm_view -dm_plex_simplex 0  > ex7_2d_quad_parallel.tmp 2> runex7_2d_quad_parallel.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -dm_plex_shape sphere -dm_view  > ex7_2d_tri.tmp 2> runex7_2d_tri.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex7_2d_tri_parallel.out ex7_2d_tri_parallel.tmp > diff-runex7_2d_tri_parallel.out 2> diff-runex7_2d_tri_parallel.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex7_3d_tri.out ex7_3d_tri.tmp > diff-runex7_3d_tri.out 2> diff-runex7_3d_tri.out
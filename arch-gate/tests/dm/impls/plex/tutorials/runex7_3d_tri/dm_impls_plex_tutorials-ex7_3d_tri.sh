@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -dm_plex_shape sphere -dm_view -dm_plex_dim 3  > ex7_3d_tri.tmp 2> runex7_3d_tri.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex7 -petsc_ci -dm_plex_shape sphere -petscpartitioner_type simple -dm_view -dm_plex_dim 3  > ex7_3d_tri_parallel.tmp 2> runex7_3d_tri_parallel.err
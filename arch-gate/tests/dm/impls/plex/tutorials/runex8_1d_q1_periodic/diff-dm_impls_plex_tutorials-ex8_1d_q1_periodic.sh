@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex8_1d_q1_periodic.out ex8_1d_q1_periodic.tmp > diff-runex8_1d_q1_periodic.out 2> diff-runex8_1d_q1_periodic.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex8_1d_q2.out ex8_1d_q2.tmp > diff-runex8_1d_q2.out 2> diff-runex8_1d_q2.out
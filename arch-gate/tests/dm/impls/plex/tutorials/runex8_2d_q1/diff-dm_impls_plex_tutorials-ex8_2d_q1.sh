@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex8_2d_q1.out ex8_2d_q1.tmp > diff-runex8_2d_q1.out 2> diff-runex8_2d_q1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex8 -petsc_ci -dm_plex_dim 2 -dm_plex_simplex 0 -dm_plex_box_faces 3,2 -dm_plex_box_bd periodic,none -petscspace_degree 1 -dm_view -view_coord -dm_sparse_localize false -dm_localize 0  > ex8_2d_q1_periodic_sparse.tmp 2> runex8_2d_q1_periodic_sparse.err
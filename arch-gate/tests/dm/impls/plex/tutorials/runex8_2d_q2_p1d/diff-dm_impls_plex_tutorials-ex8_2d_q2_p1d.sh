@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex8_2d_q2_p1d.out ex8_2d_q2_p1d.tmp > diff-runex8_2d_q2_p1d.out 2> diff-runex8_2d_q2_p1d.out
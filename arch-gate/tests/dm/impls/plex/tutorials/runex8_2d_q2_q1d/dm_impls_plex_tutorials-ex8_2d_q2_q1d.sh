@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex8 -petsc_ci -dm_plex_dim 2 -dm_plex_simplex 0 -dm_plex_box_faces 2,1 -num_fields 2 -f0_petscspace_degree 2 -f1_petscspace_degree 1 -f1_petscdualspace_lagrange_continuity 0  > ex8_2d_q2_q1d.tmp 2> runex8_2d_q2_q1d.err
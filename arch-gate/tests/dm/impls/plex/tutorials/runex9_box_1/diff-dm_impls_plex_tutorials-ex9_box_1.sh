@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/plex/tutorials/output/ex9_box_1.out ex9_box_1.tmp > diff-runex9_box_1.out 2> diff-runex9_box_1.out
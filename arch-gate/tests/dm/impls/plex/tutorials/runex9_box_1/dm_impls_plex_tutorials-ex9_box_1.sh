@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex9 -petsc_ci -dm_plex_orthogonal_quality_label_view -dm_plex_orthogonal_quality_vec_view -dm_plex_simplex 0 -dm_plex_box_faces 2,2 -orth_qual_atol 1.0  > ex9_box_1.tmp 2> runex9_box_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex10 -petsc_ci -stag_ranks_x 2 -stag_ranks_y 2 -stag_stencil_width 1 -stag_dof_2 2  > ex10_1.tmp 2> runex10_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex10_2.out ex10_2.tmp > diff-runex10_2.out 2> diff-runex10_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex10 -petsc_ci -stag_ranks_x 2 -stag_ranks_y 2 -stag_dof_1 2 -stag_grid_y 5  > ex10_2.tmp 2> runex10_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex10_3.out ex10_3.tmp > diff-runex10_3.out 2> diff-runex10_3.out
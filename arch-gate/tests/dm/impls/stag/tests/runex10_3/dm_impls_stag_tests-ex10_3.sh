@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex10 -petsc_ci -stag_ranks_x 3 -stag_ranks_y 2 -stag_dof_0 2 -stag_grid_x 6  > ex10_3.tmp 2> runex10_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex10 -petsc_ci -stag_ranks_x 3 -stag_ranks_y 2 -stag_dof_0 0 -stag_dof_1 0 -stag_dof_2 0 -stag_grid_x 4 -stag_boundary_type_x ghosted -stag_stencil_width 1  > ex10_5.tmp 2> runex10_5.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 9  ../ex10 -petsc_ci -stag_dof_0 2 -stag_dof_1 2 -stag_dof_2 1 -stag_dof_2 1 -stag_boundary_type_y ghosted -stag_grid_x 9 -stag_grid_y 13 -stag_ranks_x 3 -stag_ranks_y 3 -stag_stencil_width 1  > ex10_6.tmp 2> runex10_6.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex11_1.out ex11_1.tmp > diff-runex11_1.out 2> diff-runex11_1.out
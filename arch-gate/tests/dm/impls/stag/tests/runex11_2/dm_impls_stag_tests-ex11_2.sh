@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex11 -petsc_ci   > ex11_2.tmp 2> runex11_2.err
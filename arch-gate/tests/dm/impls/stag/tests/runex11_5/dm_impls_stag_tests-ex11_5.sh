@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex11 -petsc_ci -stag_dof_0 3 -stag_dof_1 2 -stag_dof_2 4 -stag_stencil_width 3 -stag_grid_x 6 -stag_grid_y 6  > ex11_5.tmp 2> runex11_5.err
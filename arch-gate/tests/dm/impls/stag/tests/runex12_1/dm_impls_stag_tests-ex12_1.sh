@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex12 -petsc_ci -stag_ranks_x 2 -stag_ranks_y 2 -stag_stencil_width 1  > ex12_1.tmp 2> runex12_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex12 -petsc_ci -stag_dof_0 3 -stag_dof_1 2 -stag_dof_2 4 2 -stag_stencil_width 3 -stag_grid_x 6 -stag_grid_y 6  > ex12_3.tmp 2> runex12_3.err
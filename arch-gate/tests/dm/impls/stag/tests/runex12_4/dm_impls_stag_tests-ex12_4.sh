@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex12 -petsc_ci -stag_stencil_width 1 -stag_grid_x 2 -stag_grid_y 2 -stag_boundary_type_x ghosted  > ex12_4.tmp 2> runex12_4.err
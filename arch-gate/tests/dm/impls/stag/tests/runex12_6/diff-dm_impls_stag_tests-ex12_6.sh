@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex12_6.out ex12_6.tmp > diff-runex12_6.out 2> diff-runex12_6.out
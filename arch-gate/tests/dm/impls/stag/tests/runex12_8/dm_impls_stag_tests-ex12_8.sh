@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex12 -petsc_ci -stag_stencil_width 1 -stag_grid_y 2 -stag_grid_x 19 -stag_boundary_type_y ghosted -stag_ranks_x 6  > ex12_8.tmp 2> runex12_8.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex13 -petsc_ci -dm_view -dim 1 -setsizes -stag_boundary_type_x ghosted -stag_stencil_width 0  > ex13_ghosted_1d_par_stag_stencil_width-0.tmp 2> runex13_ghosted_1d_par_stag_stencil_width-0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 12  ../ex13 -petsc_ci -dm_view -dim 3 -setsizes -stag_boundary_type_x ghosted -stag_boundary_type_y periodic -stag_boundary_type_z periodic -stag_stencil_width 1  > ex13_ghosted_periodic_periodic_3d_par_stag_stencil_width-1.tmp 2> runex13_ghosted_periodic_periodic_3d_par_stag_stencil_width-1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex13_none_1d_par_stag_stencil_width-2.out ex13_none_1d_par_stag_stencil_width-2.tmp > diff-runex13_none_1d_par_stag_stencil_width-2.out 2> diff-runex13_none_1d_par_stag_stencil_width-2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex13 -petsc_ci -dm_view -dim 1 -stag_grid_x 4 -stag_boundary_type_x ghosted -stag_stencil_width 0  > ex13_none_1d_seq_stag_stencil_width-0.tmp 2> runex13_none_1d_seq_stag_stencil_width-0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 12  ../ex13 -petsc_ci -dm_view -dim 3 -setsizes -stag_boundary_type_x none -stag_boundary_type_y none -stag_boundary_type_z none -stag_stencil_width 1  > ex13_none_none_none_3d_par_stag_stencil_width-1.tmp 2> runex13_none_none_none_3d_par_stag_stencil_width-1.err
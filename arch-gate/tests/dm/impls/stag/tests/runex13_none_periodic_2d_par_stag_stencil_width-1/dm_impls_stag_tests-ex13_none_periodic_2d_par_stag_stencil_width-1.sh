@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex13 -petsc_ci -dm_view -dim 2 -setsizes -stag_boundary_type_x none -stag_boundary_type_y periodic -stag_stencil_width 1  > ex13_none_periodic_2d_par_stag_stencil_width-1.tmp 2> runex13_none_periodic_2d_par_stag_stencil_width-1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex13_periodic_1d_seq_stag_stencil_width-1.out ex13_periodic_1d_seq_stag_stencil_width-1.tmp > diff-runex13_periodic_1d_seq_stag_stencil_width-1.out 2> diff-runex13_periodic_1d_seq_stag_stencil_width-1.out
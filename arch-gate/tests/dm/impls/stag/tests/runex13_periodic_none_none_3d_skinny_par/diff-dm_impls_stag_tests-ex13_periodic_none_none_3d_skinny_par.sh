@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex13_periodic_none_none_3d_skinny_par.out ex13_periodic_none_none_3d_skinny_par.tmp > diff-runex13_periodic_none_none_3d_skinny_par.out 2> diff-runex13_periodic_none_none_3d_skinny_par.out
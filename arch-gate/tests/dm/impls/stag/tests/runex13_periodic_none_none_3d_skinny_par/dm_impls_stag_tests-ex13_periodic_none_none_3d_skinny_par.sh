@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex13 -petsc_ci -dm_view -dim 3 -stag_boundary_type_x periodic -stag_boundary_type_y none -stag_boundary_type_z none -stag_grid_x 3 -stag_grid_y 6 -stag_grid_z 5 -stag_ranks_x 1 -stag_ranks_y 2 -stag_ranks_z 2 -stag_stencil_width 1 -useinjective 0  > ex13_periodic_none_none_3d_skinny_par.tmp 2> runex13_periodic_none_none_3d_skinny_par.err
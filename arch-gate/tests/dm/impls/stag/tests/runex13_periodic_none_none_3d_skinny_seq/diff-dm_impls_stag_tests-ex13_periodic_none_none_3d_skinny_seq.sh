@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex13_periodic_none_none_3d_skinny_seq.out ex13_periodic_none_none_3d_skinny_seq.tmp > diff-runex13_periodic_none_none_3d_skinny_seq.out 2> diff-runex13_periodic_none_none_3d_skinny_seq.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex13 -petsc_ci -dm_view -dim 2 -setsizes -stag_boundary_type_x periodic -stag_boundary_type_y periodic -stag_stencil_width 2  > ex13_periodic_periodic_2d_par_stag_stencil_width-2.tmp 2> runex13_periodic_periodic_2d_par_stag_stencil_width-2.err
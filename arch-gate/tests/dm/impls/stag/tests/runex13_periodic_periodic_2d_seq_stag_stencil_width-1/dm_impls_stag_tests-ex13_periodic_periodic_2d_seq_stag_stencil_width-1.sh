@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex13 -petsc_ci -dm_view -dim 2 -stag_grid_x 4 -stag_grid_y 5 -stag_boundary_type_x periodic -stag_boundary_type_y periodic -stag_stencil_width 1  > ex13_periodic_periodic_2d_seq_stag_stencil_width-1.tmp 2> runex13_periodic_periodic_2d_seq_stag_stencil_width-1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex14_1.out ex14_1.tmp > diff-runex14_1.out 2> diff-runex14_1.out
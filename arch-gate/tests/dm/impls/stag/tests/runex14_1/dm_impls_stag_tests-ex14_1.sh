@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex14 -petsc_ci -dim 1  > ex14_1.tmp 2> runex14_1.err
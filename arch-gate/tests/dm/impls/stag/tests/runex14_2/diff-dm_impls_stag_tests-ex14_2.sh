@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex14_2.out ex14_2.tmp > diff-runex14_2.out 2> diff-runex14_2.out
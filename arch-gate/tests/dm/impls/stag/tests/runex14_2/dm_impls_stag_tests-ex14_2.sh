@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex14 -petsc_ci -dim 2  > ex14_2.tmp 2> runex14_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex14 -petsc_ci -dim 3 -stag_grid_x 3 -stag_grid_y 2 -stag_grid_z 1  > ex14_3.tmp 2> runex14_3.err
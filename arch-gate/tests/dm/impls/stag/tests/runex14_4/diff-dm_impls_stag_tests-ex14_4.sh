@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex14_4.out ex14_4.tmp > diff-runex14_4.out 2> diff-runex14_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex14 -petsc_ci -dim 1 -setsizes  > ex14_4.tmp 2> runex14_4.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex14 -petsc_ci -dim 2 -setsizes  > ex14_5.tmp 2> runex14_5.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 12  ../ex14 -petsc_ci -dim 3 -setsizes  > ex14_6.tmp 2> runex14_6.err
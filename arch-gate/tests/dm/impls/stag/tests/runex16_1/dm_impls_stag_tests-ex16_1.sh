@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex16 -petsc_ci -dim 1 -stag_grid_x 2  > ex16_1.tmp 2> runex16_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex16 -petsc_ci -dim 2 -stag_grid_x 6 -stag_grid_y 4  > ex16_2.tmp 2> runex16_2.err
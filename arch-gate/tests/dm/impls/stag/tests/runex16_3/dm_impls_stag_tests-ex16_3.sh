@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex16 -petsc_ci -dim 3 -stag_grid_x 6 -stag_grid_y 4 -stag_grid_z 4  > ex16_3.tmp 2> runex16_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex16_4.out ex16_4.tmp > diff-runex16_4.out 2> diff-runex16_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex16 -petsc_ci -dim 1 -stag_grid_x 8  > ex16_4.tmp 2> runex16_4.err
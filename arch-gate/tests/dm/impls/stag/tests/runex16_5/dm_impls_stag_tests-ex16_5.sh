@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex16 -petsc_ci -dim 2 -stag_grid_x 4 -stag_grid_y 8  > ex16_5.tmp 2> runex16_5.err
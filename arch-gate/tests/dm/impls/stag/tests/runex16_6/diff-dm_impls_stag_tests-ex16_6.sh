@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex16_6.out ex16_6.tmp > diff-runex16_6.out 2> diff-runex16_6.out
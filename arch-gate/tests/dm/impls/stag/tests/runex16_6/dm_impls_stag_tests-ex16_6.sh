@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 12  ../ex16 -petsc_ci -dim 3 -stag_grid_x 4 -stag_grid_y 4 -stag_grid_z 12  > ex16_6.tmp 2> runex16_6.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex16 -petsc_ci -dim 1 -stag_grid_x 9 -stag_refine_x 3  > ex16_7.tmp 2> runex16_7.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex16_8.out ex16_8.tmp > diff-runex16_8.out 2> diff-runex16_8.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex16 -petsc_ci -dim 2 -stag_grid_x 9 -stag_grid_y 8 -stag_refine_x 3 -stag_refine_y 4  > ex16_8.tmp 2> runex16_8.err
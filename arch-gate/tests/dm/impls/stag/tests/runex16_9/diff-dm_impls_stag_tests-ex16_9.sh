@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex16_9.out ex16_9.tmp > diff-runex16_9.out 2> diff-runex16_9.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 12  ../ex16 -petsc_ci -dim 3 -stag_grid_x 6 -stag_grid_y 12 -stag_grid_z 24 -stag_refine_x 2 -stag_refine_y 3 -stag_refine_z 4  > ex16_9.tmp 2> runex16_9.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex17_1.out ex17_1.tmp > diff-runex17_1.out 2> diff-runex17_1.out
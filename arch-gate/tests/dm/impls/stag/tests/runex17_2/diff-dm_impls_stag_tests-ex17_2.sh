@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex17_2.out ex17_2.tmp > diff-runex17_2.out 2> diff-runex17_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex17 -petsc_ci -dim 2  > ex17_2.tmp 2> runex17_2.err
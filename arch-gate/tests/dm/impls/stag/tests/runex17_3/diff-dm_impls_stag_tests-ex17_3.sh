@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex17_3.out ex17_3.tmp > diff-runex17_3.out 2> diff-runex17_3.out
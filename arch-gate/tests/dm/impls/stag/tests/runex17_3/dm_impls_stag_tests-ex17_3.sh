@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex17 -petsc_ci -dim 2 -stag_dof_1 2  > ex17_3.tmp 2> runex17_3.err
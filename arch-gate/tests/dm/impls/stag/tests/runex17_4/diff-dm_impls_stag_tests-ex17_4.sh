@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex17_4.out ex17_4.tmp > diff-runex17_4.out 2> diff-runex17_4.out
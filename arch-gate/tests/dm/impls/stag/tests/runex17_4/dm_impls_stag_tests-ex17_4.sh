@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex17 -petsc_ci -dim 3 -stag_dof_0 3  > ex17_4.tmp 2> runex17_4.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex17 -petsc_ci -dim 3 -stag_dof_0 2  > ex17_5.tmp 2> runex17_5.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex17 -petsc_ci -dim 1  > ex17_6.tmp 2> runex17_6.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex17_7.out ex17_7.tmp > diff-runex17_7.out 2> diff-runex17_7.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex17 -petsc_ci -dim 1  > ex17_7.tmp 2> runex17_7.err
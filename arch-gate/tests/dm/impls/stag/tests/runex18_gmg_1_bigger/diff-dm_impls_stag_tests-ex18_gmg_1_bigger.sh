@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/ iterations 8/ iterations 7/g"'  /root/repo/src/dm/impls/stag/tests/output/ex18_gmg_1_bigger.out ex18_gmg_1_bigger.tmp > diff-runex18_gmg_1_bigger-0.out 2> diff-runex18_gmg_1_bigger-0.out || /root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/ iterations 8/ iterations 7/g"'  /root/repo/src/dm/impls/stag/tests/output/ex18_gmg_1_bigger_alt.out ex18_gmg_1_bigger.tmp > diff-runex18_gmg_1_bigger.out 2> diff-runex18_gmg_1_bigger.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex18_gmg_8.out ex18_gmg_8.tmp > diff-runex18_gmg_8.out 2> diff-runex18_gmg_8.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex18 -petsc_ci -ksp_type fgmres -mg_levels_pc_type jacobi -ksp_converged_reason  > ex18_gmg_8.tmp 2> runex18_gmg_8.err
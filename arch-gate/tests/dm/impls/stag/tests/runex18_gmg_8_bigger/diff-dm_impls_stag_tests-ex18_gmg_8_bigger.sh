@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex18_gmg_8_bigger.out ex18_gmg_8_bigger.tmp > diff-runex18_gmg_8_bigger.out 2> diff-runex18_gmg_8_bigger.out
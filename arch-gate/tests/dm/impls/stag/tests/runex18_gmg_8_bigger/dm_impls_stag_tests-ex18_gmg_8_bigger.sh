@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex18 -petsc_ci -ksp_type fgmres -mg_levels_pc_type jacobi -ksp_converged_reason -stag_grid_x 32 -stag_grid_y 32  > ex18_gmg_8_bigger.tmp 2> runex18_gmg_8_bigger.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex18 -petsc_ci -ksp_type fgmres -mg_levels_pc_type jacobi -ksp_converged_reason -extractSystem false -extractTransferOperators false  > ex18_gmg_8_d.tmp 2> runex18_gmg_8_d.err
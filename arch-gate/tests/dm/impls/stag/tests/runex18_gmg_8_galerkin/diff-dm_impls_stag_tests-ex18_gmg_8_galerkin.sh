@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex18_gmg_8_galerkin.out ex18_gmg_8_galerkin.tmp > diff-runex18_gmg_8_galerkin.out 2> diff-runex18_gmg_8_galerkin.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex19 -petsc_ci -stag_grid_x 8 -stag_grid_y 4  > ex19_2.tmp 2> runex19_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex1 -petsc_ci -dm_view -dim 1 -stag_grid_x 37 -stag_stencil_type none -stag_stencil_width 2  > ex1_basic_1.tmp 2> runex1_basic_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex1_basic_2.out ex1_basic_2.tmp > diff-runex1_basic_2.out 2> diff-runex1_basic_2.out
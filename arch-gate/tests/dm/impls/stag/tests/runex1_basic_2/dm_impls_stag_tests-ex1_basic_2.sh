@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 14  ../ex1 -petsc_ci -dm_view -dim 2 -stag_grid_x 11 -stag_grid_y 7 -stag_stencil_type star  > ex1_basic_2.tmp 2> runex1_basic_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 27  ../ex1 -petsc_ci -dm_view -dim 3 -stag_grid_x 4 -stag_grid_y 5 -stag_grid_z 6 -stag_stencil_type star -stag_ranks_x 3 -stag_ranks_y 3 -stag_ranks_z 3  > ex1_basic_3.tmp 2> runex1_basic_3.err
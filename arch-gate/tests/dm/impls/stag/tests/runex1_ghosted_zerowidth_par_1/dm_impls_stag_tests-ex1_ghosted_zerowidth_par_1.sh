@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex1 -petsc_ci -dm_view -dim 1 -setsizes -stag_boundary_type_x ghosted -stag_stencil_width 0  > ex1_ghosted_zerowidth_par_1.tmp 2> runex1_ghosted_zerowidth_par_1.err
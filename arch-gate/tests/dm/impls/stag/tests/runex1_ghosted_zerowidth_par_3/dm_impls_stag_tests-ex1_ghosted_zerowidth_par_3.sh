@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 12  ../ex1 -petsc_ci -dm_view -dim 3 -setsizes -stag_boundary_type_x ghosted -stag_boundary_type_y ghosted -stag_boundary_type_z ghosted -stag_stencil_width 0  > ex1_ghosted_zerowidth_par_3.tmp 2> runex1_ghosted_zerowidth_par_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_view -dim 1 -stag_grid_x 4 -stag_boundary_type_x ghosted -stag_stencil_width 0  > ex1_ghosted_zerowidth_seq_1.tmp 2> runex1_ghosted_zerowidth_seq_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex1_ghosted_zerowidth_seq_2.out ex1_ghosted_zerowidth_seq_2.tmp > diff-runex1_ghosted_zerowidth_seq_2.out 2> diff-runex1_ghosted_zerowidth_seq_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex1 -petsc_ci -dm_view -dim 1 -stag_dof_0 2 -stag_dof_1 7  > ex1_multidof_1.tmp 2> runex1_multidof_1.err
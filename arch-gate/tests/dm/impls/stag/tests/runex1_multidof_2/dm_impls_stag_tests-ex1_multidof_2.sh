@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 9  ../ex1 -petsc_ci -dm_view -dim 2 -stag_grid_x 3 -stag_grid_y 3 -stag_dof_0 3 -stag_dof_1 4 -stag_dof_2 5  > ex1_multidof_2.tmp 2> runex1_multidof_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex1_multidof_3.out ex1_multidof_3.tmp > diff-runex1_multidof_3.out 2> diff-runex1_multidof_3.out
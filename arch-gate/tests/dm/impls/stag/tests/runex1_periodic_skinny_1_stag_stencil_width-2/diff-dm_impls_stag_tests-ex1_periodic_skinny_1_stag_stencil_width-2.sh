@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex1_periodic_skinny_1_stag_stencil_width-2.out ex1_periodic_skinny_1_stag_stencil_width-2.tmp > diff-runex1_periodic_skinny_1_stag_stencil_width-2.out 2> diff-runex1_periodic_skinny_1_stag_stencil_width-2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex1 -petsc_ci -dm_view -dim 1 -setSizes  > ex1_sizes_1.tmp 2> runex1_sizes_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex1_stencil_none_1.out ex1_stencil_none_1.tmp > diff-runex1_stencil_none_1.out 2> diff-runex1_stencil_none_1.out
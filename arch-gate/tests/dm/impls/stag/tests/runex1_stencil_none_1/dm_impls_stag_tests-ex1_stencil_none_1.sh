@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex1 -petsc_ci -dm_view -dim 2 -stag_grid_x 4 -stag_grid_y 5 -stag_stencil_type none -stag_stencil_width 0  > ex1_stencil_none_1.tmp 2> runex1_stencil_none_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex1 -petsc_ci -dm_view -dim 3 -stag_grid_x 4 -stag_grid_y 5 -stag_grid_z 3 -stag_stencil_type none -stag_stencil_width 0  > ex1_stencil_none_2.tmp 2> runex1_stencil_none_2.err
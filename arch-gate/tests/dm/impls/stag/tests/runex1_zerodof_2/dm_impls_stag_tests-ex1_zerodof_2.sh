@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 9  ../ex1 -petsc_ci -dm_view -dim 2 -stag_grid_x 3 -stag_grid_y 3 -stag_dof_0 0 -stag_dof_1 0 -stag_dof_2 0  > ex1_zerodof_2.tmp 2> runex1_zerodof_2.err
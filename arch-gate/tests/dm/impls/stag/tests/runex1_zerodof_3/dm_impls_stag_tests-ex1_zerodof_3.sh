@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 27  ../ex1 -petsc_ci -dm_view -dim 3 -stag_grid_x 4 -stag_grid_y 5 -stag_grid_z 6 -stag_ranks_x 3 -stag_ranks_y 3 -stag_ranks_z 3 -stag_dof_0 0 -stag_dof_1 4 -stag_dof_2 0 -stag_dof_3 0  > ex1_zerodof_3.tmp 2> runex1_zerodof_3.err
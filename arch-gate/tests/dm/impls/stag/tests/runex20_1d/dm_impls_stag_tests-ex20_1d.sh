@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex20 -petsc_ci -dim 1  > ex20_1d.tmp 2> runex20_1d.err
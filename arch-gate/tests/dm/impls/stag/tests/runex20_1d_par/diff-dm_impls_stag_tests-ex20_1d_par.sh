@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex20_1d.out ex20_1d_par.tmp > diff-runex20_1d_par.out 2> diff-runex20_1d_par.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex20 -petsc_ci -dim 1 -stag_grid_x 6  > ex20_1d_par.tmp 2> runex20_1d_par.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex20 -petsc_ci -dim 2  > ex20_2d.tmp 2> runex20_2d.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex20 -petsc_ci -dim 2 -stag_grid_x 6 -stag_grid_y 7  > ex20_2d_par.tmp 2> runex20_2d_par.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex20 -petsc_ci -dim 2 -stag_refine_x 3 -stag_refine_y 4  > ex20_2d_ratio.tmp 2> runex20_2d_ratio.err
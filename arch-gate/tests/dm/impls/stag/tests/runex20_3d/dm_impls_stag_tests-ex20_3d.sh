@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex20 -petsc_ci -dim 3  > ex20_3d.tmp 2> runex20_3d.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex20 -petsc_ci -dim 3 -stag_grid_x 6 -stag_grid_y 7 -stag_grid_z 8  > ex20_3d_par.tmp 2> runex20_3d_par.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex20 -petsc_ci -dim 3 -stag_refine_x 3 -stag_refine_y 4 -stag_refine_z 5  > ex20_3d_ratio.tmp 2> runex20_3d_ratio.err
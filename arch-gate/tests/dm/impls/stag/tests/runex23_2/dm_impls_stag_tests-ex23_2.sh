@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex23 -petsc_ci   > ex23_2.tmp 2> runex23_2.err
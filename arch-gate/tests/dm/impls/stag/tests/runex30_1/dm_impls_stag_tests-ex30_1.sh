@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex30 -petsc_ci   > ex30_1.tmp 2> runex30_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex30 -petsc_ci   > ex30_2.tmp 2> runex30_2.err
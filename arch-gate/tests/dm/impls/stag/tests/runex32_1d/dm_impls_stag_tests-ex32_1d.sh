@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex32 -petsc_ci -dim 1  > ex32_1d.tmp 2> runex32_1d.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex32 -petsc_ci -dim 1  > ex32_1d_par.tmp 2> runex32_1d_par.err
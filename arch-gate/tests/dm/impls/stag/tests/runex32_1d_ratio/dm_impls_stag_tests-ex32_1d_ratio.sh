@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex32 -petsc_ci -dim 1 -stag_refine_x 3  > ex32_1d_ratio.tmp 2> runex32_1d_ratio.err
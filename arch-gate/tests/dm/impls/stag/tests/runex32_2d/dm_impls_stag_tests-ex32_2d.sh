@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex32 -petsc_ci -dim 2  > ex32_2d.tmp 2> runex32_2d.err
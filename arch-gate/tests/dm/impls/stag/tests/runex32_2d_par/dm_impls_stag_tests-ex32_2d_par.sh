@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex32 -petsc_ci -dim 2  > ex32_2d_par.tmp 2> runex32_2d_par.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex32 -petsc_ci -dim 2  > ex32_2d_par_2.tmp 2> runex32_2d_par_2.err
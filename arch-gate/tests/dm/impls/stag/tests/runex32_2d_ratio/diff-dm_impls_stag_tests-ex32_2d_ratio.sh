@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex32_1d.out ex32_2d_ratio.tmp > diff-runex32_2d_ratio.out 2> diff-runex32_2d_ratio.out
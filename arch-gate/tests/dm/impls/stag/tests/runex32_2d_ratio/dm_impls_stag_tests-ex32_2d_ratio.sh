@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex32 -petsc_ci -dim 2 -stag_refine_x 3 -stag_refine_y 4  > ex32_2d_ratio.tmp 2> runex32_2d_ratio.err
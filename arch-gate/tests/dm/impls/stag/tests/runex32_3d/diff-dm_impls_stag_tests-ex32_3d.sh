@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex32_1d.out ex32_3d.tmp > diff-runex32_3d.out 2> diff-runex32_3d.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex32 -petsc_ci -dim 3  > ex32_3d.tmp 2> runex32_3d.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex32 -petsc_ci -dim 3  > ex32_3d_par.tmp 2> runex32_3d_par.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex32 -petsc_ci -dim 3 -stag_refine_x 3 -stag_refine_y 4 -stag_refine_z 5  > ex32_3d_ratio.tmp 2> runex32_3d_ratio.err
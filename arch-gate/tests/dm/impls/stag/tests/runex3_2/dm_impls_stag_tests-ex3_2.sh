@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex3 -petsc_ci   > ex3_2.tmp 2> runex3_2.err
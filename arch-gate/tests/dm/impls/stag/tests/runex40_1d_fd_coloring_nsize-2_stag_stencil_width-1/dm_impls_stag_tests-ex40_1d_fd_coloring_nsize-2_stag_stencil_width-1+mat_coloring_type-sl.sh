@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex40 -petsc_ci -dim 1 -pc_type jacobi -snes_converged_reason -snes_fd_color -snes_fd_color_use_mat -snes_max_it 2 -stag_stencil_width 1  -mat_coloring_type sl > ex40_1d_fd_coloring_nsize-2_stag_stencil_width-1.tmp 2> runex40_1d_fd_coloring_nsize-2_stag_stencil_width-1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex40_1d_multidof.out ex40_1d_multidof.tmp > diff-runex40_1d_multidof.out 2> diff-runex40_1d_multidof.out
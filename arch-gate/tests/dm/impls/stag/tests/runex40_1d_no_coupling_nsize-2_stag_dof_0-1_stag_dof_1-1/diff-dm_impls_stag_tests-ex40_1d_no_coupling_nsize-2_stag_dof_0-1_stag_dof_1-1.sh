@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex40_1d_no_coupling_nsize-2_stag_dof_0-1_stag_dof_1-1.out ex40_1d_no_coupling_nsize-2_stag_dof_0-1_stag_dof_1-1.tmp > diff-runex40_1d_no_coupling_nsize-2_stag_dof_0-1_stag_dof_1-1.out 2> diff-runex40_1d_no_coupling_nsize-2_stag_dof_0-1_stag_dof_1-1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex40 -petsc_ci -dim 1 -no_coupling -stag_stencil_type none -pc_type jacobi -snes_converged_reason -snes_test_jacobian -snes_max_it 2 -stag_dof_0 2 -stag_dof_1 2  > ex40_1d_no_coupling_nsize-2_stag_dof_0-2_stag_dof_1-2.tmp 2> runex40_1d_no_coupling_nsize-2_stag_dof_0-2_stag_dof_1-2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex40_1d_periodic_nsize-1_stag_stencil_width-2.out ex40_1d_periodic_nsize-1_stag_stencil_width-2.tmp > diff-runex40_1d_periodic_nsize-1_stag_stencil_width-2.out 2> diff-runex40_1d_periodic_nsize-1_stag_stencil_width-2.out
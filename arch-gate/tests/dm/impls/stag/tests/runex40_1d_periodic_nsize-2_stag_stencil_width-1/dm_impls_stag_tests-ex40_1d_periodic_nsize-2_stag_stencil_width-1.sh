@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex40 -petsc_ci -dim 1 -stag_boundary_type_x periodic -pc_type jacobi -snes_converged_reason -snes_test_jacobian -snes_max_it 2 -stag_stencil_width 1  > ex40_1d_periodic_nsize-2_stag_stencil_width-1.tmp 2> runex40_1d_periodic_nsize-2_stag_stencil_width-1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex40_1d_test_jac_nsize-2_stag_stencil_width-0.out ex40_1d_test_jac_nsize-2_stag_stencil_width-0.tmp > diff-runex40_1d_test_jac_nsize-2_stag_stencil_width-0.out 2> diff-runex40_1d_test_jac_nsize-2_stag_stencil_width-0.out
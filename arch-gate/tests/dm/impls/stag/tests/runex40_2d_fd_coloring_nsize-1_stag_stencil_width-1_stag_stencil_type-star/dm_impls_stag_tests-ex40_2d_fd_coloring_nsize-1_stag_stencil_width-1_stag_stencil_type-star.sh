@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex40 -petsc_ci -dim 2 -pc_type jacobi -snes_converged_reason -snes_fd_color -snes_fd_color_use_mat -snes_max_it 2 -stag_stencil_width 1 -stag_stencil_type star  > ex40_2d_fd_coloring_nsize-1_stag_stencil_width-1_stag_stencil_type-star.tmp 2> runex40_2d_fd_coloring_nsize-1_stag_stencil_width-1_stag_stencil_type-star.err
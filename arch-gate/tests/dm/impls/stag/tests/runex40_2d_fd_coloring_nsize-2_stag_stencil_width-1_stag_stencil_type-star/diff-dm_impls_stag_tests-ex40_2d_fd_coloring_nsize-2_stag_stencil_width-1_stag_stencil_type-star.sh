@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex40_2d_fd_coloring_nsize-2_stag_stencil_width-1_stag_stencil_type-star.out ex40_2d_fd_coloring_nsize-2_stag_stencil_width-1_stag_stencil_type-star.tmp > diff-runex40_2d_fd_coloring_nsize-2_stag_stencil_width-1_stag_stencil_type-star.out 2> diff-runex40_2d_fd_coloring_nsize-2_stag_stencil_width-1_stag_stencil_type-star.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex40 -petsc_ci -dim 2 -no_coupling -stag_stencil_type none -pc_type jacobi -snes_test_jacobian -snes_max_it 2 -stag_dof_0 1 -stag_dof_1 1 -stag_dof_2 2  > ex40_2d_no_coupling_nsize-1_stag_dof_0-1_stag_dof_1-1_stag_dof_2-2.tmp 2> runex40_2d_no_coupling_nsize-1_stag_dof_0-1_stag_dof_1-1_stag_dof_2-2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex40_2d_no_coupling_nsize-4_stag_dof_0-1_stag_dof_1-1_stag_dof_2-2.out ex40_2d_no_coupling_nsize-4_stag_dof_0-1_stag_dof_1-1_stag_dof_2-2.tmp > diff-runex40_2d_no_coupling_nsize-4_stag_dof_0-1_stag_dof_1-1_stag_dof_2-2.out 2> diff-runex40_2d_no_coupling_nsize-4_stag_dof_0-1_stag_dof_1-1_stag_dof_2-2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex40_3d_fd_coloring_nsize-1_stag_stencil_width-1_stag_stencil_type-star.out ex40_3d_fd_coloring_nsize-1_stag_stencil_width-1_stag_stencil_type-star.tmp > diff-runex40_3d_fd_coloring_nsize-1_stag_stencil_width-1_stag_stencil_type-star.out 2> diff-runex40_3d_fd_coloring_nsize-1_stag_stencil_width-1_stag_stencil_type-star.out
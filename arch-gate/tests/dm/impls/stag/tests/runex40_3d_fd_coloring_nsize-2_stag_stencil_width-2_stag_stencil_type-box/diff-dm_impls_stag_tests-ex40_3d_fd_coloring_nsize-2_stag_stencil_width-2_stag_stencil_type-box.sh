@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex40_3d_fd_coloring_nsize-2_stag_stencil_width-2_stag_stencil_type-box.out ex40_3d_fd_coloring_nsize-2_stag_stencil_width-2_stag_stencil_type-box.tmp > diff-runex40_3d_fd_coloring_nsize-2_stag_stencil_width-2_stag_stencil_type-box.out 2> diff-runex40_3d_fd_coloring_nsize-2_stag_stencil_width-2_stag_stencil_type-box.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex40_3d_no_coupling.out ex40_3d_no_coupling.tmp > diff-runex40_3d_no_coupling.out 2> diff-runex40_3d_no_coupling.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex42_dim-1.out ex42_dim-1.tmp > diff-runex42_dim-1.out 2> diff-runex42_dim-1.out
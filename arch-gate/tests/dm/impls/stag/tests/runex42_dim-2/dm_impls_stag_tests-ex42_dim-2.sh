@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex42 -petsc_ci -dim 2  > ex42_dim-2.tmp 2> runex42_dim-2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex4 -petsc_ci -dim 1  > ex4_1d_2.tmp 2> runex4_1d_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex4 -petsc_ci -dim 2  > ex4_2d_2.tmp 2> runex4_2d_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex4 -petsc_ci -dim 3  > ex4_3d_1.tmp 2> runex4_3d_1.err
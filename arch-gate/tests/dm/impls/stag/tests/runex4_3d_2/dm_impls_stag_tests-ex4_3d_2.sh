@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex4 -petsc_ci -dim 3  > ex4_3d_2.tmp 2> runex4_3d_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex50 -petsc_ci -dim 1 -coords true  > ex50_dim-1_coords-true.tmp 2> runex50_dim-1_coords-true.err
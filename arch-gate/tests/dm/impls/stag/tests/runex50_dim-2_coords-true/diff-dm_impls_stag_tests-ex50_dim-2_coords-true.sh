@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex50_dim-2_coords-true.out ex50_dim-2_coords-true.tmp > diff-runex50_dim-2_coords-true.out 2> diff-runex50_dim-2_coords-true.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex50 -petsc_ci -dim 2 -coords true  > ex50_dim-2_coords-true.tmp 2> runex50_dim-2_coords-true.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex50 -petsc_ci -dim 3 -coords false  > ex50_dim-3_coords-false.tmp 2> runex50_dim-3_coords-false.err
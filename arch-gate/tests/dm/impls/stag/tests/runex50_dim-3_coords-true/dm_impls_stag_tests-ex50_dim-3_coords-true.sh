@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex50 -petsc_ci -dim 3 -coords true  > ex50_dim-3_coords-true.tmp 2> runex50_dim-3_coords-true.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex51 -petsc_ci   > ex51_1.tmp 2> runex51_1.err
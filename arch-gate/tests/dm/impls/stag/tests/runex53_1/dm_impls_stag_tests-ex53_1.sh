@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex53 -petsc_ci -dim 1  > ex53_1.tmp 2> runex53_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex53 -petsc_ci -dim 1 -stag_boundary_type_x none  > ex53_2.tmp 2> runex53_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex53_1.out ex53_3.tmp > diff-runex53_3.out 2> diff-runex53_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex53 -petsc_ci -dim 1 -stag_boundary_type_x periodic  > ex53_3.tmp 2> runex53_3.err
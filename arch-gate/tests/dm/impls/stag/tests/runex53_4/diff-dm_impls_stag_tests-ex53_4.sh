@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex53_1.out ex53_4.tmp > diff-runex53_4.out 2> diff-runex53_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex53 -petsc_ci -dim 2  > ex53_4.tmp 2> runex53_4.err
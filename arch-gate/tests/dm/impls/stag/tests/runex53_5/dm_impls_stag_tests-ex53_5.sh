@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex53 -petsc_ci -dim 2 -stag_boundary_type_x none -stag_stencil_type star  > ex53_5.tmp 2> runex53_5.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex53 -petsc_ci -dim 2 -stag_boundary_type_y periodic -stag_stencil_width 2 -stag_dof_0 0 -stag_dof_1 1 -stag_dof_2 0  > ex53_6.tmp 2> runex53_6.err
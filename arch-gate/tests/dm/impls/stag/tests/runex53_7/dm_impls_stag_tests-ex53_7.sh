@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex53 -petsc_ci -dim 3  > ex53_7.tmp 2> runex53_7.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex53 -petsc_ci -dim 3 -stag_boundary_type_x none -stag_boundary_type_y periodic  > ex53_8.tmp 2> runex53_8.err
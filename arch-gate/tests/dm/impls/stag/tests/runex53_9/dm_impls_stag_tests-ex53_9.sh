@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 12  ../ex53 -petsc_ci -dim 3 -stag_boundary_type_x none -stag_boundary_type_y none -stag_boundary_type_z none -stag_stencil_type star -stag_dof_0 0 -stag_dof_1 0 -stag_dof_2 0 -stag_dof_3 1  > ex53_9.tmp 2> runex53_9.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex5 -petsc_ci   > ex5_2.tmp 2> runex5_2.err
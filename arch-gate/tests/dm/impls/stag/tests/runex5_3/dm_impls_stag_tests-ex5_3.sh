@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex5 -petsc_ci -stag_grid_x 19  > ex5_3.tmp 2> runex5_3.err
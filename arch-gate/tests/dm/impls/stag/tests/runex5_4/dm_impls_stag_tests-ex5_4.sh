@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex5 -petsc_ci -stag_grid_x 21 -stag_stencil_width 2  > ex5_4.tmp 2> runex5_4.err
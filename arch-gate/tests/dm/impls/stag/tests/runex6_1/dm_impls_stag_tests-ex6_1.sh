@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 12  ../ex6 -petsc_ci -stag_ranks_x 2 -stag_ranks_y 3 -stag_ranks_z 2  > ex6_1.tmp 2> runex6_1.err
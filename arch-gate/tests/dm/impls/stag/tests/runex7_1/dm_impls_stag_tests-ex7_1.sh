@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex7 -petsc_ci -stag_ranks_x 2 -stag_ranks_y 2 -stag_ranks_z 2 -stag_stencil_width 1 -stag_dof_3 2 -stag_grid_z 3  > ex7_1.tmp 2> runex7_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex7 -petsc_ci -stag_ranks_x 2 -stag_ranks_y 2 -stag_ranks_z 2 -stag_dof_2 2 -stag_grid_y 5  > ex7_2.tmp 2> runex7_2.err
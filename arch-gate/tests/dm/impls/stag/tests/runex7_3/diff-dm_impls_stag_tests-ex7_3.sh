@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex7_3.out ex7_3.tmp > diff-runex7_3.out 2> diff-runex7_3.out
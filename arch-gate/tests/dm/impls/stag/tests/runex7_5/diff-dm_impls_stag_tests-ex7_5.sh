@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex7_5.out ex7_5.tmp > diff-runex7_5.out 2> diff-runex7_5.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex7 -petsc_ci -stag_dof_0 3 -stag_dof_1 2 -stag_dof_2 4 -stag_dof_3 2 -stag_boundary_type_y ghosted -stag_boundary_type_z ghosted -stag_stencil_width 1  > ex7_6.tmp 2> runex7_6.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex8_4.out ex8_4.tmp > diff-runex8_4.out 2> diff-runex8_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex9 -petsc_ci -stag_ranks_x 2 -stag_ranks_y 2 -stag_ranks_z 2 -stag_stencil_width 1  > ex9_1.tmp 2> runex9_1.err
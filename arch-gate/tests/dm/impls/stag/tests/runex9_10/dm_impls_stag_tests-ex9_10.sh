@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex9 -petsc_ci -stag_stencil_width 1 -stag_grid_y 2 -stag_grid_z 3 -stag_grid_x 17 -stag_boundary_type_y ghosted -stag_boundary_type_z ghosted -stag_ranks_x 5  > ex9_10.tmp 2> runex9_10.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 12  ../ex9 -petsc_ci -stag_ranks_x 3 -stag_ranks_y 2 -stag_ranks_z 2 -stag_dof_0 2 -stag_grid_x 6  > ex9_2.tmp 2> runex9_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex9 -petsc_ci -stag_stencil_width 1 -stag_grid_x 2 -stag_grid_y 2 -stag_grid_z 2 -stag_boundary_type_y ghosted  > ex9_5.tmp 2> runex9_5.err
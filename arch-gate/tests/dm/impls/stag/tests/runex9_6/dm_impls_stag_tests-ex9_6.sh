@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex9 -petsc_ci -stag_stencil_width 1 -stag_grid_x 2 -stag_grid_y 2 -stag_grid_z 2 -stag_boundary_type_z ghosted -stag_dof_0 2 -stag_dof_1 3 -stag_dof_2 2 -stag_dof_3 2  > ex9_6.tmp 2> runex9_6.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex9_8.out ex9_8.tmp > diff-runex9_8.out 2> diff-runex9_8.out
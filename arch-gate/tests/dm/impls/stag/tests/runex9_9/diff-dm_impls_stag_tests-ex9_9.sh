@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tests/output/ex9_9.out ex9_9.tmp > diff-runex9_9.out 2> diff-runex9_9.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 7  ../ex1 -petsc_ci -dm_view -stag_grid_x 11 -stag_stencil_type star -a 1.33 -b 7.22 -c 347.2 -ksp_monitor_short  > ex1_1.tmp 2> runex1_1.err
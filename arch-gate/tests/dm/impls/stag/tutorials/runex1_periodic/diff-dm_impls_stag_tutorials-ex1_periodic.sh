@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tutorials/output/ex1_periodic.out ex1_periodic.tmp > diff-runex1_periodic.out 2> diff-runex1_periodic.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -dm_view -stag_grid_x 13 -stag_boundary_type_x periodic -a 1.1234  > ex1_periodic_seq.tmp 2> runex1_periodic_seq.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tutorials/output/ex4_isovisc_nondim_abf_mg_2.out ex4_isovisc_nondim_abf_mg_2.tmp > diff-runex4_isovisc_nondim_abf_mg_2.out 2> diff-runex4_isovisc_nondim_abf_mg_2.out
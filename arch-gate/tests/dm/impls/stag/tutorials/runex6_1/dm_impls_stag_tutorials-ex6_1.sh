@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -stag_grid_x 12 -stag_grid_y 7 -nsteps 4 -dump_output 0  > ex6_1.tmp 2> runex6_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tutorials/output/ex6_2.out ex6_2.tmp > diff-runex6_2.out 2> diff-runex6_2.out
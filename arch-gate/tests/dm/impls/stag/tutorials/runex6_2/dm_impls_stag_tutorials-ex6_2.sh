@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 9  ../ex6 -petsc_ci -stag_grid_x 12 -stag_grid_y 15 -nsteps 3 -dump_output 0  > ex6_2.tmp 2> runex6_2.err
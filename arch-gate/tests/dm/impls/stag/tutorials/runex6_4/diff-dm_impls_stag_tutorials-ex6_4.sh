@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tutorials/output/ex6_4.out ex6_4.tmp > diff-runex6_4.out 2> diff-runex6_4.out
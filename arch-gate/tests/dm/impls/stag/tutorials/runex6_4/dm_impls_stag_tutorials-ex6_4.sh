@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 12  ../ex6 -petsc_ci -stag_grid_x 12 -stag_grid_y 15 -stag_grid_z 8 -nsteps 3 -dim 3 -dump_output 0  > ex6_4.tmp 2> runex6_4.err
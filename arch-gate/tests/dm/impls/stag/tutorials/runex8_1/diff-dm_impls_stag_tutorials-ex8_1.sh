@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/stag/tutorials/output/ex8_1.out ex8_1.tmp > diff-runex8_1.out 2> diff-runex8_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex12 -petsc_ci -dim 2 -da_grid_x 8 -da_grid_y 8 -np 4 -pic_sw_view  -da_bd_all periodic > ex12_2d_p1.tmp 2> runex12_2d_p1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex12 -petsc_ci -dim 3 -da_grid_x 8 -da_grid_y 8 -da_grid_z 8 -np 4 -pic_sw_view  -da_bd_all none > ex12_3d_p1.tmp 2> runex12_3d_p1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex12 -petsc_ci -dim 3 -da_grid_x 8 -da_grid_y 8 -da_grid_z 8 -np 4 -pic_sw_view  -da_bd_all periodic > ex12_3d_p2.tmp 2> runex12_3d_p2.err
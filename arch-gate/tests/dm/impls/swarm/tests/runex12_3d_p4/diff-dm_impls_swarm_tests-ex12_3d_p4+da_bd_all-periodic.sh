@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/swarm/tests/output/ex12_3d_p4.out ex12_3d_p4.tmp > diff-runex12_3d_p4.out 2> diff-runex12_3d_p4.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v marker | grep -v atomic | grep -v usage'  /root/repo/src/dm/impls/swarm/tests/output/ex1_swarm_migrate_hash_tensor_permutation.out ex1_swarm_migrate_hash_tensor_permutation.tmp > diff-runex1_swarm_migrate_hash_tensor_permutation.out 2> diff-runex1_swarm_migrate_hash_tensor_permutation.out
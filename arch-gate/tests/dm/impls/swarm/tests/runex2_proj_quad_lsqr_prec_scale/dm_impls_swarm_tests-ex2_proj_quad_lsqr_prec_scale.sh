@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 4,4 -petscspace_degree 2 -petscfe_default_quadrature_order 3 -particlesPerCell 200 -ptof_pc_type lu -ftop_ksp_rtol 1e-17 -ftop_ksp_type lsqr -ftop_pc_type bjacobi -ftop_sub_pc_type lu -ftop_sub_pc_factor_shift_type nonzero  > ex2_proj_quad_lsqr_prec_scale.tmp 2> runex2_proj_quad_lsqr_prec_scale.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/swarm/tests/output/ex2_proj_quad_lsqr_scale.out ex2_proj_quad_lsqr_scale.tmp > diff-runex2_proj_quad_lsqr_scale.out 2> diff-runex2_proj_quad_lsqr_scale.out
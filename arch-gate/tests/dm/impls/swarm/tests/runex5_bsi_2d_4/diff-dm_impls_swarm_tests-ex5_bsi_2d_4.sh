@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/swarm/tests/output/ex5_bsi_2d_4.out ex5_bsi_2d_4.tmp > diff-runex5_bsi_2d_4.out 2> diff-runex5_bsi_2d_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -dm_plex_dim 2 -dm_plex_simplex 0 -dm_plex_box_faces 10,10 -dm_plex_box_lower -5,-5 -dm_plex_box_upper 5,5 -dm_swarm_num_particles 10 -dm_swarm_coordinate_function circleMultipleX -dm_swarm_velocity_function circleMultipleV -ts_convergence_estimate -convest_num_refine 2 -dm_view -output_step 50 -error -ts_type basicsymplectic -ts_basicsymplectic_type 1  > ex5_bsi_2d_multiple_1.tmp 2> runex5_bsi_2d_multiple_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/swarm/tests/output/ex5_im_2d_0.out ex5_im_2d_0.tmp > diff-runex5_im_2d_0.out 2> diff-runex5_im_2d_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex6 -petsc_ci -dm_plex_dim 2 -dm_plex_simplex 0 -dm_plex_box_faces 10,10 -dm_plex_box_lower -5,-5 -dm_plex_box_upper 5,5 -petscpartitioner_type simple -dm_swarm_num_particles 2 -dm_swarm_coordinate_function circleSingleX -dm_swarm_velocity_function circleSingleV -dm_swarm_num_species 1 -ts_type basicsymplectic -ts_convergence_estimate -convest_num_refine 2 -em_snes_type ksponly -em_pc_type svd -em_type primal -petscspace_degree 1 -dm_view -output_step 50 -pc_type svd -sigma 1.0e-8 -timeScale 2.0e-14 -ts_dt 0.01 -ts_max_time 1.0 -ts_max_steps 10 -ts_basicsymplectic_type 4  > ex6_bsi_2d_mesh_1_par_2.tmp 2> runex6_bsi_2d_mesh_1_par_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/swarm/tests/output/ex6_bsi_2d_multiple_1.out ex6_bsi_2d_multiple_1.tmp > diff-runex6_bsi_2d_multiple_1.out 2> diff-runex6_bsi_2d_multiple_1.out
@@ -0,0 +1,62 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+executable='../ex6'
+testname='runex6_bsi_4_rt_1'
+label='dm_impls_swarm_tests-ex6_bsi_4_rt_1'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter=''
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+# -petsc_ci must be a command line argument because if it is from the environment it will be listed by PetscOptionsMonitor()
+args='-petsc_ci -dm_plex_dim 2 -dm_plex_simplex 0 -dm_plex_box_faces 2,2 -dm_plex_box_lower -5,-5 -dm_plex_box_upper 5,5 -dm_swarm_num_particles 2 -dm_swarm_coordinate_function circleSingleX -dm_swarm_velocity_function circleSingleV -em_pc_type fieldsplit -ksp_rtol 1e-10 -em_ksp_type preonly -em_type mixed -em_ksp_error_if_not_converged -dm_view -output_step 50 -error -dm_refine 0 -pc_type svd -sigma 1.0e-8 -timeScale 2.0e-14 -ts_dt 0.01 -ts_max_time 10.0 -ts_max_steps 10 -ts_type basicsymplectic -ts_basicsymplectic_type 4 -pc_fieldsplit_detect_saddle_point -pc_type fieldsplit -pc_fieldsplit_type schur -pc_fieldsplit_schur_precondition full -field_petscspace_degree 2 -field_petscfe_default_quadrature_order 1 -field_petscspace_type sum -field_petscspace_variables 2 -field_petscspace_components 2 -field_petscspace_sum_spaces 2 -field_petscspace_sum_concatenate true -field_sumcomp_0_petscspace_variables 2 -field_sumcomp_0_petscspace_type tensor -field_sumcomp_0_petscspace_tensor_spaces 2 -field_sumcomp_0_petscspace_tensor_uniform false -field_sumcomp_0_tensorcomp_0_petscspace_degree 1 -field_sumcomp_0_tensorcomp_1_petscspace_degree 0 -field_sumcomp_1_petscspace_variables 2 -field_sumcomp_1_petscspace_type tensor -field_sumcomp_1_petscspace_tensor_spaces 2 -field_sumcomp_1_petscspace_tensor_uniform false -field_sumcomp_1_tensorcomp_0_petscspace_degree 0 -field_sumcomp_1_tensorcomp_1_petscspace_degree 1 -field_petscdualspace_form_degree -1 -field_petscdualspace_order 1 -field_petscdualspace_lagrange_trimmed true -ksp_gmres_restart 500'
+diff_args=''
+timeoutfactor=1
+export PETSC_OPTIONS="${PETSC_OPTIONS} -check_pointer_intensity 0 -error_output_stdout -malloc_dump -checkfunctionlist -use_gpu_aware_mpi 0 -nox_warning"
+
+mpiexec=${PETSCMPIEXEC:-"/usr/bin/mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+mpiexec_tail=''
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags} ${diff_args}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-1}
+
+
+for insize in ${nsize_in}; do
+
+   petsc_testrun "${mpiexec} -n ${insize} ${mpiexec_tail} ${executable} ${args} " ex6_bsi_4_rt_1.tmp ${testname}.err "${label}" 
+   res=$?
+
+   if test $res = 0; then
+      petsc_testrun "${diff_exe} /root/repo/src/dm/impls/swarm/tests/output/ex6_bsi_4_rt_1.out ex6_bsi_4_rt_1.tmp" diff-${testname}.out diff-${testname}.out diff-${label} ""
+   else
+      petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+   fi
+
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -dm_plex_dim 2 -dm_plex_simplex 0 -dm_plex_box_faces 2,2 -dm_plex_box_lower -5,-5 -dm_plex_box_upper 5,5 -dm_swarm_num_particles 2 -dm_swarm_coordinate_function circleSingleX -dm_swarm_velocity_function circleSingleV -em_pc_type fieldsplit -ksp_rtol 1e-10 -em_ksp_type preonly -em_type mixed -em_ksp_error_if_not_converged -dm_view -output_step 50 -error -dm_refine 0 -pc_type svd -sigma 1.0e-8 -timeScale 2.0e-14 -ts_dt 0.01 -ts_max_time 10.0 -ts_max_steps 10 -ts_type basicsymplectic -ts_basicsymplectic_type 4 -pc_fieldsplit_detect_saddle_point -pc_type fieldsplit -pc_fieldsplit_type schur -pc_fieldsplit_schur_precondition full -field_petscspace_degree 2 -field_petscfe_default_quadrature_order 1 -field_petscspace_type sum -field_petscspace_variables 2 -field_petscspace_components 2 -field_petscspace_sum_spaces 2 -field_petscspace_sum_concatenate true -field_sumcomp_0_petscspace_variables 2 -field_sumcomp_0_petscspace_type tensor -field_sumcomp_0_petscspace_tensor_spaces 2 -field_sumcomp_0_petscspace_tensor_uniform false -field_sumcomp_0_tensorcomp_0_petscspace_degree 1 -field_sumcomp_0_tensorcomp_1_petscspace_degree 0 -field_sumcomp_1_petscspace_variables 2 -field_sumcomp_1_petscspace_type tensor -field_sumcomp_1_petscspace_tensor_spaces 2 -field_sumcomp_1_petscspace_tensor_uniform false -field_sumcomp_1_tensorcomp_0_petscspace_degree 0 -field_sumcomp_1_tensorcomp_1_petscspace_degree 1 -field_petscdualspace_form_degree -1 -field_petscdualspace_order 1 -field_petscdualspace_lagrange_trimmed true -ksp_gmres_restart 500  > ex6_bsi_4_rt_1.tmp 2> runex6_bsi_4_rt_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/swarm/tests/output/ex6_coulomb_bsi_2d_3.out ex6_coulomb_bsi_2d_3.tmp > diff-runex6_coulomb_bsi_2d_3.out 2> diff-runex6_coulomb_bsi_2d_3.out
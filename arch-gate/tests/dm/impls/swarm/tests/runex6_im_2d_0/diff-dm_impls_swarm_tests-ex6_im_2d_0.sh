@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/swarm/tests/output/ex6_im_2d_0.out ex6_im_2d_0.tmp > diff-runex6_im_2d_0.out 2> diff-runex6_im_2d_0.out
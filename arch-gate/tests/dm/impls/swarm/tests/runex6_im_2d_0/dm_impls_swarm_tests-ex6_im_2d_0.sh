@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -dm_swarm_num_particles 2 -dm_swarm_coordinate_function circleSingleX -dm_swarm_velocity_function circleSingleV -ts_type theta -ts_theta_theta 0.5 -ts_convergence_estimate -convest_num_refine 2 -mat_type baij -ksp_error_if_not_converged -em_pc_type svd -dm_view -output_step 50 -error -ts_dt 0.01 -ts_max_time 10.0 -ts_max_steps 10 -pc_type svd -sigma 1.0e-8 -timeScale 2.0e-14 -dm_plex_dim 2 -dm_plex_simplex 0 -dm_plex_box_faces 1,1 -dm_plex_box_lower -5,-5 -dm_plex_box_upper 5,5  > ex6_im_2d_0.tmp 2> runex6_im_2d_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/impls/swarm/tests/output/ex6_none_bsi_2d_2.out ex6_none_bsi_2d_2.tmp > diff-runex6_none_bsi_2d_2.out 2> diff-runex6_none_bsi_2d_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/partitioner/tests/output/ex33_default.out ex33_default.tmp > diff-runex33_default.out 2> diff-runex33_default.out
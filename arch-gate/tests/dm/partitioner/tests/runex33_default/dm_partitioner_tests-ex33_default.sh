@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex33 -petsc_ci   > ex33_default.tmp 2> runex33_default.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/partitioner/tests/output/ex33_gather_nsize-1_nparts-2.out ex33_gather_nsize-1_nparts-2.tmp > diff-runex33_gather_nsize-1_nparts-2.out 2> diff-runex33_gather_nsize-1_nparts-2.out
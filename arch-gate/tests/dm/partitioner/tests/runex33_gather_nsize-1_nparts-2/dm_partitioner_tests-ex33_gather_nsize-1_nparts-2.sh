@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex33 -petsc_ci -petscpartitioner_type gather -petscpartitioner_view -petscpartitioner_view_graph -nparts 2  > ex33_gather_nsize-1_nparts-2.tmp 2> runex33_gather_nsize-1_nparts-2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex33 -petsc_ci -petscpartitioner_type gather -petscpartitioner_view -petscpartitioner_view_graph -nparts 1  > ex33_gather_nsize-3_nparts-1.tmp 2> runex33_gather_nsize-3_nparts-1.err
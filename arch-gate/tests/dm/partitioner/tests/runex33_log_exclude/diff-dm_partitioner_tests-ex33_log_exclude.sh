@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep MyPartitionerEvent | cut -d " " -f 1'  /root/repo/src/dm/partitioner/tests/output/ex33_log_exclude.out ex33_log_exclude.tmp > diff-runex33_log_exclude.out 2> diff-runex33_log_exclude.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex33 -petsc_ci -petscpartitioner_type simple -log_view -log_exclude partitioner  > ex33_log_exclude.tmp 2> runex33_log_exclude.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex33 -petsc_ci -petscpartitioner_type simple -log_view  > ex33_log_include.tmp 2> runex33_log_include.err
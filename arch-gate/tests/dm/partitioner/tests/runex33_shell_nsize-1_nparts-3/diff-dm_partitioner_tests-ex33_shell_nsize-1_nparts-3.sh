@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/partitioner/tests/output/ex33_shell_nsize-1_nparts-3.out ex33_shell_nsize-1_nparts-3.tmp > diff-runex33_shell_nsize-1_nparts-3.out 2> diff-runex33_shell_nsize-1_nparts-3.out
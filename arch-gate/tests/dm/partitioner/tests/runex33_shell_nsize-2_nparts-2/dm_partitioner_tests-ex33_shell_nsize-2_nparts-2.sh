@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex33 -petsc_ci -petscpartitioner_type shell -petscpartitioner_shell_random -petscpartitioner_view -nparts 2  > ex33_shell_nsize-2_nparts-2.tmp 2> runex33_shell_nsize-2_nparts-2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex33 -petsc_ci -petscpartitioner_type shell -petscpartitioner_shell_random -petscpartitioner_view -nparts 3  > ex33_shell_nsize-3_nparts-3.tmp 2> runex33_shell_nsize-3_nparts-3.err
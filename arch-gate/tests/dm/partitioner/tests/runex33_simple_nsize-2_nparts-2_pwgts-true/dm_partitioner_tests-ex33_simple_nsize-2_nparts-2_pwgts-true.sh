@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex33 -petsc_ci -petscpartitioner_type simple -petscpartitioner_view -nparts 2 -pwgts true  > ex33_simple_nsize-2_nparts-2_pwgts-true.tmp 2> runex33_simple_nsize-2_nparts-2_pwgts-true.err
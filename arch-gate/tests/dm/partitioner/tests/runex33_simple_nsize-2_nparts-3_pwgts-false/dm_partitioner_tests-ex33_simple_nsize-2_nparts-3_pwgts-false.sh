@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex33 -petsc_ci -petscpartitioner_type simple -petscpartitioner_view -nparts 3 -pwgts false  > ex33_simple_nsize-2_nparts-3_pwgts-false.tmp 2> runex33_simple_nsize-2_nparts-3_pwgts-false.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/partitioner/tests/output/ex33_simple_nsize-3_nparts-1_pwgts-true.out ex33_simple_nsize-3_nparts-1_pwgts-true.tmp > diff-runex33_simple_nsize-3_nparts-1_pwgts-true.out 2> diff-runex33_simple_nsize-3_nparts-1_pwgts-true.out
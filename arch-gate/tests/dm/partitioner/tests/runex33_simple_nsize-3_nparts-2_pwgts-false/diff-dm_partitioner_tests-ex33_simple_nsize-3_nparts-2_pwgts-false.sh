@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/partitioner/tests/output/ex33_simple_nsize-3_nparts-2_pwgts-false.out ex33_simple_nsize-3_nparts-2_pwgts-false.tmp > diff-runex33_simple_nsize-3_nparts-2_pwgts-false.out 2> diff-runex33_simple_nsize-3_nparts-2_pwgts-false.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex10 -petsc_ci -petscpartitioner_type simple  > ex10_1.tmp 2> runex10_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex16 -petsc_ci   > ex16_1.tmp 2> runex16_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex16 -petsc_ci -gather_add  > ex16_2.tmp 2> runex16_2.err
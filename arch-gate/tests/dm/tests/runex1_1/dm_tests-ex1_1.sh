@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex1 -petsc_ci -nox  > ex1_1.tmp 2> runex1_1.err
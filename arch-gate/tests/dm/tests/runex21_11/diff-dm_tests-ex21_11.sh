@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex21_11.out ex21_11.tmp > diff-runex21_11.out 2> diff-runex21_11.out
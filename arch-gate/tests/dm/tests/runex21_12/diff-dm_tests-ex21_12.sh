@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex21_12.out ex21_12.tmp > diff-runex21_12.out 2> diff-runex21_12.out
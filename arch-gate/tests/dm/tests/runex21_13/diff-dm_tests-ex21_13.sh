@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex21_13.out ex21_13.tmp > diff-runex21_13.out 2> diff-runex21_13.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex21 -petsc_ci -mx 30 -my 30 -mz 30 -periodic 0  > ex21_13.tmp 2> runex21_13.err
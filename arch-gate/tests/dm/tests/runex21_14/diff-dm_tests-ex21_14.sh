@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex21_14.out ex21_14.tmp > diff-runex21_14.out 2> diff-runex21_14.out
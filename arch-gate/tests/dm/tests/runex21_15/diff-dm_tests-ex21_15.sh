@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex21_15.out ex21_15.tmp > diff-runex21_15.out 2> diff-runex21_15.out
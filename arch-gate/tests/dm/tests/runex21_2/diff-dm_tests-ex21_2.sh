@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex21_2.out ex21_2.tmp > diff-runex21_2.out 2> diff-runex21_2.out
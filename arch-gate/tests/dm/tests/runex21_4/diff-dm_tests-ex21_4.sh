@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex21_4.out ex21_4.tmp > diff-runex21_4.out 2> diff-runex21_4.out
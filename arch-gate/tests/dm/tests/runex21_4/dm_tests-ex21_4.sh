@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex21 -petsc_ci -mx 30 -my 30 -mz 29 -periodic 3 -da_processors_x 5  > ex21_4.tmp 2> runex21_4.err
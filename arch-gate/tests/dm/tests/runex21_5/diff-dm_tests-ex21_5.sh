@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex21_5.out ex21_5.tmp > diff-runex21_5.out 2> diff-runex21_5.out
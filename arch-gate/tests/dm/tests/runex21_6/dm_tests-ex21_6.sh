@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex21 -petsc_ci -mx 29 -my 30 -mz 30 -periodic 1 -da_processors_y 5  > ex21_6.tmp 2> runex21_6.err
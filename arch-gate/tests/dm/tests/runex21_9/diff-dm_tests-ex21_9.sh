@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex21_9.out ex21_9.tmp > diff-runex21_9.out 2> diff-runex21_9.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex23 -petsc_ci -one  -dof 3 -stencil_type 0 > ex23_1.tmp 2> runex23_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex23 -petsc_ci -one  -dof 1 -stencil_type 1 > ex23_1.tmp 2> runex23_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex24 -petsc_ci   > ex24_1.tmp 2> runex24_1.err
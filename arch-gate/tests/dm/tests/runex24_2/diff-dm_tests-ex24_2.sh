@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v -i Process'  /root/repo/src/dm/tests/output/ex24_2.out ex24_2.tmp > diff-runex24_2.out 2> diff-runex24_2.out
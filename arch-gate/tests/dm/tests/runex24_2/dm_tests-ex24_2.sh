@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex24 -petsc_ci   > ex24_2.tmp 2> runex24_2.err
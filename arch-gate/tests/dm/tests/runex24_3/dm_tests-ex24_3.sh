@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex24 -petsc_ci   > ex24_3.tmp 2> runex24_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex24 -petsc_ci   > ex24_4.tmp 2> runex24_4.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex24 -petsc_ci   > ex24_5.tmp 2> runex24_5.err
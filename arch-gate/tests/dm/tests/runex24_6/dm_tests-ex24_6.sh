@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex24 -petsc_ci   > ex24_6.tmp 2> runex24_6.err
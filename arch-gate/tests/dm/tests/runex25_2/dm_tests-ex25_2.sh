@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex25 -petsc_ci   > ex25_2.tmp 2> runex25_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex25 -petsc_ci   > ex25_3.tmp 2> runex25_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex25 -petsc_ci   > ex25_4.tmp 2> runex25_4.err
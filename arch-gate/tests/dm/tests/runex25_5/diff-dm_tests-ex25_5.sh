@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v -i Process'  /root/repo/src/dm/tests/output/ex25_2.out ex25_5.tmp > diff-runex25_5.out 2> diff-runex25_5.out
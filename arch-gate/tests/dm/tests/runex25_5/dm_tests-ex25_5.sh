@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex25 -petsc_ci   > ex25_5.tmp 2> runex25_5.err
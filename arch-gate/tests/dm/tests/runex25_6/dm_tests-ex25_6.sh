@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex25 -petsc_ci   > ex25_6.tmp 2> runex25_6.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex30 -petsc_ci -bs 2 -block 0 -sliced_mat_type baij -alpha 10 -u0 0.1  > ex30_1.tmp 2> runex30_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex30_2.out ex30_2.tmp > diff-runex30_2.out 2> diff-runex30_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex31_1.out ex31_1.tmp > diff-runex31_1.out 2> diff-runex31_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex32 -petsc_ci   > ex32_1.tmp 2> runex32_1.err
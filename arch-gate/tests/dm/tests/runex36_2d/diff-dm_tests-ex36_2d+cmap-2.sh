@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex36_2d.out ex36_2d.tmp > diff-runex36_2d.out 2> diff-runex36_2d.out
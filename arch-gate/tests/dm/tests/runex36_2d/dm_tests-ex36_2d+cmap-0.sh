@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex36 -petsc_ci -mx 10 -my 10 -nl 6 -dim 2  -cmap 0 > ex36_2d.tmp 2> runex36_2d.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex36_2dp2.out ex36_2dp2.tmp > diff-runex36_2dp2.out 2> diff-runex36_2dp2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex36 -petsc_ci -mx 10 -my 10 -nl 4 -dim 2 -cmap 3 -da_refine_x 3 -da_refine_y 1  > ex36_2dp2.tmp 2> runex36_2dp2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex36_3d.out ex36_3d.tmp > diff-runex36_3d.out 2> diff-runex36_3d.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex36 -petsc_ci -mx 5 -my 5 -mz 5 -nl 4 -dim 3 -cmap 3  > ex36_3d.tmp 2> runex36_3d.err
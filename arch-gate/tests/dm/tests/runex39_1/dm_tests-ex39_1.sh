@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex39 -petsc_ci   > ex39_1.tmp 2> runex39_1.err
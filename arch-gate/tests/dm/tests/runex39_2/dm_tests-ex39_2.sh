@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex39 -petsc_ci   > ex39_2.tmp 2> runex39_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex40_1.out ex40_1.tmp > diff-runex40_1.out 2> diff-runex40_1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "Vec Object"'  /root/repo/src/dm/tests/output/ex40_2.out ex40_2.tmp > diff-runex40_2.out 2> diff-runex40_2.out
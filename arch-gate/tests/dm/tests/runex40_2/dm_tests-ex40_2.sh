@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex40 -petsc_ci   > ex40_2.tmp 2> runex40_2.err
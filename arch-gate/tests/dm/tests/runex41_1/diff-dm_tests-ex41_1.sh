@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex41_1.out ex41_1.tmp > diff-runex41_1.out 2> diff-runex41_1.out
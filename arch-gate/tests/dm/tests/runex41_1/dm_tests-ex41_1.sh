@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex41 -petsc_ci   > ex41_1.tmp 2> runex41_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex41_2.out ex41_2.tmp > diff-runex41_2.out 2> diff-runex41_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex41 -petsc_ci   > ex41_2.tmp 2> runex41_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex42 -petsc_ci   > ex42_1.tmp 2> runex42_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex44_1.out ex44_1.tmp > diff-runex44_1.out 2> diff-runex44_1.out
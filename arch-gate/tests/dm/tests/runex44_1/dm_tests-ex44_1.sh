@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex44 -petsc_ci   > ex44_1.tmp 2> runex44_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex45_1.out ex45_1.tmp > diff-runex45_1.out 2> diff-runex45_1.out
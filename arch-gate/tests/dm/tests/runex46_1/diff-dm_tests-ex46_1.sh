@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex46_1.out ex46_1.tmp > diff-runex46_1.out 2> diff-runex46_1.out
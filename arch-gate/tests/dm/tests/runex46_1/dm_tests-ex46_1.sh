@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex46 -petsc_ci   > ex46_1.tmp 2> runex46_1.err
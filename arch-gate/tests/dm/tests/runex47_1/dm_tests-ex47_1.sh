@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex47 -petsc_ci   > ex47_1.tmp 2> runex47_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex48_1.out ex48_1.tmp > diff-runex48_1.out 2> diff-runex48_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex48 -petsc_ci -dof 2  > ex48_2.tmp 2> runex48_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex48 -petsc_ci -dof 3  > ex48_3.tmp 2> runex48_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex49_basic_1.out ex49_basic_1.tmp > diff-runex49_basic_1.out 2> diff-runex49_basic_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex49 -petsc_ci   > ex49_basic_1.tmp 2> runex49_basic_1.err
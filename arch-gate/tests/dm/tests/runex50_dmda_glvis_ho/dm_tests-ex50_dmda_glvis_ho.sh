@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex50 -petsc_ci -view glvis: -nex 1 -ney 1 -nez 1  > ex50_dmda_glvis_ho.tmp 2> runex50_dmda_glvis_ho.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex50_dmda_glvis_lo.out ex50_dmda_glvis_lo.tmp > diff-runex50_dmda_glvis_lo.out 2> diff-runex50_dmda_glvis_lo.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex50_dmplex_glvis_ho.out ex50_dmplex_glvis_ho.tmp > diff-runex50_dmplex_glvis_ho.out 2> diff-runex50_dmplex_glvis_ho.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex51 -petsc_ci   > ex51_1.tmp 2> runex51_1.err
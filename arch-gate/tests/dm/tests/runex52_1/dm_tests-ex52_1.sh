@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex52 -petsc_ci   > ex52_1.tmp 2> runex52_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex52_2.out ex52_2.tmp > diff-runex52_2.out 2> diff-runex52_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex52 -petsc_ci   > ex52_2.tmp 2> runex52_2.err
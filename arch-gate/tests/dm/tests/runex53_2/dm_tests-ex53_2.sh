@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex53 -petsc_ci -sliceaxis 1  > ex53_2.tmp 2> runex53_2.err
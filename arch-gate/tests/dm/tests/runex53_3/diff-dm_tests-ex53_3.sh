@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex53_3.out ex53_3.tmp > diff-runex53_3.out 2> diff-runex53_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex53 -petsc_ci -sliceaxis 2  > ex53_3.tmp 2> runex53_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex53_4.out ex53_4.tmp > diff-runex53_4.out 2> diff-runex53_4.out
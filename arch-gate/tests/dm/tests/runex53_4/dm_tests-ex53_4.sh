@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex53 -petsc_ci -sliceaxis 1 -dim 2  > ex53_4.tmp 2> runex53_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex53_5.out ex53_5.tmp > diff-runex53_5.out 2> diff-runex53_5.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex53 -petsc_ci -sliceaxis 0 -dim 2  > ex53_5.tmp 2> runex53_5.err
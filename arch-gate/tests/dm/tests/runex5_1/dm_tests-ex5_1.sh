@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci   > ex5_1.tmp 2> runex5_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/ex8_glvis.out ex8_glvis_par.tmp > diff-runex8_glvis_par.out 2> diff-runex8_glvis_par.out
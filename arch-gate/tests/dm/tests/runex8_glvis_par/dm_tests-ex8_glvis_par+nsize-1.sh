@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex8 -petsc_ci -dm_view glvis: -vec_view glvis:  > ex8_glvis_par.tmp 2> runex8_glvis_par.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex9 -petsc_ci   > ex9_composite_nest_l2g_nsize-1.tmp 2> runex9_composite_nest_l2g_nsize-1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex9 -petsc_ci   > ex9_composite_nest_l2g_nsize-2.tmp 2> runex9_composite_nest_l2g_nsize-2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/noflux_check.out noflux_check.tmp > diff-runnoflux_check.out 2> diff-runnoflux_check.out
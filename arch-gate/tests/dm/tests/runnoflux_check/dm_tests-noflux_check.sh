@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../noflux_check -petsc_ci   > noflux_check.tmp 2> runnoflux_check.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/noflux_check_2.out noflux_check_2.tmp > diff-runnoflux_check_2.out 2> diff-runnoflux_check_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../noflux_check -petsc_ci   > noflux_check_2.tmp 2> runnoflux_check_2.err
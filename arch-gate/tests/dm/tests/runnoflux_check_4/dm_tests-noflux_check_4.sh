@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../noflux_check -petsc_ci   > noflux_check_4.tmp 2> runnoflux_check_4.err
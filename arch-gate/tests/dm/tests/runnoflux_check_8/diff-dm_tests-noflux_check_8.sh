@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tests/output/noflux_check_8.out noflux_check_8.tmp > diff-runnoflux_check_8.out 2> diff-runnoflux_check_8.out
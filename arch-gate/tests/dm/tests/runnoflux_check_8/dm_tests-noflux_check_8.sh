@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../noflux_check -petsc_ci   > noflux_check_8.tmp 2> runnoflux_check_8.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex15 -petsc_ci   > ex15_1.tmp 2> runex15_1.err
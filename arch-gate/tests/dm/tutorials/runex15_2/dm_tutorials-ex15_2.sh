@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 12  ../ex15 -petsc_ci   > ex15_2.tmp 2> runex15_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 12  ../ex15 -petsc_ci -usempiio  > ex15_3.tmp 2> runex15_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex19 -petsc_ci   > ex19_1.tmp 2> runex19_1.err
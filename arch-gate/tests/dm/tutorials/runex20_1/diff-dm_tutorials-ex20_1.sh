@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v atomic' -f $'grep -v atomic'  /root/repo/src/dm/tutorials/output/ex20_1.out ex20_1.tmp > diff-runex20_1.out 2> diff-runex20_1.out
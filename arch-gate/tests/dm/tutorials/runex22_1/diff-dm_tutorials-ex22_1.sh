@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tutorials/output/ex22_1.out ex22_1.tmp > diff-runex22_1.out 2> diff-runex22_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex22 -petsc_ci -sliceaxis X -gp 0  > ex22_1.tmp 2> runex22_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "subset MPI subcomm"'  /root/repo/src/dm/tutorials/output/ex22_2.out ex22_2.tmp > diff-runex22_2.out 2> diff-runex22_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex22 -petsc_ci -sliceaxis Y -gp 1  > ex22_2.tmp 2> runex22_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex22 -petsc_ci -sliceaxis Z -gp 2  > ex22_3.tmp 2> runex22_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "subset MPI subcomm"'  /root/repo/src/dm/tutorials/output/ex22_4.out ex22_4.tmp > diff-runex22_4.out 2> diff-runex22_4.out
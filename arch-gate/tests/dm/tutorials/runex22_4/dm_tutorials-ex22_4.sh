@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex22 -petsc_ci -sliceaxis X -gp 2  > ex22_4.tmp 2> runex22_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "subset MPI subcomm"'  /root/repo/src/dm/tutorials/output/ex22_5.out ex22_5.tmp > diff-runex22_5.out 2> diff-runex22_5.out
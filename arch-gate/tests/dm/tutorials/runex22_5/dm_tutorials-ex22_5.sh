@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex22 -petsc_ci -sliceaxis Z -gp 1  > ex22_5.tmp 2> runex22_5.err
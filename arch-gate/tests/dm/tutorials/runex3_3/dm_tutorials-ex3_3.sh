@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex3 -petsc_ci -mat_view -dim 3  > ex3_3.tmp 2> runex3_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/dm/tutorials/output/ex51_1.out ex51_1.tmp > diff-runex51_1.out 2> diff-runex51_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex6 -petsc_ci   > ex6_2.tmp 2> runex6_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex6 -petsc_ci   > ex6_4.tmp 2> runex6_4.err
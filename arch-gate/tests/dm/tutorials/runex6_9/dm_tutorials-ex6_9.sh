@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 9  ../ex6 -petsc_ci   > ex6_9.tmp 2> runex6_9.err
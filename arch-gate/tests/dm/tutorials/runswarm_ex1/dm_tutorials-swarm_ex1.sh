@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../swarm_ex1 -petsc_ci -test_mode 1  > swarm_ex1.tmp 2> runswarm_ex1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../swarm_ex1 -petsc_ci -test_mode 2  > swarm_ex1_2.tmp 2> runswarm_ex1_2.err
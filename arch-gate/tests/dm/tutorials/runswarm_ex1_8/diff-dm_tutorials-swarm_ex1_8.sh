@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v atomic' -f $'grep -v atomic'  /root/repo/src/dm/tutorials/output/swarm_ex1_8.out swarm_ex1_8.tmp > diff-runswarm_ex1_8.out 2> diff-runswarm_ex1_8.out
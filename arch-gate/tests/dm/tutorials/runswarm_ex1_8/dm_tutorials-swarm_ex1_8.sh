@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../swarm_ex1 -petsc_ci -test_mode 4  > swarm_ex1_8.tmp 2> runswarm_ex1_8.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v atomic' -f $'grep -v atomic'  /root/repo/src/dm/tutorials/output/swarm_ex2.out swarm_ex2.tmp > diff-runswarm_ex2.out 2> diff-runswarm_ex2.out
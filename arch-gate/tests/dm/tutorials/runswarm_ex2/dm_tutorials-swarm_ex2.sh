@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../swarm_ex2 -petsc_ci   > swarm_ex2.tmp 2> runswarm_ex2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../swarm_ex3 -petsc_ci   > swarm_ex3.tmp 2> runswarm_ex3.err
@@ -0,0 +1,711 @@
+-7.4059e-01 -2.5657e-01 0.0000e+00
+-7.0613e-01 -3.0571e-01 0.0000e+00
+-6.8328e-01 -3.5252e-01 0.0000e+00
+-6.5181e-01 -3.9327e-01 0.0000e+00
+-6.3154e-01 -4.3358e-01 0.0000e+00
+-5.9637e-01 -4.8561e-01 0.0000e+00
+-5.7019e-01 -5.2930e-01 0.0000e+00
+-5.3664e-01 -5.7054e-01 0.0000e+00
+-7.8183e-01 -9.9255e-02 0.0000e+00
+-7.5512e-01 -1.4726e-01 0.0000e+00
+-7.2571e-01 -1.9253e-01 0.0000e+00
+-6.9693e-01 -2.3568e-01 0.0000e+00
+-6.6787e-01 -2.7695e-01 0.0000e+00
+-6.4416e-01 -3.1879e-01 0.0000e+00
+-6.1475e-01 -3.6497e-01 0.0000e+00
+-5.8334e-01 -4.0418e-01 0.0000e+00
+-5.4918e-01 -4.5331e-01 0.0000e+00
+-5.2459e-01 -4.9071e-01 0.0000e+00
+-4.9665e-01 -5.4125e-01 0.0000e+00
+-4.6564e-01 -5.8900e-01 0.0000e+00
+-4.3647e-01 -6.2768e-01 0.0000e+00
+-7.7249e-01 -2.4807e-02 0.0000e+00
+-7.3920e-01 -7.6002e-02 0.0000e+00
+-7.0700e-01 -1.0981e-01 0.0000e+00
+-6.8338e-01 -1.5940e-01 0.0000e+00
+-6.5442e-01 -2.0086e-01 0.0000e+00
+-6.2092e-01 -2.4814e-01 0.0000e+00
+-5.9198e-01 -2.9421e-01 0.0000e+00
+-5.6984e-01 -3.3577e-01 0.0000e+00
+-5.3865e-01 -3.8080e-01 0.0000e+00
+-5.0477e-01 -4.2436e-01 0.0000e+00
+-4.8034e-01 -4.6983e-01 0.0000e+00
+-4.5299e-01 -5.1329e-01 0.0000e+00
+-4.2277e-01 -5.5373e-01 0.0000e+00
+-3.9631e-01 -6.0103e-01 0.0000e+00
+-3.6119e-01 -6.4158e-01 0.0000e+00
+-3.3841e-01 -6.8863e-01 0.0000e+00
+-7.8035e-01 +8.6806e-02 0.0000e+00
+-7.5108e-01 +4.2959e-02 0.0000e+00
+-7.2475e-01 +5.0158e-03 0.0000e+00
+-6.8845e-01 -3.9419e-02 0.0000e+00
+-6.6171e-01 -8.2837e-02 0.0000e+00
+-6.3611e-01 -1.2820e-01 0.0000e+00
+-6.0924e-01 -1.7148e-01 0.0000e+00
+-5.8137e-01 -2.1995e-01 0.0000e+00
+-5.5246e-01 -2.6246e-01 0.0000e+00
+-5.1861e-01 -3.0251e-01 0.0000e+00
+-4.9145e-01 -3.5089e-01 0.0000e+00
+-4.6295e-01 -3.8776e-01 0.0000e+00
+-4.3430e-01 -4.3752e-01 0.0000e+00
+-4.0742e-01 -4.7775e-01 0.0000e+00
+-3.7560e-01 -5.2540e-01 0.0000e+00
+-3.5428e-01 -5.7458e-01 0.0000e+00
+-3.2130e-01 -6.1929e-01 0.0000e+00
+-2.8786e-01 -6.6026e-01 0.0000e+00
+-2.6756e-01 -7.0182e-01 0.0000e+00
+-2.3958e-01 -7.4636e-01 0.0000e+00
+-7.5934e-01 +1.6510e-01 0.0000e+00
+-7.3585e-01 +1.1675e-01 0.0000e+00
+-7.0164e-01 +7.7902e-02 0.0000e+00
+-6.7528e-01 +3.5535e-02 0.0000e+00
+-6.4515e-01 -1.2116e-02 0.0000e+00
+-6.2309e-01 -6.0008e-02 0.0000e+00
+-5.9196e-01 -1.0702e-01 0.0000e+00
+-5.6536e-01 -1.4445e-01 0.0000e+00
+-5.3954e-01 -1.9116e-01 0.0000e+00
+-5.0516e-01 -2.2726e-01 0.0000e+00
+-4.7601e-01 -2.8071e-01 0.0000e+00
+-4.5014e-01 -3.2805e-01 0.0000e+00
+-4.2207e-01 -3.7023e-01 0.0000e+00
+-3.9319e-01 -4.1293e-01 0.0000e+00
+-3.6068e-01 -4.5846e-01 0.0000e+00
+-3.3287e-01 -5.0081e-01 0.0000e+00
+-3.0582e-01 -5.4591e-01 0.0000e+00
+-2.8020e-01 -5.8542e-01 0.0000e+00
+-2.5081e-01 -6.3139e-01 0.0000e+00
+-2.2374e-01 -6.7262e-01 0.0000e+00
+-1.9106e-01 -7.2249e-01 0.0000e+00
+-1.6569e-01 -7.6659e-01 0.0000e+00
+-7.4789e-01 +2.3770e-01 0.0000e+00
+-7.1872e-01 +1.9775e-01 0.0000e+00
+-6.9410e-01 +1.4700e-01 0.0000e+00
+-6.5998e-01 +1.0106e-01 0.0000e+00
+-6.2795e-01 +5.7671e-02 0.0000e+00
+-6.0276e-01 +1.1769e-02 0.0000e+00
+-5.8068e-01 -2.6207e-02 0.0000e+00
+-5.4981e-01 -7.6813e-02 0.0000e+00
+-5.2384e-01 -1.1769e-01 0.0000e+00
+-4.8534e-01 -1.6170e-01 0.0000e+00
+-4.6361e-01 -2.0780e-01 0.0000e+00
+-4.3140e-01 -2.5068e-01 0.0000e+00
+-4.0932e-01 -2.9577e-01 0.0000e+00
+-3.7359e-01 -3.3691e-01 0.0000e+00
+-3.5125e-01 -3.8483e-01 0.0000e+00
+-3.1976e-01 -4.2657e-01 0.0000e+00
+-2.9230e-01 -4.6780e-01 0.0000e+00
+-2.6214e-01 -5.1080e-01 0.0000e+00
+-2.3546e-01 -5.6301e-01 0.0000e+00
+-2.0749e-01 -6.0598e-01 0.0000e+00
+-1.7036e-01 -6.4738e-01 0.0000e+00
+-1.4948e-01 -6.8510e-01 0.0000e+00
+-1.1406e-01 -7.3549e-01 0.0000e+00
+-8.8433e-02 -7.8114e-01 0.0000e+00
+-7.0780e-01 +2.6374e-01 0.0000e+00
+-6.7557e-01 +2.2425e-01 0.0000e+00
+-6.4678e-01 +1.7711e-01 0.0000e+00
+-6.1887e-01 +1.2753e-01 0.0000e+00
+-5.8804e-01 +9.3783e-02 0.0000e+00
+-5.5869e-01 +4.4193e-02 0.0000e+00
+-5.3020e-01 +4.6972e-03 0.0000e+00
+-4.9859e-01 -4.4350e-02 0.0000e+00
+-4.7181e-01 -8.5871e-02 0.0000e+00
+-4.5202e-01 -1.2986e-01 0.0000e+00
+-4.2252e-01 -1.7754e-01 0.0000e+00
+-3.8841e-01 -2.2439e-01 0.0000e+00
+-3.6281e-01 -2.6609e-01 0.0000e+00
+-3.3089e-01 -3.1277e-01 0.0000e+00
+-3.0253e-01 -3.4604e-01 0.0000e+00
+-2.7474e-01 -3.9243e-01 0.0000e+00
+-2.4760e-01 -4.4082e-01 0.0000e+00
+-2.2426e-01 -4.8462e-01 0.0000e+00
+-1.8842e-01 -5.2542e-01 0.0000e+00
+-1.5640e-01 -5.7467e-01 0.0000e+00
+-1.3331e-01 -6.1336e-01 0.0000e+00
+-1.0136e-01 -6.6552e-01 0.0000e+00
+-8.1470e-02 -7.0607e-01 0.0000e+00
+-4.8282e-02 -7.4600e-01 0.0000e+00
+-6.8973e-01 +3.3764e-01 0.0000e+00
+-6.6065e-01 +2.9262e-01 0.0000e+00
+-6.2667e-01 +2.4967e-01 0.0000e+00
+-6.0217e-01 +2.0830e-01 0.0000e+00
+-5.7664e-01 +1.6499e-01 0.0000e+00
+-5.4772e-01 +1.1682e-01 0.0000e+00
+-5.1622e-01 +6.7564e-02 0.0000e+00
+-4.9063e-01 +3.1767e-02 0.0000e+00
+-4.5728e-01 -1.4391e-02 0.0000e+00
+-4.3129e-01 -6.1696e-02 0.0000e+00
+-4.0191e-01 -1.0488e-01 0.0000e+00
+-3.7116e-01 -1.4634e-01 0.0000e+00
+-3.4294e-01 -1.8995e-01 0.0000e+00
+-3.2326e-01 -2.3426e-01 0.0000e+00
+-2.8508e-01 -2.7897e-01 0.0000e+00
+-2.6048e-01 -3.2100e-01 0.0000e+00
+-2.2764e-01 -3.6512e-01 0.0000e+00
+-2.0846e-01 -4.1158e-01 0.0000e+00
+-1.7479e-01 -4.5391e-01 0.0000e+00
+-1.4012e-01 -5.0032e-01 0.0000e+00
+-1.1678e-01 -5.4715e-01 0.0000e+00
+-9.2672e-02 -5.8874e-01 0.0000e+00
+-6.5045e-02 -6.3433e-01 0.0000e+00
+-2.9246e-02 -6.7359e-01 0.0000e+00
+-8.1595e-03 -7.2040e-01 0.0000e+00
++2.9249e-02 -7.6756e-01 0.0000e+00
+-6.7221e-01 +4.0391e-01 0.0000e+00
+-6.3925e-01 +3.6415e-01 0.0000e+00
+-6.1084e-01 +3.1907e-01 0.0000e+00
+-5.8875e-01 +2.7261e-01 0.0000e+00
+-5.5435e-01 +2.3547e-01 0.0000e+00
+-5.2973e-01 +1.9482e-01 0.0000e+00
+-5.0068e-01 +1.4251e-01 0.0000e+00
+-4.7006e-01 +1.0662e-01 0.0000e+00
+-4.4391e-01 +6.2914e-02 0.0000e+00
+-4.1670e-01 +8.5288e-03 0.0000e+00
+-3.8878e-01 -3.7254e-02 0.0000e+00
+-3.5605e-01 -7.0317e-02 0.0000e+00
+-3.3122e-01 -1.2109e-01 0.0000e+00
+-3.0031e-01 -1.6367e-01 0.0000e+00
+-2.6617e-01 -2.0805e-01 0.0000e+00
+-2.4205e-01 -2.4680e-01 0.0000e+00
+-2.1285e-01 -2.9144e-01 0.0000e+00
+-1.8644e-01 -3.3948e-01 0.0000e+00
+-1.5970e-01 -3.8793e-01 0.0000e+00
+-1.3348e-01 -4.2973e-01 0.0000e+00
+-1.0317e-01 -4.7331e-01 0.0000e+00
+-6.9331e-02 -5.1611e-01 0.0000e+00
+-4.5693e-02 -5.6051e-01 0.0000e+00
+-1.9780e-02 -6.0677e-01 0.0000e+00
++1.1203e-02 -6.4934e-01 0.0000e+00
++4.0460e-02 -6.9124e-01 0.0000e+00
++7.1997e-02 -7.4007e-01 0.0000e+00
+-6.2102e-01 +4.3743e-01 0.0000e+00
+-6.0406e-01 +3.9273e-01 0.0000e+00
+-5.7593e-01 +3.5189e-01 0.0000e+00
+-5.4788e-01 +3.0847e-01 0.0000e+00
+-5.1709e-01 +2.5864e-01 0.0000e+00
+-4.8819e-01 +2.1660e-01 0.0000e+00
+-4.5824e-01 +1.6792e-01 0.0000e+00
+-4.2622e-01 +1.3495e-01 0.0000e+00
+-4.0098e-01 +8.2218e-02 0.0000e+00
+-3.7013e-01 +3.9717e-02 0.0000e+00
+-3.4583e-01 +1.1448e-03 0.0000e+00
+-3.1456e-01 -4.7203e-02 0.0000e+00
+-2.8627e-01 -8.6772e-02 0.0000e+00
+-2.5671e-01 -1.3064e-01 0.0000e+00
+-2.2593e-01 -1.8091e-01 0.0000e+00
+-1.9906e-01 -2.2286e-01 0.0000e+00
+-1.6909e-01 -2.6344e-01 0.0000e+00
+-1.3658e-01 -3.1237e-01 0.0000e+00
+-1.1322e-01 -3.5655e-01 0.0000e+00
+-8.6009e-02 -3.9880e-01 0.0000e+00
+-6.0087e-02 -4.4009e-01 0.0000e+00
+-2.9579e-02 -4.8661e-01 0.0000e+00
+-6.1095e-04 -5.3246e-01 0.0000e+00
++3.5181e-02 -5.7775e-01 0.0000e+00
++5.6847e-02 -6.2326e-01 0.0000e+00
++8.6863e-02 -6.6273e-01 0.0000e+00
++1.1411e-01 -7.1212e-01 0.0000e+00
++1.4315e-01 -7.5242e-01 0.0000e+00
+-5.8549e-01 +4.6585e-01 0.0000e+00
+-5.5690e-01 +4.2709e-01 0.0000e+00
+-5.2652e-01 +3.7787e-01 0.0000e+00
+-5.0103e-01 +3.3140e-01 0.0000e+00
+-4.6454e-01 +2.8818e-01 0.0000e+00
+-4.4041e-01 +2.4832e-01 0.0000e+00
+-4.1871e-01 +2.0284e-01 0.0000e+00
+-3.8648e-01 +1.5600e-01 0.0000e+00
+-3.5196e-01 +1.1573e-01 0.0000e+00
+-3.2676e-01 +6.7399e-02 0.0000e+00
+-3.0233e-01 +2.7300e-02 0.0000e+00
+-2.7278e-01 -2.3136e-02 0.0000e+00
+-2.3535e-01 -6.4383e-02 0.0000e+00
+-2.1533e-01 -1.0249e-01 0.0000e+00
+-1.7905e-01 -1.5149e-01 0.0000e+00
+-1.5776e-01 -1.9930e-01 0.0000e+00
+-1.2844e-01 -2.3497e-01 0.0000e+00
+-1.0290e-01 -2.8539e-01 0.0000e+00
+-6.9563e-02 -3.2807e-01 0.0000e+00
+-4.3648e-02 -3.7453e-01 0.0000e+00
+-1.1793e-02 -4.0882e-01 0.0000e+00
++1.0556e-02 -4.6090e-01 0.0000e+00
++4.8012e-02 -5.0680e-01 0.0000e+00
++6.7786e-02 -5.4722e-01 0.0000e+00
++1.0500e-01 -5.8960e-01 0.0000e+00
++1.3522e-01 -6.3625e-01 0.0000e+00
++1.5606e-01 -6.7824e-01 0.0000e+00
++1.8850e-01 -7.2465e-01 0.0000e+00
+-5.6972e-01 +5.4422e-01 0.0000e+00
+-5.3801e-01 +4.9365e-01 0.0000e+00
+-5.0946e-01 +4.5723e-01 0.0000e+00
+-4.7751e-01 +4.0598e-01 0.0000e+00
+-4.5426e-01 +3.6574e-01 0.0000e+00
+-4.1963e-01 +3.1957e-01 0.0000e+00
+-3.9596e-01 +2.7903e-01 0.0000e+00
+-3.7250e-01 +2.2783e-01 0.0000e+00
+-3.4096e-01 +1.8411e-01 0.0000e+00
+-3.0944e-01 +1.4063e-01 0.0000e+00
+-2.8251e-01 +9.6576e-02 0.0000e+00
+-2.5590e-01 +5.5576e-02 0.0000e+00
+-2.2662e-01 +1.0837e-02 0.0000e+00
+-1.9941e-01 -3.1034e-02 0.0000e+00
+-1.6391e-01 -8.0806e-02 0.0000e+00
+-1.4586e-01 -1.2151e-01 0.0000e+00
+-1.1586e-01 -1.6858e-01 0.0000e+00
+-8.2335e-02 -2.1020e-01 0.0000e+00
+-5.6434e-02 -2.5826e-01 0.0000e+00
+-2.6604e-02 -2.9606e-01 0.0000e+00
++1.7943e-03 -3.4619e-01 0.0000e+00
++2.9033e-02 -3.8348e-01 0.0000e+00
++5.7577e-02 -4.3182e-01 0.0000e+00
++9.1637e-02 -4.7692e-01 0.0000e+00
++1.1824e-01 -5.1686e-01 0.0000e+00
++1.4249e-01 -5.6645e-01 0.0000e+00
++1.7259e-01 -6.0555e-01 0.0000e+00
++2.0299e-01 -6.5187e-01 0.0000e+00
++2.2857e-01 -6.9809e-01 0.0000e+00
++2.5592e-01 -7.3936e-01 0.0000e+00
+-5.2154e-01 +5.7067e-01 0.0000e+00
+-4.9465e-01 +5.2647e-01 0.0000e+00
+-4.6843e-01 +4.8082e-01 0.0000e+00
+-4.3950e-01 +4.4024e-01 0.0000e+00
+-4.1264e-01 +3.9361e-01 0.0000e+00
+-3.7513e-01 +3.4751e-01 0.0000e+00
+-3.5266e-01 +2.9987e-01 0.0000e+00
+-3.2319e-01 +2.6307e-01 0.0000e+00
+-2.9711e-01 +2.2041e-01 0.0000e+00
+-2.6552e-01 +1.6838e-01 0.0000e+00
+-2.3977e-01 +1.2414e-01 0.0000e+00
+-2.1233e-01 +8.2643e-02 0.0000e+00
+-1.8359e-01 +4.1899e-02 0.0000e+00
+-1.4679e-01 -5.7147e-03 0.0000e+00
+-1.2205e-01 -4.7710e-02 0.0000e+00
+-9.0912e-02 -9.5001e-02 0.0000e+00
+-6.9512e-02 -1.3589e-01 0.0000e+00
+-4.3451e-02 -1.8205e-01 0.0000e+00
+-1.1613e-02 -2.2634e-01 0.0000e+00
++1.8249e-02 -2.7121e-01 0.0000e+00
++4.1746e-02 -3.1312e-01 0.0000e+00
++7.3859e-02 -3.6026e-01 0.0000e+00
++9.9719e-02 -4.0532e-01 0.0000e+00
++1.3342e-01 -4.4789e-01 0.0000e+00
++1.5477e-01 -4.8846e-01 0.0000e+00
++1.9054e-01 -5.2764e-01 0.0000e+00
++2.1578e-01 -5.7985e-01 0.0000e+00
++2.4253e-01 -6.2247e-01 0.0000e+00
++2.7509e-01 -6.6984e-01 0.0000e+00
++3.0770e-01 -7.0985e-01 0.0000e+00
+-4.8115e-01 +5.9103e-01 0.0000e+00
+-4.4860e-01 +5.4923e-01 0.0000e+00
+-4.1857e-01 +5.1155e-01 0.0000e+00
+-4.0108e-01 +4.6593e-01 0.0000e+00
+-3.6899e-01 +4.2358e-01 0.0000e+00
+-3.3631e-01 +3.8268e-01 0.0000e+00
+-3.1010e-01 +3.3273e-01 0.0000e+00
+-2.7585e-01 +2.8529e-01 0.0000e+00
+-2.4907e-01 +2.4608e-01 0.0000e+00
+-2.2107e-01 +1.9781e-01 0.0000e+00
+-1.9147e-01 +1.5945e-01 0.0000e+00
+-1.6271e-01 +1.1127e-01 0.0000e+00
+-1.4359e-01 +6.7356e-02 0.0000e+00
+-1.0669e-01 +2.3405e-02 0.0000e+00
+-7.8965e-02 -2.2913e-02 0.0000e+00
+-4.9403e-02 -6.4906e-02 0.0000e+00
+-2.5201e-02 -1.0887e-01 0.0000e+00
++6.3419e-03 -1.5515e-01 0.0000e+00
++3.5203e-02 -2.0108e-01 0.0000e+00
++6.6892e-02 -2.4283e-01 0.0000e+00
++9.0570e-02 -2.8434e-01 0.0000e+00
++1.2585e-01 -3.3094e-01 0.0000e+00
++1.4611e-01 -3.7906e-01 0.0000e+00
++1.7354e-01 -4.2071e-01 0.0000e+00
++2.0642e-01 -4.5738e-01 0.0000e+00
++2.2910e-01 -5.0577e-01 0.0000e+00
++2.5755e-01 -5.4777e-01 0.0000e+00
++2.8656e-01 -5.9127e-01 0.0000e+00
++3.1613e-01 -6.4019e-01 0.0000e+00
++3.5109e-01 -6.7881e-01 0.0000e+00
+-4.3603e-01 +6.2729e-01 0.0000e+00
+-4.1012e-01 +5.8252e-01 0.0000e+00
+-3.7809e-01 +5.4156e-01 0.0000e+00
+-3.4974e-01 +4.9862e-01 0.0000e+00
+-3.2155e-01 +4.4698e-01 0.0000e+00
+-2.9021e-01 +4.0715e-01 0.0000e+00
+-2.6225e-01 +3.5795e-01 0.0000e+00
+-2.3353e-01 +3.1909e-01 0.0000e+00
+-2.1119e-01 +2.7225e-01 0.0000e+00
+-1.7548e-01 +2.3136e-01 0.0000e+00
+-1.5014e-01 +1.8183e-01 0.0000e+00
+-1.2670e-01 +1.4294e-01 0.0000e+00
+-8.7523e-02 +9.5018e-02 0.0000e+00
+-5.8904e-02 +5.2162e-02 0.0000e+00
+-3.8105e-02 +3.1756e-03 0.0000e+00
+-1.2421e-02 -3.5520e-02 0.0000e+00
++2.0547e-02 -8.3830e-02 0.0000e+00
++4.5260e-02 -1.2335e-01 0.0000e+00
++7.6191e-02 -1.7362e-01 0.0000e+00
++1.0878e-01 -2.1480e-01 0.0000e+00
++1.3652e-01 -2.6018e-01 0.0000e+00
++1.6579e-01 -2.9633e-01 0.0000e+00
++1.9009e-01 -3.4829e-01 0.0000e+00
++2.2293e-01 -3.8667e-01 0.0000e+00
++2.5249e-01 -4.3680e-01 0.0000e+00
++2.7681e-01 -4.7305e-01 0.0000e+00
++3.0657e-01 -5.1911e-01 0.0000e+00
++3.3527e-01 -5.6946e-01 0.0000e+00
++3.6294e-01 -6.0939e-01 0.0000e+00
++3.8875e-01 -6.5103e-01 0.0000e+00
+-3.8908e-01 +6.5080e-01 0.0000e+00
+-3.5957e-01 +6.1278e-01 0.0000e+00
+-3.3329e-01 +5.6433e-01 0.0000e+00
+-3.0601e-01 +5.2551e-01 0.0000e+00
+-2.7559e-01 +4.7861e-01 0.0000e+00
+-2.4927e-01 +4.2945e-01 0.0000e+00
+-2.2116e-01 +3.8703e-01 0.0000e+00
+-1.9670e-01 +3.4298e-01 0.0000e+00
+-1.6508e-01 +2.9761e-01 0.0000e+00
+-1.3772e-01 +2.5746e-01 0.0000e+00
+-1.0882e-01 +2.1123e-01 0.0000e+00
+-7.5749e-02 +1.6995e-01 0.0000e+00
+-4.7714e-02 +1.2918e-01 0.0000e+00
+-2.0749e-02 +7.5938e-02 0.0000e+00
++9.6517e-03 +3.8956e-02 0.0000e+00
++3.6022e-02 -1.3308e-02 0.0000e+00
++6.5692e-02 -4.6788e-02 0.0000e+00
++9.6310e-02 -9.5183e-02 0.0000e+00
++1.1658e-01 -1.4081e-01 0.0000e+00
++1.4975e-01 -1.8816e-01 0.0000e+00
++1.8084e-01 -2.3246e-01 0.0000e+00
++2.0620e-01 -2.6967e-01 0.0000e+00
++2.3228e-01 -3.1558e-01 0.0000e+00
++2.6950e-01 -3.6307e-01 0.0000e+00
++2.9591e-01 -4.0139e-01 0.0000e+00
++3.2352e-01 -4.4754e-01 0.0000e+00
++3.5555e-01 -4.9203e-01 0.0000e+00
++3.7502e-01 -5.3775e-01 0.0000e+00
++4.1160e-01 -5.8438e-01 0.0000e+00
++4.3279e-01 -6.2649e-01 0.0000e+00
+-3.4594e-01 +6.8008e-01 0.0000e+00
+-3.2096e-01 +6.4255e-01 0.0000e+00
+-2.8626e-01 +5.9729e-01 0.0000e+00
+-2.6126e-01 +5.4598e-01 0.0000e+00
+-2.2996e-01 +5.0874e-01 0.0000e+00
+-2.0648e-01 +4.6046e-01 0.0000e+00
+-1.7894e-01 +4.1694e-01 0.0000e+00
+-1.4648e-01 +3.6907e-01 0.0000e+00
+-1.1684e-01 +3.3527e-01 0.0000e+00
+-9.3717e-02 +2.8067e-01 0.0000e+00
+-6.7554e-02 +2.4312e-01 0.0000e+00
+-3.3437e-02 +1.9517e-01 0.0000e+00
+-3.5522e-03 +1.5698e-01 0.0000e+00
++2.0610e-02 +1.0761e-01 0.0000e+00
++5.5541e-02 +6.6777e-02 0.0000e+00
++7.8783e-02 +2.3343e-02 0.0000e+00
++1.1197e-01 -2.7564e-02 0.0000e+00
++1.3682e-01 -6.9610e-02 0.0000e+00
++1.7130e-01 -1.1195e-01 0.0000e+00
++1.9649e-01 -1.5317e-01 0.0000e+00
++2.1956e-01 -2.0129e-01 0.0000e+00
++2.4864e-01 -2.4179e-01 0.0000e+00
++2.8109e-01 -2.8721e-01 0.0000e+00
++3.0439e-01 -3.3501e-01 0.0000e+00
++3.4094e-01 -3.7428e-01 0.0000e+00
++3.6389e-01 -4.1809e-01 0.0000e+00
++3.9193e-01 -4.6550e-01 0.0000e+00
++4.2685e-01 -5.0530e-01 0.0000e+00
++4.5235e-01 -5.5457e-01 0.0000e+00
++4.7533e-01 -5.9863e-01 0.0000e+00
+-3.0467e-01 +7.1121e-01 0.0000e+00
+-2.7636e-01 +6.6814e-01 0.0000e+00
+-2.4691e-01 +6.2558e-01 0.0000e+00
+-2.1335e-01 +5.8042e-01 0.0000e+00
+-1.9317e-01 +5.3671e-01 0.0000e+00
+-1.6690e-01 +4.9138e-01 0.0000e+00
+-1.3534e-01 +4.4450e-01 0.0000e+00
+-1.0609e-01 +4.0371e-01 0.0000e+00
+-7.7318e-02 +3.5196e-01 0.0000e+00
+-4.1688e-02 +3.1350e-01 0.0000e+00
+-2.4467e-02 +2.7203e-01 0.0000e+00
++5.4406e-03 +2.2738e-01 0.0000e+00
++3.3957e-02 +1.8393e-01 0.0000e+00
++7.1080e-02 +1.3991e-01 0.0000e+00
++9.6005e-02 +9.0581e-02 0.0000e+00
++1.2633e-01 +4.5130e-02 0.0000e+00
++1.5008e-01 +6.2633e-03 0.0000e+00
++1.8261e-01 -4.0303e-02 0.0000e+00
++2.1014e-01 -8.0404e-02 0.0000e+00
++2.3546e-01 -1.2755e-01 0.0000e+00
++2.6851e-01 -1.7542e-01 0.0000e+00
++2.9573e-01 -2.1628e-01 0.0000e+00
++3.2451e-01 -2.5560e-01 0.0000e+00
++3.4904e-01 -3.0503e-01 0.0000e+00
++3.8018e-01 -3.4786e-01 0.0000e+00
++4.0458e-01 -3.9062e-01 0.0000e+00
++4.4046e-01 -4.3854e-01 0.0000e+00
++4.6938e-01 -4.8365e-01 0.0000e+00
++4.9787e-01 -5.2764e-01 0.0000e+00
++5.2328e-01 -5.7441e-01 0.0000e+00
+-2.5337e-01 +7.3807e-01 0.0000e+00
+-2.3403e-01 +6.9398e-01 0.0000e+00
+-2.0598e-01 +6.5284e-01 0.0000e+00
+-1.7478e-01 +6.0745e-01 0.0000e+00
+-1.4296e-01 +5.6264e-01 0.0000e+00
+-1.2030e-01 +5.2115e-01 0.0000e+00
+-8.5088e-02 +4.7963e-01 0.0000e+00
+-6.4536e-02 +4.3106e-01 0.0000e+00
+-3.3892e-02 +3.8272e-01 0.0000e+00
+-6.6287e-03 +3.4554e-01 0.0000e+00
++2.5380e-02 +2.9482e-01 0.0000e+00
++4.9831e-02 +2.5553e-01 0.0000e+00
++7.7811e-02 +2.1144e-01 0.0000e+00
++1.1024e-01 +1.6316e-01 0.0000e+00
++1.4296e-01 +1.1767e-01 0.0000e+00
++1.7422e-01 +7.6685e-02 0.0000e+00
++1.9854e-01 +3.1545e-02 0.0000e+00
++2.2250e-01 -8.1182e-03 0.0000e+00
++2.5118e-01 -5.3064e-02 0.0000e+00
++2.8014e-01 -9.4678e-02 0.0000e+00
++3.1122e-01 -1.4415e-01 0.0000e+00
++3.4325e-01 -1.8421e-01 0.0000e+00
++3.7195e-01 -2.2741e-01 0.0000e+00
++3.9444e-01 -2.7349e-01 0.0000e+00
++4.2691e-01 -3.1469e-01 0.0000e+00
++4.5002e-01 -3.6292e-01 0.0000e+00
++4.8667e-01 -4.0611e-01 0.0000e+00
++5.0898e-01 -4.5476e-01 0.0000e+00
++5.3846e-01 -4.9816e-01 0.0000e+00
++5.7042e-01 -5.3522e-01 0.0000e+00
+-1.8771e-01 +7.2387e-01 0.0000e+00
+-1.6207e-01 +6.8028e-01 0.0000e+00
+-1.3192e-01 +6.3239e-01 0.0000e+00
+-1.0543e-01 +5.9158e-01 0.0000e+00
+-7.0885e-02 +5.5218e-01 0.0000e+00
+-4.4621e-02 +4.9794e-01 0.0000e+00
+-1.4269e-02 +4.5696e-01 0.0000e+00
++1.4817e-02 +4.1591e-01 0.0000e+00
++4.1826e-02 +3.6891e-01 0.0000e+00
++6.6588e-02 +3.2314e-01 0.0000e+00
++9.5334e-02 +2.8592e-01 0.0000e+00
++1.3331e-01 +2.3676e-01 0.0000e+00
++1.5248e-01 +1.9469e-01 0.0000e+00
++1.8196e-01 +1.5079e-01 0.0000e+00
++2.1478e-01 +1.0790e-01 0.0000e+00
++2.3506e-01 +6.2750e-02 0.0000e+00
++2.6826e-01 +2.1615e-02 0.0000e+00
++2.9619e-01 -2.2899e-02 0.0000e+00
++3.3173e-01 -7.2481e-02 0.0000e+00
++3.5713e-01 -1.1319e-01 0.0000e+00
++3.7968e-01 -1.5797e-01 0.0000e+00
++4.1427e-01 -1.9717e-01 0.0000e+00
++4.4392e-01 -2.4557e-01 0.0000e+00
++4.6610e-01 -2.9261e-01 0.0000e+00
++4.9506e-01 -3.3610e-01 0.0000e+00
++5.3307e-01 -3.7975e-01 0.0000e+00
++5.5443e-01 -4.2315e-01 0.0000e+00
++5.8045e-01 -4.6477e-01 0.0000e+00
+-1.4556e-01 +7.5639e-01 0.0000e+00
+-1.1386e-01 +7.1224e-01 0.0000e+00
+-8.1508e-02 +6.6572e-01 0.0000e+00
+-5.8024e-02 +6.1826e-01 0.0000e+00
+-3.1503e-02 +5.8040e-01 0.0000e+00
+-1.3968e-03 +5.3509e-01 0.0000e+00
++2.6331e-02 +4.9257e-01 0.0000e+00
++5.0631e-02 +4.4479e-01 0.0000e+00
++8.4276e-02 +4.0365e-01 0.0000e+00
++1.1464e-01 +3.5677e-01 0.0000e+00
++1.4234e-01 +3.1723e-01 0.0000e+00
++1.7184e-01 +2.7204e-01 0.0000e+00
++2.0074e-01 +2.2402e-01 0.0000e+00
++2.2795e-01 +1.7317e-01 0.0000e+00
++2.5827e-01 +1.3903e-01 0.0000e+00
++2.8367e-01 +8.5629e-02 0.0000e+00
++3.1051e-01 +4.5270e-02 0.0000e+00
++3.4086e-01 +2.1397e-05 0.0000e+00
++3.6827e-01 -4.6448e-02 0.0000e+00
++3.9972e-01 -8.1632e-02 0.0000e+00
++4.2504e-01 -1.3393e-01 0.0000e+00
++4.5104e-01 -1.7476e-01 0.0000e+00
++4.8323e-01 -2.1326e-01 0.0000e+00
++5.1237e-01 -2.6533e-01 0.0000e+00
++5.3772e-01 -3.0827e-01 0.0000e+00
++5.7305e-01 -3.5318e-01 0.0000e+00
++5.9879e-01 -3.9716e-01 0.0000e+00
++6.2940e-01 -4.4212e-01 0.0000e+00
+-6.9645e-02 +7.4176e-01 0.0000e+00
+-4.1530e-02 +6.9768e-01 0.0000e+00
+-1.4635e-02 +6.4795e-01 0.0000e+00
++1.5396e-02 +6.0334e-01 0.0000e+00
++4.7297e-02 +5.6278e-01 0.0000e+00
++7.3357e-02 +5.1495e-01 0.0000e+00
++1.0042e-01 +4.7570e-01 0.0000e+00
++1.3132e-01 +4.2430e-01 0.0000e+00
++1.5769e-01 +3.8314e-01 0.0000e+00
++1.8998e-01 +3.4438e-01 0.0000e+00
++2.1124e-01 +2.9358e-01 0.0000e+00
++2.4189e-01 +2.5479e-01 0.0000e+00
++2.6581e-01 +2.0933e-01 0.0000e+00
++3.0025e-01 +1.5879e-01 0.0000e+00
++3.3556e-01 +1.1834e-01 0.0000e+00
++3.5949e-01 +8.1924e-02 0.0000e+00
++3.8557e-01 +3.2316e-02 0.0000e+00
++4.0975e-01 -1.0398e-02 0.0000e+00
++4.4578e-01 -5.6624e-02 0.0000e+00
++4.6884e-01 -1.0532e-01 0.0000e+00
++4.9900e-01 -1.4258e-01 0.0000e+00
++5.2729e-01 -1.9165e-01 0.0000e+00
++5.5781e-01 -2.3766e-01 0.0000e+00
++5.8171e-01 -2.7776e-01 0.0000e+00
++6.1781e-01 -3.2234e-01 0.0000e+00
++6.4437e-01 -3.6556e-01 0.0000e+00
++6.6748e-01 -4.0844e-01 0.0000e+00
+-2.5412e-02 +7.6970e-01 0.0000e+00
++2.8523e-03 +7.2415e-01 0.0000e+00
++2.4294e-02 +6.7891e-01 0.0000e+00
++6.2162e-02 +6.3603e-01 0.0000e+00
++8.7632e-02 +5.8340e-01 0.0000e+00
++1.1075e-01 +5.4688e-01 0.0000e+00
++1.4411e-01 +5.0152e-01 0.0000e+00
++1.7530e-01 +4.5683e-01 0.0000e+00
++2.0700e-01 +4.1285e-01 0.0000e+00
++2.3314e-01 +3.7239e-01 0.0000e+00
++2.5868e-01 +3.1945e-01 0.0000e+00
++2.8587e-01 +2.7633e-01 0.0000e+00
++3.1735e-01 +2.3469e-01 0.0000e+00
++3.4676e-01 +1.8952e-01 0.0000e+00
++3.6973e-01 +1.5039e-01 0.0000e+00
++4.0209e-01 +1.0511e-01 0.0000e+00
++4.2948e-01 +5.2735e-02 0.0000e+00
++4.5586e-01 +1.4462e-02 0.0000e+00
++4.8790e-01 -2.3555e-02 0.0000e+00
++5.1986e-01 -7.2153e-02 0.0000e+00
++5.4204e-01 -1.1697e-01 0.0000e+00
++5.7284e-01 -1.6044e-01 0.0000e+00
++6.0111e-01 -2.0569e-01 0.0000e+00
++6.3115e-01 -2.5218e-01 0.0000e+00
++6.6455e-01 -2.9461e-01 0.0000e+00
++6.8815e-01 -3.4074e-01 0.0000e+00
++4.3591e-02 +7.4914e-01 0.0000e+00
++7.4772e-02 +7.0974e-01 0.0000e+00
++1.0696e-01 +6.5813e-01 0.0000e+00
++1.3032e-01 +6.2016e-01 0.0000e+00
++1.6260e-01 +5.7686e-01 0.0000e+00
++1.8930e-01 +5.2816e-01 0.0000e+00
++2.2359e-01 +4.8575e-01 0.0000e+00
++2.4187e-01 +4.4053e-01 0.0000e+00
++2.7276e-01 +3.9476e-01 0.0000e+00
++3.0072e-01 +3.4921e-01 0.0000e+00
++3.3013e-01 +3.0444e-01 0.0000e+00
++3.5966e-01 +2.5819e-01 0.0000e+00
++3.8628e-01 +2.2415e-01 0.0000e+00
++4.1751e-01 +1.7426e-01 0.0000e+00
++4.4446e-01 +1.3442e-01 0.0000e+00
++4.7577e-01 +8.4921e-02 0.0000e+00
++5.0142e-01 +4.6933e-02 0.0000e+00
++5.3140e-01 -8.1957e-04 0.0000e+00
++5.6401e-01 -4.1672e-02 0.0000e+00
++5.8714e-01 -8.3599e-02 0.0000e+00
++6.1490e-01 -1.2839e-01 0.0000e+00
++6.4520e-01 -1.7986e-01 0.0000e+00
++6.6976e-01 -2.1966e-01 0.0000e+00
++7.0098e-01 -2.6650e-01 0.0000e+00
++9.0645e-02 +7.8281e-01 0.0000e+00
++1.2377e-01 +7.3523e-01 0.0000e+00
++1.5101e-01 +6.9339e-01 0.0000e+00
++1.7820e-01 +6.5095e-01 0.0000e+00
++2.1050e-01 +6.0127e-01 0.0000e+00
++2.3069e-01 +5.6017e-01 0.0000e+00
++2.6058e-01 +5.1238e-01 0.0000e+00
++2.8796e-01 +4.7321e-01 0.0000e+00
++3.1407e-01 +4.2761e-01 0.0000e+00
++3.5188e-01 +3.8477e-01 0.0000e+00
++3.7566e-01 +3.3565e-01 0.0000e+00
++4.0709e-01 +2.9008e-01 0.0000e+00
++4.3401e-01 +2.5445e-01 0.0000e+00
++4.5929e-01 +2.0799e-01 0.0000e+00
++4.9309e-01 +1.6529e-01 0.0000e+00
++5.1895e-01 +1.1770e-01 0.0000e+00
++5.4801e-01 +7.6130e-02 0.0000e+00
++5.7397e-01 +2.6409e-02 0.0000e+00
++6.0283e-01 -1.0812e-02 0.0000e+00
++6.3254e-01 -6.2375e-02 0.0000e+00
++6.6054e-01 -1.1051e-01 0.0000e+00
++6.9190e-01 -1.4790e-01 0.0000e+00
++7.1750e-01 -1.8907e-01 0.0000e+00
++7.5046e-01 -2.3584e-01 0.0000e+00
++1.6640e-01 +7.6457e-01 0.0000e+00
++1.9574e-01 +7.1799e-01 0.0000e+00
++2.2319e-01 +6.7595e-01 0.0000e+00
++2.4823e-01 +6.3322e-01 0.0000e+00
++2.7821e-01 +5.8690e-01 0.0000e+00
++3.0156e-01 +5.4348e-01 0.0000e+00
++3.3425e-01 +4.9486e-01 0.0000e+00
++3.6313e-01 +4.4766e-01 0.0000e+00
++3.9702e-01 +4.0977e-01 0.0000e+00
++4.2452e-01 +3.6692e-01 0.0000e+00
++4.5411e-01 +3.1990e-01 0.0000e+00
++4.7579e-01 +2.8168e-01 0.0000e+00
++5.0599e-01 +2.3082e-01 0.0000e+00
++5.3747e-01 +1.8629e-01 0.0000e+00
++5.6436e-01 +1.5181e-01 0.0000e+00
++5.9044e-01 +1.0479e-01 0.0000e+00
++6.2613e-01 +5.5387e-02 0.0000e+00
++6.5414e-01 +1.1799e-02 0.0000e+00
++6.7685e-01 -2.6000e-02 0.0000e+00
++7.0311e-01 -7.9890e-02 0.0000e+00
++7.3286e-01 -1.2441e-01 0.0000e+00
++7.6428e-01 -1.6103e-01 0.0000e+00
++2.4253e-01 +7.4740e-01 0.0000e+00
++2.6301e-01 +7.0782e-01 0.0000e+00
++2.9105e-01 +6.6249e-01 0.0000e+00
++3.2422e-01 +6.1758e-01 0.0000e+00
++3.4831e-01 +5.7033e-01 0.0000e+00
++3.8479e-01 +5.2732e-01 0.0000e+00
++4.1455e-01 +4.8100e-01 0.0000e+00
++4.3716e-01 +4.4311e-01 0.0000e+00
++4.6189e-01 +3.8958e-01 0.0000e+00
++4.9551e-01 +3.4899e-01 0.0000e+00
++5.2327e-01 +3.0834e-01 0.0000e+00
++5.4903e-01 +2.5678e-01 0.0000e+00
++5.7875e-01 +2.1740e-01 0.0000e+00
++6.0729e-01 +1.7895e-01 0.0000e+00
++6.3586e-01 +1.2818e-01 0.0000e+00
++6.6598e-01 +8.1761e-02 0.0000e+00
++6.9485e-01 +4.7596e-02 0.0000e+00
++7.1847e-01 -3.9715e-03 0.0000e+00
++7.4734e-01 -5.2077e-02 0.0000e+00
++7.8248e-01 -9.4133e-02 0.0000e+00
++3.3403e-01 +6.8786e-01 0.0000e+00
++3.6893e-01 +6.4588e-01 0.0000e+00
++3.9466e-01 +6.0183e-01 0.0000e+00
++4.2047e-01 +5.5769e-01 0.0000e+00
++4.4829e-01 +5.1427e-01 0.0000e+00
++4.8028e-01 +4.6653e-01 0.0000e+00
++5.0176e-01 +4.2418e-01 0.0000e+00
++5.3807e-01 +3.7357e-01 0.0000e+00
++5.6717e-01 +3.3228e-01 0.0000e+00
++5.9294e-01 +2.8483e-01 0.0000e+00
++6.2669e-01 +2.4597e-01 0.0000e+00
++6.5274e-01 +2.0832e-01 0.0000e+00
++6.8116e-01 +1.5816e-01 0.0000e+00
++7.1339e-01 +1.1345e-01 0.0000e+00
++7.4167e-01 +6.7584e-02 0.0000e+00
++7.6353e-01 +2.6313e-02 0.0000e+00
++4.4221e-01 +6.2756e-01 0.0000e+00
++4.6471e-01 +5.8274e-01 0.0000e+00
++4.9511e-01 +5.3698e-01 0.0000e+00
++5.2112e-01 +4.9159e-01 0.0000e+00
++5.5121e-01 +4.5315e-01 0.0000e+00
++5.8596e-01 +4.0536e-01 0.0000e+00
++6.0713e-01 +3.6430e-01 0.0000e+00
++6.4497e-01 +3.1750e-01 0.0000e+00
++6.7108e-01 +2.7585e-01 0.0000e+00
++6.9153e-01 +2.3255e-01 0.0000e+00
++7.2922e-01 +1.8589e-01 0.0000e+00
++7.5526e-01 +1.4253e-01 0.0000e+00
++5.3879e-01 +5.6926e-01 0.0000e+00
++5.7118e-01 +5.2627e-01 0.0000e+00
++5.9945e-01 +4.7958e-01 0.0000e+00
++6.2364e-01 +4.4034e-01 0.0000e+00
++6.5277e-01 +3.9138e-01 0.0000e+00
++6.8138e-01 +3.4225e-01 0.0000e+00
++7.1075e-01 +3.0126e-01 0.0000e+00
++7.3869e-01 +2.5813e-01 0.0000e+00
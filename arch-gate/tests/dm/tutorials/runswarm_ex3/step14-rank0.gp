@@ -0,0 +1,711 @@
+-7.9783e-01 +5.2072e-02 0.0000e+00
+-7.8490e-01 -7.7695e-03 0.0000e+00
+-7.8195e-01 -6.0827e-02 0.0000e+00
+-7.6850e-01 -1.1160e-01 0.0000e+00
+-7.6541e-01 -1.5752e-01 0.0000e+00
+-7.5295e-01 -2.2036e-01 0.0000e+00
+-7.4564e-01 -2.7180e-01 0.0000e+00
+-7.3043e-01 -3.2385e-01 0.0000e+00
+-7.7431e-01 +2.1630e-01 0.0000e+00
+-7.6821e-01 +1.6059e-01 0.0000e+00
+-7.5848e-01 +1.0638e-01 0.0000e+00
+-7.4851e-01 +5.4424e-02 0.0000e+00
+-7.3754e-01 +4.1146e-03 0.0000e+00
+-7.3181e-01 -4.4609e-02 0.0000e+00
+-7.2245e-01 -9.9666e-02 0.0000e+00
+-7.0845e-01 -1.4897e-01 0.0000e+00
+-6.9580e-01 -2.0868e-01 0.0000e+00
+-6.8749e-01 -2.5358e-01 0.0000e+00
+-6.8123e-01 -3.1216e-01 0.0000e+00
+-6.7099e-01 -3.6933e-01 0.0000e+00
+-6.5889e-01 -4.1723e-01 0.0000e+00
+-7.3604e-01 +2.8258e-01 0.0000e+00
+-7.2502e-01 +2.2127e-01 0.0000e+00
+-7.0813e-01 +1.7674e-01 0.0000e+00
+-7.0557e-01 +1.2077e-01 0.0000e+00
+-6.9476e-01 +7.0324e-02 0.0000e+00
+-6.8199e-01 +1.2609e-02 0.0000e+00
+-6.7303e-01 -4.2159e-02 0.0000e+00
+-6.6867e-01 -8.9997e-02 0.0000e+00
+-6.5718e-01 -1.4468e-01 0.0000e+00
+-6.4258e-01 -1.9905e-01 0.0000e+00
+-6.3762e-01 -2.5147e-01 0.0000e+00
+-6.2912e-01 -3.0316e-01 0.0000e+00
+-6.1672e-01 -3.5315e-01 0.0000e+00
+-6.1058e-01 -4.0809e-01 0.0000e+00
+-5.9362e-01 -4.6012e-01 0.0000e+00
+-5.9083e-01 -5.1337e-01 0.0000e+00
+-6.9923e-01 +3.9062e-01 0.0000e+00
+-6.8908e-01 +3.3781e-01 0.0000e+00
+-6.7936e-01 +2.9172e-01 0.0000e+00
+-6.6282e-01 +2.3557e-01 0.0000e+00
+-6.5487e-01 +1.8416e-01 0.0000e+00
+-6.4878e-01 +1.3138e-01 0.0000e+00
+-6.4065e-01 +8.0050e-02 0.0000e+00
+-6.3365e-01 +2.3451e-02 0.0000e+00
+-6.2330e-01 -2.7968e-02 0.0000e+00
+-6.0734e-01 -7.9025e-02 0.0000e+00
+-6.0096e-01 -1.3526e-01 0.0000e+00
+-5.8877e-01 -1.8121e-01 0.0000e+00
+-5.8154e-01 -2.3933e-01 0.0000e+00
+-5.7220e-01 -2.8780e-01 0.0000e+00
+-5.6116e-01 -3.4519e-01 0.0000e+00
+-5.6059e-01 -3.9987e-01 0.0000e+00
+-5.4729e-01 -4.5496e-01 0.0000e+00
+-5.3208e-01 -5.0672e-01 0.0000e+00
+-5.2946e-01 -5.5383e-01 0.0000e+00
+-5.2079e-01 -6.0678e-01 0.0000e+00
+-6.4848e-01 +4.5591e-01 0.0000e+00
+-6.4554e-01 +4.0115e-01 0.0000e+00
+-6.2876e-01 +3.5108e-01 0.0000e+00
+-6.2076e-01 +3.0082e-01 0.0000e+00
+-6.1130e-01 +2.4409e-01 0.0000e+00
+-6.0953e-01 +1.9033e-01 0.0000e+00
+-5.9888e-01 +1.3381e-01 0.0000e+00
+-5.8870e-01 +8.8085e-02 0.0000e+00
+-5.8292e-01 +3.3953e-02 0.0000e+00
+-5.6490e-01 -1.3600e-02 0.0000e+00
+-5.5866e-01 -7.5392e-02 0.0000e+00
+-5.5308e-01 -1.3015e-01 0.0000e+00
+-5.4340e-01 -1.8091e-01 0.0000e+00
+-5.3316e-01 -2.3249e-01 0.0000e+00
+-5.2063e-01 -2.8817e-01 0.0000e+00
+-5.1125e-01 -3.3900e-01 0.0000e+00
+-5.0368e-01 -3.9210e-01 0.0000e+00
+-4.9524e-01 -4.3939e-01 0.0000e+00
+-4.8581e-01 -4.9425e-01 0.0000e+00
+-4.7670e-01 -5.4373e-01 0.0000e+00
+-4.6572e-01 -6.0356e-01 0.0000e+00
+-4.5933e-01 -6.5505e-01 0.0000e+00
+-6.0896e-01 +5.1962e-01 0.0000e+00
+-5.9736e-01 +4.7051e-01 0.0000e+00
+-5.9432e-01 +4.1306e-01 0.0000e+00
+-5.8042e-01 +3.5636e-01 0.0000e+00
+-5.6750e-01 +3.0289e-01 0.0000e+00
+-5.6199e-01 +2.4976e-01 0.0000e+00
+-5.5627e-01 +2.0531e-01 0.0000e+00
+-5.4730e-01 +1.4551e-01 0.0000e+00
+-5.3907e-01 +9.6797e-02 0.0000e+00
+-5.2030e-01 +4.0178e-02 0.0000e+00
+-5.1813e-01 -1.1763e-02 0.0000e+00
+-5.0483e-01 -6.4831e-02 0.0000e+00
+-5.0193e-01 -1.1596e-01 0.0000e+00
+-4.8463e-01 -1.6879e-01 0.0000e+00
+-4.8260e-01 -2.2269e-01 0.0000e+00
+-4.6953e-01 -2.7440e-01 0.0000e+00
+-4.6004e-01 -3.2403e-01 0.0000e+00
+-4.4872e-01 -3.7639e-01 0.0000e+00
+-4.4430e-01 -4.3604e-01 0.0000e+00
+-4.3503e-01 -4.8751e-01 0.0000e+00
+-4.1652e-01 -5.4114e-01 0.0000e+00
+-4.1183e-01 -5.8487e-01 0.0000e+00
+-3.9848e-01 -6.4627e-01 0.0000e+00
+-3.9247e-01 -6.9933e-01 0.0000e+00
+-5.6096e-01 +5.2823e-01 0.0000e+00
+-5.4630e-01 +4.7834e-01 0.0000e+00
+-5.3791e-01 +4.2263e-01 0.0000e+00
+-5.3130e-01 +3.6497e-01 0.0000e+00
+-5.1568e-01 +3.2103e-01 0.0000e+00
+-5.0773e-01 +2.6279e-01 0.0000e+00
+-4.9658e-01 +2.1438e-01 0.0000e+00
+-4.8629e-01 +1.5575e-01 0.0000e+00
+-4.7755e-01 +1.0611e-01 0.0000e+00
+-4.7637e-01 +5.6912e-02 0.0000e+00
+-4.6751e-01 +4.1154e-04 0.0000e+00
+-4.5400e-01 -5.7138e-02 0.0000e+00
+-4.4645e-01 -1.0648e-01 0.0000e+00
+-4.3492e-01 -1.6300e-01 0.0000e+00
+-4.2144e-01 -2.0551e-01 0.0000e+00
+-4.1368e-01 -2.6012e-01 0.0000e+00
+-4.0733e-01 -3.1637e-01 0.0000e+00
+-4.0274e-01 -3.6678e-01 0.0000e+00
+-3.8520e-01 -4.1934e-01 0.0000e+00
+-3.7460e-01 -4.7832e-01 0.0000e+00
+-3.6822e-01 -5.2383e-01 0.0000e+00
+-3.5884e-01 -5.8552e-01 0.0000e+00
+-3.5620e-01 -6.3152e-01 0.0000e+00
+-3.4080e-01 -6.8219e-01 0.0000e+00
+-5.1471e-01 +5.9055e-01 0.0000e+00
+-5.0520e-01 +5.3671e-01 0.0000e+00
+-4.9027e-01 +4.8288e-01 0.0000e+00
+-4.8361e-01 +4.3429e-01 0.0000e+00
+-4.7676e-01 +3.8345e-01 0.0000e+00
+-4.6865e-01 +3.2672e-01 0.0000e+00
+-4.5854e-01 +2.6794e-01 0.0000e+00
+-4.4866e-01 +2.2415e-01 0.0000e+00
+-4.3559e-01 +1.6755e-01 0.0000e+00
+-4.2989e-01 +1.1279e-01 0.0000e+00
+-4.1937e-01 +6.0556e-02 0.0000e+00
+-4.0688e-01 +9.4003e-03 0.0000e+00
+-3.9761e-01 -4.2767e-02 0.0000e+00
+-3.9666e-01 -9.2219e-02 0.0000e+00
+-3.7848e-01 -1.4937e-01 0.0000e+00
+-3.7199e-01 -1.9862e-01 0.0000e+00
+-3.5859e-01 -2.5310e-01 0.0000e+00
+-3.5896e-01 -3.0437e-01 0.0000e+00
+-3.4407e-01 -3.5751e-01 0.0000e+00
+-3.2986e-01 -4.1487e-01 0.0000e+00
+-3.2645e-01 -4.6813e-01 0.0000e+00
+-3.2026e-01 -5.1678e-01 0.0000e+00
+-3.1234e-01 -5.7058e-01 0.0000e+00
+-2.9424e-01 -6.2166e-01 0.0000e+00
+-2.9295e-01 -6.7402e-01 0.0000e+00
+-2.7646e-01 -7.3317e-01 0.0000e+00
+-4.7200e-01 +6.4591e-01 0.0000e+00
+-4.5676e-01 +5.9548e-01 0.0000e+00
+-4.4790e-01 +5.4186e-01 0.0000e+00
+-4.4553e-01 +4.8943e-01 0.0000e+00
+-4.2790e-01 +4.4089e-01 0.0000e+00
+-4.2085e-01 +3.9292e-01 0.0000e+00
+-4.1426e-01 +3.3224e-01 0.0000e+00
+-3.9968e-01 +2.8638e-01 0.0000e+00
+-3.9241e-01 +2.3494e-01 0.0000e+00
+-3.8837e-01 +1.7303e-01 0.0000e+00
+-3.8025e-01 +1.1894e-01 0.0000e+00
+-3.6257e-01 +7.4890e-02 0.0000e+00
+-3.5933e-01 +1.7330e-02 0.0000e+00
+-3.4714e-01 -3.4943e-02 0.0000e+00
+-3.3262e-01 -9.0188e-02 0.0000e+00
+-3.2528e-01 -1.3616e-01 0.0000e+00
+-3.1551e-01 -1.8969e-01 0.0000e+00
+-3.0971e-01 -2.4532e-01 0.0000e+00
+-3.0375e-01 -3.0145e-01 0.0000e+00
+-2.9566e-01 -3.5113e-01 0.0000e+00
+-2.8442e-01 -4.0410e-01 0.0000e+00
+-2.6956e-01 -4.5774e-01 0.0000e+00
+-2.6492e-01 -5.0884e-01 0.0000e+00
+-2.5888e-01 -5.6259e-01 0.0000e+00
+-2.4661e-01 -6.1488e-01 0.0000e+00
+-2.3569e-01 -6.6586e-01 0.0000e+00
+-2.2538e-01 -7.2425e-01 0.0000e+00
+-4.1060e-01 +6.5715e-01 0.0000e+00
+-4.1235e-01 +6.0841e-01 0.0000e+00
+-4.0209e-01 +5.5888e-01 0.0000e+00
+-3.9291e-01 +5.0695e-01 0.0000e+00
+-3.8370e-01 +4.4792e-01 0.0000e+00
+-3.7318e-01 +3.9695e-01 0.0000e+00
+-3.6429e-01 +3.3932e-01 0.0000e+00
+-3.4725e-01 +2.9565e-01 0.0000e+00
+-3.4441e-01 +2.3608e-01 0.0000e+00
+-3.3223e-01 +1.8391e-01 0.0000e+00
+-3.2466e-01 +1.3802e-01 0.0000e+00
+-3.1441e-01 +8.0191e-02 0.0000e+00
+-3.0349e-01 +3.1790e-02 0.0000e+00
+-2.9307e-01 -2.1154e-02 0.0000e+00
+-2.8404e-01 -8.0605e-02 0.0000e+00
+-2.7539e-01 -1.3068e-01 0.0000e+00
+-2.6328e-01 -1.8070e-01 0.0000e+00
+-2.5210e-01 -2.3957e-01 0.0000e+00
+-2.4763e-01 -2.9036e-01 0.0000e+00
+-2.3878e-01 -3.4085e-01 0.0000e+00
+-2.3076e-01 -3.8993e-01 0.0000e+00
+-2.2051e-01 -4.4575e-01 0.0000e+00
+-2.1143e-01 -5.0033e-01 0.0000e+00
+-1.9572e-01 -5.5708e-01 0.0000e+00
+-1.9337e-01 -6.0843e-01 0.0000e+00
+-1.8078e-01 -6.5743e-01 0.0000e+00
+-1.7473e-01 -7.1465e-01 0.0000e+00
+-1.6338e-01 -7.6404e-01 0.0000e+00
+-3.6594e-01 +6.6980e-01 0.0000e+00
+-3.5441e-01 +6.2204e-01 0.0000e+00
+-3.4534e-01 +5.6374e-01 0.0000e+00
+-3.3978e-01 +5.0996e-01 0.0000e+00
+-3.2259e-01 +4.5487e-01 0.0000e+00
+-3.1569e-01 +4.0785e-01 0.0000e+00
+-3.1331e-01 +3.5650e-01 0.0000e+00
+-3.0156e-01 +2.9970e-01 0.0000e+00
+-2.8505e-01 +2.4817e-01 0.0000e+00
+-2.8049e-01 +1.9276e-01 0.0000e+00
+-2.7341e-01 +1.4539e-01 0.0000e+00
+-2.6560e-01 +8.6269e-02 0.0000e+00
+-2.4675e-01 +3.2673e-02 0.0000e+00
+-2.4302e-01 -1.1085e-02 0.0000e+00
+-2.2831e-01 -7.1511e-02 0.0000e+00
+-2.2723e-01 -1.2488e-01 0.0000e+00
+-2.1379e-01 -1.7003e-01 0.0000e+00
+-2.0975e-01 -2.2755e-01 0.0000e+00
+-1.9531e-01 -2.8087e-01 0.0000e+00
+-1.8935e-01 -3.3481e-01 0.0000e+00
+-1.7298e-01 -3.7966e-01 0.0000e+00
+-1.7259e-01 -4.3747e-01 0.0000e+00
+-1.5556e-01 -4.9546e-01 0.0000e+00
+-1.5297e-01 -5.4128e-01 0.0000e+00
+-1.3477e-01 -5.9586e-01 0.0000e+00
+-1.2484e-01 -6.5169e-01 0.0000e+00
+-1.2187e-01 -6.9941e-01 0.0000e+00
+-1.0975e-01 -7.5589e-01 0.0000e+00
+-3.2008e-01 +7.3723e-01 0.0000e+00
+-3.1030e-01 +6.7713e-01 0.0000e+00
+-2.9788e-01 +6.3158e-01 0.0000e+00
+-2.8813e-01 +5.7076e-01 0.0000e+00
+-2.8222e-01 +5.2372e-01 0.0000e+00
+-2.6794e-01 +4.6661e-01 0.0000e+00
+-2.6175e-01 +4.1912e-01 0.0000e+00
+-2.5997e-01 +3.6169e-01 0.0000e+00
+-2.4763e-01 +3.0810e-01 0.0000e+00
+-2.3522e-01 +2.5475e-01 0.0000e+00
+-2.2734e-01 +2.0266e-01 0.0000e+00
+-2.1857e-01 +1.5358e-01 0.0000e+00
+-2.0875e-01 +9.9929e-02 0.0000e+00
+-1.9975e-01 +4.9789e-02 0.0000e+00
+-1.8609e-01 -1.1058e-02 0.0000e+00
+-1.8524e-01 -5.6465e-02 0.0000e+00
+-1.7568e-01 -1.1260e-01 0.0000e+00
+-1.6064e-01 -1.6500e-01 0.0000e+00
+-1.5532e-01 -2.2044e-01 0.0000e+00
+-1.4225e-01 -2.6779e-01 0.0000e+00
+-1.3540e-01 -3.2616e-01 0.0000e+00
+-1.2457e-01 -3.7201e-01 0.0000e+00
+-1.1687e-01 -4.2875e-01 0.0000e+00
+-1.0271e-01 -4.8464e-01 0.0000e+00
+-9.3525e-02 -5.3273e-01 0.0000e+00
+-9.0359e-02 -5.8894e-01 0.0000e+00
+-7.7544e-02 -6.3762e-01 0.0000e+00
+-6.7311e-02 -6.9321e-01 0.0000e+00
+-6.1561e-02 -7.4679e-01 0.0000e+00
+-5.2194e-02 -7.9641e-01 0.0000e+00
+-2.6431e-01 +7.4302e-01 0.0000e+00
+-2.5654e-01 +6.9081e-01 0.0000e+00
+-2.4997e-01 +6.3752e-01 0.0000e+00
+-2.3884e-01 +5.8791e-01 0.0000e+00
+-2.3205e-01 +5.3343e-01 0.0000e+00
+-2.1505e-01 +4.7524e-01 0.0000e+00
+-2.1279e-01 +4.2156e-01 0.0000e+00
+-1.9966e-01 +3.7530e-01 0.0000e+00
+-1.9203e-01 +3.2486e-01 0.0000e+00
+-1.8294e-01 +2.6344e-01 0.0000e+00
+-1.7625e-01 +2.1165e-01 0.0000e+00
+-1.6688e-01 +1.6177e-01 0.0000e+00
+-1.5600e-01 +1.1209e-01 0.0000e+00
+-1.4026e-01 +5.2755e-02 0.0000e+00
+-1.3363e-01 +3.4780e-03 0.0000e+00
+-1.2309e-01 -5.3309e-02 0.0000e+00
+-1.1916e-01 -1.0023e-01 0.0000e+00
+-1.1294e-01 -1.5394e-01 0.0000e+00
+-1.0055e-01 -2.0818e-01 0.0000e+00
+-9.0245e-02 -2.6220e-01 0.0000e+00
+-8.4748e-02 -3.1089e-01 0.0000e+00
+-7.3228e-02 -3.6793e-01 0.0000e+00
+-6.6761e-02 -4.2053e-01 0.0000e+00
+-5.1936e-02 -4.7390e-01 0.0000e+00
+-4.7931e-02 -5.2049e-01 0.0000e+00
+-2.9817e-02 -5.7149e-01 0.0000e+00
+-2.6770e-02 -6.3057e-01 0.0000e+00
+-1.8495e-02 -6.8123e-01 0.0000e+00
+-6.6408e-03 -7.3865e-01 0.0000e+00
++8.1679e-03 -7.8918e-01 0.0000e+00
+-2.1828e-01 +7.4617e-01 0.0000e+00
+-2.0423e-01 +6.9398e-01 0.0000e+00
+-1.9092e-01 +6.4666e-01 0.0000e+00
+-1.9255e-01 +5.9685e-01 0.0000e+00
+-1.7915e-01 +5.4433e-01 0.0000e+00
+-1.6463e-01 +4.9293e-01 0.0000e+00
+-1.5976e-01 +4.3560e-01 0.0000e+00
+-1.4635e-01 +3.7744e-01 0.0000e+00
+-1.3670e-01 +3.2998e-01 0.0000e+00
+-1.2949e-01 +2.7351e-01 0.0000e+00
+-1.1686e-01 +2.2573e-01 0.0000e+00
+-1.0890e-01 +1.6904e-01 0.0000e+00
+-1.0831e-01 +1.2018e-01 0.0000e+00
+-9.1034e-02 +6.4253e-02 0.0000e+00
+-8.3309e-02 +9.7294e-03 0.0000e+00
+-7.2147e-02 -4.1454e-02 0.0000e+00
+-6.6805e-02 -9.2372e-02 0.0000e+00
+-5.5478e-02 -1.4837e-01 0.0000e+00
+-4.6533e-02 -2.0297e-01 0.0000e+00
+-3.3275e-02 -2.5477e-01 0.0000e+00
+-2.7454e-02 -3.0317e-01 0.0000e+00
+-1.2737e-02 -3.6095e-01 0.0000e+00
+-1.2747e-02 -4.1421e-01 0.0000e+00
+-3.4582e-03 -4.6423e-01 0.0000e+00
++1.2932e-02 -5.1172e-01 0.0000e+00
++1.5090e-02 -5.6620e-01 0.0000e+00
++2.5206e-02 -6.1694e-01 0.0000e+00
++3.5255e-02 -6.6933e-01 0.0000e+00
++4.3681e-02 -7.2704e-01 0.0000e+00
++6.1248e-02 -7.7718e-01 0.0000e+00
+-1.6150e-01 +7.6238e-01 0.0000e+00
+-1.5487e-01 +7.1004e-01 0.0000e+00
+-1.4099e-01 +6.5884e-01 0.0000e+00
+-1.3133e-01 +6.0725e-01 0.0000e+00
+-1.2529e-01 +5.4754e-01 0.0000e+00
+-1.1159e-01 +4.9768e-01 0.0000e+00
+-1.0479e-01 +4.4035e-01 0.0000e+00
+-9.3185e-02 +3.9246e-01 0.0000e+00
+-9.0728e-02 +3.3957e-01 0.0000e+00
+-7.3348e-02 +2.8699e-01 0.0000e+00
+-6.9140e-02 +2.3039e-01 0.0000e+00
+-6.2509e-02 +1.8455e-01 0.0000e+00
+-4.4653e-02 +1.2399e-01 0.0000e+00
+-3.4719e-02 +7.2363e-02 0.0000e+00
+-3.4564e-02 +1.8075e-02 0.0000e+00
+-2.5742e-02 -2.8473e-02 0.0000e+00
+-1.3880e-02 -8.6945e-02 0.0000e+00
+-6.2963e-03 -1.3388e-01 0.0000e+00
++2.8727e-03 -1.9339e-01 0.0000e+00
++1.7205e-02 -2.4501e-01 0.0000e+00
++2.5314e-02 -2.9865e-01 0.0000e+00
++3.8515e-02 -3.4423e-01 0.0000e+00
++4.0781e-02 -4.0270e-01 0.0000e+00
++5.6456e-02 -4.5179e-01 0.0000e+00
++6.4395e-02 -5.1062e-01 0.0000e+00
++7.2907e-02 -5.5433e-01 0.0000e+00
++8.2640e-02 -6.0942e-01 0.0000e+00
++8.9678e-02 -6.6811e-01 0.0000e+00
++9.9883e-02 -7.1661e-01 0.0000e+00
++1.0766e-01 -7.6598e-01 0.0000e+00
+-1.0806e-01 +7.6590e-01 0.0000e+00
+-9.5369e-02 +7.1847e-01 0.0000e+00
+-8.9853e-02 +6.6251e-01 0.0000e+00
+-7.9578e-02 +6.1521e-01 0.0000e+00
+-6.9551e-02 +5.5907e-01 0.0000e+00
+-6.4280e-02 +5.0244e-01 0.0000e+00
+-5.4650e-02 +4.5142e-01 0.0000e+00
+-4.9097e-02 +4.0032e-01 0.0000e+00
+-3.7337e-02 +3.4515e-01 0.0000e+00
+-2.7514e-02 +2.9657e-01 0.0000e+00
+-1.8658e-02 +2.4167e-01 0.0000e+00
+-3.9098e-03 +1.8977e-01 0.0000e+00
++6.3014e-03 +1.4034e-01 0.0000e+00
++1.0566e-02 +7.9605e-02 0.0000e+00
++2.4500e-02 +3.2800e-02 0.0000e+00
++2.8594e-02 -2.6775e-02 0.0000e+00
++4.3229e-02 -6.9999e-02 0.0000e+00
++5.2849e-02 -1.2762e-01 0.0000e+00
++5.3831e-02 -1.7854e-01 0.0000e+00
++6.6266e-02 -2.3619e-01 0.0000e+00
++7.7959e-02 -2.9015e-01 0.0000e+00
++8.7059e-02 -3.3517e-01 0.0000e+00
++9.3398e-02 -3.8866e-01 0.0000e+00
++1.0958e-01 -4.4805e-01 0.0000e+00
++1.1923e-01 -4.9453e-01 0.0000e+00
++1.2692e-01 -5.4885e-01 0.0000e+00
++1.3941e-01 -6.0335e-01 0.0000e+00
++1.3960e-01 -6.5405e-01 0.0000e+00
++1.5553e-01 -7.1237e-01 0.0000e+00
++1.5878e-01 -7.6035e-01 0.0000e+00
+-5.5902e-02 +7.7633e-01 0.0000e+00
+-4.7286e-02 +7.3116e-01 0.0000e+00
+-3.2585e-02 +6.7487e-01 0.0000e+00
+-2.9407e-02 +6.1674e-01 0.0000e+00
+-1.4721e-02 +5.6933e-01 0.0000e+00
+-1.1769e-02 +5.1465e-01 0.0000e+00
+-3.1131e-03 +4.6283e-01 0.0000e+00
++8.4407e-03 +4.0497e-01 0.0000e+00
++2.2925e-02 +3.6146e-01 0.0000e+00
++2.3043e-02 +3.0097e-01 0.0000e+00
++3.2769e-02 +2.5531e-01 0.0000e+00
++4.5853e-02 +1.9672e-01 0.0000e+00
++5.8826e-02 +1.4899e-01 0.0000e+00
++6.1988e-02 +9.3000e-02 0.0000e+00
++7.8658e-02 +4.0782e-02 0.0000e+00
++8.3308e-02 -9.2536e-03 0.0000e+00
++9.4344e-02 -7.0252e-02 0.0000e+00
++1.0106e-01 -1.1962e-01 0.0000e+00
++1.1671e-01 -1.7308e-01 0.0000e+00
++1.2406e-01 -2.2181e-01 0.0000e+00
++1.2669e-01 -2.7618e-01 0.0000e+00
++1.3799e-01 -3.2577e-01 0.0000e+00
++1.5052e-01 -3.8132e-01 0.0000e+00
++1.5349e-01 -4.3548e-01 0.0000e+00
++1.7230e-01 -4.8687e-01 0.0000e+00
++1.7653e-01 -5.3715e-01 0.0000e+00
++1.8411e-01 -5.9282e-01 0.0000e+00
++2.0118e-01 -6.4407e-01 0.0000e+00
++2.0565e-01 -7.0049e-01 0.0000e+00
++2.0980e-01 -7.5101e-01 0.0000e+00
+-4.7852e-03 +7.8926e-01 0.0000e+00
++4.7759e-03 +7.3756e-01 0.0000e+00
++1.5613e-02 +6.8588e-01 0.0000e+00
++2.9278e-02 +6.3014e-01 0.0000e+00
++3.0936e-02 +5.8106e-01 0.0000e+00
++3.7679e-02 +5.2804e-01 0.0000e+00
++4.8787e-02 +4.7147e-01 0.0000e+00
++6.0130e-02 +4.2154e-01 0.0000e+00
++6.6689e-02 +3.6149e-01 0.0000e+00
++8.4957e-02 +3.1123e-01 0.0000e+00
++8.4723e-02 +2.6543e-01 0.0000e+00
++9.5158e-02 +2.1161e-01 0.0000e+00
++1.0476e-01 +1.5947e-01 0.0000e+00
++1.2223e-01 +1.0339e-01 0.0000e+00
++1.2612e-01 +4.7138e-02 0.0000e+00
++1.3664e-01 -7.5999e-03 0.0000e+00
++1.4357e-01 -5.3545e-02 0.0000e+00
++1.5571e-01 -1.1020e-01 0.0000e+00
++1.6571e-01 -1.5880e-01 0.0000e+00
++1.7084e-01 -2.1315e-01 0.0000e+00
++1.8296e-01 -2.7124e-01 0.0000e+00
++1.9237e-01 -3.2044e-01 0.0000e+00
++2.0386e-01 -3.6880e-01 0.0000e+00
++2.0734e-01 -4.2497e-01 0.0000e+00
++2.1965e-01 -4.7758e-01 0.0000e+00
++2.2566e-01 -5.2744e-01 0.0000e+00
++2.4042e-01 -5.8670e-01 0.0000e+00
++2.4974e-01 -6.4055e-01 0.0000e+00
++2.5910e-01 -6.9319e-01 0.0000e+00
++2.6447e-01 -7.4722e-01 0.0000e+00
++5.4085e-02 +7.9419e-01 0.0000e+00
++5.4803e-02 +7.4509e-01 0.0000e+00
++6.4886e-02 +6.9530e-01 0.0000e+00
++7.6237e-02 +6.4027e-01 0.0000e+00
++8.8407e-02 +5.8555e-01 0.0000e+00
++9.3284e-02 +5.3757e-01 0.0000e+00
++1.0994e-01 +4.8459e-01 0.0000e+00
++1.1003e-01 +4.3079e-01 0.0000e+00
++1.1970e-01 +3.7322e-01 0.0000e+00
++1.3060e-01 +3.2746e-01 0.0000e+00
++1.4061e-01 +2.6711e-01 0.0000e+00
++1.4804e-01 +2.2049e-01 0.0000e+00
++1.5688e-01 +1.6796e-01 0.0000e+00
++1.6825e-01 +1.0973e-01 0.0000e+00
++1.8099e-01 +5.4007e-02 0.0000e+00
++1.9415e-01 +3.1019e-03 0.0000e+00
++1.9914e-01 -4.8966e-02 0.0000e+00
++2.0596e-01 -9.5741e-02 0.0000e+00
++2.1512e-01 -1.4935e-01 0.0000e+00
++2.2587e-01 -1.9994e-01 0.0000e+00
++2.3549e-01 -2.5876e-01 0.0000e+00
++2.4974e-01 -3.0910e-01 0.0000e+00
++2.5962e-01 -3.6108e-01 0.0000e+00
++2.6251e-01 -4.1331e-01 0.0000e+00
++2.7672e-01 -4.6490e-01 0.0000e+00
++2.7935e-01 -5.1939e-01 0.0000e+00
++2.9670e-01 -5.7450e-01 0.0000e+00
++2.9841e-01 -6.2907e-01 0.0000e+00
++3.0894e-01 -6.8155e-01 0.0000e+00
++3.2431e-01 -7.2905e-01 0.0000e+00
++1.1018e-01 +7.5484e-01 0.0000e+00
++1.1703e-01 +7.0371e-01 0.0000e+00
++1.2641e-01 +6.4675e-01 0.0000e+00
++1.3515e-01 +5.9789e-01 0.0000e+00
++1.5202e-01 +5.4718e-01 0.0000e+00
++1.5524e-01 +4.8578e-01 0.0000e+00
++1.6754e-01 +4.3524e-01 0.0000e+00
++1.7863e-01 +3.8513e-01 0.0000e+00
++1.8541e-01 +3.3025e-01 0.0000e+00
++1.9056e-01 +2.7741e-01 0.0000e+00
++2.0285e-01 +2.3104e-01 0.0000e+00
++2.1908e-01 +1.6979e-01 0.0000e+00
++2.2045e-01 +1.2265e-01 0.0000e+00
++2.3078e-01 +6.9702e-02 0.0000e+00
++2.4464e-01 +1.6380e-02 0.0000e+00
++2.4583e-01 -3.4093e-02 0.0000e+00
++2.6075e-01 -8.5911e-02 0.0000e+00
++2.6938e-01 -1.3882e-01 0.0000e+00
++2.8316e-01 -1.9950e-01 0.0000e+00
++2.9092e-01 -2.4784e-01 0.0000e+00
++2.9438e-01 -2.9886e-01 0.0000e+00
++3.1138e-01 -3.4942e-01 0.0000e+00
++3.2008e-01 -4.0665e-01 0.0000e+00
++3.2231e-01 -4.5966e-01 0.0000e+00
++3.3231e-01 -5.1201e-01 0.0000e+00
++3.5076e-01 -5.6810e-01 0.0000e+00
++3.5365e-01 -6.1735e-01 0.0000e+00
++3.6163e-01 -6.6679e-01 0.0000e+00
++1.6269e-01 +7.6873e-01 0.0000e+00
++1.7501e-01 +7.1467e-01 0.0000e+00
++1.8700e-01 +6.5812e-01 0.0000e+00
++1.9028e-01 +6.0421e-01 0.0000e+00
++2.0022e-01 +5.5811e-01 0.0000e+00
++2.1058e-01 +5.0359e-01 0.0000e+00
++2.1981e-01 +4.5264e-01 0.0000e+00
++2.2373e-01 +3.9809e-01 0.0000e+00
++2.3907e-01 +3.4610e-01 0.0000e+00
++2.4906e-01 +2.9000e-01 0.0000e+00
++2.5944e-01 +2.4186e-01 0.0000e+00
++2.6928e-01 +1.8770e-01 0.0000e+00
++2.7742e-01 +1.3111e-01 0.0000e+00
++2.8287e-01 +7.2528e-02 0.0000e+00
++2.9785e-01 +2.8429e-02 0.0000e+00
++3.0059e-01 -3.1835e-02 0.0000e+00
++3.0984e-01 -8.0405e-02 0.0000e+00
++3.2045e-01 -1.3496e-01 0.0000e+00
++3.2782e-01 -1.8950e-01 0.0000e+00
++3.4345e-01 -2.3503e-01 0.0000e+00
++3.4654e-01 -2.9422e-01 0.0000e+00
++3.5482e-01 -3.4290e-01 0.0000e+00
++3.6984e-01 -3.9185e-01 0.0000e+00
++3.7660e-01 -4.5234e-01 0.0000e+00
++3.8343e-01 -5.0274e-01 0.0000e+00
++3.9887e-01 -5.5895e-01 0.0000e+00
++4.0565e-01 -6.1049e-01 0.0000e+00
++4.1662e-01 -6.6488e-01 0.0000e+00
++2.2826e-01 +7.2491e-01 0.0000e+00
++2.3724e-01 +6.7233e-01 0.0000e+00
++2.4283e-01 +6.1493e-01 0.0000e+00
++2.5340e-01 +5.6110e-01 0.0000e+00
++2.6733e-01 +5.1034e-01 0.0000e+00
++2.7289e-01 +4.5506e-01 0.0000e+00
++2.8278e-01 +4.0744e-01 0.0000e+00
++2.9148e-01 +3.4688e-01 0.0000e+00
++2.9997e-01 +2.9775e-01 0.0000e+00
++3.1497e-01 +2.4852e-01 0.0000e+00
++3.1485e-01 +1.9234e-01 0.0000e+00
++3.2830e-01 +1.4374e-01 0.0000e+00
++3.3278e-01 +9.1530e-02 0.0000e+00
++3.4514e-01 +3.0381e-02 0.0000e+00
++3.6232e-01 -2.1631e-02 0.0000e+00
++3.7040e-01 -6.5341e-02 0.0000e+00
++3.7527e-01 -1.2230e-01 0.0000e+00
++3.8108e-01 -1.7203e-01 0.0000e+00
++3.9666e-01 -2.2976e-01 0.0000e+00
++3.9904e-01 -2.8467e-01 0.0000e+00
++4.1265e-01 -3.3164e-01 0.0000e+00
++4.1981e-01 -3.8898e-01 0.0000e+00
++4.3028e-01 -4.4432e-01 0.0000e+00
++4.3688e-01 -4.9148e-01 0.0000e+00
++4.5316e-01 -5.4768e-01 0.0000e+00
++4.6101e-01 -5.9883e-01 0.0000e+00
++4.6575e-01 -6.4830e-01 0.0000e+00
++2.8091e-01 +7.3366e-01 0.0000e+00
++2.8945e-01 +6.7965e-01 0.0000e+00
++2.9169e-01 +6.2862e-01 0.0000e+00
++3.1031e-01 +5.7331e-01 0.0000e+00
++3.1341e-01 +5.1375e-01 0.0000e+00
++3.2068e-01 +4.7027e-01 0.0000e+00
++3.3408e-01 +4.1441e-01 0.0000e+00
++3.4570e-01 +3.6005e-01 0.0000e+00
++3.5809e-01 +3.0615e-01 0.0000e+00
++3.6665e-01 +2.5776e-01 0.0000e+00
++3.6969e-01 +1.9788e-01 0.0000e+00
++3.7817e-01 +1.4657e-01 0.0000e+00
++3.9128e-01 +9.4963e-02 0.0000e+00
++4.0104e-01 +4.0855e-02 0.0000e+00
++4.0714e-01 -5.0297e-03 0.0000e+00
++4.1963e-01 -6.0411e-02 0.0000e+00
++4.2464e-01 -1.2050e-01 0.0000e+00
++4.3428e-01 -1.6692e-01 0.0000e+00
++4.4935e-01 -2.1535e-01 0.0000e+00
++4.6015e-01 -2.7370e-01 0.0000e+00
++4.6325e-01 -3.2461e-01 0.0000e+00
++4.7499e-01 -3.7768e-01 0.0000e+00
++4.8365e-01 -4.3141e-01 0.0000e+00
++4.9348e-01 -4.8701e-01 0.0000e+00
++5.0808e-01 -5.4012e-01 0.0000e+00
++5.1200e-01 -5.9284e-01 0.0000e+00
++3.3764e-01 +6.8700e-01 0.0000e+00
++3.5135e-01 +6.3762e-01 0.0000e+00
++3.6117e-01 +5.7635e-01 0.0000e+00
++3.6810e-01 +5.3141e-01 0.0000e+00
++3.8130e-01 +4.7791e-01 0.0000e+00
++3.8712e-01 +4.2156e-01 0.0000e+00
++4.0256e-01 +3.6811e-01 0.0000e+00
++4.0183e-01 +3.1836e-01 0.0000e+00
++4.1275e-01 +2.6310e-01 0.0000e+00
++4.2099e-01 +2.0920e-01 0.0000e+00
++4.3091e-01 +1.5548e-01 0.0000e+00
++4.4037e-01 +1.0030e-01 0.0000e+00
++4.5191e-01 +5.7758e-02 0.0000e+00
++4.6151e-01 -1.5117e-03 0.0000e+00
++4.7106e-01 -4.9639e-02 0.0000e+00
++4.8090e-01 -1.0857e-01 0.0000e+00
++4.8997e-01 -1.5444e-01 0.0000e+00
++4.9924e-01 -2.1120e-01 0.0000e+00
++5.1372e-01 -2.6252e-01 0.0000e+00
++5.1887e-01 -3.1110e-01 0.0000e+00
++5.2723e-01 -3.6420e-01 0.0000e+00
++5.3533e-01 -4.2458e-01 0.0000e+00
++5.4265e-01 -4.7173e-01 0.0000e+00
++5.5346e-01 -5.2813e-01 0.0000e+00
++3.9521e-01 +7.0003e-01 0.0000e+00
++4.0751e-01 +6.4218e-01 0.0000e+00
++4.1655e-01 +5.9205e-01 0.0000e+00
++4.2530e-01 +5.4139e-01 0.0000e+00
++4.3600e-01 +4.8189e-01 0.0000e+00
++4.3870e-01 +4.3526e-01 0.0000e+00
++4.4787e-01 +3.7850e-01 0.0000e+00
++4.5810e-01 +3.3083e-01 0.0000e+00
++4.6459e-01 +2.7763e-01 0.0000e+00
++4.8317e-01 +2.2237e-01 0.0000e+00
++4.8607e-01 +1.6678e-01 0.0000e+00
++4.9757e-01 +1.1150e-01 0.0000e+00
++5.0878e-01 +6.7339e-02 0.0000e+00
++5.1414e-01 +1.3652e-02 0.0000e+00
++5.2901e-01 -3.9870e-02 0.0000e+00
++5.3447e-01 -9.4851e-02 0.0000e+00
++5.4534e-01 -1.4544e-01 0.0000e+00
++5.5005e-01 -2.0246e-01 0.0000e+00
++5.6243e-01 -2.4888e-01 0.0000e+00
++5.6995e-01 -3.0912e-01 0.0000e+00
++5.7722e-01 -3.6547e-01 0.0000e+00
++5.9189e-01 -4.1303e-01 0.0000e+00
++5.9965e-01 -4.6187e-01 0.0000e+00
++6.1212e-01 -5.1890e-01 0.0000e+00
++4.5921e-01 +6.5287e-01 0.0000e+00
++4.6834e-01 +5.9747e-01 0.0000e+00
++4.7749e-01 +5.4708e-01 0.0000e+00
++4.8412e-01 +4.9699e-01 0.0000e+00
++4.9396e-01 +4.4157e-01 0.0000e+00
++4.9872e-01 +3.9151e-01 0.0000e+00
++5.1019e-01 +3.3285e-01 0.0000e+00
++5.1866e-01 +2.7705e-01 0.0000e+00
++5.3551e-01 +2.2800e-01 0.0000e+00
++5.4439e-01 +1.7684e-01 0.0000e+00
++5.5359e-01 +1.2091e-01 0.0000e+00
++5.5884e-01 +7.6396e-02 0.0000e+00
++5.6709e-01 +1.6627e-02 0.0000e+00
++5.7904e-01 -3.7702e-02 0.0000e+00
++5.9067e-01 -8.0774e-02 0.0000e+00
++5.9657e-01 -1.3531e-01 0.0000e+00
++6.1056e-01 -1.9588e-01 0.0000e+00
++6.1963e-01 -2.4795e-01 0.0000e+00
++6.2601e-01 -2.9247e-01 0.0000e+00
++6.2936e-01 -3.5354e-01 0.0000e+00
++6.3970e-01 -4.0717e-01 0.0000e+00
++6.5473e-01 -4.5404e-01 0.0000e+00
++5.2397e-01 +6.0659e-01 0.0000e+00
++5.2755e-01 +5.6127e-01 0.0000e+00
++5.3597e-01 +5.0755e-01 0.0000e+00
++5.4936e-01 +4.5219e-01 0.0000e+00
++5.5329e-01 +3.9824e-01 0.0000e+00
++5.7056e-01 +3.4335e-01 0.0000e+00
++5.8020e-01 +2.8803e-01 0.0000e+00
++5.8645e-01 +2.4345e-01 0.0000e+00
++5.8850e-01 +1.8334e-01 0.0000e+00
++6.0403e-01 +1.3187e-01 0.0000e+00
++6.1403e-01 +8.2657e-02 0.0000e+00
++6.1783e-01 +2.3981e-02 0.0000e+00
++6.3018e-01 -2.4803e-02 0.0000e+00
++6.4178e-01 -7.2256e-02 0.0000e+00
++6.4853e-01 -1.3130e-01 0.0000e+00
++6.5846e-01 -1.8686e-01 0.0000e+00
++6.7208e-01 -2.3042e-01 0.0000e+00
++6.7386e-01 -2.8825e-01 0.0000e+00
++6.8195e-01 -3.4490e-01 0.0000e+00
++6.9833e-01 -3.9836e-01 0.0000e+00
++5.8642e-01 +5.1438e-01 0.0000e+00
++6.0260e-01 +4.6109e-01 0.0000e+00
++6.0935e-01 +4.0950e-01 0.0000e+00
++6.1613e-01 +3.5777e-01 0.0000e+00
++6.2509e-01 +3.0595e-01 0.0000e+00
++6.3626e-01 +2.4840e-01 0.0000e+00
++6.3968e-01 +2.0008e-01 0.0000e+00
++6.5378e-01 +1.3812e-01 0.0000e+00
++6.6478e-01 +8.7772e-02 0.0000e+00
++6.7021e-01 +3.2965e-02 0.0000e+00
++6.8656e-01 -1.6930e-02 0.0000e+00
++6.9613e-01 -6.2646e-02 0.0000e+00
++7.0299e-01 -1.2105e-01 0.0000e+00
++7.1558e-01 -1.7585e-01 0.0000e+00
++7.2401e-01 -2.3017e-01 0.0000e+00
++7.2822e-01 -2.7762e-01 0.0000e+00
++6.6424e-01 +4.1485e-01 0.0000e+00
++6.6764e-01 +3.6381e-01 0.0000e+00
++6.7809e-01 +3.0876e-01 0.0000e+00
++6.8458e-01 +2.5578e-01 0.0000e+00
++6.9764e-01 +2.0773e-01 0.0000e+00
++7.1138e-01 +1.4904e-01 0.0000e+00
++7.1502e-01 +1.0205e-01 0.0000e+00
++7.3206e-01 +4.3071e-02 0.0000e+00
++7.4012e-01 -6.4222e-03 0.0000e+00
++7.4220e-01 -5.5222e-02 0.0000e+00
++7.5915e-01 -1.1402e-01 0.0000e+00
++7.6646e-01 -1.6509e-01 0.0000e+00
++7.3194e-01 +3.2180e-01 0.0000e+00
++7.4537e-01 +2.6856e-01 0.0000e+00
++7.5345e-01 +2.1347e-01 0.0000e+00
++7.6066e-01 +1.6701e-01 0.0000e+00
++7.6865e-01 +1.0944e-01 0.0000e+00
++7.7609e-01 +5.1926e-02 0.0000e+00
++7.8747e-01 +1.7557e-03 0.0000e+00
++7.9666e-01 -4.9854e-02 0.0000e+00
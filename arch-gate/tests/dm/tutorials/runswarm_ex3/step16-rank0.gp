@@ -0,0 +1,711 @@
+-7.7944e-01 +2.1112e-01 0.0000e+00
+-7.7860e-01 +1.4929e-01 0.0000e+00
+-7.8629e-01 +9.6171e-02 0.0000e+00
+-7.8314e-01 +4.3218e-02 0.0000e+00
+-7.8926e-01 -2.8630e-03 0.0000e+00
+-7.8949e-01 -6.7569e-02 0.0000e+00
+-7.9254e-01 -1.1995e-01 0.0000e+00
+-7.8790e-01 -1.7453e-01 0.0000e+00
+-7.2330e-01 +3.6900e-01 0.0000e+00
+-7.2841e-01 +3.1262e-01 0.0000e+00
+-7.2962e-01 +2.5702e-01 0.0000e+00
+-7.3014e-01 +2.0358e-01 0.0000e+00
+-7.2934e-01 +1.5158e-01 0.0000e+00
+-7.3342e-01 +1.0220e-01 0.0000e+00
+-7.3516e-01 +4.5821e-02 0.0000e+00
+-7.3116e-01 -5.7878e-03 0.0000e+00
+-7.3057e-01 -6.7430e-02 0.0000e+00
+-7.3133e-01 -1.1354e-01 0.0000e+00
+-7.3685e-01 -1.7279e-01 0.0000e+00
+-7.3814e-01 -2.3144e-01 0.0000e+00
+-7.3575e-01 -2.8128e-01 0.0000e+00
+-6.7216e-01 +4.2697e-01 0.0000e+00
+-6.7351e-01 +3.6406e-01 0.0000e+00
+-6.6570e-01 +3.1660e-01 0.0000e+00
+-6.7436e-01 +2.6067e-01 0.0000e+00
+-6.7374e-01 +2.0857e-01 0.0000e+00
+-6.7265e-01 +1.4888e-01 0.0000e+00
+-6.7473e-01 +9.2869e-02 0.0000e+00
+-6.7998e-01 +4.4636e-02 0.0000e+00
+-6.7954e-01 -1.1800e-02 0.0000e+00
+-6.7597e-01 -6.8541e-02 0.0000e+00
+-6.8154e-01 -1.2143e-01 0.0000e+00
+-6.8346e-01 -1.7431e-01 0.0000e+00
+-6.8118e-01 -2.2627e-01 0.0000e+00
+-6.8609e-01 -2.8189e-01 0.0000e+00
+-6.7970e-01 -3.3679e-01 0.0000e+00
+-6.8760e-01 -3.9007e-01 0.0000e+00
+-6.1411e-01 +5.2656e-01 0.0000e+00
+-6.1462e-01 +4.7225e-01 0.0000e+00
+-6.1422e-01 +4.2467e-01 0.0000e+00
+-6.0908e-01 +3.6577e-01 0.0000e+00
+-6.1149e-01 +3.1329e-01 0.0000e+00
+-6.1601e-01 +2.5982e-01 0.0000e+00
+-6.1823e-01 +2.0738e-01 0.0000e+00
+-6.2262e-01 +1.4995e-01 0.0000e+00
+-6.2266e-01 +9.6972e-02 0.0000e+00
+-6.1707e-01 +4.3233e-02 0.0000e+00
+-6.2200e-01 -1.3713e-02 0.0000e+00
+-6.1913e-01 -6.1639e-02 0.0000e+00
+-6.2359e-01 -1.2063e-01 0.0000e+00
+-6.2404e-01 -1.7048e-01 0.0000e+00
+-6.2458e-01 -2.2951e-01 0.0000e+00
+-6.3496e-01 -2.8375e-01 0.0000e+00
+-6.3281e-01 -3.4096e-01 0.0000e+00
+-6.2811e-01 -3.9523e-01 0.0000e+00
+-6.3493e-01 -4.4240e-01 0.0000e+00
+-6.3693e-01 -4.9655e-01 0.0000e+00
+-5.5081e-01 +5.8104e-01 0.0000e+00
+-5.5885e-01 +5.2625e-01 0.0000e+00
+-5.5225e-01 +4.7332e-01 0.0000e+00
+-5.5439e-01 +4.2196e-01 0.0000e+00
+-5.5637e-01 +3.6391e-01 0.0000e+00
+-5.6537e-01 +3.1034e-01 0.0000e+00
+-5.6613e-01 +2.5225e-01 0.0000e+00
+-5.6520e-01 +2.0494e-01 0.0000e+00
+-5.7030e-01 +1.5020e-01 0.0000e+00
+-5.6197e-01 +9.9515e-02 0.0000e+00
+-5.6815e-01 +3.7093e-02 0.0000e+00
+-5.7358e-01 -1.8232e-02 0.0000e+00
+-5.7415e-01 -7.0421e-02 0.0000e+00
+-5.7432e-01 -1.2353e-01 0.0000e+00
+-5.7306e-01 -1.8116e-01 0.0000e+00
+-5.7394e-01 -2.3336e-01 0.0000e+00
+-5.7706e-01 -2.8744e-01 0.0000e+00
+-5.7816e-01 -3.3595e-01 0.0000e+00
+-5.7981e-01 -3.9215e-01 0.0000e+00
+-5.8067e-01 -4.4295e-01 0.0000e+00
+-5.8177e-01 -5.0438e-01 0.0000e+00
+-5.8575e-01 -5.5664e-01 0.0000e+00
+-4.9895e-01 +6.3622e-01 0.0000e+00
+-4.9728e-01 +5.8528e-01 0.0000e+00
+-5.0576e-01 +5.2779e-01 0.0000e+00
+-5.0335e-01 +4.6888e-01 0.0000e+00
+-5.0125e-01 +4.1336e-01 0.0000e+00
+-5.0642e-01 +3.5966e-01 0.0000e+00
+-5.0965e-01 +3.1451e-01 0.0000e+00
+-5.1272e-01 +2.5352e-01 0.0000e+00
+-5.1432e-01 +2.0364e-01 0.0000e+00
+-5.0706e-01 +1.4384e-01 0.0000e+00
+-5.1530e-01 +9.1980e-02 0.0000e+00
+-5.1275e-01 +3.6783e-02 0.0000e+00
+-5.2010e-01 -1.4415e-02 0.0000e+00
+-5.1354e-01 -7.0173e-02 0.0000e+00
+-5.2231e-01 -1.2394e-01 0.0000e+00
+-5.1972e-01 -1.7774e-01 0.0000e+00
+-5.2025e-01 -2.2878e-01 0.0000e+00
+-5.1951e-01 -2.8289e-01 0.0000e+00
+-5.2707e-01 -3.4282e-01 0.0000e+00
+-5.2819e-01 -3.9563e-01 0.0000e+00
+-5.2059e-01 -4.5243e-01 0.0000e+00
+-5.2468e-01 -4.9666e-01 0.0000e+00
+-5.2375e-01 -5.6011e-01 0.0000e+00
+-5.2841e-01 -6.1385e-01 0.0000e+00
+-4.4971e-01 +6.3514e-01 0.0000e+00
+-4.4517e-01 +5.8282e-01 0.0000e+00
+-4.4800e-01 +5.2598e-01 0.0000e+00
+-4.5299e-01 +4.6758e-01 0.0000e+00
+-4.4632e-01 +4.2096e-01 0.0000e+00
+-4.5009e-01 +3.6171e-01 0.0000e+00
+-4.4874e-01 +3.1155e-01 0.0000e+00
+-4.5027e-01 +2.5145e-01 0.0000e+00
+-4.5156e-01 +2.0056e-01 0.0000e+00
+-4.6022e-01 +1.5162e-01 0.0000e+00
+-4.6276e-01 +9.3910e-02 0.0000e+00
+-4.6089e-01 +3.4233e-02 0.0000e+00
+-4.6328e-01 -1.6120e-02 0.0000e+00
+-4.6317e-01 -7.4390e-02 0.0000e+00
+-4.5833e-01 -1.1916e-01 0.0000e+00
+-4.6157e-01 -1.7479e-01 0.0000e+00
+-4.6653e-01 -2.3174e-01 0.0000e+00
+-4.7207e-01 -2.8256e-01 0.0000e+00
+-4.6521e-01 -3.3810e-01 0.0000e+00
+-4.6652e-01 -3.9861e-01 0.0000e+00
+-4.6930e-01 -4.4495e-01 0.0000e+00
+-4.7235e-01 -5.0789e-01 0.0000e+00
+-4.7894e-01 -5.5396e-01 0.0000e+00
+-4.7383e-01 -6.0721e-01 0.0000e+00
+-3.9145e-01 +6.8758e-01 0.0000e+00
+-3.9280e-01 +6.3239e-01 0.0000e+00
+-3.8879e-01 +5.7610e-01 0.0000e+00
+-3.9192e-01 +5.2667e-01 0.0000e+00
+-3.9530e-01 +4.7497e-01 0.0000e+00
+-3.9862e-01 +4.1718e-01 0.0000e+00
+-4.0037e-01 +3.5697e-01 0.0000e+00
+-3.9934e-01 +3.1164e-01 0.0000e+00
+-3.9772e-01 +2.5300e-01 0.0000e+00
+-4.0303e-01 +1.9764e-01 0.0000e+00
+-4.0307e-01 +1.4383e-01 0.0000e+00
+-4.0093e-01 +9.0682e-02 0.0000e+00
+-4.0219e-01 +3.7184e-02 0.0000e+00
+-4.1114e-01 -1.1964e-02 0.0000e+00
+-4.0457e-01 -7.2180e-02 0.0000e+00
+-4.0799e-01 -1.2224e-01 0.0000e+00
+-4.0562e-01 -1.7885e-01 0.0000e+00
+-4.1625e-01 -2.2953e-01 0.0000e+00
+-4.1213e-01 -2.8512e-01 0.0000e+00
+-4.0953e-01 -3.4475e-01 0.0000e+00
+-4.1682e-01 -3.9816e-01 0.0000e+00
+-4.2041e-01 -4.4756e-01 0.0000e+00
+-4.2334e-01 -5.0240e-01 0.0000e+00
+-4.1563e-01 -5.5660e-01 0.0000e+00
+-4.2482e-01 -6.0869e-01 0.0000e+00
+-4.2033e-01 -6.7054e-01 0.0000e+00
+-3.3809e-01 +7.3385e-01 0.0000e+00
+-3.3310e-01 +6.8088e-01 0.0000e+00
+-3.3505e-01 +6.2602e-01 0.0000e+00
+-3.4319e-01 +5.7364e-01 0.0000e+00
+-3.3545e-01 +5.2206e-01 0.0000e+00
+-3.3806e-01 +4.7316e-01 0.0000e+00
+-3.4366e-01 +4.1177e-01 0.0000e+00
+-3.3841e-01 +3.6345e-01 0.0000e+00
+-3.4150e-01 +3.1107e-01 0.0000e+00
+-3.4988e-01 +2.4898e-01 0.0000e+00
+-3.5266e-01 +1.9380e-01 0.0000e+00
+-3.4396e-01 +1.4665e-01 0.0000e+00
+-3.5227e-01 +8.9023e-02 0.0000e+00
+-3.5066e-01 +3.4834e-02 0.0000e+00
+-3.4733e-01 -2.2762e-02 0.0000e+00
+-3.4926e-01 -6.9747e-02 0.0000e+00
+-3.5030e-01 -1.2469e-01 0.0000e+00
+-3.5568e-01 -1.8092e-01 0.0000e+00
+-3.6100e-01 -2.3769e-01 0.0000e+00
+-3.6293e-01 -2.8849e-01 0.0000e+00
+-3.6240e-01 -3.4318e-01 0.0000e+00
+-3.5841e-01 -3.9925e-01 0.0000e+00
+-3.6404e-01 -4.5077e-01 0.0000e+00
+-3.6881e-01 -5.0519e-01 0.0000e+00
+-3.6712e-01 -5.5941e-01 0.0000e+00
+-3.6651e-01 -6.1206e-01 0.0000e+00
+-3.6798e-01 -6.7193e-01 0.0000e+00
+-2.7506e-01 +7.3270e-01 0.0000e+00
+-2.8655e-01 +6.8479e-01 0.0000e+00
+-2.8629e-01 +6.3371e-01 0.0000e+00
+-2.8759e-01 +5.8047e-01 0.0000e+00
+-2.9028e-01 +5.2018e-01 0.0000e+00
+-2.9006e-01 +4.6761e-01 0.0000e+00
+-2.9278e-01 +4.0879e-01 0.0000e+00
+-2.8464e-01 +3.6214e-01 0.0000e+00
+-2.9374e-01 +3.0260e-01 0.0000e+00
+-2.9212e-01 +2.4851e-01 0.0000e+00
+-2.9381e-01 +2.0157e-01 0.0000e+00
+-2.9523e-01 +1.4227e-01 0.0000e+00
+-2.9409e-01 +9.2169e-02 0.0000e+00
+-2.9437e-01 +3.7671e-02 0.0000e+00
+-2.9732e-01 -2.2991e-02 0.0000e+00
+-2.9878e-01 -7.4299e-02 0.0000e+00
+-2.9679e-01 -1.2624e-01 0.0000e+00
+-2.9749e-01 -1.8675e-01 0.0000e+00
+-3.0323e-01 -2.3793e-01 0.0000e+00
+-3.0457e-01 -2.8969e-01 0.0000e+00
+-3.0644e-01 -3.3988e-01 0.0000e+00
+-3.0745e-01 -3.9719e-01 0.0000e+00
+-3.0938e-01 -4.5304e-01 0.0000e+00
+-3.0518e-01 -5.1236e-01 0.0000e+00
+-3.1312e-01 -5.6368e-01 0.0000e+00
+-3.1046e-01 -6.1470e-01 0.0000e+00
+-3.1591e-01 -6.7256e-01 0.0000e+00
+-3.1456e-01 -7.2372e-01 0.0000e+00
+-2.2832e-01 +7.3629e-01 0.0000e+00
+-2.2646e-01 +6.8670e-01 0.0000e+00
+-2.2914e-01 +6.2717e-01 0.0000e+00
+-2.3439e-01 +5.7281e-01 0.0000e+00
+-2.2839e-01 +5.1484e-01 0.0000e+00
+-2.3097e-01 +4.6691e-01 0.0000e+00
+-2.3887e-01 +4.1560e-01 0.0000e+00
+-2.3860e-01 +3.5702e-01 0.0000e+00
+-2.3257e-01 +3.0270e-01 0.0000e+00
+-2.3914e-01 +2.4693e-01 0.0000e+00
+-2.4160e-01 +1.9861e-01 0.0000e+00
+-2.4569e-01 +1.3853e-01 0.0000e+00
+-2.3775e-01 +8.1697e-02 0.0000e+00
+-2.4280e-01 +3.7629e-02 0.0000e+00
+-2.4033e-01 -2.5134e-02 0.0000e+00
+-2.4994e-01 -7.8189e-02 0.0000e+00
+-2.4566e-01 -1.2557e-01 0.0000e+00
+-2.5316e-01 -1.8333e-01 0.0000e+00
+-2.4953e-01 -2.3900e-01 0.0000e+00
+-2.5442e-01 -2.9359e-01 0.0000e+00
+-2.4718e-01 -3.4127e-01 0.0000e+00
+-2.5836e-01 -3.9857e-01 0.0000e+00
+-2.5310e-01 -4.5939e-01 0.0000e+00
+-2.5970e-01 -5.0527e-01 0.0000e+00
+-2.5259e-01 -5.6295e-01 0.0000e+00
+-2.5393e-01 -6.2020e-01 0.0000e+00
+-2.6053e-01 -6.6804e-01 0.0000e+00
+-2.5983e-01 -7.2638e-01 0.0000e+00
+-1.6943e-01 +7.9388e-01 0.0000e+00
+-1.7177e-01 +7.3242e-01 0.0000e+00
+-1.6858e-01 +6.8484e-01 0.0000e+00
+-1.7110e-01 +6.2268e-01 0.0000e+00
+-1.7465e-01 +5.7493e-01 0.0000e+00
+-1.7194e-01 +5.1553e-01 0.0000e+00
+-1.7531e-01 +4.6728e-01 0.0000e+00
+-1.8503e-01 +4.1007e-01 0.0000e+00
+-1.8353e-01 +3.5454e-01 0.0000e+00
+-1.8191e-01 +2.9924e-01 0.0000e+00
+-1.8453e-01 +2.4610e-01 0.0000e+00
+-1.8566e-01 +1.9576e-01 0.0000e+00
+-1.8668e-01 +1.4068e-01 0.0000e+00
+-1.8780e-01 +8.9241e-02 0.0000e+00
+-1.8644e-01 +2.6270e-02 0.0000e+00
+-1.9468e-01 -1.8852e-02 0.0000e+00
+-1.9644e-01 -7.6336e-02 0.0000e+00
+-1.9204e-01 -1.3122e-01 0.0000e+00
+-1.9786e-01 -1.8717e-01 0.0000e+00
+-1.9438e-01 -2.3666e-01 0.0000e+00
+-1.9928e-01 -2.9582e-01 0.0000e+00
+-1.9772e-01 -3.4338e-01 0.0000e+00
+-2.0145e-01 -4.0109e-01 0.0000e+00
+-1.9861e-01 -4.5925e-01 0.0000e+00
+-1.9913e-01 -5.0869e-01 0.0000e+00
+-2.0724e-01 -5.6498e-01 0.0000e+00
+-2.0429e-01 -6.1574e-01 0.0000e+00
+-2.0528e-01 -6.7281e-01 0.0000e+00
+-2.1030e-01 -7.2701e-01 0.0000e+00
+-2.1095e-01 -7.7801e-01 0.0000e+00
+-1.1307e-01 +7.8845e-01 0.0000e+00
+-1.1581e-01 +7.3521e-01 0.0000e+00
+-1.1996e-01 +6.8114e-01 0.0000e+00
+-1.1887e-01 +6.2980e-01 0.0000e+00
+-1.2304e-01 +5.7451e-01 0.0000e+00
+-1.1785e-01 +5.1350e-01 0.0000e+00
+-1.2635e-01 +4.5990e-01 0.0000e+00
+-1.2260e-01 +4.1148e-01 0.0000e+00
+-1.2514e-01 +3.6002e-01 0.0000e+00
+-1.2842e-01 +2.9739e-01 0.0000e+00
+-1.3216e-01 +2.4478e-01 0.0000e+00
+-1.3286e-01 +1.9353e-01 0.0000e+00
+-1.3202e-01 +1.4217e-01 0.0000e+00
+-1.2830e-01 +8.0279e-02 0.0000e+00
+-1.3160e-01 +3.0169e-02 0.0000e+00
+-1.3252e-01 -2.8159e-02 0.0000e+00
+-1.3802e-01 -7.5393e-02 0.0000e+00
+-1.4260e-01 -1.2981e-01 0.0000e+00
+-1.4118e-01 -1.8599e-01 0.0000e+00
+-1.4178e-01 -2.4152e-01 0.0000e+00
+-1.4608e-01 -2.9083e-01 0.0000e+00
+-1.4608e-01 -3.4960e-01 0.0000e+00
+-1.5020e-01 -4.0297e-01 0.0000e+00
+-1.4620e-01 -4.5877e-01 0.0000e+00
+-1.5155e-01 -5.0570e-01 0.0000e+00
+-1.4382e-01 -5.5981e-01 0.0000e+00
+-1.5262e-01 -6.1891e-01 0.0000e+00
+-1.5456e-01 -6.7072e-01 0.0000e+00
+-1.5430e-01 -7.2993e-01 0.0000e+00
+-1.4975e-01 -7.8292e-01 0.0000e+00
+-6.6867e-02 +7.8236e-01 0.0000e+00
+-6.3394e-02 +7.2789e-01 0.0000e+00
+-5.9682e-02 +6.7838e-01 0.0000e+00
+-7.1254e-02 +6.2940e-01 0.0000e+00
+-6.8495e-02 +5.7472e-01 0.0000e+00
+-6.4393e-02 +5.2093e-01 0.0000e+00
+-7.1044e-02 +4.6320e-01 0.0000e+00
+-6.9404e-02 +4.0293e-01 0.0000e+00
+-6.9338e-02 +3.5402e-01 0.0000e+00
+-7.3497e-02 +2.9667e-01 0.0000e+00
+-7.0544e-02 +2.4684e-01 0.0000e+00
+-7.4002e-02 +1.8913e-01 0.0000e+00
+-8.3192e-02 +1.4064e-01 0.0000e+00
+-7.7273e-02 +8.1817e-02 0.0000e+00
+-8.0530e-02 +2.6294e-02 0.0000e+00
+-7.9716e-02 -2.6610e-02 0.0000e+00
+-8.4611e-02 -7.8087e-02 0.0000e+00
+-8.4596e-02 -1.3579e-01 0.0000e+00
+-8.6663e-02 -1.9164e-01 0.0000e+00
+-8.3897e-02 -2.4557e-01 0.0000e+00
+-8.7815e-02 -2.9465e-01 0.0000e+00
+-8.4800e-02 -3.5479e-01 0.0000e+00
+-9.5462e-02 -4.0752e-01 0.0000e+00
+-9.6269e-02 -4.5889e-01 0.0000e+00
+-8.9542e-02 -5.0919e-01 0.0000e+00
+-9.8301e-02 -5.6356e-01 0.0000e+00
+-9.8435e-02 -6.1582e-01 0.0000e+00
+-9.8963e-02 -6.6969e-01 0.0000e+00
+-1.0216e-01 -7.2850e-01 0.0000e+00
+-9.4801e-02 -7.8166e-01 0.0000e+00
+-7.4136e-03 +7.8706e-01 0.0000e+00
+-1.1317e-02 +7.3391e-01 0.0000e+00
+-7.8086e-03 +6.8045e-01 0.0000e+00
+-8.5714e-03 +6.2744e-01 0.0000e+00
+-1.4529e-02 +5.6712e-01 0.0000e+00
+-1.0942e-02 +5.1502e-01 0.0000e+00
+-1.5672e-02 +4.5691e-01 0.0000e+00
+-1.3762e-02 +4.0717e-01 0.0000e+00
+-2.1907e-02 +3.5432e-01 0.0000e+00
+-1.5218e-02 +2.9879e-01 0.0000e+00
+-2.2370e-02 +2.4191e-01 0.0000e+00
+-2.4973e-02 +1.9521e-01 0.0000e+00
+-1.9410e-02 +1.3168e-01 0.0000e+00
+-1.9899e-02 +7.8583e-02 0.0000e+00
+-3.0604e-02 +2.4807e-02 0.0000e+00
+-3.1180e-02 -2.3040e-02 0.0000e+00
+-3.1130e-02 -8.3300e-02 0.0000e+00
+-3.3009e-02 -1.3128e-01 0.0000e+00
+-3.5835e-02 -1.9203e-01 0.0000e+00
+-3.1970e-02 -2.4601e-01 0.0000e+00
+-3.4670e-02 -3.0073e-01 0.0000e+00
+-3.0716e-02 -3.4849e-01 0.0000e+00
+-4.0167e-02 -4.0683e-01 0.0000e+00
+-3.4467e-02 -4.5856e-01 0.0000e+00
+-3.8373e-02 -5.1839e-01 0.0000e+00
+-3.8688e-02 -5.6337e-01 0.0000e+00
+-4.0070e-02 -6.1985e-01 0.0000e+00
+-4.4842e-02 -6.7937e-01 0.0000e+00
+-4.4437e-02 -7.2942e-01 0.0000e+00
+-4.6616e-02 -7.7985e-01 0.0000e+00
++4.6201e-02 +7.7985e-01 0.0000e+00
++4.9278e-02 +7.3035e-01 0.0000e+00
++4.3547e-02 +6.7385e-01 0.0000e+00
++4.4259e-02 +6.2497e-01 0.0000e+00
++4.2959e-02 +5.6739e-01 0.0000e+00
++3.6852e-02 +5.1027e-01 0.0000e+00
++3.6181e-02 +4.5784e-01 0.0000e+00
++3.1459e-02 +4.0614e-01 0.0000e+00
++3.2067e-02 +3.4917e-01 0.0000e+00
++3.2076e-02 +2.9911e-01 0.0000e+00
++2.9864e-02 +2.4299e-01 0.0000e+00
++3.4083e-02 +1.8865e-01 0.0000e+00
++3.4306e-02 +1.3768e-01 0.0000e+00
++2.6381e-02 +7.6696e-02 0.0000e+00
++3.0815e-02 +2.7572e-02 0.0000e+00
++2.2953e-02 -3.2226e-02 0.0000e+00
++2.8797e-02 -7.7945e-02 0.0000e+00
++2.6796e-02 -1.3691e-01 0.0000e+00
++1.7585e-02 -1.8752e-01 0.0000e+00
++1.8365e-02 -2.4708e-01 0.0000e+00
++1.9150e-02 -3.0284e-01 0.0000e+00
++1.9155e-02 -3.4923e-01 0.0000e+00
++1.4733e-02 -4.0345e-01 0.0000e+00
++1.8870e-02 -4.6548e-01 0.0000e+00
++1.9134e-02 -5.1343e-01 0.0000e+00
++1.5876e-02 -5.6874e-01 0.0000e+00
++1.7341e-02 -6.2520e-01 0.0000e+00
++7.3979e-03 -6.7543e-01 0.0000e+00
++1.1499e-02 -7.3635e-01 0.0000e+00
++5.1253e-03 -7.8450e-01 0.0000e+00
++9.9923e-02 +7.7975e-01 0.0000e+00
++9.9419e-02 +7.3331e-01 0.0000e+00
++1.0272e-01 +6.7464e-01 0.0000e+00
++9.4235e-02 +6.1645e-01 0.0000e+00
++9.9292e-02 +5.6658e-01 0.0000e+00
++9.1278e-02 +5.1185e-01 0.0000e+00
++8.9483e-02 +4.5882e-01 0.0000e+00
++8.9350e-02 +3.9923e-01 0.0000e+00
++9.4988e-02 +3.5326e-01 0.0000e+00
++8.3007e-02 +2.9335e-01 0.0000e+00
++8.3503e-02 +2.4620e-01 0.0000e+00
++8.4738e-02 +1.8558e-01 0.0000e+00
++8.8036e-02 +1.3573e-01 0.0000e+00
++7.9968e-02 +7.9673e-02 0.0000e+00
++8.6028e-02 +2.4643e-02 0.0000e+00
++8.0624e-02 -2.5823e-02 0.0000e+00
++7.9350e-02 -8.8418e-02 0.0000e+00
++7.6122e-02 -1.3863e-01 0.0000e+00
++8.0929e-02 -1.9469e-01 0.0000e+00
++7.8457e-02 -2.4440e-01 0.0000e+00
++7.0190e-02 -2.9876e-01 0.0000e+00
++7.1460e-02 -3.5011e-01 0.0000e+00
++7.2750e-02 -4.0761e-01 0.0000e+00
++6.4856e-02 -4.6183e-01 0.0000e+00
++7.3202e-02 -5.1646e-01 0.0000e+00
++6.7336e-02 -5.6709e-01 0.0000e+00
++6.3706e-02 -6.2371e-01 0.0000e+00
++7.0357e-02 -6.7786e-01 0.0000e+00
++6.3493e-02 -7.3461e-01 0.0000e+00
++5.7497e-02 -7.8545e-01 0.0000e+00
++1.5311e-01 +7.8232e-01 0.0000e+00
++1.5224e-01 +7.2923e-01 0.0000e+00
++1.5263e-01 +6.7590e-01 0.0000e+00
++1.5501e-01 +6.1799e-01 0.0000e+00
++1.4684e-01 +5.6906e-01 0.0000e+00
++1.4291e-01 +5.1522e-01 0.0000e+00
++1.4259e-01 +4.5700e-01 0.0000e+00
++1.4384e-01 +4.0529e-01 0.0000e+00
++1.3832e-01 +3.4454e-01 0.0000e+00
++1.4635e-01 +2.9113e-01 0.0000e+00
++1.3696e-01 +2.4583e-01 0.0000e+00
++1.3653e-01 +1.9046e-01 0.0000e+00
++1.3561e-01 +1.3692e-01 0.0000e+00
++1.4168e-01 +7.7907e-02 0.0000e+00
++1.3429e-01 +2.1441e-02 0.0000e+00
++1.3375e-01 -3.4851e-02 0.0000e+00
++1.3143e-01 -8.1725e-02 0.0000e+00
++1.3212e-01 -1.4024e-01 0.0000e+00
++1.3229e-01 -1.9036e-01 0.0000e+00
++1.2650e-01 -2.4519e-01 0.0000e+00
++1.2689e-01 -3.0512e-01 0.0000e+00
++1.2636e-01 -3.5571e-01 0.0000e+00
++1.2806e-01 -4.0588e-01 0.0000e+00
++1.2027e-01 -4.6219e-01 0.0000e+00
++1.2194e-01 -5.1673e-01 0.0000e+00
++1.1791e-01 -5.6729e-01 0.0000e+00
++1.2067e-01 -6.2891e-01 0.0000e+00
++1.1913e-01 -6.8410e-01 0.0000e+00
++1.1787e-01 -7.3808e-01 0.0000e+00
++1.1238e-01 -7.9265e-01 0.0000e+00
++2.1238e-01 +7.7543e-01 0.0000e+00
++2.0327e-01 +7.2668e-01 0.0000e+00
++2.0330e-01 +6.7537e-01 0.0000e+00
++2.0353e-01 +6.1862e-01 0.0000e+00
++2.0463e-01 +5.6202e-01 0.0000e+00
++1.9986e-01 +5.1354e-01 0.0000e+00
++2.0576e-01 +4.5776e-01 0.0000e+00
++1.9509e-01 +4.0448e-01 0.0000e+00
++1.9314e-01 +3.4554e-01 0.0000e+00
++1.9479e-01 +2.9807e-01 0.0000e+00
++1.9262e-01 +2.3631e-01 0.0000e+00
++1.9066e-01 +1.8868e-01 0.0000e+00
++1.8890e-01 +1.3490e-01 0.0000e+00
++1.8851e-01 +7.4985e-02 0.0000e+00
++1.8998e-01 +1.7269e-02 0.0000e+00
++1.9283e-01 -3.5759e-02 0.0000e+00
++1.8736e-01 -8.8305e-02 0.0000e+00
++1.8475e-01 -1.3598e-01 0.0000e+00
++1.8310e-01 -1.9088e-01 0.0000e+00
++1.8362e-01 -2.4312e-01 0.0000e+00
++1.8138e-01 -3.0327e-01 0.0000e+00
++1.8543e-01 -3.5596e-01 0.0000e+00
++1.8481e-01 -4.0940e-01 0.0000e+00
++1.7723e-01 -4.6168e-01 0.0000e+00
++1.8097e-01 -5.1559e-01 0.0000e+00
++1.7268e-01 -5.7007e-01 0.0000e+00
++1.7883e-01 -6.2810e-01 0.0000e+00
++1.6961e-01 -6.8246e-01 0.0000e+00
++1.6954e-01 -7.3652e-01 0.0000e+00
++1.7525e-01 -7.8662e-01 0.0000e+00
++2.6005e-01 +7.2526e-01 0.0000e+00
++2.5660e-01 +6.7327e-01 0.0000e+00
++2.5450e-01 +6.1500e-01 0.0000e+00
++2.5338e-01 +5.6488e-01 0.0000e+00
++2.5994e-01 +5.1130e-01 0.0000e+00
++2.5084e-01 +4.4988e-01 0.0000e+00
++2.5291e-01 +3.9738e-01 0.0000e+00
++2.5387e-01 +3.4555e-01 0.0000e+00
++2.4961e-01 +2.8987e-01 0.0000e+00
++2.4414e-01 +2.3653e-01 0.0000e+00
++2.4703e-01 +1.8816e-01 0.0000e+00
++2.5085e-01 +1.2428e-01 0.0000e+00
++2.4277e-01 +7.7332e-02 0.0000e+00
++2.4241e-01 +2.2850e-02 0.0000e+00
++2.4547e-01 -3.2712e-02 0.0000e+00
++2.3655e-01 -8.2918e-02 0.0000e+00
++2.4096e-01 -1.3720e-01 0.0000e+00
++2.3892e-01 -1.9130e-01 0.0000e+00
++2.4042e-01 -2.5414e-01 0.0000e+00
++2.3844e-01 -3.0354e-01 0.0000e+00
++2.3166e-01 -3.5475e-01 0.0000e+00
++2.3838e-01 -4.0820e-01 0.0000e+00
++2.3555e-01 -4.6660e-01 0.0000e+00
++2.2715e-01 -5.1952e-01 0.0000e+00
++2.2658e-01 -5.7335e-01 0.0000e+00
++2.3363e-01 -6.3257e-01 0.0000e+00
++2.2665e-01 -6.8191e-01 0.0000e+00
++2.2466e-01 -7.3245e-01 0.0000e+00
++3.1481e-01 +7.2850e-01 0.0000e+00
++3.1619e-01 +6.7252e-01 0.0000e+00
++3.1675e-01 +6.1414e-01 0.0000e+00
++3.0922e-01 +5.6011e-01 0.0000e+00
++3.0984e-01 +5.1248e-01 0.0000e+00
++3.0920e-01 +4.5644e-01 0.0000e+00
++3.0814e-01 +4.0415e-01 0.0000e+00
++3.0112e-01 +3.4937e-01 0.0000e+00
++3.0590e-01 +2.9482e-01 0.0000e+00
++3.0457e-01 +2.3728e-01 0.0000e+00
++3.0521e-01 +1.8756e-01 0.0000e+00
++3.0413e-01 +1.3196e-01 0.0000e+00
++3.0087e-01 +7.4312e-02 0.0000e+00
++2.9455e-01 +1.5229e-02 0.0000e+00
++3.0056e-01 -3.1426e-02 0.0000e+00
++2.9122e-01 -9.1635e-02 0.0000e+00
++2.9066e-01 -1.4157e-01 0.0000e+00
++2.9025e-01 -1.9770e-01 0.0000e+00
++2.8664e-01 -2.5317e-01 0.0000e+00
++2.9301e-01 -3.0137e-01 0.0000e+00
++2.8423e-01 -3.6058e-01 0.0000e+00
++2.8269e-01 -4.1043e-01 0.0000e+00
++2.8777e-01 -4.6190e-01 0.0000e+00
++2.8237e-01 -5.2313e-01 0.0000e+00
++2.7905e-01 -5.7440e-01 0.0000e+00
++2.8309e-01 -6.3314e-01 0.0000e+00
++2.7949e-01 -6.8551e-01 0.0000e+00
++2.7948e-01 -7.4156e-01 0.0000e+00
++3.7096e-01 +6.7201e-01 0.0000e+00
++3.6933e-01 +6.1816e-01 0.0000e+00
++3.6339e-01 +5.6022e-01 0.0000e+00
++3.6308e-01 +5.0481e-01 0.0000e+00
++3.6672e-01 +4.5177e-01 0.0000e+00
++3.6117e-01 +3.9593e-01 0.0000e+00
++3.6144e-01 +3.4681e-01 0.0000e+00
++3.5794e-01 +2.8512e-01 0.0000e+00
++3.5652e-01 +2.3478e-01 0.0000e+00
++3.6153e-01 +1.8304e-01 0.0000e+00
++3.5016e-01 +1.2745e-01 0.0000e+00
++3.5377e-01 +7.6641e-02 0.0000e+00
++3.4776e-01 +2.4057e-02 0.0000e+00
++3.4777e-01 -3.8951e-02 0.0000e+00
++3.5437e-01 -9.3879e-02 0.0000e+00
++3.5362e-01 -1.3877e-01 0.0000e+00
++3.4706e-01 -1.9613e-01 0.0000e+00
++3.4287e-01 -2.4653e-01 0.0000e+00
++3.4674e-01 -3.0680e-01 0.0000e+00
++3.3812e-01 -3.6164e-01 0.0000e+00
++3.4220e-01 -4.1086e-01 0.0000e+00
++3.3781e-01 -4.6905e-01 0.0000e+00
++3.3711e-01 -5.2593e-01 0.0000e+00
++3.3421e-01 -5.7394e-01 0.0000e+00
++3.3909e-01 -6.3284e-01 0.0000e+00
++3.3663e-01 -6.8504e-01 0.0000e+00
++3.3144e-01 -7.3497e-01 0.0000e+00
++4.2484e-01 +6.7014e-01 0.0000e+00
++4.2248e-01 +6.1496e-01 0.0000e+00
++4.1449e-01 +5.6400e-01 0.0000e+00
++4.2187e-01 +5.0552e-01 0.0000e+00
++4.1302e-01 +4.4593e-01 0.0000e+00
++4.1152e-01 +4.0143e-01 0.0000e+00
++4.1362e-01 +3.4345e-01 0.0000e+00
++4.1426e-01 +2.8731e-01 0.0000e+00
++4.1574e-01 +2.3147e-01 0.0000e+00
++4.1453e-01 +1.8185e-01 0.0000e+00
++4.0557e-01 +1.2196e-01 0.0000e+00
++4.0371e-01 +6.9471e-02 0.0000e+00
++4.0636e-01 +1.5758e-02 0.0000e+00
++4.0520e-01 -3.9761e-02 0.0000e+00
++4.0206e-01 -8.6408e-02 0.0000e+00
++4.0335e-01 -1.4373e-01 0.0000e+00
++3.9629e-01 -2.0422e-01 0.0000e+00
++3.9655e-01 -2.5211e-01 0.0000e+00
++4.0179e-01 -3.0307e-01 0.0000e+00
++4.0081e-01 -3.6299e-01 0.0000e+00
++3.9370e-01 -4.1401e-01 0.0000e+00
++3.9471e-01 -4.6890e-01 0.0000e+00
++3.9253e-01 -5.2382e-01 0.0000e+00
++3.9114e-01 -5.8084e-01 0.0000e+00
++3.9497e-01 -6.3634e-01 0.0000e+00
++3.8831e-01 -6.8931e-01 0.0000e+00
++4.7166e-01 +6.1260e-01 0.0000e+00
++4.7536e-01 +5.6097e-01 0.0000e+00
++4.7283e-01 +4.9835e-01 0.0000e+00
++4.7070e-01 +4.5247e-01 0.0000e+00
++4.7307e-01 +3.9687e-01 0.0000e+00
++4.6756e-01 +3.3992e-01 0.0000e+00
++4.7216e-01 +2.8392e-01 0.0000e+00
++4.6149e-01 +2.3481e-01 0.0000e+00
++4.6124e-01 +1.7792e-01 0.0000e+00
++4.5863e-01 +1.2291e-01 0.0000e+00
++4.5770e-01 +6.7740e-02 0.0000e+00
++4.5602e-01 +1.1223e-02 0.0000e+00
++4.5894e-01 -3.3200e-02 0.0000e+00
++4.5659e-01 -9.3799e-02 0.0000e+00
++4.5642e-01 -1.4335e-01 0.0000e+00
++4.5438e-01 -2.0367e-01 0.0000e+00
++4.5418e-01 -2.5089e-01 0.0000e+00
++4.5201e-01 -3.0894e-01 0.0000e+00
++4.5608e-01 -3.6264e-01 0.0000e+00
++4.5146e-01 -4.1176e-01 0.0000e+00
++4.4911e-01 -4.6601e-01 0.0000e+00
++4.4506e-01 -5.2740e-01 0.0000e+00
++4.4288e-01 -5.7554e-01 0.0000e+00
++4.4230e-01 -6.3354e-01 0.0000e+00
++5.3126e-01 +6.1399e-01 0.0000e+00
++5.3187e-01 +5.5426e-01 0.0000e+00
++5.3079e-01 +5.0282e-01 0.0000e+00
++5.2933e-01 +4.5092e-01 0.0000e+00
++5.2802e-01 +3.8988e-01 0.0000e+00
++5.2137e-01 +3.4317e-01 0.0000e+00
++5.1910e-01 +2.8514e-01 0.0000e+00
++5.1968e-01 +2.3590e-01 0.0000e+00
++5.1547e-01 +1.8193e-01 0.0000e+00
++5.2282e-01 +1.2352e-01 0.0000e+00
++5.1457e-01 +6.7897e-02 0.0000e+00
++5.1490e-01 +1.0869e-02 0.0000e+00
++5.1716e-01 -3.5089e-02 0.0000e+00
++5.1173e-01 -8.9312e-02 0.0000e+00
++5.1574e-01 -1.4527e-01 0.0000e+00
++5.1016e-01 -2.0080e-01 0.0000e+00
++5.1079e-01 -2.5306e-01 0.0000e+00
++5.0405e-01 -3.1045e-01 0.0000e+00
++5.0703e-01 -3.5888e-01 0.0000e+00
++5.0242e-01 -4.2002e-01 0.0000e+00
++4.9835e-01 -4.7725e-01 0.0000e+00
++5.0336e-01 -5.2728e-01 0.0000e+00
++5.0128e-01 -5.7719e-01 0.0000e+00
++5.0221e-01 -6.3613e-01 0.0000e+00
++5.8519e-01 +5.5450e-01 0.0000e+00
++5.8315e-01 +4.9783e-01 0.0000e+00
++5.8213e-01 +4.4611e-01 0.0000e+00
++5.7868e-01 +3.9520e-01 0.0000e+00
++5.7733e-01 +3.3836e-01 0.0000e+00
++5.7203e-01 +2.8785e-01 0.0000e+00
++5.7166e-01 +2.2749e-01 0.0000e+00
++5.6888e-01 +1.7055e-01 0.0000e+00
++5.7576e-01 +1.1862e-01 0.0000e+00
++5.7431e-01 +6.6190e-02 0.0000e+00
++5.7223e-01 +8.9881e-03 0.0000e+00
++5.6853e-01 -3.6136e-02 0.0000e+00
++5.6474e-01 -9.6957e-02 0.0000e+00
++5.6571e-01 -1.5313e-01 0.0000e+00
++5.6861e-01 -1.9810e-01 0.0000e+00
++5.6354e-01 -2.5327e-01 0.0000e+00
++5.6528e-01 -3.1603e-01 0.0000e+00
++5.6385e-01 -3.6940e-01 0.0000e+00
++5.6126e-01 -4.1475e-01 0.0000e+00
++5.5236e-01 -4.7587e-01 0.0000e+00
++5.5187e-01 -5.3104e-01 0.0000e+00
++5.5738e-01 -5.8045e-01 0.0000e+00
++6.4005e-01 +4.9573e-01 0.0000e+00
++6.3453e-01 +4.5015e-01 0.0000e+00
++6.3212e-01 +3.9528e-01 0.0000e+00
++6.3431e-01 +3.3780e-01 0.0000e+00
++6.2741e-01 +2.8360e-01 0.0000e+00
++6.3352e-01 +2.2581e-01 0.0000e+00
++6.3200e-01 +1.6911e-01 0.0000e+00
++6.2928e-01 +1.2373e-01 0.0000e+00
++6.1928e-01 +6.3806e-02 0.0000e+00
++6.2436e-01 +9.7428e-03 0.0000e+00
++6.2442e-01 -4.0975e-02 0.0000e+00
++6.1645e-01 -9.9825e-02 0.0000e+00
++6.1891e-01 -1.5059e-01 0.0000e+00
++6.2091e-01 -1.9989e-01 0.0000e+00
++6.1579e-01 -2.5969e-01 0.0000e+00
++6.1451e-01 -3.1669e-01 0.0000e+00
++6.1927e-01 -3.6253e-01 0.0000e+00
++6.0947e-01 -4.2014e-01 0.0000e+00
++6.0615e-01 -4.7784e-01 0.0000e+00
++6.1168e-01 -5.3404e-01 0.0000e+00
++6.8343e-01 +3.9196e-01 0.0000e+00
++6.8879e-01 +3.3596e-01 0.0000e+00
++6.8515e-01 +2.8353e-01 0.0000e+00
++6.8152e-01 +2.3097e-01 0.0000e+00
++6.8003e-01 +1.7787e-01 0.0000e+00
++6.7957e-01 +1.1866e-01 0.0000e+00
++6.7330e-01 +7.0142e-02 0.0000e+00
++6.7486e-01 +5.9805e-03 0.0000e+00
++6.7569e-01 -4.6062e-02 0.0000e+00
++6.7010e-01 -1.0141e-01 0.0000e+00
++6.7631e-01 -1.5407e-01 0.0000e+00
++6.7664e-01 -2.0125e-01 0.0000e+00
++6.7175e-01 -2.6044e-01 0.0000e+00
++6.7326e-01 -3.1721e-01 0.0000e+00
++6.7074e-01 -3.7267e-01 0.0000e+00
++6.6541e-01 -4.2049e-01 0.0000e+00
++7.4057e-01 +2.7786e-01 0.0000e+00
++7.3373e-01 +2.2665e-01 0.0000e+00
++7.3306e-01 +1.7005e-01 0.0000e+00
++7.2889e-01 +1.1631e-01 0.0000e+00
++7.3221e-01 +6.6124e-02 0.0000e+00
++7.3408e-01 +5.2760e-03 0.0000e+00
++7.2828e-01 -4.1971e-02 0.0000e+00
++7.3336e-01 -1.0377e-01 0.0000e+00
++7.3144e-01 -1.5438e-01 0.0000e+00
++7.2373e-01 -2.0311e-01 0.0000e+00
++7.2876e-01 -2.6471e-01 0.0000e+00
++7.2578e-01 -3.1673e-01 0.0000e+00
++7.8898e-01 +1.7219e-01 0.0000e+00
++7.9163e-01 +1.1681e-01 0.0000e+00
++7.8861e-01 +6.0643e-02 0.0000e+00
++7.8646e-01 +1.3203e-02 0.0000e+00
++7.8286e-01 -4.5380e-02 0.0000e+00
++7.7872e-01 -1.0381e-01 0.0000e+00
++7.7995e-01 -1.5576e-01 0.0000e+00
++7.7872e-01 -2.0869e-01 0.0000e+00
@@ -0,0 +1,711 @@
+-7.5833e-01 +2.8906e-01 0.0000e+00
+-7.6367e-01 +2.2715e-01 0.0000e+00
+-7.7668e-01 +1.7480e-01 0.0000e+00
+-7.7882e-01 +1.2153e-01 0.0000e+00
+-7.8954e-01 +7.6062e-02 0.0000e+00
+-7.9625e-01 +1.1380e-02 0.0000e+00
+-8.0454e-01 -4.0698e-02 0.0000e+00
+-8.0535e-01 -9.5736e-02 0.0000e+00
+-6.8641e-01 +4.4133e-01 0.0000e+00
+-6.9715e-01 +3.8546e-01 0.0000e+00
+-7.0392e-01 +3.2998e-01 0.0000e+00
+-7.0978e-01 +2.7660e-01 0.0000e+00
+-7.1418e-01 +2.2451e-01 0.0000e+00
+-7.2320e-01 +1.7554e-01 0.0000e+00
+-7.3058e-01 +1.1934e-01 0.0000e+00
+-7.3174e-01 +6.7328e-02 0.0000e+00
+-7.3732e-01 +5.6269e-03 0.0000e+00
+-7.4268e-01 -4.0410e-02 0.0000e+00
+-7.5413e-01 -9.9102e-02 0.0000e+00
+-7.6129e-01 -1.5762e-01 0.0000e+00
+-7.6388e-01 -2.0771e-01 0.0000e+00
+-6.2947e-01 +4.9418e-01 0.0000e+00
+-6.3711e-01 +4.3142e-01 0.0000e+00
+-6.3404e-01 +3.8317e-01 0.0000e+00
+-6.4829e-01 +3.2811e-01 0.0000e+00
+-6.5289e-01 +2.7595e-01 0.0000e+00
+-6.5776e-01 +2.1615e-01 0.0000e+00
+-6.6545e-01 +1.6034e-01 0.0000e+00
+-6.7552e-01 +1.1263e-01 0.0000e+00
+-6.8072e-01 +5.6154e-02 0.0000e+00
+-6.8282e-01 -9.4493e-04 0.0000e+00
+-6.9368e-01 -5.3281e-02 0.0000e+00
+-7.0089e-01 -1.0596e-01 0.0000e+00
+-7.0381e-01 -1.5815e-01 0.0000e+00
+-7.1428e-01 -2.1328e-01 0.0000e+00
+-7.1338e-01 -2.6882e-01 0.0000e+00
+-7.2661e-01 -3.2131e-01 0.0000e+00
+-5.6146e-01 +5.8798e-01 0.0000e+00
+-5.6740e-01 +5.3371e-01 0.0000e+00
+-5.7175e-01 +4.8609e-01 0.0000e+00
+-5.7250e-01 +4.2668e-01 0.0000e+00
+-5.8016e-01 +3.7444e-01 0.0000e+00
+-5.9003e-01 +3.2142e-01 0.0000e+00
+-5.9749e-01 +2.6920e-01 0.0000e+00
+-6.0763e-01 +2.1221e-01 0.0000e+00
+-6.1296e-01 +1.5924e-01 0.0000e+00
+-6.1274e-01 +1.0494e-01 0.0000e+00
+-6.2337e-01 +4.8488e-02 0.0000e+00
+-6.2529e-01 +2.7368e-04 0.0000e+00
+-6.3565e-01 -5.8270e-02 0.0000e+00
+-6.4109e-01 -1.0807e-01 0.0000e+00
+-6.4753e-01 -1.6705e-01 0.0000e+00
+-6.6334e-01 -2.2025e-01 0.0000e+00
+-6.6691e-01 -2.7767e-01 0.0000e+00
+-6.6763e-01 -3.3242e-01 0.0000e+00
+-6.7917e-01 -3.7890e-01 0.0000e+00
+-6.8659e-01 -4.3286e-01 0.0000e+00
+-4.9271e-01 +6.3612e-01 0.0000e+00
+-5.0623e-01 +5.8213e-01 0.0000e+00
+-5.0492e-01 +5.2855e-01 0.0000e+00
+-5.1219e-01 +4.7740e-01 0.0000e+00
+-5.1998e-01 +4.1954e-01 0.0000e+00
+-5.3434e-01 +3.6687e-01 0.0000e+00
+-5.4090e-01 +3.0886e-01 0.0000e+00
+-5.4470e-01 +2.6146e-01 0.0000e+00
+-5.5528e-01 +2.0723e-01 0.0000e+00
+-5.5202e-01 +1.5571e-01 0.0000e+00
+-5.6444e-01 +9.3908e-02 0.0000e+00
+-5.7540e-01 +3.9126e-02 0.0000e+00
+-5.8119e-01 -1.3006e-02 0.0000e+00
+-5.8668e-01 -6.6101e-02 0.0000e+00
+-5.9118e-01 -1.2386e-01 0.0000e+00
+-5.9727e-01 -1.7596e-01 0.0000e+00
+-6.0581e-01 -2.2974e-01 0.0000e+00
+-6.1176e-01 -2.7813e-01 0.0000e+00
+-6.1902e-01 -3.3417e-01 0.0000e+00
+-6.2497e-01 -3.8488e-01 0.0000e+00
+-6.3221e-01 -4.4620e-01 0.0000e+00
+-6.4142e-01 -4.9806e-01 0.0000e+00
+-4.3533e-01 +6.8611e-01 0.0000e+00
+-4.3875e-01 +6.3501e-01 0.0000e+00
+-4.5298e-01 +5.7837e-01 0.0000e+00
+-4.5646e-01 +5.1921e-01 0.0000e+00
+-4.5991e-01 +4.6348e-01 0.0000e+00
+-4.7046e-01 +4.1030e-01 0.0000e+00
+-4.7820e-01 +3.6548e-01 0.0000e+00
+-4.8737e-01 +3.0479e-01 0.0000e+00
+-4.9395e-01 +2.5507e-01 0.0000e+00
+-4.9268e-01 +1.9454e-01 0.0000e+00
+-5.0610e-01 +1.4351e-01 0.0000e+00
+-5.0907e-01 +8.8058e-02 0.0000e+00
+-5.2154e-01 +3.7595e-02 0.0000e+00
+-5.2055e-01 -1.8819e-02 0.0000e+00
+-5.3471e-01 -7.1709e-02 0.0000e+00
+-5.3749e-01 -1.2577e-01 0.0000e+00
+-5.4313e-01 -1.7676e-01 0.0000e+00
+-5.4780e-01 -2.3094e-01 0.0000e+00
+-5.6135e-01 -2.9011e-01 0.0000e+00
+-5.6775e-01 -3.4281e-01 0.0000e+00
+-5.6583e-01 -4.0037e-01 0.0000e+00
+-5.7435e-01 -4.4419e-01 0.0000e+00
+-5.7976e-01 -5.0773e-01 0.0000e+00
+-5.8980e-01 -5.6101e-01 0.0000e+00
+-3.8619e-01 +6.8011e-01 0.0000e+00
+-3.8689e-01 +6.2733e-01 0.0000e+00
+-3.9541e-01 +5.7078e-01 0.0000e+00
+-4.0624e-01 +5.1288e-01 0.0000e+00
+-4.0422e-01 +4.6559e-01 0.0000e+00
+-4.1392e-01 +4.0671e-01 0.0000e+00
+-4.1759e-01 +3.5642e-01 0.0000e+00
+-4.2513e-01 +2.9647e-01 0.0000e+00
+-4.3150e-01 +2.4572e-01 0.0000e+00
+-4.4506e-01 +1.9764e-01 0.0000e+00
+-4.5337e-01 +1.4019e-01 0.0000e+00
+-4.5746e-01 +8.0322e-02 0.0000e+00
+-4.6489e-01 +3.0208e-02 0.0000e+00
+-4.7061e-01 -2.8073e-02 0.0000e+00
+-4.7025e-01 -7.3331e-02 0.0000e+00
+-4.7905e-01 -1.2863e-01 0.0000e+00
+-4.8971e-01 -1.8508e-01 0.0000e+00
+-5.0032e-01 -2.3536e-01 0.0000e+00
+-4.9903e-01 -2.9158e-01 0.0000e+00
+-5.0638e-01 -3.5196e-01 0.0000e+00
+-5.1379e-01 -3.9802e-01 0.0000e+00
+-5.2314e-01 -4.6066e-01 0.0000e+00
+-5.3433e-01 -5.0607e-01 0.0000e+00
+-5.3456e-01 -5.5983e-01 0.0000e+00
+-3.2269e-01 +7.2673e-01 0.0000e+00
+-3.2957e-01 +6.7167e-01 0.0000e+00
+-3.3118e-01 +6.1498e-01 0.0000e+00
+-3.3925e-01 +5.6586e-01 0.0000e+00
+-3.4780e-01 +5.1450e-01 0.0000e+00
+-3.5690e-01 +4.5704e-01 0.0000e+00
+-3.6467e-01 +3.9700e-01 0.0000e+00
+-3.6818e-01 +3.5158e-01 0.0000e+00
+-3.7242e-01 +2.9277e-01 0.0000e+00
+-3.8327e-01 +2.3795e-01 0.0000e+00
+-3.8869e-01 +1.8413e-01 0.0000e+00
+-3.9186e-01 +1.3077e-01 0.0000e+00
+-3.9847e-01 +7.7403e-02 0.0000e+00
+-4.1233e-01 +2.9149e-02 0.0000e+00
+-4.1178e-01 -3.1724e-02 0.0000e+00
+-4.2022e-01 -8.1439e-02 0.0000e+00
+-4.2351e-01 -1.3829e-01 0.0000e+00
+-4.3920e-01 -1.8791e-01 0.0000e+00
+-4.4064e-01 -2.4390e-01 0.0000e+00
+-4.4401e-01 -3.0379e-01 0.0000e+00
+-4.5663e-01 -3.5648e-01 0.0000e+00
+-4.6517e-01 -4.0551e-01 0.0000e+00
+-4.7358e-01 -4.6007e-01 0.0000e+00
+-4.7129e-01 -5.1504e-01 0.0000e+00
+-4.8569e-01 -5.6621e-01 0.0000e+00
+-4.8738e-01 -6.2851e-01 0.0000e+00
+-2.6471e-01 +7.6766e-01 0.0000e+00
+-2.6501e-01 +7.1418e-01 0.0000e+00
+-2.7245e-01 +6.5952e-01 0.0000e+00
+-2.8582e-01 +6.0796e-01 0.0000e+00
+-2.8324e-01 +5.5560e-01 0.0000e+00
+-2.9074e-01 +5.0697e-01 0.0000e+00
+-3.0249e-01 +4.4614e-01 0.0000e+00
+-3.0207e-01 +3.9729e-01 0.0000e+00
+-3.1039e-01 +3.4522e-01 0.0000e+00
+-3.2498e-01 +2.8396e-01 0.0000e+00
+-3.3328e-01 +2.2906e-01 0.0000e+00
+-3.2930e-01 +1.8105e-01 0.0000e+00
+-3.4337e-01 +1.2425e-01 0.0000e+00
+-3.4717e-01 +6.9900e-02 0.0000e+00
+-3.4961e-01 +1.1971e-02 0.0000e+00
+-3.5624e-01 -3.4821e-02 0.0000e+00
+-3.6276e-01 -8.9659e-02 0.0000e+00
+-3.7377e-01 -1.4535e-01 0.0000e+00
+-3.8477e-01 -2.0159e-01 0.0000e+00
+-3.9178e-01 -2.5220e-01 0.0000e+00
+-3.9672e-01 -3.0694e-01 0.0000e+00
+-3.9834e-01 -3.6341e-01 0.0000e+00
+-4.0911e-01 -4.1436e-01 0.0000e+00
+-4.1933e-01 -4.6831e-01 0.0000e+00
+-4.2306e-01 -5.2270e-01 0.0000e+00
+-4.2772e-01 -5.7541e-01 0.0000e+00
+-4.3518e-01 -6.3514e-01 0.0000e+00
+-2.0179e-01 +7.6021e-01 0.0000e+00
+-2.1807e-01 +7.1345e-01 0.0000e+00
+-2.2292e-01 +6.6234e-01 0.0000e+00
+-2.2954e-01 +6.0922e-01 0.0000e+00
+-2.3826e-01 +5.4920e-01 0.0000e+00
+-2.4329e-01 +4.9662e-01 0.0000e+00
+-2.5190e-01 +4.3807e-01 0.0000e+00
+-2.4843e-01 +3.9060e-01 0.0000e+00
+-2.6348e-01 +3.3198e-01 0.0000e+00
+-2.6727e-01 +2.7773e-01 0.0000e+00
+-2.7365e-01 +2.3096e-01 0.0000e+00
+-2.8100e-01 +1.7179e-01 0.0000e+00
+-2.8488e-01 +1.2158e-01 0.0000e+00
+-2.9060e-01 +6.7108e-02 0.0000e+00
+-2.9962e-01 +6.7404e-03 0.0000e+00
+-3.0621e-01 -4.4421e-02 0.0000e+00
+-3.0941e-01 -9.6557e-02 0.0000e+00
+-3.1617e-01 -1.5701e-01 0.0000e+00
+-3.2702e-01 -2.0761e-01 0.0000e+00
+-3.3353e-01 -2.5923e-01 0.0000e+00
+-3.4043e-01 -3.0923e-01 0.0000e+00
+-3.4717e-01 -3.6645e-01 0.0000e+00
+-3.5468e-01 -4.2210e-01 0.0000e+00
+-3.5641e-01 -4.8185e-01 0.0000e+00
+-3.6949e-01 -5.3236e-01 0.0000e+00
+-3.7193e-01 -5.8365e-01 0.0000e+00
+-3.8316e-01 -6.4097e-01 0.0000e+00
+-3.8693e-01 -6.9227e-01 0.0000e+00
+-1.5469e-01 +7.5913e-01 0.0000e+00
+-1.5779e-01 +7.0935e-01 0.0000e+00
+-1.6642e-01 +6.5008e-01 0.0000e+00
+-1.7711e-01 +5.9625e-01 0.0000e+00
+-1.7691e-01 +5.3768e-01 0.0000e+00
+-1.8428e-01 +4.9000e-01 0.0000e+00
+-1.9731e-01 +4.3948e-01 0.0000e+00
+-2.0290e-01 +3.8088e-01 0.0000e+00
+-2.0230e-01 +3.2596e-01 0.0000e+00
+-2.1444e-01 +2.7084e-01 0.0000e+00
+-2.2173e-01 +2.2277e-01 0.0000e+00
+-2.3184e-01 +1.6309e-01 0.0000e+00
+-2.2958e-01 +1.0547e-01 0.0000e+00
+-2.3904e-01 +6.1909e-02 0.0000e+00
+-2.4284e-01 -1.1010e-03 0.0000e+00
+-2.5775e-01 -5.3196e-02 0.0000e+00
+-2.5822e-01 -1.0101e-01 0.0000e+00
+-2.7149e-01 -1.5801e-01 0.0000e+00
+-2.7343e-01 -2.1405e-01 0.0000e+00
+-2.8377e-01 -2.6815e-01 0.0000e+00
+-2.8131e-01 -3.1655e-01 0.0000e+00
+-2.9822e-01 -3.7274e-01 0.0000e+00
+-2.9903e-01 -4.3408e-01 0.0000e+00
+-3.1023e-01 -4.7930e-01 0.0000e+00
+-3.0889e-01 -5.3769e-01 0.0000e+00
+-3.1595e-01 -5.9481e-01 0.0000e+00
+-3.2733e-01 -6.4199e-01 0.0000e+00
+-3.3247e-01 -7.0040e-01 0.0000e+00
+-9.0041e-02 +8.1082e-01 0.0000e+00
+-9.8527e-02 +7.4959e-01 0.0000e+00
+-1.0010e-01 +7.0170e-01 0.0000e+00
+-1.0883e-01 +6.3979e-01 0.0000e+00
+-1.1716e-01 +5.9239e-01 0.0000e+00
+-1.2039e-01 +5.3272e-01 0.0000e+00
+-1.2858e-01 +4.8481e-01 0.0000e+00
+-1.4402e-01 +4.2857e-01 0.0000e+00
+-1.4808e-01 +3.7290e-01 0.0000e+00
+-1.5199e-01 +3.1743e-01 0.0000e+00
+-1.5992e-01 +2.6456e-01 0.0000e+00
+-1.6609e-01 +2.1433e-01 0.0000e+00
+-1.7261e-01 +1.5935e-01 0.0000e+00
+-1.7887e-01 +1.0802e-01 0.0000e+00
+-1.8381e-01 +4.4914e-02 0.0000e+00
+-1.9657e-01 +6.1603e-04 0.0000e+00
+-2.0408e-01 -5.6691e-02 0.0000e+00
+-2.0516e-01 -1.1202e-01 0.0000e+00
+-2.1658e-01 -1.6739e-01 0.0000e+00
+-2.1805e-01 -2.1722e-01 0.0000e+00
+-2.2886e-01 -2.7589e-01 0.0000e+00
+-2.3206e-01 -3.2361e-01 0.0000e+00
+-2.4156e-01 -3.8094e-01 0.0000e+00
+-2.4454e-01 -4.3939e-01 0.0000e+00
+-2.5000e-01 -4.8878e-01 0.0000e+00
+-2.6374e-01 -5.4426e-01 0.0000e+00
+-2.6587e-01 -5.9531e-01 0.0000e+00
+-2.7256e-01 -6.5229e-01 0.0000e+00
+-2.8300e-01 -7.0598e-01 0.0000e+00
+-2.8876e-01 -7.5691e-01 0.0000e+00
+-3.4223e-02 +7.9976e-01 0.0000e+00
+-4.2290e-02 +7.4680e-01 0.0000e+00
+-5.1851e-02 +6.9313e-01 0.0000e+00
+-5.5887e-02 +6.4168e-01 0.0000e+00
+-6.5592e-02 +5.8681e-01 0.0000e+00
+-6.6497e-02 +5.2528e-01 0.0000e+00
+-8.0360e-02 +4.7254e-01 0.0000e+00
+-8.1451e-02 +4.2374e-01 0.0000e+00
+-8.9137e-02 +3.7253e-01 0.0000e+00
+-9.8683e-02 +3.1024e-01 0.0000e+00
+-1.0768e-01 +2.5800e-01 0.0000e+00
+-1.1351e-01 +2.0682e-01 0.0000e+00
+-1.1781e-01 +1.5537e-01 0.0000e+00
+-1.2028e-01 +9.3109e-02 0.0000e+00
+-1.2858e-01 +4.3329e-02 0.0000e+00
+-1.3533e-01 -1.4907e-02 0.0000e+00
+-1.4556e-01 -6.1591e-02 0.0000e+00
+-1.5558e-01 -1.1555e-01 0.0000e+00
+-1.5978e-01 -1.7187e-01 0.0000e+00
+-1.6593e-01 -2.2735e-01 0.0000e+00
+-1.7516e-01 -2.7622e-01 0.0000e+00
+-1.8104e-01 -3.3500e-01 0.0000e+00
+-1.9050e-01 -3.8795e-01 0.0000e+00
+-1.9207e-01 -4.4415e-01 0.0000e+00
+-2.0212e-01 -4.9054e-01 0.0000e+00
+-1.9980e-01 -5.4543e-01 0.0000e+00
+-2.1451e-01 -6.0364e-01 0.0000e+00
+-2.2163e-01 -6.5526e-01 0.0000e+00
+-2.2730e-01 -7.1450e-01 0.0000e+00
+-2.2804e-01 -7.6794e-01 0.0000e+00
++1.1369e-02 +7.8905e-01 0.0000e+00
++9.3946e-03 +7.3423e-01 0.0000e+00
++8.1553e-03 +6.8434e-01 0.0000e+00
+-8.3142e-03 +6.3652e-01 0.0000e+00
+-1.1023e-02 +5.8157e-01 0.0000e+00
+-1.2300e-02 +5.2737e-01 0.0000e+00
+-2.4724e-02 +4.7030e-01 0.0000e+00
+-2.9111e-02 +4.0987e-01 0.0000e+00
+-3.3936e-02 +3.6095e-01 0.0000e+00
+-4.3830e-02 +3.0402e-01 0.0000e+00
+-4.5860e-02 +2.5389e-01 0.0000e+00
+-5.5089e-02 +1.9653e-01 0.0000e+00
+-6.9128e-02 +1.4896e-01 0.0000e+00
+-6.9091e-02 +8.9545e-02 0.0000e+00
+-7.7901e-02 +3.4347e-02 0.0000e+00
+-8.2377e-02 -1.8639e-02 0.0000e+00
+-9.2420e-02 -6.9626e-02 0.0000e+00
+-9.8175e-02 -1.2733e-01 0.0000e+00
+-1.0583e-01 -1.8297e-01 0.0000e+00
+-1.0845e-01 -2.3718e-01 0.0000e+00
+-1.1728e-01 -2.8587e-01 0.0000e+00
+-1.2028e-01 -3.4631e-01 0.0000e+00
+-1.3621e-01 -3.9797e-01 0.0000e+00
+-1.4216e-01 -4.4927e-01 0.0000e+00
+-1.4046e-01 -5.0024e-01 0.0000e+00
+-1.5466e-01 -5.5373e-01 0.0000e+00
+-1.6002e-01 -6.0597e-01 0.0000e+00
+-1.6593e-01 -6.5979e-01 0.0000e+00
+-1.7501e-01 -7.1829e-01 0.0000e+00
+-1.7297e-01 -7.7218e-01 0.0000e+00
++7.1292e-02 +7.8780e-01 0.0000e+00
++6.2074e-02 +7.3505e-01 0.0000e+00
++6.0236e-02 +6.8123e-01 0.0000e+00
++5.4173e-02 +6.2830e-01 0.0000e+00
++4.2183e-02 +5.6857e-01 0.0000e+00
++4.0560e-02 +5.1612e-01 0.0000e+00
++3.0019e-02 +4.5848e-01 0.0000e+00
++2.6955e-02 +4.0854e-01 0.0000e+00
++1.3525e-02 +3.5651e-01 0.0000e+00
++1.4661e-02 +3.0031e-01 0.0000e+00
++1.8212e-03 +2.4415e-01 0.0000e+00
+-5.4526e-03 +1.9771e-01 0.0000e+00
+-6.2419e-03 +1.3362e-01 0.0000e+00
+-1.2041e-02 +8.0573e-02 0.0000e+00
+-2.8123e-02 +2.7867e-02 0.0000e+00
+-3.3484e-02 -1.9922e-02 0.0000e+00
+-3.9460e-02 -8.0187e-02 0.0000e+00
+-4.6138e-02 -1.2798e-01 0.0000e+00
+-5.5038e-02 -1.8845e-01 0.0000e+00
+-5.6571e-02 -2.4281e-01 0.0000e+00
+-6.4743e-02 -2.9726e-01 0.0000e+00
+-6.5566e-02 -3.4542e-01 0.0000e+00
+-8.0849e-02 -4.0281e-01 0.0000e+00
+-8.0323e-02 -4.5512e-01 0.0000e+00
+-9.0212e-02 -5.1456e-01 0.0000e+00
+-9.5024e-02 -5.5950e-01 0.0000e+00
+-1.0206e-01 -6.1585e-01 0.0000e+00
+-1.1278e-01 -6.7488e-01 0.0000e+00
+-1.1738e-01 -7.2497e-01 0.0000e+00
+-1.2460e-01 -7.7519e-01 0.0000e+00
++1.2419e-01 +7.7523e-01 0.0000e+00
++1.2231e-01 +7.2543e-01 0.0000e+00
++1.1093e-01 +6.6950e-01 0.0000e+00
++1.0676e-01 +6.2054e-01 0.0000e+00
++9.9698e-02 +5.6310e-01 0.0000e+00
++8.7879e-02 +5.0659e-01 0.0000e+00
++8.1965e-02 +4.5422e-01 0.0000e+00
++7.2073e-02 +4.0299e-01 0.0000e+00
++6.6984e-02 +3.4596e-01 0.0000e+00
++6.1987e-02 +2.9590e-01 0.0000e+00
++5.4163e-02 +2.4000e-01 0.0000e+00
++5.2949e-02 +1.8525e-01 0.0000e+00
++4.8074e-02 +1.3425e-01 0.0000e+00
++3.4051e-02 +7.4058e-02 0.0000e+00
++3.3572e-02 +2.4491e-02 0.0000e+00
++1.9730e-02 -3.4522e-02 0.0000e+00
++2.1003e-02 -8.0825e-02 0.0000e+00
++1.3105e-02 -1.3959e-01 0.0000e+00
+-1.1678e-03 -1.8928e-01 0.0000e+00
+-6.3432e-03 -2.4892e-01 0.0000e+00
+-1.1133e-02 -3.0475e-01 0.0000e+00
+-1.5768e-02 -3.5114e-01 0.0000e+00
+-2.5612e-02 -4.0492e-01 0.0000e+00
+-2.7678e-02 -4.6737e-01 0.0000e+00
+-3.2208e-02 -5.1534e-01 0.0000e+00
+-4.0998e-02 -5.7033e-01 0.0000e+00
+-4.5179e-02 -6.2693e-01 0.0000e+00
+-6.0145e-02 -6.7617e-01 0.0000e+00
+-6.2136e-02 -7.3750e-01 0.0000e+00
+-7.3325e-02 -7.8501e-01 0.0000e+00
++1.7790e-01 +7.6976e-01 0.0000e+00
++1.7275e-01 +7.2337e-01 0.0000e+00
++1.7018e-01 +6.6437e-01 0.0000e+00
++1.5588e-01 +6.0703e-01 0.0000e+00
++1.5595e-01 +5.5665e-01 0.0000e+00
++1.4246e-01 +5.0273e-01 0.0000e+00
++1.3537e-01 +4.4987e-01 0.0000e+00
++1.2927e-01 +3.9030e-01 0.0000e+00
++1.3031e-01 +3.4376e-01 0.0000e+00
++1.1234e-01 +2.8505e-01 0.0000e+00
++1.0812e-01 +2.3785e-01 0.0000e+00
++1.0330e-01 +1.7711e-01 0.0000e+00
++1.0161e-01 +1.2693e-01 0.0000e+00
++8.7936e-02 +7.1676e-02 0.0000e+00
++8.8492e-02 +1.6040e-02 0.0000e+00
++7.8042e-02 -3.3885e-02 0.0000e+00
++7.0508e-02 -9.6353e-02 0.0000e+00
++6.2259e-02 -1.4625e-01 0.0000e+00
++6.1460e-02 -2.0278e-01 0.0000e+00
++5.4017e-02 -2.5225e-01 0.0000e+00
++4.0315e-02 -3.0577e-01 0.0000e+00
++3.6450e-02 -3.5725e-01 0.0000e+00
++3.1989e-02 -4.1489e-01 0.0000e+00
++1.8673e-02 -4.6831e-01 0.0000e+00
++2.1555e-02 -5.2378e-01 0.0000e+00
++1.0627e-02 -5.7382e-01 0.0000e+00
++1.3350e-03 -6.3008e-01 0.0000e+00
++2.5711e-03 -6.8490e-01 0.0000e+00
+-9.9683e-03 -7.4096e-01 0.0000e+00
+-2.1048e-02 -7.9120e-01 0.0000e+00
++2.3135e-01 +7.6701e-01 0.0000e+00
++2.2516e-01 +7.1401e-01 0.0000e+00
++2.2022e-01 +6.6064e-01 0.0000e+00
++2.1681e-01 +6.0249e-01 0.0000e+00
++2.0374e-01 +5.5438e-01 0.0000e+00
++1.9443e-01 +5.0093e-01 0.0000e+00
++1.8829e-01 +4.4274e-01 0.0000e+00
++1.8437e-01 +3.9091e-01 0.0000e+00
++1.7277e-01 +3.3071e-01 0.0000e+00
++1.7547e-01 +2.7650e-01 0.0000e+00
++1.6154e-01 +2.3213e-01 0.0000e+00
++1.5557e-01 +1.7681e-01 0.0000e+00
++1.4930e-01 +1.2336e-01 0.0000e+00
++1.4947e-01 +6.3739e-02 0.0000e+00
++1.3643e-01 +8.0123e-03 0.0000e+00
++1.3026e-01 -4.8226e-02 0.0000e+00
++1.2326e-01 -9.4868e-02 0.0000e+00
++1.1809e-01 -1.5346e-01 0.0000e+00
++1.1326e-01 -2.0358e-01 0.0000e+00
++1.0199e-01 -2.5784e-01 0.0000e+00
++9.6374e-02 -3.1781e-01 0.0000e+00
++9.0790e-02 -3.6834e-01 0.0000e+00
++8.7473e-02 -4.1868e-01 0.0000e+00
++7.4054e-02 -4.7422e-01 0.0000e+00
++7.0267e-02 -5.2892e-01 0.0000e+00
++6.1183e-02 -5.7909e-01 0.0000e+00
++5.7783e-02 -6.4098e-01 0.0000e+00
++5.0724e-02 -6.9601e-01 0.0000e+00
++4.4063e-02 -7.4987e-01 0.0000e+00
++3.3116e-02 -8.0388e-01 0.0000e+00
++2.8992e-01 +7.5419e-01 0.0000e+00
++2.7594e-01 +7.0635e-01 0.0000e+00
++2.7083e-01 +6.5504e-01 0.0000e+00
++2.6539e-01 +5.9827e-01 0.0000e+00
++2.6084e-01 +5.4155e-01 0.0000e+00
++2.5122e-01 +4.9355e-01 0.0000e+00
++2.5154e-01 +4.3718e-01 0.0000e+00
++2.3553e-01 +3.8497e-01 0.0000e+00
++2.2770e-01 +3.2623e-01 0.0000e+00
++2.2459e-01 +2.7859e-01 0.0000e+00
++2.1625e-01 +2.1705e-01 0.0000e+00
++2.0952e-01 +1.6962e-01 0.0000e+00
++2.0239e-01 +1.1601e-01 0.0000e+00
++1.9601e-01 +5.6134e-02 0.0000e+00
++1.9171e-01 -1.7290e-03 0.0000e+00
++1.8925e-01 -5.5041e-02 0.0000e+00
++1.7853e-01 -1.0704e-01 0.0000e+00
++1.7115e-01 -1.5445e-01 0.0000e+00
++1.6401e-01 -2.0919e-01 0.0000e+00
++1.5931e-01 -2.6148e-01 0.0000e+00
++1.5105e-01 -3.2141e-01 0.0000e+00
++1.4983e-01 -3.7450e-01 0.0000e+00
++1.4387e-01 -4.2788e-01 0.0000e+00
++1.3106e-01 -4.7940e-01 0.0000e+00
++1.2941e-01 -5.3369e-01 0.0000e+00
++1.1567e-01 -5.8733e-01 0.0000e+00
++1.1602e-01 -6.4598e-01 0.0000e+00
++1.0136e-01 -6.9942e-01 0.0000e+00
++9.5885e-02 -7.5348e-01 0.0000e+00
++9.6591e-02 -8.0415e-01 0.0000e+00
++3.3257e-01 +6.9925e-01 0.0000e+00
++3.2392e-01 +6.4761e-01 0.0000e+00
++3.1600e-01 +5.8955e-01 0.0000e+00
++3.0987e-01 +5.3954e-01 0.0000e+00
++3.1107e-01 +4.8530e-01 0.0000e+00
++2.9583e-01 +4.2479e-01 0.0000e+00
++2.9265e-01 +3.7209e-01 0.0000e+00
++2.8842e-01 +3.2016e-01 0.0000e+00
++2.7859e-01 +2.6491e-01 0.0000e+00
++2.6779e-01 +2.1211e-01 0.0000e+00
++2.6584e-01 +1.6346e-01 0.0000e+00
++2.6328e-01 +9.9190e-02 0.0000e+00
++2.5050e-01 +5.3055e-02 0.0000e+00
++2.4469e-01 -1.3905e-03 0.0000e+00
++2.4220e-01 -5.7259e-02 0.0000e+00
++2.2826e-01 -1.0657e-01 0.0000e+00
++2.2724e-01 -1.6130e-01 0.0000e+00
++2.1979e-01 -2.1520e-01 0.0000e+00
++2.1501e-01 -2.7818e-01 0.0000e+00
++2.0809e-01 -3.2739e-01 0.0000e+00
++1.9618e-01 -3.7792e-01 0.0000e+00
++1.9756e-01 -4.3204e-01 0.0000e+00
++1.8889e-01 -4.9016e-01 0.0000e+00
++1.7520e-01 -5.4224e-01 0.0000e+00
++1.6925e-01 -5.9601e-01 0.0000e+00
++1.7037e-01 -6.5593e-01 0.0000e+00
++1.5846e-01 -7.0458e-01 0.0000e+00
++1.5141e-01 -7.5492e-01 0.0000e+00
++3.8766e-01 +6.9702e-01 0.0000e+00
++3.8344e-01 +6.4090e-01 0.0000e+00
++3.7817e-01 +5.8246e-01 0.0000e+00
++3.6523e-01 +5.2919e-01 0.0000e+00
++3.6109e-01 +4.8150e-01 0.0000e+00
++3.5484e-01 +4.2552e-01 0.0000e+00
++3.4856e-01 +3.7334e-01 0.0000e+00
++3.3605e-01 +3.1925e-01 0.0000e+00
++3.3538e-01 +2.6423e-01 0.0000e+00
++3.2829e-01 +2.0683e-01 0.0000e+00
++3.2397e-01 +1.5704e-01 0.0000e+00
++3.1732e-01 +1.0155e-01 0.0000e+00
++3.0830e-01 +4.4225e-02 0.0000e+00
++2.9607e-01 -1.4226e-02 0.0000e+00
++2.9742e-01 -6.1482e-02 0.0000e+00
++2.8205e-01 -1.2076e-01 0.0000e+00
++2.7650e-01 -1.7063e-01 0.0000e+00
++2.7048e-01 -2.2672e-01 0.0000e+00
++2.6133e-01 -2.8184e-01 0.0000e+00
++2.6287e-01 -3.3067e-01 0.0000e+00
++2.4818e-01 -3.8901e-01 0.0000e+00
++2.4164e-01 -4.3870e-01 0.0000e+00
++2.4158e-01 -4.9067e-01 0.0000e+00
++2.3006e-01 -5.5137e-01 0.0000e+00
++2.2161e-01 -6.0230e-01 0.0000e+00
++2.1977e-01 -6.6145e-01 0.0000e+00
++2.1094e-01 -7.1346e-01 0.0000e+00
++2.0532e-01 -7.6950e-01 0.0000e+00
++4.3816e-01 +6.3491e-01 0.0000e+00
++4.3115e-01 +5.8123e-01 0.0000e+00
++4.1941e-01 +5.2388e-01 0.0000e+00
++4.1356e-01 +4.6850e-01 0.0000e+00
++4.1190e-01 +4.1510e-01 0.0000e+00
++4.0076e-01 +3.5981e-01 0.0000e+00
++3.9613e-01 +3.1066e-01 0.0000e+00
++3.8645e-01 +2.4932e-01 0.0000e+00
++3.8000e-01 +1.9912e-01 0.0000e+00
++3.7983e-01 +1.4689e-01 0.0000e+00
++3.6291e-01 +9.2429e-02 0.0000e+00
++3.6143e-01 +4.1264e-02 0.0000e+00
++3.5017e-01 -1.0719e-02 0.0000e+00
++3.4387e-01 -7.3728e-02 0.0000e+00
++3.4498e-01 -1.2932e-01 0.0000e+00
++3.3975e-01 -1.7413e-01 0.0000e+00
++3.2744e-01 -2.3084e-01 0.0000e+00
++3.1821e-01 -2.8082e-01 0.0000e+00
++3.1606e-01 -3.4147e-01 0.0000e+00
++3.0196e-01 -3.9545e-01 0.0000e+00
++3.0111e-01 -4.4508e-01 0.0000e+00
++2.9091e-01 -5.0283e-01 0.0000e+00
++2.8452e-01 -5.5964e-01 0.0000e+00
++2.7682e-01 -6.0736e-01 0.0000e+00
++2.7581e-01 -6.6675e-01 0.0000e+00
++2.6813e-01 -7.1871e-01 0.0000e+00
++2.5794e-01 -7.6811e-01 0.0000e+00
++4.9185e-01 +6.2766e-01 0.0000e+00
++4.8398e-01 +5.7271e-01 0.0000e+00
++4.7089e-01 +5.2255e-01 0.0000e+00
++4.7242e-01 +4.6333e-01 0.0000e+00
++4.5762e-01 +4.0463e-01 0.0000e+00
++4.5167e-01 +3.6028e-01 0.0000e+00
++4.4796e-01 +3.0209e-01 0.0000e+00
++4.4299e-01 +2.4588e-01 0.0000e+00
++4.3889e-01 +1.8990e-01 0.0000e+00
++4.3272e-01 +1.4040e-01 0.0000e+00
++4.1777e-01 +8.1408e-02 0.0000e+00
++4.1065e-01 +2.9100e-02 0.0000e+00
++4.0793e-01 -2.4877e-02 0.0000e+00
++4.0122e-01 -8.0281e-02 0.0000e+00
++3.9342e-01 -1.2661e-01 0.0000e+00
++3.8898e-01 -1.8407e-01 0.0000e+00
++3.7587e-01 -2.4385e-01 0.0000e+00
++3.7134e-01 -2.9176e-01 0.0000e+00
++3.7148e-01 -3.4325e-01 0.0000e+00
++3.6451e-01 -4.0307e-01 0.0000e+00
++3.5230e-01 -4.5338e-01 0.0000e+00
++3.4782e-01 -5.0837e-01 0.0000e+00
++3.4014e-01 -5.6308e-01 0.0000e+00
++3.3306e-01 -6.1995e-01 0.0000e+00
++3.3134e-01 -6.7583e-01 0.0000e+00
++3.1938e-01 -7.2814e-01 0.0000e+00
++5.3292e-01 +5.6544e-01 0.0000e+00
++5.3146e-01 +5.1344e-01 0.0000e+00
++5.2267e-01 +4.5107e-01 0.0000e+00
++5.1595e-01 +4.0540e-01 0.0000e+00
++5.1276e-01 +3.4956e-01 0.0000e+00
++5.0155e-01 +2.9317e-01 0.0000e+00
++5.0055e-01 +2.3670e-01 0.0000e+00
++4.8497e-01 +1.8866e-01 0.0000e+00
++4.7903e-01 +1.3180e-01 0.0000e+00
++4.7092e-01 +7.7050e-02 0.0000e+00
++4.6447e-01 +2.1971e-02 0.0000e+00
++4.5714e-01 -3.4379e-02 0.0000e+00
++4.5562e-01 -7.9094e-02 0.0000e+00
++4.4721e-01 -1.3946e-01 0.0000e+00
++4.4209e-01 -1.8900e-01 0.0000e+00
++4.3401e-01 -2.4910e-01 0.0000e+00
++4.2909e-01 -2.9631e-01 0.0000e+00
++4.2112e-01 -3.5414e-01 0.0000e+00
++4.1981e-01 -4.0825e-01 0.0000e+00
++4.1028e-01 -4.5691e-01 0.0000e+00
++4.0251e-01 -5.1092e-01 0.0000e+00
++3.9232e-01 -5.7191e-01 0.0000e+00
++3.8533e-01 -6.1983e-01 0.0000e+00
++3.7895e-01 -6.7777e-01 0.0000e+00
++5.9266e-01 +5.6086e-01 0.0000e+00
++5.8729e-01 +5.0107e-01 0.0000e+00
++5.8108e-01 +4.4974e-01 0.0000e+00
++5.7442e-01 +3.9799e-01 0.0000e+00
++5.6700e-01 +3.3707e-01 0.0000e+00
++5.5568e-01 +2.9103e-01 0.0000e+00
++5.4761e-01 +2.3323e-01 0.0000e+00
++5.4327e-01 +1.8393e-01 0.0000e+00
++5.3367e-01 +1.3039e-01 0.0000e+00
++5.3517e-01 +7.1234e-02 0.0000e+00
++5.2136e-01 +1.6440e-02 0.0000e+00
++5.1598e-01 -4.0620e-02 0.0000e+00
++5.1365e-01 -8.6805e-02 0.0000e+00
++5.0280e-01 -1.4048e-01 0.0000e+00
++5.0122e-01 -1.9685e-01 0.0000e+00
++4.9008e-01 -2.5181e-01 0.0000e+00
++4.8549e-01 -3.0414e-01 0.0000e+00
++4.7301e-01 -3.6085e-01 0.0000e+00
++4.7115e-01 -4.0959e-01 0.0000e+00
++4.6042e-01 -4.7026e-01 0.0000e+00
++4.5063e-01 -5.2709e-01 0.0000e+00
++4.5063e-01 -5.7761e-01 0.0000e+00
++4.4356e-01 -6.2731e-01 0.0000e+00
++4.3860e-01 -6.8635e-01 0.0000e+00
++6.4064e-01 +4.9598e-01 0.0000e+00
++6.3294e-01 +4.3951e-01 0.0000e+00
++6.2674e-01 +3.8789e-01 0.0000e+00
++6.1820e-01 +3.3733e-01 0.0000e+00
++6.1117e-01 +2.8063e-01 0.0000e+00
++6.0082e-01 +2.3065e-01 0.0000e+00
++5.9441e-01 +1.7032e-01 0.0000e+00
++5.8593e-01 +1.1366e-01 0.0000e+00
++5.8762e-01 +6.1042e-02 0.0000e+00
++5.8093e-01 +8.7586e-03 0.0000e+00
++5.7313e-01 -4.8235e-02 0.0000e+00
++5.6492e-01 -9.2989e-02 0.0000e+00
++5.5505e-01 -1.5343e-01 0.0000e+00
++5.5040e-01 -2.0971e-01 0.0000e+00
++5.4880e-01 -2.5496e-01 0.0000e+00
++5.3821e-01 -3.0962e-01 0.0000e+00
++5.3368e-01 -3.7256e-01 0.0000e+00
++5.2691e-01 -4.2578e-01 0.0000e+00
++5.1978e-01 -4.7088e-01 0.0000e+00
++5.0477e-01 -5.3111e-01 0.0000e+00
++4.9876e-01 -5.8622e-01 0.0000e+00
++4.9933e-01 -6.3619e-01 0.0000e+00
++6.8962e-01 +4.3172e-01 0.0000e+00
++6.7955e-01 +3.8670e-01 0.0000e+00
++6.7165e-01 +3.3207e-01 0.0000e+00
++6.6809e-01 +2.7437e-01 0.0000e+00
++6.5577e-01 +2.2086e-01 0.0000e+00
++6.5610e-01 +1.6246e-01 0.0000e+00
++6.4891e-01 +1.0591e-01 0.0000e+00
++6.4165e-01 +6.0800e-02 0.0000e+00
++6.2566e-01 +1.8782e-03 0.0000e+00
++6.2533e-01 -5.2693e-02 0.0000e+00
++6.2032e-01 -1.0342e-01 0.0000e+00
++6.0646e-01 -1.6147e-01 0.0000e+00
++6.0385e-01 -2.1248e-01 0.0000e+00
++6.0092e-01 -2.6198e-01 0.0000e+00
++5.8982e-01 -3.2127e-01 0.0000e+00
++5.8284e-01 -3.7814e-01 0.0000e+00
++5.8302e-01 -4.2445e-01 0.0000e+00
++5.6746e-01 -4.8108e-01 0.0000e+00
++5.5837e-01 -5.3846e-01 0.0000e+00
++5.5827e-01 -5.9521e-01 0.0000e+00
++7.2262e-01 +3.2361e-01 0.0000e+00
++7.2239e-01 +2.6708e-01 0.0000e+00
++7.1350e-01 +2.1502e-01 0.0000e+00
++7.0462e-01 +1.6282e-01 0.0000e+00
++6.9782e-01 +1.0987e-01 0.0000e+00
++6.9144e-01 +5.0707e-02 0.0000e+00
++6.8031e-01 +2.8130e-03 0.0000e+00
++6.7546e-01 -6.1506e-02 0.0000e+00
++6.7108e-01 -1.1363e-01 0.0000e+00
++6.5996e-01 -1.6842e-01 0.0000e+00
++6.6090e-01 -2.2170e-01 0.0000e+00
++6.5652e-01 -2.6891e-01 0.0000e+00
++6.4570e-01 -3.2761e-01 0.0000e+00
++6.4153e-01 -3.8453e-01 0.0000e+00
++6.3347e-01 -4.3974e-01 0.0000e+00
++6.2336e-01 -4.8703e-01 0.0000e+00
++7.6835e-01 +2.0380e-01 0.0000e+00
++7.5639e-01 +1.5327e-01 0.0000e+00
++7.5007e-01 +9.6742e-02 0.0000e+00
++7.4052e-01 +4.3418e-02 0.0000e+00
++7.3882e-01 -7.0970e-03 0.0000e+00
++7.3461e-01 -6.8132e-02 0.0000e+00
++7.2408e-01 -1.1480e-01 0.0000e+00
++7.2298e-01 -1.7711e-01 0.0000e+00
++7.1600e-01 -2.2753e-01 0.0000e+00
++7.0342e-01 -2.7548e-01 0.0000e+00
++7.0228e-01 -3.3758e-01 0.0000e+00
++6.9410e-01 -3.8931e-01 0.0000e+00
++8.0620e-01 +9.3295e-02 0.0000e+00
++8.0331e-01 +3.7643e-02 0.0000e+00
++7.9468e-01 -1.8218e-02 0.0000e+00
++7.8778e-01 -6.5443e-02 0.0000e+00
++7.7832e-01 -1.2367e-01 0.0000e+00
++7.6834e-01 -1.8168e-01 0.0000e+00
++7.6437e-01 -2.3375e-01 0.0000e+00
++7.5786e-01 -2.8656e-01 0.0000e+00
@@ -0,0 +1,711 @@
+-7.2942e-01 +3.6490e-01 0.0000e+00
+-7.4096e-01 +3.0352e-01 0.0000e+00
+-7.5920e-01 +2.5247e-01 0.0000e+00
+-7.6666e-01 +1.9941e-01 0.0000e+00
+-7.8194e-01 +1.5502e-01 0.0000e+00
+-7.9511e-01 +9.1005e-02 0.0000e+00
+-8.0861e-01 +3.9755e-02 0.0000e+00
+-8.1492e-01 -1.5201e-02 0.0000e+00
+-6.4227e-01 +5.0997e-01 0.0000e+00
+-6.5860e-01 +4.5518e-01 0.0000e+00
+-6.7092e-01 +4.0037e-01 0.0000e+00
+-6.8212e-01 +3.4757e-01 0.0000e+00
+-6.9173e-01 +2.9593e-01 0.0000e+00
+-7.0564e-01 +2.4786e-01 0.0000e+00
+-7.1865e-01 +1.9240e-01 0.0000e+00
+-7.2501e-01 +1.4050e-01 0.0000e+00
+-7.3675e-01 +7.9359e-02 0.0000e+00
+-7.4672e-01 +3.3858e-02 0.0000e+00
+-7.6404e-01 -2.3688e-02 0.0000e+00
+-7.7705e-01 -8.1493e-02 0.0000e+00
+-7.8465e-01 -1.3132e-01 0.0000e+00
+-5.8005e-01 +5.5713e-01 0.0000e+00
+-5.9396e-01 +4.9513e-01 0.0000e+00
+-5.9573e-01 +4.4657e-01 0.0000e+00
+-6.1548e-01 +3.9294e-01 0.0000e+00
+-6.2529e-01 +3.4123e-01 0.0000e+00
+-6.3614e-01 +2.8192e-01 0.0000e+00
+-6.4941e-01 +2.2689e-01 0.0000e+00
+-6.6425e-01 +1.8019e-01 0.0000e+00
+-6.7511e-01 +1.2423e-01 0.0000e+00
+-6.8291e-01 +6.7337e-02 0.0000e+00
+-6.9901e-01 +1.6087e-02 0.0000e+00
+-7.1149e-01 -3.5871e-02 0.0000e+00
+-7.1963e-01 -8.7771e-02 0.0000e+00
+-7.3561e-01 -1.4186e-01 0.0000e+00
+-7.4026e-01 -1.9748e-01 0.0000e+00
+-7.5874e-01 -2.4865e-01 0.0000e+00
+-5.0266e-01 +6.4412e-01 0.0000e+00
+-5.1403e-01 +5.9045e-01 0.0000e+00
+-5.2314e-01 +5.4327e-01 0.0000e+00
+-5.2983e-01 +4.8393e-01 0.0000e+00
+-5.4272e-01 +4.3246e-01 0.0000e+00
+-5.5789e-01 +3.8042e-01 0.0000e+00
+-5.7057e-01 +3.2895e-01 0.0000e+00
+-5.8641e-01 +2.7297e-01 0.0000e+00
+-5.9704e-01 +2.2053e-01 0.0000e+00
+-6.0225e-01 +1.6621e-01 0.0000e+00
+-6.1853e-01 +1.1082e-01 0.0000e+00
+-6.2526e-01 +6.2803e-02 0.0000e+00
+-6.4148e-01 +5.2951e-03 0.0000e+00
+-6.5190e-01 -4.3964e-02 0.0000e+00
+-6.6424e-01 -1.0229e-01 0.0000e+00
+-6.8536e-01 -1.5392e-01 0.0000e+00
+-6.9468e-01 -2.1098e-01 0.0000e+00
+-7.0087e-01 -2.6566e-01 0.0000e+00
+-7.1706e-01 -3.1099e-01 0.0000e+00
+-7.2988e-01 -3.6420e-01 0.0000e+00
+-4.2910e-01 +6.8539e-01 0.0000e+00
+-4.4802e-01 +6.3276e-01 0.0000e+00
+-4.5207e-01 +5.7904e-01 0.0000e+00
+-4.6445e-01 +5.2862e-01 0.0000e+00
+-4.7802e-01 +4.7154e-01 0.0000e+00
+-4.9765e-01 +4.2031e-01 0.0000e+00
+-5.1002e-01 +3.6295e-01 0.0000e+00
+-5.1856e-01 +3.1593e-01 0.0000e+00
+-5.3456e-01 +2.6276e-01 0.0000e+00
+-5.3645e-01 +2.1091e-01 0.0000e+00
+-5.5505e-01 +1.5035e-01 0.0000e+00
+-5.7149e-01 +9.6667e-02 0.0000e+00
+-5.8249e-01 +4.5114e-02 0.0000e+00
+-5.9329e-01 -7.4328e-03 0.0000e+00
+-6.0356e-01 -6.4739e-02 0.0000e+00
+-6.1487e-01 -1.1624e-01 0.0000e+00
+-6.2878e-01 -1.6916e-01 0.0000e+00
+-6.3957e-01 -2.1696e-01 0.0000e+00
+-6.5244e-01 -2.7227e-01 0.0000e+00
+-6.6346e-01 -3.2239e-01 0.0000e+00
+-6.7683e-01 -3.8298e-01 0.0000e+00
+-6.9122e-01 -4.3392e-01 0.0000e+00
+-3.6672e-01 +7.2965e-01 0.0000e+00
+-3.7525e-01 +6.7888e-01 0.0000e+00
+-3.9515e-01 +6.2367e-01 0.0000e+00
+-4.0454e-01 +5.6486e-01 0.0000e+00
+-4.1356e-01 +5.0947e-01 0.0000e+00
+-4.2943e-01 +4.5734e-01 0.0000e+00
+-4.4165e-01 +4.1330e-01 0.0000e+00
+-4.5689e-01 +3.5353e-01 0.0000e+00
+-4.6844e-01 +3.0447e-01 0.0000e+00
+-4.7322e-01 +2.4381e-01 0.0000e+00
+-4.9175e-01 +1.9412e-01 0.0000e+00
+-5.0026e-01 +1.3896e-01 0.0000e+00
+-5.1778e-01 +8.9749e-02 0.0000e+00
+-5.2244e-01 +3.3236e-02 0.0000e+00
+-5.4188e-01 -1.8238e-02 0.0000e+00
+-5.5007e-01 -7.2024e-02 0.0000e+00
+-5.6080e-01 -1.2245e-01 0.0000e+00
+-5.7089e-01 -1.7616e-01 0.0000e+00
+-5.9036e-01 -2.3398e-01 0.0000e+00
+-6.0203e-01 -2.8604e-01 0.0000e+00
+-6.0586e-01 -3.4379e-01 0.0000e+00
+-6.1877e-01 -3.8675e-01 0.0000e+00
+-6.3053e-01 -4.4976e-01 0.0000e+00
+-6.4590e-01 -5.0203e-01 0.0000e+00
+-3.1818e-01 +7.1873e-01 0.0000e+00
+-3.2415e-01 +6.6602e-01 0.0000e+00
+-3.3833e-01 +6.1032e-01 0.0000e+00
+-3.5495e-01 +5.5350e-01 0.0000e+00
+-3.5766e-01 +5.0601e-01 0.0000e+00
+-3.7325e-01 +4.4811e-01 0.0000e+00
+-3.8194e-01 +3.9818e-01 0.0000e+00
+-3.9548e-01 +3.3899e-01 0.0000e+00
+-4.0693e-01 +2.8887e-01 0.0000e+00
+-4.2529e-01 +2.4214e-01 0.0000e+00
+-4.3935e-01 +1.8552e-01 0.0000e+00
+-4.4943e-01 +1.2607e-01 0.0000e+00
+-4.6187e-01 +7.6697e-02 0.0000e+00
+-4.7342e-01 +1.8988e-02 0.0000e+00
+-4.7758e-01 -2.6306e-02 0.0000e+00
+-4.9191e-01 -8.0724e-02 0.0000e+00
+-5.0821e-01 -1.3611e-01 0.0000e+00
+-5.2386e-01 -1.8533e-01 0.0000e+00
+-5.2818e-01 -2.4168e-01 0.0000e+00
+-5.4158e-01 -3.0132e-01 0.0000e+00
+-5.5360e-01 -3.4664e-01 0.0000e+00
+-5.6921e-01 -4.0835e-01 0.0000e+00
+-5.8494e-01 -4.5264e-01 0.0000e+00
+-5.9054e-01 -5.0637e-01 0.0000e+00
+-2.5002e-01 +7.5900e-01 0.0000e+00
+-2.6240e-01 +7.0462e-01 0.0000e+00
+-2.6968e-01 +6.4810e-01 0.0000e+00
+-2.8267e-01 +5.9978e-01 0.0000e+00
+-2.9636e-01 +5.4928e-01 0.0000e+00
+-3.1120e-01 +4.9273e-01 0.0000e+00
+-3.2497e-01 +4.3347e-01 0.0000e+00
+-3.3302e-01 +3.8839e-01 0.0000e+00
+-3.4314e-01 +3.3001e-01 0.0000e+00
+-3.5948e-01 +2.7627e-01 0.0000e+00
+-3.7027e-01 +2.2300e-01 0.0000e+00
+-3.7878e-01 +1.6996e-01 0.0000e+00
+-3.9073e-01 +1.1725e-01 0.0000e+00
+-4.0942e-01 +7.0383e-02 0.0000e+00
+-4.1496e-01 +9.4547e-03 0.0000e+00
+-4.2836e-01 -3.9417e-02 0.0000e+00
+-4.3734e-01 -9.5939e-02 0.0000e+00
+-4.5799e-01 -1.4399e-01 0.0000e+00
+-4.6503e-01 -1.9984e-01 0.0000e+00
+-4.7439e-01 -2.5939e-01 0.0000e+00
+-4.9228e-01 -3.1082e-01 0.0000e+00
+-5.0572e-01 -3.5900e-01 0.0000e+00
+-5.1958e-01 -4.1271e-01 0.0000e+00
+-5.2279e-01 -4.6791e-01 0.0000e+00
+-5.4231e-01 -5.1764e-01 0.0000e+00
+-5.5023e-01 -5.7977e-01 0.0000e+00
+-1.8794e-01 +7.9413e-01 0.0000e+00
+-1.9359e-01 +7.4069e-01 0.0000e+00
+-2.0649e-01 +6.8677e-01 0.0000e+00
+-2.2503e-01 +6.3654e-01 0.0000e+00
+-2.2768e-01 +5.8393e-01 0.0000e+00
+-2.4005e-01 +5.3605e-01 0.0000e+00
+-2.5787e-01 +4.7639e-01 0.0000e+00
+-2.6234e-01 +4.2750e-01 0.0000e+00
+-2.7587e-01 +3.7626e-01 0.0000e+00
+-2.9658e-01 +3.1646e-01 0.0000e+00
+-3.1037e-01 +2.6239e-01 0.0000e+00
+-3.1119e-01 +2.1398e-01 0.0000e+00
+-3.3095e-01 +1.5859e-01 0.0000e+00
+-3.4018e-01 +1.0462e-01 0.0000e+00
+-3.4841e-01 +4.6932e-02 0.0000e+00
+-3.5972e-01 +8.0245e-04 0.0000e+00
+-3.7173e-01 -5.3382e-02 0.0000e+00
+-3.8831e-01 -1.0798e-01 0.0000e+00
+-4.0493e-01 -1.6311e-01 0.0000e+00
+-4.1700e-01 -2.1302e-01 0.0000e+00
+-4.2741e-01 -2.6727e-01 0.0000e+00
+-4.3468e-01 -3.2358e-01 0.0000e+00
+-4.5055e-01 -3.7345e-01 0.0000e+00
+-4.6616e-01 -4.2638e-01 0.0000e+00
+-4.7533e-01 -4.8039e-01 0.0000e+00
+-4.8526e-01 -5.3264e-01 0.0000e+00
+-4.9869e-01 -5.9162e-01 0.0000e+00
+-1.2577e-01 +7.8039e-01 0.0000e+00
+-1.4672e-01 +7.3526e-01 0.0000e+00
+-1.5669e-01 +6.8463e-01 0.0000e+00
+-1.6862e-01 +6.3218e-01 0.0000e+00
+-1.8334e-01 +5.7303e-01 0.0000e+00
+-1.9363e-01 +5.2095e-01 0.0000e+00
+-2.0810e-01 +4.6326e-01 0.0000e+00
+-2.0937e-01 +4.1545e-01 0.0000e+00
+-2.3029e-01 +3.5833e-01 0.0000e+00
+-2.3950e-01 +3.0445e-01 0.0000e+00
+-2.5055e-01 +2.5832e-01 0.0000e+00
+-2.6382e-01 +1.9990e-01 0.0000e+00
+-2.7272e-01 +1.5007e-01 0.0000e+00
+-2.8389e-01 +9.6168e-02 0.0000e+00
+-2.9894e-01 +3.6702e-02 0.0000e+00
+-3.1065e-01 -1.3801e-02 0.0000e+00
+-3.1907e-01 -6.5616e-02 0.0000e+00
+-3.3187e-01 -1.2539e-01 0.0000e+00
+-3.4778e-01 -1.7491e-01 0.0000e+00
+-3.5946e-01 -2.2588e-01 0.0000e+00
+-3.7135e-01 -2.7519e-01 0.0000e+00
+-3.8382e-01 -3.3173e-01 0.0000e+00
+-3.9689e-01 -3.8663e-01 0.0000e+00
+-4.0460e-01 -4.4621e-01 0.0000e+00
+-4.2273e-01 -4.9542e-01 0.0000e+00
+-4.3029e-01 -5.4646e-01 0.0000e+00
+-4.4726e-01 -6.0265e-01 0.0000e+00
+-4.5616e-01 -6.5358e-01 0.0000e+00
+-7.8781e-02 +7.7459e-01 0.0000e+00
+-8.6856e-02 +7.2513e-01 0.0000e+00
+-1.0141e-01 +6.6673e-01 0.0000e+00
+-1.1749e-01 +6.1396e-01 0.0000e+00
+-1.2314e-01 +5.5537e-01 0.0000e+00
+-1.3528e-01 +5.0843e-01 0.0000e+00
+-1.5336e-01 +4.5922e-01 0.0000e+00
+-1.6481e-01 +4.0117e-01 0.0000e+00
+-1.6970e-01 +3.4619e-01 0.0000e+00
+-1.8736e-01 +2.9229e-01 0.0000e+00
+-1.9946e-01 +2.4495e-01 0.0000e+00
+-2.1553e-01 +1.8628e-01 0.0000e+00
+-2.1903e-01 +1.2843e-01 0.0000e+00
+-2.3285e-01 +8.5813e-02 0.0000e+00
+-2.4295e-01 +2.3183e-02 0.0000e+00
+-2.6307e-01 -2.7420e-02 0.0000e+00
+-2.6832e-01 -7.5184e-02 0.0000e+00
+-2.8729e-01 -1.3086e-01 0.0000e+00
+-2.9484e-01 -1.8670e-01 0.0000e+00
+-3.1059e-01 -2.3977e-01 0.0000e+00
+-3.1296e-01 -2.8842e-01 0.0000e+00
+-3.3549e-01 -3.4292e-01 0.0000e+00
+-3.4244e-01 -4.0418e-01 0.0000e+00
+-3.5816e-01 -4.4828e-01 0.0000e+00
+-3.6266e-01 -5.0680e-01 0.0000e+00
+-3.7543e-01 -5.6322e-01 0.0000e+00
+-3.9153e-01 -6.0926e-01 0.0000e+00
+-4.0251e-01 -6.6715e-01 0.0000e+00
+-8.9595e-03 +8.1982e-01 0.0000e+00
+-2.3568e-02 +7.5945e-01 0.0000e+00
+-2.9929e-02 +7.1171e-01 0.0000e+00
+-4.4856e-02 +6.5067e-01 0.0000e+00
+-5.7921e-02 +6.0411e-01 0.0000e+00
+-6.7117e-02 +5.4476e-01 0.0000e+00
+-8.0101e-02 +4.9767e-01 0.0000e+00
+-1.0116e-01 +4.4297e-01 0.0000e+00
+-1.1079e-01 +3.8770e-01 0.0000e+00
+-1.2025e-01 +3.3263e-01 0.0000e+00
+-1.3347e-01 +2.8055e-01 0.0000e+00
+-1.4465e-01 +2.3094e-01 0.0000e+00
+-1.5668e-01 +1.7661e-01 0.0000e+00
+-1.6807e-01 +1.2591e-01 0.0000e+00
+-1.7932e-01 +6.3296e-02 0.0000e+00
+-1.9651e-01 +2.0273e-02 0.0000e+00
+-2.0975e-01 -3.6284e-02 0.0000e+00
+-2.1636e-01 -9.1505e-02 0.0000e+00
+-2.3332e-01 -1.4573e-01 0.0000e+00
+-2.3977e-01 -1.9542e-01 0.0000e+00
+-2.5645e-01 -2.5300e-01 0.0000e+00
+-2.6442e-01 -3.0040e-01 0.0000e+00
+-2.7966e-01 -3.5679e-01 0.0000e+00
+-2.8847e-01 -4.1493e-01 0.0000e+00
+-2.9888e-01 -4.6378e-01 0.0000e+00
+-3.1817e-01 -5.1788e-01 0.0000e+00
+-3.2540e-01 -5.6872e-01 0.0000e+00
+-3.3779e-01 -6.2503e-01 0.0000e+00
+-3.5360e-01 -6.7768e-01 0.0000e+00
+-3.6445e-01 -7.2804e-01 0.0000e+00
++4.5752e-02 +8.0318e-01 0.0000e+00
++3.2389e-02 +7.5102e-01 0.0000e+00
++1.7463e-02 +6.9832e-01 0.0000e+00
++8.2816e-03 +6.4727e-01 0.0000e+00
+-6.9106e-03 +5.9337e-01 0.0000e+00
+-1.3969e-02 +5.3193e-01 0.0000e+00
+-3.3106e-02 +4.8057e-01 0.0000e+00
+-3.9077e-02 +4.3188e-01 0.0000e+00
+-5.1883e-02 +3.8145e-01 0.0000e+00
+-6.7659e-02 +3.2010e-01 0.0000e+00
+-8.1883e-02 +2.6877e-01 0.0000e+00
+-9.2825e-02 +2.1817e-01 0.0000e+00
+-1.0227e-01 +1.6715e-01 0.0000e+00
+-1.1096e-01 +1.0514e-01 0.0000e+00
+-1.2425e-01 +5.6187e-02 0.0000e+00
+-1.3682e-01 -1.3735e-03 0.0000e+00
+-1.5172e-01 -4.7035e-02 0.0000e+00
+-1.6713e-01 -9.9991e-02 0.0000e+00
+-1.7697e-01 -1.5590e-01 0.0000e+00
+-1.8867e-01 -2.1075e-01 0.0000e+00
+-2.0278e-01 -2.5871e-01 0.0000e+00
+-2.1454e-01 -3.1689e-01 0.0000e+00
+-2.2929e-01 -3.6890e-01 0.0000e+00
+-2.3649e-01 -4.2495e-01 0.0000e+00
+-2.5117e-01 -4.7033e-01 0.0000e+00
+-2.5434e-01 -5.2545e-01 0.0000e+00
+-2.7487e-01 -5.8219e-01 0.0000e+00
+-2.8715e-01 -6.3310e-01 0.0000e+00
+-2.9875e-01 -6.9177e-01 0.0000e+00
+-3.0484e-01 -7.4514e-01 0.0000e+00
++9.0274e-02 +7.8791e-01 0.0000e+00
++8.2817e-02 +7.3329e-01 0.0000e+00
++7.6590e-02 +6.8353e-01 0.0000e+00
++5.5338e-02 +6.3735e-01 0.0000e+00
++4.7134e-02 +5.8267e-01 0.0000e+00
++4.0437e-02 +5.2860e-01 0.0000e+00
++2.2306e-02 +4.7278e-01 0.0000e+00
++1.1877e-02 +4.1278e-01 0.0000e+00
++2.1589e-03 +3.6434e-01 0.0000e+00
+-1.3428e-02 +3.0840e-01 0.0000e+00
+-2.0471e-02 +2.5848e-01 0.0000e+00
+-3.5436e-02 +2.0204e-01 0.0000e+00
+-5.4232e-02 +1.5587e-01 0.0000e+00
+-6.0137e-02 +9.6454e-02 0.0000e+00
+-7.4466e-02 +4.2137e-02 0.0000e+00
+-8.4241e-02 -1.0401e-02 0.0000e+00
+-9.9383e-02 -6.0384e-02 0.0000e+00
+-1.1091e-01 -1.1751e-01 0.0000e+00
+-1.2412e-01 -1.7239e-01 0.0000e+00
+-1.3217e-01 -2.2634e-01 0.0000e+00
+-1.4587e-01 -2.7414e-01 0.0000e+00
+-1.5491e-01 -3.3428e-01 0.0000e+00
+-1.7601e-01 -3.8435e-01 0.0000e+00
+-1.8709e-01 -4.3505e-01 0.0000e+00
+-1.9048e-01 -4.8619e-01 0.0000e+00
+-2.1003e-01 -5.3826e-01 0.0000e+00
+-2.2061e-01 -5.8997e-01 0.0000e+00
+-2.3191e-01 -6.4320e-01 0.0000e+00
+-2.4684e-01 -7.0078e-01 0.0000e+00
+-2.5019e-01 -7.5488e-01 0.0000e+00
++1.5007e-01 +7.8067e-01 0.0000e+00
++1.3558e-01 +7.2884e-01 0.0000e+00
++1.2836e-01 +6.7521e-01 0.0000e+00
++1.1700e-01 +6.2288e-01 0.0000e+00
++9.9041e-02 +5.6435e-01 0.0000e+00
++9.2172e-02 +5.1206e-01 0.0000e+00
++7.5867e-02 +4.5547e-01 0.0000e+00
++6.7809e-02 +4.0585e-01 0.0000e+00
++4.9175e-02 +3.5516e-01 0.0000e+00
++4.4692e-02 +2.9884e-01 0.0000e+00
++2.6236e-02 +2.4397e-01 0.0000e+00
++1.4318e-02 +1.9825e-01 0.0000e+00
++7.1198e-03 +1.3424e-01 0.0000e+00
+-3.9839e-03 +8.1777e-02 0.0000e+00
+-2.5336e-02 +3.0680e-02 0.0000e+00
+-3.5476e-02 -1.6574e-02 0.0000e+00
+-4.7479e-02 -7.6241e-02 0.0000e+00
+-5.8936e-02 -1.2337e-01 0.0000e+00
+-7.3883e-02 -1.8295e-01 0.0000e+00
+-8.0852e-02 -2.3715e-01 0.0000e+00
+-9.4469e-02 -2.9079e-01 0.0000e+00
+-1.0011e-01 -3.3886e-01 0.0000e+00
+-1.2113e-01 -3.9473e-01 0.0000e+00
+-1.2583e-01 -4.4708e-01 0.0000e+00
+-1.4167e-01 -5.0554e-01 0.0000e+00
+-1.5097e-01 -5.5000e-01 0.0000e+00
+-1.6364e-01 -6.0564e-01 0.0000e+00
+-1.8027e-01 -6.6361e-01 0.0000e+00
+-1.8988e-01 -7.1324e-01 0.0000e+00
+-2.0212e-01 -7.6273e-01 0.0000e+00
++2.0171e-01 +7.6281e-01 0.0000e+00
++1.9486e-01 +7.1320e-01 0.0000e+00
++1.7788e-01 +6.5840e-01 0.0000e+00
++1.6881e-01 +6.0987e-01 0.0000e+00
++1.5601e-01 +5.5313e-01 0.0000e+00
++1.3854e-01 +4.9780e-01 0.0000e+00
++1.2739e-01 +4.4602e-01 0.0000e+00
++1.1237e-01 +3.9579e-01 0.0000e+00
++1.0158e-01 +3.3926e-01 0.0000e+00
++9.1577e-02 +2.8970e-01 0.0000e+00
++7.8163e-02 +2.3459e-01 0.0000e+00
++7.1474e-02 +1.7995e-01 0.0000e+00
++6.1499e-02 +1.2944e-01 0.0000e+00
++4.1456e-02 +7.0653e-02 0.0000e+00
++3.6021e-02 +2.1133e-02 0.0000e+00
++1.6278e-02 -3.6495e-02 0.0000e+00
++1.2920e-02 -8.2925e-02 0.0000e+00
+-8.5430e-04 -1.4090e-01 0.0000e+00
+-2.0096e-02 -1.8917e-01 0.0000e+00
+-3.1235e-02 -2.4828e-01 0.0000e+00
+-4.1608e-02 -3.0364e-01 0.0000e+00
+-5.0883e-02 -3.4957e-01 0.0000e+00
+-6.6104e-02 -4.0236e-01 0.0000e+00
+-7.4415e-02 -4.6460e-01 0.0000e+00
+-8.3743e-02 -5.1212e-01 0.0000e+00
+-9.8031e-02 -5.6623e-01 0.0000e+00
+-1.0787e-01 -6.2242e-01 0.0000e+00
+-1.2776e-01 -6.7015e-01 0.0000e+00
+-1.3589e-01 -7.3129e-01 0.0000e+00
+-1.5183e-01 -7.7768e-01 0.0000e+00
++2.5487e-01 +7.5197e-01 0.0000e+00
++2.4509e-01 +7.0609e-01 0.0000e+00
++2.3662e-01 +6.4735e-01 0.0000e+00
++2.1658e-01 +5.9144e-01 0.0000e+00
++2.1162e-01 +5.4106e-01 0.0000e+00
++1.9274e-01 +4.8848e-01 0.0000e+00
++1.8035e-01 +4.3634e-01 0.0000e+00
++1.6830e-01 +3.7737e-01 0.0000e+00
++1.6469e-01 +3.3073e-01 0.0000e+00
++1.4085e-01 +2.7382e-01 0.0000e+00
++1.3191e-01 +2.2704e-01 0.0000e+00
++1.2101e-01 +1.6678e-01 0.0000e+00
++1.1430e-01 +1.1677e-01 0.0000e+00
++9.5103e-02 +6.2882e-02 0.0000e+00
++9.0096e-02 +7.1908e-03 0.0000e+00
++7.4653e-02 -4.1689e-02 0.0000e+00
++6.0873e-02 -1.0340e-01 0.0000e+00
++4.7634e-02 -1.5247e-01 0.0000e+00
++4.1182e-02 -2.0893e-01 0.0000e+00
++2.8792e-02 -2.5765e-01 0.0000e+00
++9.7374e-03 -3.0981e-01 0.0000e+00
++7.2433e-04 -3.6090e-01 0.0000e+00
+-9.5002e-03 -4.1809e-01 0.0000e+00
+-2.8158e-02 -4.7018e-01 0.0000e+00
+-3.0823e-02 -5.2594e-01 0.0000e+00
+-4.6755e-02 -5.7488e-01 0.0000e+00
+-6.1673e-02 -6.3022e-01 0.0000e+00
+-6.5919e-02 -6.8515e-01 0.0000e+00
+-8.4064e-02 -7.3996e-01 0.0000e+00
+-1.0017e-01 -7.8910e-01 0.0000e+00
++3.0805e-01 +7.4388e-01 0.0000e+00
++2.9656e-01 +6.9149e-01 0.0000e+00
++2.8629e-01 +6.3862e-01 0.0000e+00
++2.7706e-01 +5.8080e-01 0.0000e+00
++2.5918e-01 +5.3400e-01 0.0000e+00
++2.4453e-01 +4.8149e-01 0.0000e+00
++2.3257e-01 +4.2391e-01 0.0000e+00
++2.2346e-01 +3.7247e-01 0.0000e+00
++2.0585e-01 +3.1343e-01 0.0000e+00
++2.0312e-01 +2.5895e-01 0.0000e+00
++1.8476e-01 +2.1598e-01 0.0000e+00
++1.7325e-01 +1.6125e-01 0.0000e+00
++1.6163e-01 +1.0843e-01 0.0000e+00
++1.5585e-01 +4.8791e-02 0.0000e+00
++1.3724e-01 -5.6312e-03 0.0000e+00
++1.2544e-01 -6.1252e-02 0.0000e+00
++1.1377e-01 -1.0719e-01 0.0000e+00
++1.0275e-01 -1.6526e-01 0.0000e+00
++9.2898e-02 -2.1491e-01 0.0000e+00
++7.6202e-02 -2.6804e-01 0.0000e+00
++6.4593e-02 -3.2745e-01 0.0000e+00
++5.3955e-02 -3.7742e-01 0.0000e+00
++4.5605e-02 -4.2743e-01 0.0000e+00
++2.6632e-02 -4.8163e-01 0.0000e+00
++1.7375e-02 -5.3595e-01 0.0000e+00
++3.2743e-03 -5.8520e-01 0.0000e+00
+-6.3153e-03 -6.4676e-01 0.0000e+00
+-1.8877e-02 -7.0108e-01 0.0000e+00
+-3.0924e-02 -7.5427e-01 0.0000e+00
+-4.7273e-02 -8.0720e-01 0.0000e+00
++3.6534e-01 +7.2520e-01 0.0000e+00
++3.4658e-01 +6.7876e-01 0.0000e+00
++3.3634e-01 +6.2795e-01 0.0000e+00
++3.2522e-01 +5.7173e-01 0.0000e+00
++3.1499e-01 +5.1547e-01 0.0000e+00
++3.0057e-01 +4.6843e-01 0.0000e+00
++2.9525e-01 +4.1203e-01 0.0000e+00
++2.7403e-01 +3.6142e-01 0.0000e+00
++2.6032e-01 +3.0346e-01 0.0000e+00
++2.5245e-01 +2.5613e-01 0.0000e+00
++2.3796e-01 +1.9543e-01 0.0000e+00
++2.2648e-01 +1.4866e-01 0.0000e+00
++2.1399e-01 +9.5775e-02 0.0000e+00
++2.0163e-01 +3.6532e-02 0.0000e+00
++1.9153e-01 -2.0900e-02 0.0000e+00
++1.8375e-01 -7.3966e-02 0.0000e+00
++1.6782e-01 -1.2489e-01 0.0000e+00
++1.5571e-01 -1.7157e-01 0.0000e+00
++1.4309e-01 -2.2560e-01 0.0000e+00
++1.3316e-01 -2.7741e-01 0.0000e+00
++1.1891e-01 -3.3651e-01 0.0000e+00
++1.1238e-01 -3.8949e-01 0.0000e+00
++1.0108e-01 -4.4226e-01 0.0000e+00
++8.3120e-02 -4.9250e-01 0.0000e+00
++7.6044e-02 -5.4663e-01 0.0000e+00
++5.6938e-02 -5.9890e-01 0.0000e+00
++5.1421e-02 -6.5758e-01 0.0000e+00
++3.1420e-02 -7.0956e-01 0.0000e+00
++2.0537e-02 -7.6307e-01 0.0000e+00
++1.6177e-02 -8.1380e-01 0.0000e+00
++4.0250e-01 +6.6599e-01 0.0000e+00
++3.8869e-01 +6.1522e-01 0.0000e+00
++3.7495e-01 +5.5795e-01 0.0000e+00
++3.6382e-01 +5.0856e-01 0.0000e+00
++3.5960e-01 +4.5420e-01 0.0000e+00
++3.3831e-01 +3.9521e-01 0.0000e+00
++3.2986e-01 +3.4282e-01 0.0000e+00
++3.2044e-01 +2.9132e-01 0.0000e+00
++3.0508e-01 +2.3705e-01 0.0000e+00
++2.8900e-01 +1.8533e-01 0.0000e+00
++2.8219e-01 +1.3687e-01 0.0000e+00
++2.7320e-01 +7.2863e-02 0.0000e+00
++2.5581e-01 +2.8005e-02 0.0000e+00
++2.4455e-01 -2.5860e-02 0.0000e+00
++2.3647e-01 -8.1479e-02 0.0000e+00
++2.1760e-01 -1.2940e-01 0.0000e+00
++2.1111e-01 -1.8402e-01 0.0000e+00
++1.9827e-01 -2.3718e-01 0.0000e+00
++1.8719e-01 -2.9968e-01 0.0000e+00
++1.7535e-01 -3.4819e-01 0.0000e+00
++1.5839e-01 -3.9753e-01 0.0000e+00
++1.5436e-01 -4.5179e-01 0.0000e+00
++1.3987e-01 -5.0905e-01 0.0000e+00
++1.2097e-01 -5.5976e-01 0.0000e+00
++1.0965e-01 -6.1293e-01 0.0000e+00
++1.0478e-01 -6.7297e-01 0.0000e+00
++8.7998e-02 -7.2042e-01 0.0000e+00
++7.5923e-02 -7.7006e-01 0.0000e+00
++4.5736e-01 +6.5825e-01 0.0000e+00
++4.4753e-01 +6.0256e-01 0.0000e+00
++4.3641e-01 +5.4464e-01 0.0000e+00
++4.1815e-01 +4.9266e-01 0.0000e+00
++4.0924e-01 +4.4539e-01 0.0000e+00
++3.9739e-01 +3.9004e-01 0.0000e+00
++3.8589e-01 +3.3848e-01 0.0000e+00
++3.6798e-01 +2.8565e-01 0.0000e+00
++3.6181e-01 +2.3069e-01 0.0000e+00
++3.4898e-01 +1.7400e-01 0.0000e+00
++3.3967e-01 +1.2464e-01 0.0000e+00
++3.2748e-01 +6.9819e-02 0.0000e+00
++3.1273e-01 +1.3394e-02 0.0000e+00
++2.9465e-01 -4.3833e-02 0.0000e+00
++2.9127e-01 -9.1223e-02 0.0000e+00
++2.6998e-01 -1.4896e-01 0.0000e+00
++2.5944e-01 -1.9829e-01 0.0000e+00
++2.4781e-01 -2.5377e-01 0.0000e+00
++2.3314e-01 -3.0797e-01 0.0000e+00
++2.2981e-01 -3.5696e-01 0.0000e+00
++2.0928e-01 -4.1383e-01 0.0000e+00
++1.9777e-01 -4.6287e-01 0.0000e+00
++1.9251e-01 -5.1483e-01 0.0000e+00
++1.7492e-01 -5.7438e-01 0.0000e+00
++1.6138e-01 -6.2447e-01 0.0000e+00
++1.5363e-01 -6.8342e-01 0.0000e+00
++1.3960e-01 -7.3456e-01 0.0000e+00
++1.2837e-01 -7.9004e-01 0.0000e+00
++5.0165e-01 +5.9109e-01 0.0000e+00
++4.8927e-01 +5.3811e-01 0.0000e+00
++4.7180e-01 +4.8194e-01 0.0000e+00
++4.6041e-01 +4.2715e-01 0.0000e+00
++4.5341e-01 +3.7391e-01 0.0000e+00
++4.3674e-01 +3.1974e-01 0.0000e+00
++4.2719e-01 +2.7105e-01 0.0000e+00
++4.1139e-01 +2.1068e-01 0.0000e+00
++3.9991e-01 +1.6112e-01 0.0000e+00
++3.9452e-01 +1.0891e-01 0.0000e+00
++3.7215e-01 +5.6138e-02 0.0000e+00
++3.6556e-01 +5.1215e-03 0.0000e+00
++3.4910e-01 -4.5736e-02 0.0000e+00
++3.3650e-01 -1.0811e-01 0.0000e+00
++3.3205e-01 -1.6381e-01 0.0000e+00
++3.2233e-01 -2.0810e-01 0.0000e+00
++3.0436e-01 -2.6358e-01 0.0000e+00
++2.9013e-01 -3.1264e-01 0.0000e+00
++2.8191e-01 -3.7308e-01 0.0000e+00
++2.6241e-01 -4.2564e-01 0.0000e+00
++2.5660e-01 -4.7519e-01 0.0000e+00
++2.4063e-01 -5.3192e-01 0.0000e+00
++2.2856e-01 -5.8809e-01 0.0000e+00
++2.1608e-01 -6.3504e-01 0.0000e+00
++2.0913e-01 -6.9433e-01 0.0000e+00
++1.9626e-01 -7.4552e-01 0.0000e+00
++1.8113e-01 -7.9390e-01 0.0000e+00
++5.5462e-01 +5.7847e-01 0.0000e+00
++5.4125e-01 +5.2432e-01 0.0000e+00
++5.2315e-01 +4.7546e-01 0.0000e+00
++5.1875e-01 +4.1609e-01 0.0000e+00
++4.9808e-01 +3.5887e-01 0.0000e+00
++4.8770e-01 +3.1511e-01 0.0000e+00
++4.7817e-01 +2.5729e-01 0.0000e+00
++4.6758e-01 +2.0159e-01 0.0000e+00
++4.5788e-01 +1.4601e-01 0.0000e+00
++4.4676e-01 +9.7129e-02 0.0000e+00
++4.2591e-01 +3.9631e-02 0.0000e+00
++4.1356e-01 -1.1965e-02 0.0000e+00
++4.0544e-01 -6.5670e-02 0.0000e+00
++3.9319e-01 -1.2040e-01 0.0000e+00
++3.8076e-01 -1.6596e-01 0.0000e+00
++3.7057e-01 -2.2297e-01 0.0000e+00
++3.5149e-01 -2.8144e-01 0.0000e+00
++3.4216e-01 -3.2890e-01 0.0000e+00
++3.3715e-01 -3.8040e-01 0.0000e+00
++3.2420e-01 -4.3952e-01 0.0000e+00
++3.0696e-01 -4.8861e-01 0.0000e+00
++2.9698e-01 -5.4315e-01 0.0000e+00
++2.8384e-01 -5.9709e-01 0.0000e+00
++2.7107e-01 -6.5326e-01 0.0000e+00
++2.6376e-01 -7.0897e-01 0.0000e+00
++2.4656e-01 -7.6008e-01 0.0000e+00
++5.8947e-01 +5.1215e-01 0.0000e+00
++5.8280e-01 +4.6029e-01 0.0000e+00
++5.6778e-01 +3.9880e-01 0.0000e+00
++5.5649e-01 +3.5381e-01 0.0000e+00
++5.4771e-01 +2.9829e-01 0.0000e+00
++5.3087e-01 +2.4301e-01 0.0000e+00
++5.2422e-01 +1.8665e-01 0.0000e+00
++5.0383e-01 +1.4017e-01 0.0000e+00
++4.9221e-01 +8.3894e-02 0.0000e+00
++4.7862e-01 +2.9958e-02 0.0000e+00
++4.6667e-01 -2.4477e-02 0.0000e+00
++4.5371e-01 -8.0093e-02 0.0000e+00
++4.4771e-01 -1.2466e-01 0.0000e+00
++4.3327e-01 -1.8418e-01 0.0000e+00
++4.2319e-01 -2.3321e-01 0.0000e+00
++4.0910e-01 -2.9250e-01 0.0000e+00
++3.9946e-01 -3.3922e-01 0.0000e+00
++3.8570e-01 -3.9625e-01 0.0000e+00
++3.7899e-01 -4.5023e-01 0.0000e+00
++3.6459e-01 -4.9793e-01 0.0000e+00
++3.5142e-01 -5.5117e-01 0.0000e+00
++3.3513e-01 -6.1114e-01 0.0000e+00
++3.2335e-01 -6.5836e-01 0.0000e+00
++3.1117e-01 -7.1566e-01 0.0000e+00
++6.4875e-01 +5.0159e-01 0.0000e+00
++6.3740e-01 +4.4234e-01 0.0000e+00
++6.2605e-01 +3.9163e-01 0.0000e+00
++6.1422e-01 +3.4054e-01 0.0000e+00
++6.0071e-01 +2.8037e-01 0.0000e+00
++5.8479e-01 +2.3546e-01 0.0000e+00
++5.7093e-01 +1.7847e-01 0.0000e+00
++5.6167e-01 +1.2961e-01 0.0000e+00
++5.4671e-01 +7.7020e-02 0.0000e+00
++5.4229e-01 +1.7717e-02 0.0000e+00
++5.2300e-01 -3.5696e-02 0.0000e+00
++5.1192e-01 -9.2219e-02 0.0000e+00
++5.0497e-01 -1.3817e-01 0.0000e+00
++4.8875e-01 -1.9076e-01 0.0000e+00
++4.8153e-01 -2.4697e-01 0.0000e+00
++4.6490e-01 -3.0082e-01 0.0000e+00
++4.5507e-01 -3.5268e-01 0.0000e+00
++4.3692e-01 -4.0816e-01 0.0000e+00
++4.3019e-01 -4.5670e-01 0.0000e+00
++4.1339e-01 -5.1631e-01 0.0000e+00
++3.9792e-01 -5.7215e-01 0.0000e+00
++3.9287e-01 -6.2267e-01 0.0000e+00
++3.8083e-01 -6.7167e-01 0.0000e+00
++3.6997e-01 -7.3021e-01 0.0000e+00
++6.9024e-01 +4.3192e-01 0.0000e+00
++6.7689e-01 +3.7622e-01 0.0000e+00
++6.6553e-01 +3.2522e-01 0.0000e+00
++6.5193e-01 +2.7551e-01 0.0000e+00
++6.3923e-01 +2.1951e-01 0.0000e+00
++6.2388e-01 +1.7057e-01 0.0000e+00
++6.1144e-01 +1.1088e-01 0.0000e+00
++5.9730e-01 +5.5066e-02 0.0000e+00
++5.9372e-01 +2.2807e-03 0.0000e+00
++5.8181e-01 -4.9334e-02 0.0000e+00
++5.6831e-01 -1.0555e-01 0.0000e+00
++5.5562e-01 -1.4948e-01 0.0000e+00
++5.3970e-01 -2.0894e-01 0.0000e+00
++5.2943e-01 -2.6475e-01 0.0000e+00
++5.2331e-01 -3.0984e-01 0.0000e+00
++5.0725e-01 -3.6344e-01 0.0000e+00
++4.9642e-01 -4.2593e-01 0.0000e+00
++4.8433e-01 -4.7847e-01 0.0000e+00
++4.7269e-01 -5.2286e-01 0.0000e+00
++4.5166e-01 -5.8158e-01 0.0000e+00
++4.4014e-01 -6.3610e-01 0.0000e+00
++4.3571e-01 -6.8612e-01 0.0000e+00
++7.3279e-01 +3.6276e-01 0.0000e+00
++7.1822e-01 +3.1874e-01 0.0000e+00
++7.0485e-01 +2.6491e-01 0.0000e+00
++6.9552e-01 +2.0756e-01 0.0000e+00
++6.7785e-01 +1.5528e-01 0.0000e+00
++6.7235e-01 +9.6847e-02 0.0000e+00
++6.5950e-01 +4.1018e-02 0.0000e+00
++6.4773e-01 -3.3646e-03 0.0000e+00
++6.2585e-01 -6.0688e-02 0.0000e+00
++6.2006e-01 -1.1523e-01 0.0000e+00
++6.0998e-01 -1.6545e-01 0.0000e+00
++5.9032e-01 -2.2212e-01 0.0000e+00
++5.8261e-01 -2.7287e-01 0.0000e+00
++5.7472e-01 -3.2207e-01 0.0000e+00
++5.5769e-01 -3.8025e-01 0.0000e+00
++5.4502e-01 -4.3642e-01 0.0000e+00
++5.4058e-01 -4.8276e-01 0.0000e+00
++5.1935e-01 -5.3783e-01 0.0000e+00
++5.0452e-01 -5.9430e-01 0.0000e+00
++4.9875e-01 -6.5104e-01 0.0000e+00
++7.5499e-01 +2.5135e-01 0.0000e+00
++7.4909e-01 +1.9485e-01 0.0000e+00
++7.3501e-01 +1.4367e-01 0.0000e+00
++7.2090e-01 +9.2356e-02 0.0000e+00
++7.0880e-01 +4.0084e-02 0.0000e+00
++6.9651e-01 -1.8437e-02 0.0000e+00
++6.8059e-01 -6.5218e-02 0.0000e+00
++6.6931e-01 -1.2905e-01 0.0000e+00
++6.5972e-01 -1.8074e-01 0.0000e+00
++6.4312e-01 -2.3441e-01 0.0000e+00
++6.3873e-01 -2.8779e-01 0.0000e+00
++6.2963e-01 -3.3456e-01 0.0000e+00
++6.1294e-01 -3.9218e-01 0.0000e+00
++6.0308e-01 -4.4869e-01 0.0000e+00
++5.8950e-01 -5.0309e-01 0.0000e+00
++5.7466e-01 -5.4937e-01 0.0000e+00
++7.8873e-01 +1.2696e-01 0.0000e+00
++7.7172e-01 +7.7633e-02 0.0000e+00
++7.5974e-01 +2.1735e-02 0.0000e+00
++7.4486e-01 -3.0634e-02 0.0000e+00
++7.3811e-01 -8.0979e-02 0.0000e+00
++7.2779e-01 -1.4159e-01 0.0000e+00
++7.1260e-01 -1.8721e-01 0.0000e+00
++7.0527e-01 -2.4941e-01 0.0000e+00
++6.9325e-01 -2.9913e-01 0.0000e+00
++6.7588e-01 -3.4583e-01 0.0000e+00
++6.6853e-01 -4.0781e-01 0.0000e+00
++6.5517e-01 -4.5872e-01 0.0000e+00
++8.1553e-01 +1.2675e-02 0.0000e+00
++8.0707e-01 -4.2688e-02 0.0000e+00
++7.9285e-01 -9.7685e-02 0.0000e+00
++7.8123e-01 -1.4422e-01 0.0000e+00
++7.6595e-01 -2.0150e-01 0.0000e+00
++7.5017e-01 -2.5852e-01 0.0000e+00
++7.4100e-01 -3.1019e-01 0.0000e+00
++7.2920e-01 -3.6235e-01 0.0000e+00
@@ -0,0 +1,711 @@
+-3.2078e-01 -6.8147e-01 0.0000e+00
+-2.6386e-01 -6.9077e-01 0.0000e+00
+-2.1633e-01 -7.0648e-01 0.0000e+00
+-1.6718e-01 -7.1220e-01 0.0000e+00
+-1.2586e-01 -7.2532e-01 0.0000e+00
+-6.6469e-02 -7.3607e-01 0.0000e+00
+-1.8856e-02 -7.4740e-01 0.0000e+00
++3.2020e-02 -7.5202e-01 0.0000e+00
+-4.5664e-01 -6.0421e-01 0.0000e+00
+-4.0569e-01 -6.1808e-01 0.0000e+00
+-3.5482e-01 -6.2824e-01 0.0000e+00
+-3.0583e-01 -6.3742e-01 0.0000e+00
+-2.5794e-01 -6.4515e-01 0.0000e+00
+-2.1326e-01 -6.5693e-01 0.0000e+00
+-1.6176e-01 -6.6772e-01 0.0000e+00
+-1.1371e-01 -6.7244e-01 0.0000e+00
+-5.7004e-02 -6.8194e-01 0.0000e+00
+-1.4778e-02 -6.9014e-01 0.0000e+00
++3.8733e-02 -7.0485e-01 0.0000e+00
++9.2387e-02 -7.1559e-01 0.0000e+00
++1.3856e-01 -7.2150e-01 0.0000e+00
+-5.0155e-01 -5.4781e-01 0.0000e+00
+-4.4400e-01 -5.5929e-01 0.0000e+00
+-3.9914e-01 -5.5984e-01 0.0000e+00
+-3.4918e-01 -5.7690e-01 0.0000e+00
+-3.0123e-01 -5.8481e-01 0.0000e+00
+-2.4623e-01 -5.9352e-01 0.0000e+00
+-1.9513e-01 -6.0456e-01 0.0000e+00
+-1.5169e-01 -6.1723e-01 0.0000e+00
+-9.9788e-02 -6.2601e-01 0.0000e+00
+-4.7094e-02 -6.3197e-01 0.0000e+00
++5.7582e-04 -6.4569e-01 0.0000e+00
++4.8820e-02 -6.5607e-01 0.0000e+00
++9.6915e-02 -6.6244e-01 0.0000e+00
++1.4720e-01 -6.7600e-01 0.0000e+00
++1.9866e-01 -6.7907e-01 0.0000e+00
++2.4630e-01 -6.9499e-01 0.0000e+00
+-5.8357e-01 -4.7828e-01 0.0000e+00
+-5.3377e-01 -4.8759e-01 0.0000e+00
+-4.9001e-01 -4.9497e-01 0.0000e+00
+-4.3508e-01 -4.9983e-01 0.0000e+00
+-3.8728e-01 -5.1059e-01 0.0000e+00
+-3.3890e-01 -5.2345e-01 0.0000e+00
+-2.9110e-01 -5.3403e-01 0.0000e+00
+-2.3907e-01 -5.4741e-01 0.0000e+00
+-1.9042e-01 -5.5607e-01 0.0000e+00
+-1.4016e-01 -5.5968e-01 0.0000e+00
+-8.8664e-02 -5.7348e-01 0.0000e+00
+-4.4180e-02 -5.7864e-01 0.0000e+00
++9.2696e-03 -5.9234e-01 0.0000e+00
++5.4976e-02 -6.0087e-01 0.0000e+00
++1.0910e-01 -6.1098e-01 0.0000e+00
++1.5723e-01 -6.2934e-01 0.0000e+00
++2.1012e-01 -6.3668e-01 0.0000e+00
++2.6073e-01 -6.4120e-01 0.0000e+00
++3.0293e-01 -6.5514e-01 0.0000e+00
++3.5235e-01 -6.6580e-01 0.0000e+00
+-6.2330e-01 -4.1128e-01 0.0000e+00
+-5.7428e-01 -4.2758e-01 0.0000e+00
+-5.2460e-01 -4.3014e-01 0.0000e+00
+-4.7778e-01 -4.4046e-01 0.0000e+00
+-4.2479e-01 -4.5173e-01 0.0000e+00
+-3.7705e-01 -4.6872e-01 0.0000e+00
+-3.2382e-01 -4.7887e-01 0.0000e+00
+-2.8023e-01 -4.8571e-01 0.0000e+00
+-2.3078e-01 -4.9932e-01 0.0000e+00
+-1.8288e-01 -4.9991e-01 0.0000e+00
+-1.2656e-01 -5.1575e-01 0.0000e+00
+-7.6631e-02 -5.2975e-01 0.0000e+00
+-2.8793e-02 -5.3876e-01 0.0000e+00
++1.9957e-02 -5.4757e-01 0.0000e+00
++7.3090e-02 -5.5579e-01 0.0000e+00
++1.2088e-01 -5.6510e-01 0.0000e+00
++1.7005e-01 -5.7677e-01 0.0000e+00
++2.1442e-01 -5.8568e-01 0.0000e+00
++2.6576e-01 -5.9633e-01 0.0000e+00
++3.1228e-01 -6.0540e-01 0.0000e+00
++3.6851e-01 -6.1641e-01 0.0000e+00
++4.1586e-01 -6.2857e-01 0.0000e+00
+-6.6553e-01 -3.5466e-01 0.0000e+00
+-6.1848e-01 -3.6142e-01 0.0000e+00
+-5.6706e-01 -3.7857e-01 0.0000e+00
+-5.1256e-01 -3.8594e-01 0.0000e+00
+-4.6123e-01 -3.9305e-01 0.0000e+00
+-4.1275e-01 -4.0655e-01 0.0000e+00
+-3.7182e-01 -4.1686e-01 0.0000e+00
+-3.1630e-01 -4.2961e-01 0.0000e+00
+-2.7075e-01 -4.3920e-01 0.0000e+00
+-2.1465e-01 -4.4227e-01 0.0000e+00
+-1.6836e-01 -4.5828e-01 0.0000e+00
+-1.1725e-01 -4.6492e-01 0.0000e+00
+-7.1430e-02 -4.8001e-01 0.0000e+00
+-1.9154e-02 -4.8306e-01 0.0000e+00
++2.8798e-02 -4.9987e-01 0.0000e+00
++7.8634e-02 -5.0624e-01 0.0000e+00
++1.2542e-01 -5.1504e-01 0.0000e+00
++1.7523e-01 -5.2317e-01 0.0000e+00
++2.2904e-01 -5.3987e-01 0.0000e+00
++2.7736e-01 -5.4949e-01 0.0000e+00
++3.3076e-01 -5.5176e-01 0.0000e+00
++3.7072e-01 -5.6272e-01 0.0000e+00
++4.2914e-01 -5.7219e-01 0.0000e+00
++4.7774e-01 -5.8522e-01 0.0000e+00
+-6.5652e-01 -3.0962e-01 0.0000e+00
+-6.0773e-01 -3.1396e-01 0.0000e+00
+-5.5599e-01 -3.2582e-01 0.0000e+00
+-5.0317e-01 -3.3991e-01 0.0000e+00
+-4.5926e-01 -3.4137e-01 0.0000e+00
+-4.0546e-01 -3.5448e-01 0.0000e+00
+-3.5918e-01 -3.6141e-01 0.0000e+00
+-3.0423e-01 -3.7260e-01 0.0000e+00
+-2.5771e-01 -3.8206e-01 0.0000e+00
+-2.1417e-01 -3.9798e-01 0.0000e+00
+-1.6158e-01 -4.0971e-01 0.0000e+00
+-1.0647e-01 -4.1771e-01 0.0000e+00
+-6.0614e-02 -4.2810e-01 0.0000e+00
+-7.0814e-03 -4.3749e-01 0.0000e+00
++3.4827e-02 -4.4033e-01 0.0000e+00
++8.5383e-02 -4.5236e-01 0.0000e+00
++1.3688e-01 -4.6619e-01 0.0000e+00
++1.8266e-01 -4.7955e-01 0.0000e+00
++2.3478e-01 -4.8229e-01 0.0000e+00
++2.9014e-01 -4.9335e-01 0.0000e+00
++3.3224e-01 -5.0344e-01 0.0000e+00
++3.8956e-01 -5.1649e-01 0.0000e+00
++4.3079e-01 -5.3004e-01 0.0000e+00
++4.8052e-01 -5.3402e-01 0.0000e+00
+-6.9520e-01 -2.4758e-01 0.0000e+00
+-6.4473e-01 -2.5780e-01 0.0000e+00
+-5.9238e-01 -2.6328e-01 0.0000e+00
+-5.4749e-01 -2.7420e-01 0.0000e+00
+-5.0056e-01 -2.8572e-01 0.0000e+00
+-4.4803e-01 -2.9818e-01 0.0000e+00
+-3.9302e-01 -3.0959e-01 0.0000e+00
+-3.5122e-01 -3.1602e-01 0.0000e+00
+-2.9710e-01 -3.2408e-01 0.0000e+00
+-2.4713e-01 -3.3797e-01 0.0000e+00
+-1.9771e-01 -3.4676e-01 0.0000e+00
+-1.4855e-01 -3.5345e-01 0.0000e+00
+-9.9624e-02 -3.6332e-01 0.0000e+00
+-5.5943e-02 -3.7954e-01 0.0000e+00
++4.2972e-04 -3.8330e-01 0.0000e+00
++4.5845e-02 -3.9460e-01 0.0000e+00
++9.8225e-02 -4.0164e-01 0.0000e+00
++1.4304e-01 -4.1965e-01 0.0000e+00
++1.9476e-01 -4.2492e-01 0.0000e+00
++2.4995e-01 -4.3224e-01 0.0000e+00
++2.9782e-01 -4.4762e-01 0.0000e+00
++3.4260e-01 -4.5897e-01 0.0000e+00
++3.9249e-01 -4.7058e-01 0.0000e+00
++4.4352e-01 -4.7232e-01 0.0000e+00
++4.8986e-01 -4.8925e-01 0.0000e+00
++5.4740e-01 -4.9519e-01 0.0000e+00
+-7.2901e-01 -1.9104e-01 0.0000e+00
+-6.7954e-01 -1.9507e-01 0.0000e+00
+-6.2948e-01 -2.0580e-01 0.0000e+00
+-5.8270e-01 -2.2180e-01 0.0000e+00
+-5.3407e-01 -2.2309e-01 0.0000e+00
+-4.8959e-01 -2.3345e-01 0.0000e+00
+-4.3412e-01 -2.4859e-01 0.0000e+00
+-3.8888e-01 -2.5163e-01 0.0000e+00
+-3.4128e-01 -2.6299e-01 0.0000e+00
+-2.8562e-01 -2.8079e-01 0.0000e+00
+-2.3539e-01 -2.9233e-01 0.0000e+00
+-1.9068e-01 -2.9202e-01 0.0000e+00
+-1.3911e-01 -3.0904e-01 0.0000e+00
+-8.9076e-02 -3.1637e-01 0.0000e+00
+-3.5639e-02 -3.2269e-01 0.0000e+00
++7.1985e-03 -3.3212e-01 0.0000e+00
++5.7488e-02 -3.4201e-01 0.0000e+00
++1.0826e-01 -3.5611e-01 0.0000e+00
++1.5953e-01 -3.7024e-01 0.0000e+00
++2.0587e-01 -3.8028e-01 0.0000e+00
++2.5618e-01 -3.8870e-01 0.0000e+00
++3.0833e-01 -3.9416e-01 0.0000e+00
++3.5472e-01 -4.0771e-01 0.0000e+00
++4.0393e-01 -4.2096e-01 0.0000e+00
++4.5400e-01 -4.2823e-01 0.0000e+00
++5.0245e-01 -4.3624e-01 0.0000e+00
++5.5720e-01 -4.4734e-01 0.0000e+00
+-7.1769e-01 -1.3334e-01 0.0000e+00
+-6.7556e-01 -1.5169e-01 0.0000e+00
+-6.2861e-01 -1.5977e-01 0.0000e+00
+-5.7992e-01 -1.6962e-01 0.0000e+00
+-5.2499e-01 -1.8191e-01 0.0000e+00
+-4.7668e-01 -1.9026e-01 0.0000e+00
+-4.2309e-01 -2.0234e-01 0.0000e+00
+-3.7893e-01 -2.0246e-01 0.0000e+00
+-3.2573e-01 -2.2051e-01 0.0000e+00
+-2.7579e-01 -2.2783e-01 0.0000e+00
+-2.3296e-01 -2.3702e-01 0.0000e+00
+-1.7872e-01 -2.4798e-01 0.0000e+00
+-1.3253e-01 -2.5509e-01 0.0000e+00
+-8.2519e-02 -2.6422e-01 0.0000e+00
+-2.7286e-02 -2.7680e-01 0.0000e+00
++1.9598e-02 -2.8649e-01 0.0000e+00
++6.7620e-02 -2.9312e-01 0.0000e+00
++1.2309e-01 -3.0362e-01 0.0000e+00
++1.6916e-01 -3.1722e-01 0.0000e+00
++2.1647e-01 -3.2687e-01 0.0000e+00
++2.6226e-01 -3.3677e-01 0.0000e+00
++3.1473e-01 -3.4702e-01 0.0000e+00
++3.6570e-01 -3.5789e-01 0.0000e+00
++4.2088e-01 -3.6368e-01 0.0000e+00
++4.6671e-01 -3.7933e-01 0.0000e+00
++5.1400e-01 -3.8519e-01 0.0000e+00
++5.6625e-01 -3.9962e-01 0.0000e+00
++6.1346e-01 -4.0671e-01 0.0000e+00
+-7.1338e-01 -8.9829e-02 0.0000e+00
+-6.6754e-01 -9.6192e-02 0.0000e+00
+-6.1330e-01 -1.0834e-01 0.0000e+00
+-5.6423e-01 -1.2202e-01 0.0000e+00
+-5.1001e-01 -1.2594e-01 0.0000e+00
+-4.6641e-01 -1.3611e-01 0.0000e+00
+-4.2057e-01 -1.5172e-01 0.0000e+00
+-3.6673e-01 -1.6101e-01 0.0000e+00
+-3.1586e-01 -1.6431e-01 0.0000e+00
+-2.6571e-01 -1.7943e-01 0.0000e+00
+-2.2174e-01 -1.8955e-01 0.0000e+00
+-1.6722e-01 -2.0309e-01 0.0000e+00
+-1.1373e-01 -2.0505e-01 0.0000e+00
+-7.4085e-02 -2.1686e-01 0.0000e+00
+-1.6041e-02 -2.2481e-01 0.0000e+00
++3.1121e-02 -2.4227e-01 0.0000e+00
++7.5333e-02 -2.4606e-01 0.0000e+00
++1.2715e-01 -2.6235e-01 0.0000e+00
++1.7888e-01 -2.6808e-01 0.0000e+00
++2.2822e-01 -2.8145e-01 0.0000e+00
++2.7318e-01 -2.8257e-01 0.0000e+00
++3.2399e-01 -3.0216e-01 0.0000e+00
++3.8071e-01 -3.0723e-01 0.0000e+00
++4.2177e-01 -3.2076e-01 0.0000e+00
++4.7589e-01 -3.2363e-01 0.0000e+00
++5.2826e-01 -3.3417e-01 0.0000e+00
++5.7112e-01 -3.4802e-01 0.0000e+00
++6.2481e-01 -3.5688e-01 0.0000e+00
+-7.5668e-01 -2.6366e-02 0.0000e+00
+-7.0061e-01 -3.8520e-02 0.0000e+00
+-6.5641e-01 -4.3339e-02 0.0000e+00
+-5.9972e-01 -5.5773e-02 0.0000e+00
+-5.5645e-01 -6.6808e-02 0.0000e+00
+-5.0145e-01 -7.3987e-02 0.0000e+00
+-4.5769e-01 -8.4935e-02 0.0000e+00
+-4.0673e-01 -1.0317e-01 0.0000e+00
+-3.5549e-01 -1.1084e-01 0.0000e+00
+-3.0444e-01 -1.1836e-01 0.0000e+00
+-2.5606e-01 -1.2941e-01 0.0000e+00
+-2.1001e-01 -1.3864e-01 0.0000e+00
+-1.5959e-01 -1.4854e-01 0.0000e+00
+-1.1253e-01 -1.5794e-01 0.0000e+00
+-5.4478e-02 -1.6695e-01 0.0000e+00
+-1.4379e-02 -1.8187e-01 0.0000e+00
++3.8127e-02 -1.9284e-01 0.0000e+00
++8.9254e-02 -1.9773e-01 0.0000e+00
++1.3969e-01 -2.1218e-01 0.0000e+00
++1.8570e-01 -2.1705e-01 0.0000e+00
++2.3924e-01 -2.3118e-01 0.0000e+00
++2.8317e-01 -2.3749e-01 0.0000e+00
++3.3556e-01 -2.5031e-01 0.0000e+00
++3.8944e-01 -2.5717e-01 0.0000e+00
++4.3477e-01 -2.6570e-01 0.0000e+00
++4.8514e-01 -2.8231e-01 0.0000e+00
++5.3224e-01 -2.8786e-01 0.0000e+00
++5.8449e-01 -2.9806e-01 0.0000e+00
++6.3345e-01 -3.1149e-01 0.0000e+00
++6.8018e-01 -3.2040e-01 0.0000e+00
+-7.4252e-01 +2.4512e-02 0.0000e+00
+-6.9408e-01 +1.3326e-02 0.0000e+00
+-6.4509e-01 +7.0922e-04 0.0000e+00
+-5.9776e-01 -6.6403e-03 0.0000e+00
+-5.4766e-01 -1.9476e-02 0.0000e+00
+-4.9078e-01 -2.4637e-02 0.0000e+00
+-4.4294e-01 -4.1171e-02 0.0000e+00
+-3.9786e-01 -4.5609e-02 0.0000e+00
+-3.5102e-01 -5.6319e-02 0.0000e+00
+-2.9403e-01 -6.9529e-02 0.0000e+00
+-2.4633e-01 -8.1528e-02 0.0000e+00
+-1.9937e-01 -9.0514e-02 0.0000e+00
+-1.5206e-01 -9.8107e-02 0.0000e+00
+-9.4615e-02 -1.0477e-01 0.0000e+00
+-4.9130e-02 -1.1595e-01 0.0000e+00
++4.2879e-03 -1.2629e-01 0.0000e+00
++4.6772e-02 -1.3903e-01 0.0000e+00
++9.6002e-02 -1.5209e-01 0.0000e+00
++1.4783e-01 -1.5994e-01 0.0000e+00
++1.9874e-01 -1.6953e-01 0.0000e+00
++2.4332e-01 -1.8150e-01 0.0000e+00
++2.9730e-01 -1.9107e-01 0.0000e+00
++3.4564e-01 -2.0354e-01 0.0000e+00
++3.9754e-01 -2.0895e-01 0.0000e+00
++4.3976e-01 -2.2151e-01 0.0000e+00
++4.9072e-01 -2.2322e-01 0.0000e+00
++5.4356e-01 -2.4092e-01 0.0000e+00
++5.9083e-01 -2.5113e-01 0.0000e+00
++6.4525e-01 -2.6054e-01 0.0000e+00
++6.9466e-01 -2.6498e-01 0.0000e+00
+-7.2941e-01 +6.5952e-02 0.0000e+00
+-6.7881e-01 +6.0274e-02 0.0000e+00
+-6.3274e-01 +5.5623e-02 0.0000e+00
+-5.8964e-01 +3.7022e-02 0.0000e+00
+-5.3897e-01 +3.0655e-02 0.0000e+00
+-4.8890e-01 +2.5666e-02 0.0000e+00
+-4.3697e-01 +1.0159e-02 0.0000e+00
+-3.8135e-01 +1.8543e-03 0.0000e+00
+-3.3642e-01 -6.0483e-03 0.0000e+00
+-2.8443e-01 -1.9204e-02 0.0000e+00
+-2.3818e-01 -2.4604e-02 0.0000e+00
+-1.8575e-01 -3.7174e-02 0.0000e+00
+-1.4271e-01 -5.3508e-02 0.0000e+00
+-8.7721e-02 -5.7648e-02 0.0000e+00
+-3.7258e-02 -6.9678e-02 0.0000e+00
++1.1462e-02 -7.7543e-02 0.0000e+00
++5.7941e-02 -9.0419e-02 0.0000e+00
++1.1094e-01 -9.9799e-02 0.0000e+00
++1.6189e-01 -1.1079e-01 0.0000e+00
++2.1187e-01 -1.1703e-01 0.0000e+00
++2.5631e-01 -1.2862e-01 0.0000e+00
++3.1204e-01 -1.3564e-01 0.0000e+00
++3.5873e-01 -1.5401e-01 0.0000e+00
++4.0578e-01 -1.6312e-01 0.0000e+00
++4.5307e-01 -1.6513e-01 0.0000e+00
++5.0157e-01 -1.8202e-01 0.0000e+00
++5.4954e-01 -1.9065e-01 0.0000e+00
++5.9893e-01 -1.9991e-01 0.0000e+00
++6.5243e-01 -2.1242e-01 0.0000e+00
++7.0245e-01 -2.1432e-01 0.0000e+00
+-7.2404e-01 +1.2132e-01 0.0000e+00
+-6.7587e-01 +1.0908e-01 0.0000e+00
+-6.2620e-01 +1.0360e-01 0.0000e+00
+-5.7764e-01 +9.4272e-02 0.0000e+00
+-5.2321e-01 +7.8980e-02 0.0000e+00
+-4.7478e-01 +7.3793e-02 0.0000e+00
+-4.2218e-01 +5.9989e-02 0.0000e+00
+-3.7618e-01 +5.3645e-02 0.0000e+00
+-3.2897e-01 +3.7561e-02 0.0000e+00
+-2.7688e-01 +3.4665e-02 0.0000e+00
+-2.2582e-01 +1.8837e-02 0.0000e+00
+-1.8334e-01 +8.8430e-03 0.0000e+00
+-1.2409e-01 +3.6103e-03 0.0000e+00
+-7.5410e-02 -5.4829e-03 0.0000e+00
+-2.7765e-02 -2.4068e-02 0.0000e+00
++1.6084e-02 -3.2386e-02 0.0000e+00
++7.1435e-02 -4.2151e-02 0.0000e+00
++1.1520e-01 -5.1688e-02 0.0000e+00
++1.7053e-01 -6.4173e-02 0.0000e+00
++2.2073e-01 -6.9410e-02 0.0000e+00
++2.7055e-01 -8.0798e-02 0.0000e+00
++3.1505e-01 -8.4942e-02 0.0000e+00
++3.6709e-01 -1.0312e-01 0.0000e+00
++4.1553e-01 -1.0631e-01 0.0000e+00
++4.6985e-01 -1.1963e-01 0.0000e+00
++5.1110e-01 -1.2724e-01 0.0000e+00
++5.6275e-01 -1.3771e-01 0.0000e+00
++6.1663e-01 -1.5178e-01 0.0000e+00
++6.6266e-01 -1.5956e-01 0.0000e+00
++7.0862e-01 -1.6977e-01 0.0000e+00
+-7.0869e-01 +1.6939e-01 0.0000e+00
+-6.6274e-01 +1.6415e-01 0.0000e+00
+-6.1178e-01 +1.4969e-01 0.0000e+00
+-5.6677e-01 +1.4239e-01 0.0000e+00
+-5.1410e-01 +1.3182e-01 0.0000e+00
+-4.6264e-01 +1.1691e-01 0.0000e+00
+-4.1459e-01 +1.0776e-01 0.0000e+00
+-3.6788e-01 +9.5009e-02 0.0000e+00
+-3.1546e-01 +8.6292e-02 0.0000e+00
+-2.6948e-01 +7.8151e-02 0.0000e+00
+-2.1830e-01 +6.6984e-02 0.0000e+00
+-1.6771e-01 +6.2014e-02 0.0000e+00
+-1.2086e-01 +5.3920e-02 0.0000e+00
+-6.6143e-02 +3.6714e-02 0.0000e+00
+-2.0306e-02 +3.2789e-02 0.0000e+00
++3.3333e-02 +1.5834e-02 0.0000e+00
++7.6273e-02 +1.3759e-02 0.0000e+00
++1.3010e-01 +2.3212e-03 0.0000e+00
++1.7508e-01 -1.4378e-02 0.0000e+00
++2.2991e-01 -2.3357e-02 0.0000e+00
++2.8124e-01 -3.1712e-02 0.0000e+00
++3.2385e-01 -3.9261e-02 0.0000e+00
++3.7293e-01 -5.2148e-02 0.0000e+00
++4.3057e-01 -5.8447e-02 0.0000e+00
++4.7465e-01 -6.6010e-02 0.0000e+00
++5.2492e-01 -7.8007e-02 0.0000e+00
++5.7701e-01 -8.5853e-02 0.0000e+00
++6.2152e-01 -1.0316e-01 0.0000e+00
++6.7814e-01 -1.0931e-01 0.0000e+00
++7.2132e-01 -1.2300e-01 0.0000e+00
+-6.9986e-01 +2.1871e-01 0.0000e+00
+-6.5729e-01 +2.1068e-01 0.0000e+00
+-6.0287e-01 +2.0416e-01 0.0000e+00
+-5.5081e-01 +1.8690e-01 0.0000e+00
+-5.0419e-01 +1.8343e-01 0.0000e+00
+-4.5523e-01 +1.6716e-01 0.0000e+00
+-4.0682e-01 +1.5687e-01 0.0000e+00
+-3.5211e-01 +1.4705e-01 0.0000e+00
+-3.0897e-01 +1.4474e-01 0.0000e+00
+-2.5590e-01 +1.2399e-01 0.0000e+00
+-2.1252e-01 +1.1677e-01 0.0000e+00
+-1.5664e-01 +1.0804e-01 0.0000e+00
+-1.1033e-01 +1.0295e-01 0.0000e+00
+-6.0153e-02 +8.6413e-02 0.0000e+00
+-8.6272e-03 +8.3020e-02 0.0000e+00
++3.6841e-02 +6.9842e-02 0.0000e+00
++9.4121e-02 +5.8481e-02 0.0000e+00
++1.3971e-01 +4.7342e-02 0.0000e+00
++1.9198e-01 +4.2631e-02 0.0000e+00
++2.3723e-01 +3.2268e-02 0.0000e+00
++2.8580e-01 +1.5828e-02 0.0000e+00
++3.3317e-01 +8.6341e-03 0.0000e+00
++3.8620e-01 +4.5690e-04 0.0000e+00
++4.3470e-01 -1.5619e-02 0.0000e+00
++4.8624e-01 -1.6848e-02 0.0000e+00
++5.3177e-01 -3.0476e-02 0.0000e+00
++5.8319e-01 -4.3028e-02 0.0000e+00
++6.3400e-01 -4.5735e-02 0.0000e+00
++6.8500e-01 -6.1278e-02 0.0000e+00
++7.3072e-01 -7.5061e-02 0.0000e+00
+-6.9356e-01 +2.6798e-01 0.0000e+00
+-6.4494e-01 +2.5853e-01 0.0000e+00
+-5.9590e-01 +2.5021e-01 0.0000e+00
+-5.4232e-01 +2.4297e-01 0.0000e+00
+-4.9872e-01 +2.2750e-01 0.0000e+00
+-4.4992e-01 +2.1512e-01 0.0000e+00
+-3.9650e-01 +2.0536e-01 0.0000e+00
+-3.4881e-01 +1.9808e-01 0.0000e+00
+-2.9391e-01 +1.8312e-01 0.0000e+00
+-2.4355e-01 +1.8181e-01 0.0000e+00
+-2.0347e-01 +1.6580e-01 0.0000e+00
+-1.5269e-01 +1.5639e-01 0.0000e+00
+-1.0367e-01 +1.4683e-01 0.0000e+00
+-4.8485e-02 +1.4280e-01 0.0000e+00
++2.1699e-03 +1.2682e-01 0.0000e+00
++5.3781e-02 +1.1716e-01 0.0000e+00
++9.6452e-02 +1.0740e-01 0.0000e+00
++1.5031e-01 +9.8504e-02 0.0000e+00
++1.9636e-01 +9.0509e-02 0.0000e+00
++2.4577e-01 +7.6267e-02 0.0000e+00
++3.0088e-01 +6.6860e-02 0.0000e+00
++3.4725e-01 +5.8143e-02 0.0000e+00
++3.9361e-01 +5.1537e-02 0.0000e+00
++4.4406e-01 +3.5217e-02 0.0000e+00
++4.9442e-01 +2.7869e-02 0.0000e+00
++5.4020e-01 +1.5939e-02 0.0000e+00
++5.9724e-01 +8.4442e-03 0.0000e+00
++6.4767e-01 -1.9541e-03 0.0000e+00
++6.9704e-01 -1.1902e-02 0.0000e+00
++7.4626e-01 -2.5827e-02 0.0000e+00
+-6.7758e-01 +3.2129e-01 0.0000e+00
+-6.3429e-01 +3.0498e-01 0.0000e+00
+-5.8716e-01 +2.9665e-01 0.0000e+00
+-5.3501e-01 +2.8763e-01 0.0000e+00
+-4.8284e-01 +2.7943e-01 0.0000e+00
+-4.3910e-01 +2.6716e-01 0.0000e+00
+-3.8691e-01 +2.6349e-01 0.0000e+00
+-3.3972e-01 +2.4501e-01 0.0000e+00
+-2.8591e-01 +2.3363e-01 0.0000e+00
+-2.4204e-01 +2.2742e-01 0.0000e+00
+-1.8567e-01 +2.1537e-01 0.0000e+00
+-1.4225e-01 +2.0581e-01 0.0000e+00
+-9.3145e-02 +1.9545e-01 0.0000e+00
+-3.8178e-02 +1.8534e-01 0.0000e+00
++1.5068e-02 +1.7729e-01 0.0000e+00
++6.4232e-02 +1.7127e-01 0.0000e+00
++1.1160e-01 +1.5769e-01 0.0000e+00
++1.5496e-01 +1.4754e-01 0.0000e+00
++2.0512e-01 +1.3708e-01 0.0000e+00
++2.5317e-01 +1.2906e-01 0.0000e+00
++3.0805e-01 +1.1721e-01 0.0000e+00
++3.5710e-01 +1.1235e-01 0.0000e+00
++4.0607e-01 +1.0308e-01 0.0000e+00
++4.5286e-01 +8.7608e-02 0.0000e+00
++5.0298e-01 +8.2270e-02 0.0000e+00
++5.5166e-01 +6.5784e-02 0.0000e+00
++6.0596e-01 +6.1986e-02 0.0000e+00
++6.5439e-01 +4.4668e-02 0.0000e+00
++7.0402e-01 +3.5802e-02 0.0000e+00
++7.5096e-01 +3.2896e-02 0.0000e+00
+-6.2374e-01 +3.5690e-01 0.0000e+00
+-5.7656e-01 +3.4526e-01 0.0000e+00
+-5.2339e-01 +3.3385e-01 0.0000e+00
+-4.7754e-01 +3.2466e-01 0.0000e+00
+-4.2726e-01 +3.2196e-01 0.0000e+00
+-3.7233e-01 +3.0361e-01 0.0000e+00
+-3.2378e-01 +2.9697e-01 0.0000e+00
+-2.7603e-01 +2.8941e-01 0.0000e+00
+-2.2558e-01 +2.7643e-01 0.0000e+00
+-1.7748e-01 +2.6272e-01 0.0000e+00
+-1.3259e-01 +2.5750e-01 0.0000e+00
+-7.3298e-02 +2.5061e-01 0.0000e+00
+-3.1501e-02 +2.3555e-01 0.0000e+00
++1.8477e-02 +2.2635e-01 0.0000e+00
++7.0004e-02 +2.2012e-01 0.0000e+00
++1.1466e-01 +2.0375e-01 0.0000e+00
++1.6523e-01 +1.9896e-01 0.0000e+00
++2.1459e-01 +1.8828e-01 0.0000e+00
++2.7254e-01 +1.7943e-01 0.0000e+00
++3.1759e-01 +1.6957e-01 0.0000e+00
++3.6351e-01 +1.5500e-01 0.0000e+00
++4.1370e-01 +1.5248e-01 0.0000e+00
++4.6687e-01 +1.4037e-01 0.0000e+00
++5.1411e-01 +1.2404e-01 0.0000e+00
++5.6345e-01 +1.1476e-01 0.0000e+00
++6.1899e-01 +1.1159e-01 0.0000e+00
++6.6317e-01 +9.7142e-02 0.0000e+00
++7.0926e-01 +8.7090e-02 0.0000e+00
+-6.1781e-01 +4.0772e-01 0.0000e+00
+-5.6617e-01 +3.9987e-01 0.0000e+00
+-5.1246e-01 +3.9088e-01 0.0000e+00
+-4.6406e-01 +3.7517e-01 0.0000e+00
+-4.2022e-01 +3.6799e-01 0.0000e+00
+-3.6886e-01 +3.5827e-01 0.0000e+00
+-3.2101e-01 +3.4879e-01 0.0000e+00
+-2.7184e-01 +3.3342e-01 0.0000e+00
+-2.2097e-01 +3.2894e-01 0.0000e+00
+-1.6834e-01 +3.1834e-01 0.0000e+00
+-1.2257e-01 +3.1084e-01 0.0000e+00
+-7.1686e-02 +3.0079e-01 0.0000e+00
+-1.9268e-02 +2.8842e-01 0.0000e+00
++3.3964e-02 +2.7299e-01 0.0000e+00
++7.7790e-02 +2.7092e-01 0.0000e+00
++1.3157e-01 +2.5254e-01 0.0000e+00
++1.7733e-01 +2.4390e-01 0.0000e+00
++2.2882e-01 +2.3438e-01 0.0000e+00
++2.7918e-01 +2.2204e-01 0.0000e+00
++3.2448e-01 +2.2004e-01 0.0000e+00
++3.7743e-01 +2.0234e-01 0.0000e+00
++4.2296e-01 +1.9280e-01 0.0000e+00
++4.7105e-01 +1.8909e-01 0.0000e+00
++5.2641e-01 +1.7417e-01 0.0000e+00
++5.7296e-01 +1.6277e-01 0.0000e+00
++6.2756e-01 +1.5692e-01 0.0000e+00
++6.7507e-01 +1.4509e-01 0.0000e+00
++7.2654e-01 +1.3595e-01 0.0000e+00
+-5.5678e-01 +4.5009e-01 0.0000e+00
+-5.0760e-01 +4.3983e-01 0.0000e+00
+-4.5535e-01 +4.2494e-01 0.0000e+00
+-4.0451e-01 +4.1564e-01 0.0000e+00
+-3.5521e-01 +4.1034e-01 0.0000e+00
+-3.0483e-01 +3.9615e-01 0.0000e+00
+-2.5967e-01 +3.8841e-01 0.0000e+00
+-2.0358e-01 +3.7515e-01 0.0000e+00
+-1.5758e-01 +3.6565e-01 0.0000e+00
+-1.0925e-01 +3.6182e-01 0.0000e+00
+-6.0042e-02 +3.4234e-01 0.0000e+00
+-1.2796e-02 +3.3738e-01 0.0000e+00
++3.4519e-02 +3.2330e-01 0.0000e+00
++9.2387e-02 +3.1305e-01 0.0000e+00
++1.4391e-01 +3.1017e-01 0.0000e+00
++1.8501e-01 +3.0218e-01 0.0000e+00
++2.3663e-01 +2.8681e-01 0.0000e+00
++2.8223e-01 +2.7476e-01 0.0000e+00
++3.3821e-01 +2.6850e-01 0.0000e+00
++3.8717e-01 +2.5166e-01 0.0000e+00
++4.3304e-01 +2.4739e-01 0.0000e+00
++4.8577e-01 +2.3389e-01 0.0000e+00
++5.3789e-01 +2.2399e-01 0.0000e+00
++5.8151e-01 +2.1351e-01 0.0000e+00
++6.3640e-01 +2.0840e-01 0.0000e+00
++6.8395e-01 +1.9764e-01 0.0000e+00
++7.2895e-01 +1.8474e-01 0.0000e+00
+-5.4630e-01 +4.9926e-01 0.0000e+00
+-4.9601e-01 +4.8812e-01 0.0000e+00
+-4.5050e-01 +4.7249e-01 0.0000e+00
+-3.9559e-01 +4.6974e-01 0.0000e+00
+-3.4231e-01 +4.5192e-01 0.0000e+00
+-3.0168e-01 +4.4330e-01 0.0000e+00
+-2.4809e-01 +4.3578e-01 0.0000e+00
+-1.9643e-01 +4.2723e-01 0.0000e+00
+-1.4490e-01 +4.1950e-01 0.0000e+00
+-9.9531e-02 +4.1031e-01 0.0000e+00
+-4.5988e-02 +3.9233e-01 0.0000e+00
++1.9186e-03 +3.8207e-01 0.0000e+00
++5.1680e-02 +3.7576e-01 0.0000e+00
++1.0248e-01 +3.6566e-01 0.0000e+00
++1.4481e-01 +3.5519e-01 0.0000e+00
++1.9767e-01 +3.4704e-01 0.0000e+00
++2.5207e-01 +3.3071e-01 0.0000e+00
++2.9609e-01 +3.2315e-01 0.0000e+00
++3.4375e-01 +3.1966e-01 0.0000e+00
++3.9862e-01 +3.0901e-01 0.0000e+00
++4.4432e-01 +2.9418e-01 0.0000e+00
++4.9489e-01 +2.8617e-01 0.0000e+00
++5.4498e-01 +2.7522e-01 0.0000e+00
++5.9712e-01 +2.6467e-01 0.0000e+00
++6.4871e-01 +2.5915e-01 0.0000e+00
++6.9628e-01 +2.4441e-01 0.0000e+00
+-4.8583e-01 +5.3290e-01 0.0000e+00
+-4.3781e-01 +5.2790e-01 0.0000e+00
+-3.8071e-01 +5.1538e-01 0.0000e+00
+-3.3892e-01 +5.0595e-01 0.0000e+00
+-2.8747e-01 +4.9907e-01 0.0000e+00
+-2.3607e-01 +4.8474e-01 0.0000e+00
+-1.8389e-01 +4.7985e-01 0.0000e+00
+-1.4052e-01 +4.6206e-01 0.0000e+00
+-8.8316e-02 +4.5257e-01 0.0000e+00
+-3.8222e-02 +4.4121e-01 0.0000e+00
++1.2297e-02 +4.3138e-01 0.0000e+00
++6.3930e-02 +4.2064e-01 0.0000e+00
++1.0520e-01 +4.1608e-01 0.0000e+00
++1.6048e-01 +4.0407e-01 0.0000e+00
++2.0596e-01 +3.9584e-01 0.0000e+00
++2.6102e-01 +3.8415e-01 0.0000e+00
++3.0436e-01 +3.7628e-01 0.0000e+00
++3.5732e-01 +3.6483e-01 0.0000e+00
++4.0730e-01 +3.5983e-01 0.0000e+00
++4.5166e-01 +3.4759e-01 0.0000e+00
++5.0110e-01 +3.3660e-01 0.0000e+00
++5.5682e-01 +3.2288e-01 0.0000e+00
++6.0067e-01 +3.1305e-01 0.0000e+00
++6.5385e-01 +3.0307e-01 0.0000e+00
+-4.7740e-01 +5.8787e-01 0.0000e+00
+-4.2245e-01 +5.7870e-01 0.0000e+00
+-3.7538e-01 +5.6934e-01 0.0000e+00
+-3.2795e-01 +5.5954e-01 0.0000e+00
+-2.7211e-01 +5.4840e-01 0.0000e+00
+-2.3029e-01 +5.3469e-01 0.0000e+00
+-1.7737e-01 +5.2316e-01 0.0000e+00
+-1.3205e-01 +5.1568e-01 0.0000e+00
+-8.3172e-02 +5.0303e-01 0.0000e+00
+-2.8326e-02 +5.0026e-01 0.0000e+00
++2.1412e-02 +4.8363e-01 0.0000e+00
++7.3839e-02 +4.7465e-01 0.0000e+00
++1.1642e-01 +4.6924e-01 0.0000e+00
++1.6533e-01 +4.5543e-01 0.0000e+00
++2.1738e-01 +4.5001e-01 0.0000e+00
++2.6746e-01 +4.3584e-01 0.0000e+00
++3.1556e-01 +4.2792e-01 0.0000e+00
++3.6717e-01 +4.1238e-01 0.0000e+00
++4.1214e-01 +4.0724e-01 0.0000e+00
++4.6754e-01 +3.9305e-01 0.0000e+00
++5.1944e-01 +3.7999e-01 0.0000e+00
++5.6619e-01 +3.7645e-01 0.0000e+00
++6.1169e-01 +3.6641e-01 0.0000e+00
++6.6598e-01 +3.5768e-01 0.0000e+00
+-4.1399e-01 +6.2771e-01 0.0000e+00
+-3.6227e-01 +6.1661e-01 0.0000e+00
+-3.1494e-01 +6.0726e-01 0.0000e+00
+-2.6875e-01 +5.9579e-01 0.0000e+00
+-2.1677e-01 +5.8531e-01 0.0000e+00
+-1.7124e-01 +5.7221e-01 0.0000e+00
+-1.1586e-01 +5.6204e-01 0.0000e+00
+-6.4021e-02 +5.5022e-01 0.0000e+00
+-1.5210e-02 +5.4809e-01 0.0000e+00
++3.2705e-02 +5.3822e-01 0.0000e+00
++8.4901e-02 +5.2700e-01 0.0000e+00
++1.2574e-01 +5.1626e-01 0.0000e+00
++1.8098e-01 +5.0288e-01 0.0000e+00
++2.3273e-01 +4.9462e-01 0.0000e+00
++2.7450e-01 +4.8996e-01 0.0000e+00
++3.2434e-01 +4.7633e-01 0.0000e+00
++3.8227e-01 +4.6771e-01 0.0000e+00
++4.3104e-01 +4.5770e-01 0.0000e+00
++4.7228e-01 +4.4794e-01 0.0000e+00
++5.2696e-01 +4.2982e-01 0.0000e+00
++5.7754e-01 +4.2039e-01 0.0000e+00
++6.2382e-01 +4.1740e-01 0.0000e+00
+-3.5108e-01 +6.6852e-01 0.0000e+00
+-3.1012e-01 +6.5604e-01 0.0000e+00
+-2.6012e-01 +6.4489e-01 0.0000e+00
+-2.0697e-01 +6.3754e-01 0.0000e+00
+-1.5832e-01 +6.2238e-01 0.0000e+00
+-1.0425e-01 +6.1859e-01 0.0000e+00
+-5.2425e-02 +6.0796e-01 0.0000e+00
+-1.1190e-02 +5.9807e-01 0.0000e+00
++4.2215e-02 +5.7913e-01 0.0000e+00
++9.2694e-02 +5.7500e-01 0.0000e+00
++1.3928e-01 +5.6680e-01 0.0000e+00
++1.9203e-01 +5.4990e-01 0.0000e+00
++2.3906e-01 +5.4390e-01 0.0000e+00
++2.8466e-01 +5.3770e-01 0.0000e+00
++3.3875e-01 +5.2327e-01 0.0000e+00
++3.9088e-01 +5.1281e-01 0.0000e+00
++4.3376e-01 +5.0972e-01 0.0000e+00
++4.8507e-01 +4.9134e-01 0.0000e+00
++5.3753e-01 +4.7890e-01 0.0000e+00
++5.9004e-01 +4.7483e-01 0.0000e+00
+-2.4871e-01 +6.9147e-01 0.0000e+00
+-1.9642e-01 +6.8728e-01 0.0000e+00
+-1.4886e-01 +6.7540e-01 0.0000e+00
+-1.0118e-01 +6.6351e-01 0.0000e+00
+-5.2651e-02 +6.5350e-01 0.0000e+00
++1.6487e-03 +6.4344e-01 0.0000e+00
++4.5189e-02 +6.2977e-01 0.0000e+00
++1.0437e-01 +6.2077e-01 0.0000e+00
++1.5230e-01 +6.1305e-01 0.0000e+00
++2.0222e-01 +5.9891e-01 0.0000e+00
++2.5160e-01 +5.9604e-01 0.0000e+00
++2.9498e-01 +5.8867e-01 0.0000e+00
++3.4854e-01 +5.7454e-01 0.0000e+00
++4.0093e-01 +5.6668e-01 0.0000e+00
++4.5145e-01 +5.5534e-01 0.0000e+00
++4.9450e-01 +5.4266e-01 0.0000e+00
+-1.3462e-01 +7.2537e-01 0.0000e+00
+-8.8705e-02 +7.1075e-01 0.0000e+00
+-3.6835e-02 +7.0093e-01 0.0000e+00
++1.1842e-02 +6.8835e-01 0.0000e+00
++5.8471e-02 +6.8323e-01 0.0000e+00
++1.1466e-01 +6.7504e-01 0.0000e+00
++1.5711e-01 +6.6202e-01 0.0000e+00
++2.1469e-01 +6.5662e-01 0.0000e+00
++2.6086e-01 +6.4662e-01 0.0000e+00
++3.0436e-01 +6.3161e-01 0.0000e+00
++3.6174e-01 +6.2620e-01 0.0000e+00
++4.0904e-01 +6.1499e-01 0.0000e+00
+-2.9701e-02 +7.5263e-01 0.0000e+00
++2.1597e-02 +7.4605e-01 0.0000e+00
++7.2686e-02 +7.3413e-01 0.0000e+00
++1.1590e-01 +7.2443e-01 0.0000e+00
++1.6912e-01 +7.1159e-01 0.0000e+00
++2.2211e-01 +6.9827e-01 0.0000e+00
++2.7002e-01 +6.9095e-01 0.0000e+00
++3.1843e-01 +6.8121e-01 0.0000e+00
@@ -0,0 +1,711 @@
+-6.2279e-01 -4.5648e-01 0.0000e+00
+-5.7609e-01 -4.9274e-01 0.0000e+00
+-5.4098e-01 -5.3018e-01 0.0000e+00
+-4.9953e-01 -5.5942e-01 0.0000e+00
+-4.6875e-01 -5.9148e-01 0.0000e+00
+-4.2054e-01 -6.3026e-01 0.0000e+00
+-3.8321e-01 -6.6379e-01 0.0000e+00
+-3.3966e-01 -6.9288e-01 0.0000e+00
+-7.0727e-01 -3.2034e-01 0.0000e+00
+-6.6819e-01 -3.5779e-01 0.0000e+00
+-6.2736e-01 -3.9187e-01 0.0000e+00
+-5.8774e-01 -4.2414e-01 0.0000e+00
+-5.4841e-01 -4.5456e-01 0.0000e+00
+-5.1394e-01 -4.8707e-01 0.0000e+00
+-4.7285e-01 -5.2201e-01 0.0000e+00
+-4.3190e-01 -5.4981e-01 0.0000e+00
+-3.8549e-01 -5.8615e-01 0.0000e+00
+-3.5148e-01 -6.1423e-01 0.0000e+00
+-3.1051e-01 -6.5370e-01 0.0000e+00
+-2.6745e-01 -6.8966e-01 0.0000e+00
+-2.2877e-01 -7.1761e-01 0.0000e+00
+-7.2008e-01 -2.4754e-01 0.0000e+00
+-6.7388e-01 -2.8607e-01 0.0000e+00
+-6.3375e-01 -3.0856e-01 0.0000e+00
+-5.9713e-01 -3.4839e-01 0.0000e+00
+-5.5782e-01 -3.7902e-01 0.0000e+00
+-5.1257e-01 -4.1381e-01 0.0000e+00
+-4.7196e-01 -4.4879e-01 0.0000e+00
+-4.3905e-01 -4.8148e-01 0.0000e+00
+-3.9661e-01 -5.1483e-01 0.0000e+00
+-3.5208e-01 -5.4601e-01 0.0000e+00
+-3.1588e-01 -5.8173e-01 0.0000e+00
+-2.7752e-01 -6.1471e-01 0.0000e+00
+-2.3733e-01 -6.4401e-01 0.0000e+00
+-1.9869e-01 -6.8086e-01 0.0000e+00
+-1.5386e-01 -7.0885e-01 0.0000e+00
+-1.1876e-01 -7.4653e-01 0.0000e+00
+-7.5987e-01 -1.4474e-01 0.0000e+00
+-7.1958e-01 -1.7752e-01 0.0000e+00
+-6.8379e-01 -2.0561e-01 0.0000e+00
+-6.3671e-01 -2.3690e-01 0.0000e+00
+-5.9894e-01 -2.7002e-01 0.0000e+00
+-5.6168e-01 -3.0530e-01 0.0000e+00
+-5.2381e-01 -3.3825e-01 0.0000e+00
+-4.8352e-01 -3.7579e-01 0.0000e+00
+-4.4396e-01 -4.0743e-01 0.0000e+00
+-4.0046e-01 -4.3531e-01 0.0000e+00
+-3.6085e-01 -4.7297e-01 0.0000e+00
+-3.2332e-01 -4.9942e-01 0.0000e+00
+-2.8191e-01 -5.3795e-01 0.0000e+00
+-2.4493e-01 -5.6802e-01 0.0000e+00
+-2.0114e-01 -6.0365e-01 0.0000e+00
+-1.6680e-01 -6.4377e-01 0.0000e+00
+-1.2277e-01 -6.7629e-01 0.0000e+00
+-7.9405e-02 -7.0516e-01 0.0000e+00
+-4.8231e-02 -7.3839e-01 0.0000e+00
+-8.9603e-03 -7.7220e-01 0.0000e+00
+-7.6281e-01 -6.4932e-02 0.0000e+00
+-7.2666e-01 -1.0363e-01 0.0000e+00
+-6.8318e-01 -1.3028e-01 0.0000e+00
+-6.4607e-01 -1.6251e-01 0.0000e+00
+-6.0387e-01 -1.9863e-01 0.0000e+00
+-5.6921e-01 -2.3732e-01 0.0000e+00
+-5.2626e-01 -2.7254e-01 0.0000e+00
+-4.9035e-01 -3.0007e-01 0.0000e+00
+-4.5249e-01 -3.3655e-01 0.0000e+00
+-4.0965e-01 -3.6056e-01 0.0000e+00
+-3.6669e-01 -4.0242e-01 0.0000e+00
+-3.2859e-01 -4.3949e-01 0.0000e+00
+-2.8993e-01 -4.7105e-01 0.0000e+00
+-2.5034e-01 -5.0287e-01 0.0000e+00
+-2.0653e-01 -5.3630e-01 0.0000e+00
+-1.6805e-01 -5.6810e-01 0.0000e+00
+-1.2949e-01 -6.0271e-01 0.0000e+00
+-9.3906e-02 -6.3247e-01 0.0000e+00
+-5.2892e-02 -6.6722e-01 0.0000e+00
+-1.5447e-02 -6.9818e-01 0.0000e+00
++2.9798e-02 -7.3565e-01 0.0000e+00
++6.6476e-02 -7.6980e-01 0.0000e+00
+-7.7310e-01 +6.7412e-03 0.0000e+00
+-7.3404e-01 -2.2403e-02 0.0000e+00
+-6.9614e-01 -6.3038e-02 0.0000e+00
+-6.5068e-01 -9.6381e-02 0.0000e+00
+-6.0793e-01 -1.2794e-01 0.0000e+00
+-5.7090e-01 -1.6384e-01 0.0000e+00
+-5.3909e-01 -1.9319e-01 0.0000e+00
+-4.9534e-01 -2.3188e-01 0.0000e+00
+-4.5902e-01 -2.6283e-01 0.0000e+00
+-4.1001e-01 -2.9309e-01 0.0000e+00
+-3.7617e-01 -3.3018e-01 0.0000e+00
+-3.3340e-01 -3.6120e-01 0.0000e+00
+-2.9953e-01 -3.9725e-01 0.0000e+00
+-2.5395e-01 -4.2561e-01 0.0000e+00
+-2.1901e-01 -4.6424e-01 0.0000e+00
+-1.7725e-01 -4.9440e-01 0.0000e+00
+-1.3943e-01 -5.2525e-01 0.0000e+00
+-9.8565e-02 -5.5698e-01 0.0000e+00
+-5.8287e-02 -5.9839e-01 0.0000e+00
+-1.9491e-02 -6.3073e-01 0.0000e+00
++2.7484e-02 -6.5894e-01 0.0000e+00
++5.8090e-02 -6.8839e-01 0.0000e+00
++1.0606e-01 -7.2554e-01 0.0000e+00
++1.4344e-01 -7.6109e-01 0.0000e+00
+-7.4291e-01 +4.2893e-02 0.0000e+00
+-7.0111e-01 +1.5068e-02 0.0000e+00
+-6.6033e-01 -2.0959e-02 0.0000e+00
+-6.1966e-01 -5.9533e-02 0.0000e+00
+-5.8084e-01 -8.2360e-02 0.0000e+00
+-5.3882e-01 -1.2053e-01 0.0000e+00
+-5.0053e-01 -1.4945e-01 0.0000e+00
+-4.5654e-01 -1.8645e-01 0.0000e+00
+-4.1928e-01 -2.1777e-01 0.0000e+00
+-3.8787e-01 -2.5344e-01 0.0000e+00
+-3.4627e-01 -2.8977e-01 0.0000e+00
+-3.0056e-01 -3.2397e-01 0.0000e+00
+-2.6436e-01 -3.5580e-01 0.0000e+00
+-2.2075e-01 -3.9049e-01 0.0000e+00
+-1.8440e-01 -4.1358e-01 0.0000e+00
+-1.4477e-01 -4.4919e-01 0.0000e+00
+-1.0518e-01 -4.8688e-01 0.0000e+00
+-7.0499e-02 -5.2134e-01 0.0000e+00
+-2.4911e-02 -5.4935e-01 0.0000e+00
++1.9526e-02 -5.8643e-01 0.0000e+00
++5.2495e-02 -6.1615e-01 0.0000e+00
++9.7708e-02 -6.5599e-01 0.0000e+00
++1.2821e-01 -6.8839e-01 0.0000e+00
++1.7104e-01 -7.1635e-01 0.0000e+00
+-7.4735e-01 +1.1771e-01 0.0000e+00
+-7.0691e-01 +8.3772e-02 0.0000e+00
+-6.6245e-01 +5.3192e-02 0.0000e+00
+-6.2738e-01 +2.1359e-02 0.0000e+00
+-5.9077e-01 -1.2013e-02 0.0000e+00
+-5.4956e-01 -4.8972e-02 0.0000e+00
+-5.0561e-01 -8.6200e-02 0.0000e+00
+-4.7113e-01 -1.1248e-01 0.0000e+00
+-4.2634e-01 -1.4625e-01 0.0000e+00
+-3.8815e-01 -1.8325e-01 0.0000e+00
+-3.4795e-01 -2.1538e-01 0.0000e+00
+-3.0696e-01 -2.4549e-01 0.0000e+00
+-2.6774e-01 -2.7835e-01 0.0000e+00
+-2.3635e-01 -3.1436e-01 0.0000e+00
+-1.8744e-01 -3.4538e-01 0.0000e+00
+-1.5208e-01 -3.7780e-01 0.0000e+00
+-1.0836e-01 -4.0981e-01 0.0000e+00
+-7.6822e-02 -4.4798e-01 0.0000e+00
+-3.2832e-02 -4.7807e-01 0.0000e+00
++1.3277e-02 -5.1171e-01 0.0000e+00
++4.8845e-02 -5.4902e-01 0.0000e+00
++8.3608e-02 -5.8118e-01 0.0000e+00
++1.2285e-01 -6.1608e-01 0.0000e+00
++1.6795e-01 -6.4266e-01 0.0000e+00
++2.0138e-01 -6.8061e-01 0.0000e+00
++2.5029e-01 -7.1415e-01 0.0000e+00
+-7.5009e-01 +1.8519e-01 0.0000e+00
+-7.0752e-01 +1.5732e-01 0.0000e+00
+-6.6769e-01 +1.2313e-01 0.0000e+00
+-6.3341e-01 +8.5799e-02 0.0000e+00
+-5.9024e-01 +6.0810e-02 0.0000e+00
+-5.5527e-01 +2.9685e-02 0.0000e+00
+-5.1273e-01 -1.1131e-02 0.0000e+00
+-4.7349e-01 -3.6036e-02 0.0000e+00
+-4.3619e-01 -6.9595e-02 0.0000e+00
+-3.9479e-01 -1.1290e-01 0.0000e+00
+-3.5522e-01 -1.4790e-01 0.0000e+00
+-3.1480e-01 -1.6953e-01 0.0000e+00
+-2.7670e-01 -2.1012e-01 0.0000e+00
+-2.3524e-01 -2.4124e-01 0.0000e+00
+-1.9022e-01 -2.7312e-01 0.0000e+00
+-1.5626e-01 -3.0260e-01 0.0000e+00
+-1.1582e-01 -3.3615e-01 0.0000e+00
+-7.7011e-02 -3.7372e-01 0.0000e+00
+-3.7769e-02 -4.1157e-01 0.0000e+00
+-9.5611e-04 -4.4332e-01 0.0000e+00
++4.0224e-02 -4.7555e-01 0.0000e+00
++8.4505e-02 -5.0602e-01 0.0000e+00
++1.1964e-01 -5.4096e-01 0.0000e+00
++1.5747e-01 -5.7700e-01 0.0000e+00
++1.9899e-01 -6.0809e-01 0.0000e+00
++2.3869e-01 -6.3904e-01 0.0000e+00
++2.8256e-01 -6.7586e-01 0.0000e+00
+-7.1162e-01 +2.3160e-01 0.0000e+00
+-6.8267e-01 +1.9444e-01 0.0000e+00
+-6.4435e-01 +1.6415e-01 0.0000e+00
+-6.0533e-01 +1.3142e-01 0.0000e+00
+-5.6189e-01 +9.3437e-02 0.0000e+00
+-5.2248e-01 +6.2244e-02 0.0000e+00
+-4.8015e-01 +2.5109e-02 0.0000e+00
+-4.4043e-01 +3.3596e-03 0.0000e+00
+-4.0137e-01 -3.8962e-02 0.0000e+00
+-3.5999e-01 -7.0020e-02 0.0000e+00
+-3.2592e-01 -9.9283e-02 0.0000e+00
+-2.8245e-01 -1.3573e-01 0.0000e+00
+-2.4434e-01 -1.6477e-01 0.0000e+00
+-2.0378e-01 -1.9749e-01 0.0000e+00
+-1.6021e-01 -2.3589e-01 0.0000e+00
+-1.2274e-01 -2.6759e-01 0.0000e+00
+-8.2740e-02 -2.9709e-01 0.0000e+00
+-3.7937e-02 -3.3372e-01 0.0000e+00
+-3.1148e-03 -3.6854e-01 0.0000e+00
++3.4759e-02 -4.0042e-01 0.0000e+00
++7.1145e-02 -4.3177e-01 0.0000e+00
++1.1337e-01 -4.6672e-01 0.0000e+00
++1.5395e-01 -5.0148e-01 0.0000e+00
++2.0079e-01 -5.3373e-01 0.0000e+00
++2.3439e-01 -5.7028e-01 0.0000e+00
++2.7411e-01 -5.9873e-01 0.0000e+00
++3.1409e-01 -6.3732e-01 0.0000e+00
++3.5313e-01 -6.6684e-01 0.0000e+00
+-6.8642e-01 +2.6867e-01 0.0000e+00
+-6.4825e-01 +2.4048e-01 0.0000e+00
+-6.0536e-01 +2.0296e-01 0.0000e+00
+-5.6788e-01 +1.6660e-01 0.0000e+00
+-5.2098e-01 +1.3650e-01 0.0000e+00
+-4.8670e-01 +1.0598e-01 0.0000e+00
+-4.5307e-01 +6.9456e-02 0.0000e+00
+-4.0914e-01 +3.4710e-02 0.0000e+00
+-3.6495e-01 +6.8115e-03 0.0000e+00
+-3.2719e-01 -3.1372e-02 0.0000e+00
+-2.9256e-01 -6.2035e-02 0.0000e+00
+-2.5010e-01 -1.0094e-01 0.0000e+00
+-2.0289e-01 -1.2892e-01 0.0000e+00
+-1.7298e-01 -1.5898e-01 0.0000e+00
+-1.2460e-01 -1.9458e-01 0.0000e+00
+-9.0690e-02 -2.3341e-01 0.0000e+00
+-5.2733e-02 -2.5849e-01 0.0000e+00
+-1.4051e-02 -2.9855e-01 0.0000e+00
++2.9716e-02 -3.2906e-01 0.0000e+00
++6.7597e-02 -3.6528e-01 0.0000e+00
++1.0754e-01 -3.8832e-01 0.0000e+00
++1.4369e-01 -4.3086e-01 0.0000e+00
++1.9228e-01 -4.6321e-01 0.0000e+00
++2.2262e-01 -4.9552e-01 0.0000e+00
++2.6996e-01 -5.2462e-01 0.0000e+00
++3.1195e-01 -5.5977e-01 0.0000e+00
++3.4376e-01 -5.9325e-01 0.0000e+00
++3.8777e-01 -6.2754e-01 0.0000e+00
+-6.9431e-01 +3.4704e-01 0.0000e+00
+-6.4978e-01 +3.0862e-01 0.0000e+00
+-6.1233e-01 +2.8262e-01 0.0000e+00
+-5.6738e-01 +2.4365e-01 0.0000e+00
+-5.3382e-01 +2.1251e-01 0.0000e+00
+-4.8781e-01 +1.7909e-01 0.0000e+00
+-4.5377e-01 +1.4779e-01 0.0000e+00
+-4.1681e-01 +1.0639e-01 0.0000e+00
+-3.7443e-01 +7.4385e-02 0.0000e+00
+-3.3214e-01 +4.2599e-02 0.0000e+00
+-2.9400e-01 +8.9383e-03 0.0000e+00
+-2.5705e-01 -2.1941e-02 0.0000e+00
+-2.1650e-01 -5.5563e-02 0.0000e+00
+-1.7873e-01 -8.7087e-02 0.0000e+00
+-1.3086e-01 -1.2364e-01 0.0000e+00
+-1.0206e-01 -1.5672e-01 0.0000e+00
+-6.0161e-02 -1.9234e-01 0.0000e+00
+-1.6515e-02 -2.2179e-01 0.0000e+00
++2.1817e-02 -2.5952e-01 0.0000e+00
++6.0870e-02 -2.8645e-01 0.0000e+00
++1.0215e-01 -3.2540e-01 0.0000e+00
++1.3862e-01 -3.5261e-01 0.0000e+00
++1.7952e-01 -3.8983e-01 0.0000e+00
++2.2468e-01 -4.2241e-01 0.0000e+00
++2.6131e-01 -4.5230e-01 0.0000e+00
++2.9854e-01 -4.9194e-01 0.0000e+00
++3.3822e-01 -5.2002e-01 0.0000e+00
++3.8029e-01 -5.5481e-01 0.0000e+00
++4.1778e-01 -5.9090e-01 0.0000e+00
++4.5551e-01 -6.2181e-01 0.0000e+00
+-6.5663e-01 +3.8592e-01 0.0000e+00
+-6.1848e-01 +3.5210e-01 0.0000e+00
+-5.8055e-01 +3.1674e-01 0.0000e+00
+-5.4153e-01 +2.8693e-01 0.0000e+00
+-5.0271e-01 +2.5082e-01 0.0000e+00
+-4.5402e-01 +2.1830e-01 0.0000e+00
+-4.1904e-01 +1.7997e-01 0.0000e+00
+-3.8062e-01 +1.5388e-01 0.0000e+00
+-3.4369e-01 +1.2129e-01 0.0000e+00
+-2.9885e-01 +8.1468e-02 0.0000e+00
+-2.6177e-01 +4.7286e-02 0.0000e+00
+-2.2389e-01 +1.6186e-02 0.0000e+00
+-1.8501e-01 -1.3833e-02 0.0000e+00
+-1.3654e-01 -4.7979e-02 0.0000e+00
+-1.0106e-01 -8.0337e-02 0.0000e+00
+-5.8021e-02 -1.1582e-01 0.0000e+00
+-2.6007e-02 -1.4811e-01 0.0000e+00
++1.1923e-02 -1.8400e-01 0.0000e+00
++5.4752e-02 -2.1646e-01 0.0000e+00
++9.5889e-02 -2.5005e-01 0.0000e+00
++1.3017e-01 -2.8267e-01 0.0000e+00
++1.7409e-01 -3.1774e-01 0.0000e+00
++2.1151e-01 -3.5266e-01 0.0000e+00
++2.5559e-01 -3.8296e-01 0.0000e+00
++2.8747e-01 -4.1496e-01 0.0000e+00
++3.3251e-01 -4.4146e-01 0.0000e+00
++3.7142e-01 -4.8330e-01 0.0000e+00
++4.0898e-01 -5.1566e-01 0.0000e+00
++4.5338e-01 -5.5080e-01 0.0000e+00
++4.9569e-01 -5.7901e-01 0.0000e+00
+-6.2451e-01 +4.1681e-01 0.0000e+00
+-5.8174e-01 +3.8690e-01 0.0000e+00
+-5.4252e-01 +3.6014e-01 0.0000e+00
+-5.1283e-01 +3.2227e-01 0.0000e+00
+-4.7032e-01 +2.9171e-01 0.0000e+00
+-4.2768e-01 +2.6268e-01 0.0000e+00
+-3.8851e-01 +2.2327e-01 0.0000e+00
+-3.4250e-01 +1.8854e-01 0.0000e+00
+-3.0591e-01 +1.5940e-01 0.0000e+00
+-2.6554e-01 +1.2208e-01 0.0000e+00
+-2.2654e-01 +9.4556e-02 0.0000e+00
+-1.8548e-01 +5.7542e-02 0.0000e+00
+-1.5473e-01 +2.1744e-02 0.0000e+00
+-1.0724e-01 -8.9284e-03 0.0000e+00
+-6.7694e-02 -4.4489e-02 0.0000e+00
+-2.7676e-02 -7.5444e-02 0.0000e+00
++7.8696e-03 -1.0981e-01 0.0000e+00
++5.0996e-02 -1.4423e-01 0.0000e+00
++9.1497e-02 -1.7909e-01 0.0000e+00
++1.3345e-01 -2.0921e-01 0.0000e+00
++1.6779e-01 -2.4141e-01 0.0000e+00
++2.1453e-01 -2.7504e-01 0.0000e+00
++2.4756e-01 -3.1447e-01 0.0000e+00
++2.8547e-01 -3.4572e-01 0.0000e+00
++3.2707e-01 -3.7070e-01 0.0000e+00
++3.6247e-01 -4.0968e-01 0.0000e+00
++4.0144e-01 -4.4096e-01 0.0000e+00
++4.4138e-01 -4.7350e-01 0.0000e+00
++4.8342e-01 -5.1098e-01 0.0000e+00
++5.2754e-01 -5.3720e-01 0.0000e+00
+-5.9255e-01 +4.6404e-01 0.0000e+00
+-5.5517e-01 +4.2941e-01 0.0000e+00
+-5.1312e-01 +4.0014e-01 0.0000e+00
+-4.7397e-01 +3.6794e-01 0.0000e+00
+-4.3245e-01 +3.2750e-01 0.0000e+00
+-3.9138e-01 +2.9910e-01 0.0000e+00
+-3.5078e-01 +2.6089e-01 0.0000e+00
+-3.1247e-01 +2.3264e-01 0.0000e+00
+-2.7783e-01 +1.9502e-01 0.0000e+00
+-2.3235e-01 +1.6689e-01 0.0000e+00
+-1.9412e-01 +1.2762e-01 0.0000e+00
+-1.6077e-01 +9.7804e-02 0.0000e+00
+-1.0998e-01 +6.4057e-02 0.0000e+00
+-7.0594e-02 +3.2014e-02 0.0000e+00
+-3.6796e-02 -8.0684e-03 0.0000e+00
+-1.3856e-03 -3.7045e-02 0.0000e+00
++4.3673e-02 -7.2961e-02 0.0000e+00
++7.8407e-02 -1.0299e-01 0.0000e+00
++1.2212e-01 -1.4135e-01 0.0000e+00
++1.6475e-01 -1.7066e-01 0.0000e+00
++2.0403e-01 -2.0533e-01 0.0000e+00
++2.4208e-01 -2.3087e-01 0.0000e+00
++2.8004e-01 -2.7274e-01 0.0000e+00
++3.2210e-01 -2.9934e-01 0.0000e+00
++3.6448e-01 -3.3796e-01 0.0000e+00
++3.9789e-01 -3.6503e-01 0.0000e+00
++4.3928e-01 -3.9976e-01 0.0000e+00
++4.8090e-01 -4.3883e-01 0.0000e+00
++5.1855e-01 -4.6839e-01 0.0000e+00
++5.5493e-01 -5.0011e-01 0.0000e+00
+-5.5518e-01 +4.9980e-01 0.0000e+00
+-5.1636e-01 +4.7257e-01 0.0000e+00
+-4.7755e-01 +4.3457e-01 0.0000e+00
+-4.4060e-01 +4.0594e-01 0.0000e+00
+-3.9835e-01 +3.7062e-01 0.0000e+00
+-3.5932e-01 +3.3198e-01 0.0000e+00
+-3.2053e-01 +3.0019e-01 0.0000e+00
+-2.8472e-01 +2.6582e-01 0.0000e+00
+-2.4178e-01 +2.3228e-01 0.0000e+00
+-2.0437e-01 +2.0242e-01 0.0000e+00
+-1.6376e-01 +1.6729e-01 0.0000e+00
+-1.2064e-01 +1.3802e-01 0.0000e+00
+-8.2411e-02 +1.0778e-01 0.0000e+00
+-4.1572e-02 +6.5472e-02 0.0000e+00
+-2.2184e-03 +3.9477e-02 0.0000e+00
++3.7775e-02 -2.0752e-03 0.0000e+00
++7.5425e-02 -2.4985e-02 0.0000e+00
++1.1830e-01 -6.1662e-02 0.0000e+00
++1.5062e-01 -9.8741e-02 0.0000e+00
++1.9559e-01 -1.3369e-01 0.0000e+00
++2.3772e-01 -1.6637e-01 0.0000e+00
++2.7239e-01 -1.9404e-01 0.0000e+00
++3.1027e-01 -2.2970e-01 0.0000e+00
++3.5909e-01 -2.6362e-01 0.0000e+00
++3.9508e-01 -2.9202e-01 0.0000e+00
++4.3447e-01 -3.2746e-01 0.0000e+00
++4.7753e-01 -3.6005e-01 0.0000e+00
++5.0913e-01 -3.9745e-01 0.0000e+00
++5.5710e-01 -4.3073e-01 0.0000e+00
++5.8927e-01 -4.6422e-01 0.0000e+00
+-5.2305e-01 +5.3988e-01 0.0000e+00
+-4.8865e-01 +5.1180e-01 0.0000e+00
+-4.4284e-01 +4.7926e-01 0.0000e+00
+-4.0442e-01 +4.3820e-01 0.0000e+00
+-3.6414e-01 +4.1223e-01 0.0000e+00
+-3.2802e-01 +3.7359e-01 0.0000e+00
+-2.8947e-01 +3.4061e-01 0.0000e+00
+-2.4502e-01 +3.0496e-01 0.0000e+00
+-2.0730e-01 +2.8174e-01 0.0000e+00
+-1.6968e-01 +2.3705e-01 0.0000e+00
+-1.3416e-01 +2.0929e-01 0.0000e+00
+-8.8120e-02 +1.7404e-01 0.0000e+00
+-4.8902e-02 +1.4677e-01 0.0000e+00
+-1.1825e-02 +1.0729e-01 0.0000e+00
++3.2912e-02 +7.8987e-02 0.0000e+00
++6.7398e-02 +4.4840e-02 0.0000e+00
++1.1341e-01 +6.5423e-03 0.0000e+00
++1.4901e-01 -2.5830e-02 0.0000e+00
++1.9376e-01 -5.5681e-02 0.0000e+00
++2.2944e-01 -8.7188e-02 0.0000e+00
++2.6512e-01 -1.2579e-01 0.0000e+00
++3.0425e-01 -1.5548e-01 0.0000e+00
++3.4799e-01 -1.8883e-01 0.0000e+00
++3.8379e-01 -2.2707e-01 0.0000e+00
++4.2960e-01 -2.5343e-01 0.0000e+00
++4.6393e-01 -2.8802e-01 0.0000e+00
++5.0408e-01 -3.2452e-01 0.0000e+00
++5.4851e-01 -3.5185e-01 0.0000e+00
++5.8682e-01 -3.9084e-01 0.0000e+00
++6.2124e-01 -4.2565e-01 0.0000e+00
+-4.9324e-01 +5.8117e-01 0.0000e+00
+-4.5409e-01 +5.4884e-01 0.0000e+00
+-4.1400e-01 +5.1731e-01 0.0000e+00
+-3.6931e-01 +4.8454e-01 0.0000e+00
+-3.3763e-01 +4.4924e-01 0.0000e+00
+-2.9974e-01 +4.1418e-01 0.0000e+00
+-2.5642e-01 +3.7921e-01 0.0000e+00
+-2.1704e-01 +3.4929e-01 0.0000e+00
+-1.7493e-01 +3.0892e-01 0.0000e+00
+-1.3023e-01 +2.8306e-01 0.0000e+00
+-1.0198e-01 +2.4901e-01 0.0000e+00
+-6.0866e-02 +2.1565e-01 0.0000e+00
+-2.1410e-02 +1.8302e-01 0.0000e+00
++2.6315e-02 +1.5235e-01 0.0000e+00
++6.4099e-02 +1.1314e-01 0.0000e+00
++1.0584e-01 +7.9151e-02 0.0000e+00
++1.3948e-01 +4.9452e-02 0.0000e+00
++1.8362e-01 +1.5051e-02 0.0000e+00
++2.2117e-01 -1.4715e-02 0.0000e+00
++2.5869e-01 -5.1754e-02 0.0000e+00
++3.0370e-01 -8.7226e-02 0.0000e+00
++3.4119e-01 -1.1780e-01 0.0000e+00
++3.7970e-01 -1.4646e-01 0.0000e+00
++4.1713e-01 -1.8588e-01 0.0000e+00
++4.5888e-01 -2.1717e-01 0.0000e+00
++4.9426e-01 -2.5035e-01 0.0000e+00
++5.4195e-01 -2.8505e-01 0.0000e+00
++5.8227e-01 -3.1912e-01 0.0000e+00
++6.2185e-01 -3.5227e-01 0.0000e+00
++6.5935e-01 -3.8893e-01 0.0000e+00
+-4.5273e-01 +6.2134e-01 0.0000e+00
+-4.2173e-01 +5.8545e-01 0.0000e+00
+-3.8338e-01 +5.5485e-01 0.0000e+00
+-3.4084e-01 +5.2117e-01 0.0000e+00
+-2.9788e-01 +4.8822e-01 0.0000e+00
+-2.6450e-01 +4.5574e-01 0.0000e+00
+-2.1930e-01 +4.2686e-01 0.0000e+00
+-1.8585e-01 +3.8710e-01 0.0000e+00
+-1.4298e-01 +3.5048e-01 0.0000e+00
+-1.0652e-01 +3.2339e-01 0.0000e+00
+-6.1663e-02 +2.8493e-01 0.0000e+00
+-2.7243e-02 +2.5504e-01 0.0000e+00
++1.1896e-02 +2.2164e-01 0.0000e+00
++5.6439e-02 +1.8561e-01 0.0000e+00
++1.0044e-01 +1.5227e-01 0.0000e+00
++1.4177e-01 +1.2276e-01 0.0000e+00
++1.7777e-01 +8.7317e-02 0.0000e+00
++2.1183e-01 +5.6928e-02 0.0000e+00
++2.5188e-01 +2.2936e-02 0.0000e+00
++2.9122e-01 -7.8383e-03 0.0000e+00
++3.3483e-01 -4.5400e-02 0.0000e+00
++3.7662e-01 -7.3814e-02 0.0000e+00
++4.1618e-01 -1.0616e-01 0.0000e+00
++4.5072e-01 -1.4301e-01 0.0000e+00
++4.9325e-01 -1.7238e-01 0.0000e+00
++5.2901e-01 -2.1108e-01 0.0000e+00
++5.7604e-01 -2.4111e-01 0.0000e+00
++6.1116e-01 -2.8043e-01 0.0000e+00
++6.5152e-01 -3.1274e-01 0.0000e+00
++6.9236e-01 -3.3836e-01 0.0000e+00
+-3.8680e-01 +6.2703e-01 0.0000e+00
+-3.5001e-01 +5.9343e-01 0.0000e+00
+-3.0772e-01 +5.5710e-01 0.0000e+00
+-2.7094e-01 +5.2636e-01 0.0000e+00
+-2.2698e-01 +4.9929e-01 0.0000e+00
+-1.8651e-01 +4.5585e-01 0.0000e+00
+-1.4605e-01 +4.2607e-01 0.0000e+00
+-1.0675e-01 +3.9586e-01 0.0000e+00
+-6.7683e-02 +3.5946e-01 0.0000e+00
+-3.1086e-02 +3.2355e-01 0.0000e+00
++6.7782e-03 +2.9685e-01 0.0000e+00
++5.6798e-02 +2.6159e-01 0.0000e+00
++8.7056e-02 +2.2755e-01 0.0000e+00
++1.2755e-01 +1.9477e-01 0.0000e+00
++1.7090e-01 +1.6391e-01 0.0000e+00
++2.0309e-01 +1.2729e-01 0.0000e+00
++2.4629e-01 +9.8201e-02 0.0000e+00
++2.8550e-01 +6.4397e-02 0.0000e+00
++3.3335e-01 +2.8031e-02 0.0000e+00
++3.6908e-01 -2.9242e-03 0.0000e+00
++4.0330e-01 -3.8544e-02 0.0000e+00
++4.4725e-01 -6.5410e-02 0.0000e+00
++4.8920e-01 -1.0237e-01 0.0000e+00
++5.2374e-01 -1.4022e-01 0.0000e+00
++5.6362e-01 -1.7276e-01 0.0000e+00
++6.1208e-01 -2.0282e-01 0.0000e+00
++6.4478e-01 -2.3748e-01 0.0000e+00
++6.8136e-01 -2.6912e-01 0.0000e+00
+-3.5655e-01 +6.6988e-01 0.0000e+00
+-3.1390e-01 +6.3751e-01 0.0000e+00
+-2.6993e-01 +6.0310e-01 0.0000e+00
+-2.3405e-01 +5.6524e-01 0.0000e+00
+-1.9809e-01 +5.3729e-01 0.0000e+00
+-1.5660e-01 +5.0337e-01 0.0000e+00
+-1.1816e-01 +4.7138e-01 0.0000e+00
+-8.1412e-02 +4.3345e-01 0.0000e+00
+-3.7798e-02 +4.0448e-01 0.0000e+00
++4.3989e-03 +3.6916e-01 0.0000e+00
++4.1946e-02 +3.3997e-01 0.0000e+00
++8.2837e-02 +3.0599e-01 0.0000e+00
++1.2398e-01 +2.6916e-01 0.0000e+00
++1.6435e-01 +2.2919e-01 0.0000e+00
++2.0280e-01 +2.0584e-01 0.0000e+00
++2.4222e-01 +1.6294e-01 0.0000e+00
++2.7920e-01 +1.3273e-01 0.0000e+00
++3.2090e-01 +9.8939e-02 0.0000e+00
++3.6020e-01 +6.3146e-02 0.0000e+00
++4.0002e-01 +3.9147e-02 0.0000e+00
++4.3903e-01 -2.7382e-03 0.0000e+00
++4.7535e-01 -3.3636e-02 0.0000e+00
++5.1684e-01 -6.0542e-02 0.0000e+00
++5.5938e-01 -1.0111e-01 0.0000e+00
++5.9571e-01 -1.3418e-01 0.0000e+00
++6.4201e-01 -1.6621e-01 0.0000e+00
++6.7900e-01 -2.0014e-01 0.0000e+00
++7.2087e-01 -2.3359e-01 0.0000e+00
+-2.8083e-01 +6.7814e-01 0.0000e+00
+-2.4157e-01 +6.4479e-01 0.0000e+00
+-2.0182e-01 +6.0578e-01 0.0000e+00
+-1.6060e-01 +5.7250e-01 0.0000e+00
+-1.1879e-01 +5.4357e-01 0.0000e+00
+-8.0379e-02 +5.0610e-01 0.0000e+00
+-4.3506e-02 +4.7700e-01 0.0000e+00
++5.0344e-04 +4.3758e-01 0.0000e+00
++3.7273e-02 +4.0648e-01 0.0000e+00
++7.8915e-02 +3.7936e-01 0.0000e+00
++1.1368e-01 +3.3770e-01 0.0000e+00
++1.5379e-01 +3.1008e-01 0.0000e+00
++1.8951e-01 +2.7422e-01 0.0000e+00
++2.3659e-01 +2.3663e-01 0.0000e+00
++2.8158e-01 +2.0879e-01 0.0000e+00
++3.1467e-01 +1.8145e-01 0.0000e+00
++3.5362e-01 +1.4232e-01 0.0000e+00
++3.8878e-01 +1.0912e-01 0.0000e+00
++4.3612e-01 +7.6059e-02 0.0000e+00
++4.7196e-01 +3.6900e-02 0.0000e+00
++5.1118e-01 +1.0582e-02 0.0000e+00
++5.5204e-01 -2.7413e-02 0.0000e+00
++5.9413e-01 -6.1874e-02 0.0000e+00
++6.2827e-01 -9.2683e-02 0.0000e+00
++6.7520e-01 -1.2418e-01 0.0000e+00
++7.1274e-01 -1.5717e-01 0.0000e+00
++7.4695e-01 -1.9083e-01 0.0000e+00
+-2.4730e-01 +7.1728e-01 0.0000e+00
+-2.0747e-01 +6.8260e-01 0.0000e+00
+-1.7415e-01 +6.4622e-01 0.0000e+00
+-1.2606e-01 +6.1684e-01 0.0000e+00
+-8.6803e-02 +5.7468e-01 0.0000e+00
+-5.4444e-02 +5.4701e-01 0.0000e+00
+-9.8711e-03 +5.1399e-01 0.0000e+00
++3.2462e-02 +4.8097e-01 0.0000e+00
++7.5072e-02 +4.4876e-01 0.0000e+00
++1.1143e-01 +4.1826e-01 0.0000e+00
++1.5083e-01 +3.7583e-01 0.0000e+00
++1.8895e-01 +3.4312e-01 0.0000e+00
++2.3067e-01 +3.1305e-01 0.0000e+00
++2.7146e-01 +2.7906e-01 0.0000e+00
++3.0445e-01 +2.4889e-01 0.0000e+00
++3.4805e-01 +2.1565e-01 0.0000e+00
++3.8904e-01 +1.7429e-01 0.0000e+00
++4.2498e-01 +1.4591e-01 0.0000e+00
++4.6618e-01 +1.1942e-01 0.0000e+00
++5.1038e-01 +8.2938e-02 0.0000e+00
++5.4426e-01 +4.7183e-02 0.0000e+00
++5.8588e-01 +1.5191e-02 0.0000e+00
++6.2562e-01 -1.9208e-02 0.0000e+00
++6.6739e-01 -5.4256e-02 0.0000e+00
++7.1115e-01 -8.4507e-02 0.0000e+00
++7.4676e-01 -1.2109e-01 0.0000e+00
+-1.7636e-01 +7.1794e-01 0.0000e+00
+-1.3558e-01 +6.8990e-01 0.0000e+00
+-9.0292e-02 +6.5065e-01 0.0000e+00
+-5.7278e-02 +6.2169e-01 0.0000e+00
+-1.4319e-02 +5.9028e-01 0.0000e+00
++2.4949e-02 +5.5219e-01 0.0000e+00
++6.9539e-02 +5.2221e-01 0.0000e+00
++9.9869e-02 +4.8494e-01 0.0000e+00
++1.4223e-01 +4.5081e-01 0.0000e+00
++1.8178e-01 +4.1604e-01 0.0000e+00
++2.2245e-01 +3.8243e-01 0.0000e+00
++2.6369e-01 +3.4746e-01 0.0000e+00
++2.9862e-01 +3.2313e-01 0.0000e+00
++3.4250e-01 +2.8523e-01 0.0000e+00
++3.7943e-01 +2.5553e-01 0.0000e+00
++4.2328e-01 +2.1802e-01 0.0000e+00
++4.5845e-01 +1.8970e-01 0.0000e+00
++5.0054e-01 +1.5344e-01 0.0000e+00
++5.4309e-01 +1.2444e-01 0.0000e+00
++5.7704e-01 +9.1686e-02 0.0000e+00
++6.1618e-01 +5.7570e-02 0.0000e+00
++6.5963e-01 +1.7908e-02 0.0000e+00
++6.9431e-01 -1.2435e-02 0.0000e+00
++7.3730e-01 -4.7474e-02 0.0000e+00
+-1.4184e-01 +7.6330e-01 0.0000e+00
+-9.6845e-02 +7.2812e-01 0.0000e+00
+-5.9050e-02 +6.9663e-01 0.0000e+00
+-2.1140e-02 +6.6457e-01 0.0000e+00
++2.3691e-02 +6.2717e-01 0.0000e+00
++5.4628e-02 +5.9433e-01 0.0000e+00
++9.6633e-02 +5.5802e-01 0.0000e+00
++1.3377e-01 +5.2908e-01 0.0000e+00
++1.7159e-01 +4.9373e-01 0.0000e+00
++2.1963e-01 +4.6437e-01 0.0000e+00
++2.5627e-01 +4.2502e-01 0.0000e+00
++2.9908e-01 +3.9124e-01 0.0000e+00
++3.3477e-01 +3.6551e-01 0.0000e+00
++3.7205e-01 +3.2910e-01 0.0000e+00
++4.1626e-01 +2.9872e-01 0.0000e+00
++4.5442e-01 +2.6142e-01 0.0000e+00
++4.9385e-01 +2.3071e-01 0.0000e+00
++5.3271e-01 +1.9143e-01 0.0000e+00
++5.7068e-01 +1.6476e-01 0.0000e+00
++6.1362e-01 +1.2484e-01 0.0000e+00
++6.5396e-01 +8.7652e-02 0.0000e+00
++6.9432e-01 +6.1553e-02 0.0000e+00
++7.3038e-01 +3.0218e-02 0.0000e+00
++7.7498e-01 -4.2501e-03 0.0000e+00
+-6.5217e-02 +7.6811e-01 0.0000e+00
+-2.4082e-02 +7.3278e-01 0.0000e+00
++1.3961e-02 +7.0116e-01 0.0000e+00
++4.9939e-02 +6.6820e-01 0.0000e+00
++9.1607e-02 +6.3329e-01 0.0000e+00
++1.2619e-01 +5.9919e-01 0.0000e+00
++1.7107e-01 +5.6289e-01 0.0000e+00
++2.1196e-01 +5.2685e-01 0.0000e+00
++2.5487e-01 +5.0100e-01 0.0000e+00
++2.9319e-01 +4.6864e-01 0.0000e+00
++3.3469e-01 +4.3296e-01 0.0000e+00
++3.6620e-01 +4.0328e-01 0.0000e+00
++4.0939e-01 +3.6416e-01 0.0000e+00
++4.5195e-01 +3.3137e-01 0.0000e+00
++4.8728e-01 +3.0670e-01 0.0000e+00
++5.2547e-01 +2.7000e-01 0.0000e+00
++5.7341e-01 +2.3385e-01 0.0000e+00
++6.1243e-01 +2.0094e-01 0.0000e+00
++6.4478e-01 +1.7195e-01 0.0000e+00
++6.8514e-01 +1.2883e-01 0.0000e+00
++7.2607e-01 +9.5556e-02 0.0000e+00
++7.6628e-01 +7.0191e-02 0.0000e+00
++1.1434e-02 +7.7404e-01 0.0000e+00
++4.2203e-02 +7.4272e-01 0.0000e+00
++8.1761e-02 +7.0818e-01 0.0000e+00
++1.2602e-01 +6.7552e-01 0.0000e+00
++1.6241e-01 +6.3803e-01 0.0000e+00
++2.0924e-01 +6.0812e-01 0.0000e+00
++2.5070e-01 +5.7316e-01 0.0000e+00
++2.8298e-01 +5.4404e-01 0.0000e+00
++3.2180e-01 +5.0082e-01 0.0000e+00
++3.6523e-01 +4.7237e-01 0.0000e+00
++4.0316e-01 +4.4215e-01 0.0000e+00
++4.4238e-01 +4.0108e-01 0.0000e+00
++4.8179e-01 +3.7264e-01 0.0000e+00
++5.1981e-01 +3.4472e-01 0.0000e+00
++5.6145e-01 +3.0521e-01 0.0000e+00
++6.0327e-01 +2.7025e-01 0.0000e+00
++6.4037e-01 +2.4646e-01 0.0000e+00
++6.7757e-01 +2.0476e-01 0.0000e+00
++7.1871e-01 +1.6785e-01 0.0000e+00
++7.6400e-01 +1.3846e-01 0.0000e+00
++1.1486e-01 +7.4454e-01 0.0000e+00
++1.5990e-01 +7.1514e-01 0.0000e+00
++1.9691e-01 +6.8114e-01 0.0000e+00
++2.3402e-01 +6.4707e-01 0.0000e+00
++2.7281e-01 +6.1427e-01 0.0000e+00
++3.1678e-01 +5.7861e-01 0.0000e+00
++3.4929e-01 +5.4497e-01 0.0000e+00
++3.9817e-01 +5.0786e-01 0.0000e+00
++4.3755e-01 +4.7743e-01 0.0000e+00
++4.7557e-01 +4.4023e-01 0.0000e+00
++5.1863e-01 +4.1345e-01 0.0000e+00
++5.5408e-01 +3.8555e-01 0.0000e+00
++5.9539e-01 +3.4658e-01 0.0000e+00
++6.3871e-01 +3.1384e-01 0.0000e+00
++6.7865e-01 +2.7887e-01 0.0000e+00
++7.1121e-01 +2.4635e-01 0.0000e+00
++2.3421e-01 +7.1916e-01 0.0000e+00
++2.6840e-01 +6.8350e-01 0.0000e+00
++3.1029e-01 +6.4924e-01 0.0000e+00
++3.4796e-01 +6.1405e-01 0.0000e+00
++3.8744e-01 +5.8660e-01 0.0000e+00
++4.3402e-01 +5.5169e-01 0.0000e+00
++4.6587e-01 +5.1917e-01 0.0000e+00
++5.1508e-01 +4.8609e-01 0.0000e+00
++5.5175e-01 +4.5446e-01 0.0000e+00
++5.8357e-01 +4.1963e-01 0.0000e+00
++6.3259e-01 +3.8663e-01 0.0000e+00
++6.6969e-01 +3.5337e-01 0.0000e+00
++3.4205e-01 +6.9230e-01 0.0000e+00
++3.8502e-01 +6.6123e-01 0.0000e+00
++4.2519e-01 +6.2547e-01 0.0000e+00
++4.5935e-01 +5.9556e-01 0.0000e+00
++5.0098e-01 +5.5791e-01 0.0000e+00
++5.4217e-01 +5.1996e-01 0.0000e+00
++5.8172e-01 +4.8989e-01 0.0000e+00
++6.2055e-01 +4.5739e-01 0.0000e+00
@@ -0,0 +1,711 @@
+-7.0786e-01 -3.2736e-01 0.0000e+00
+-6.6887e-01 -3.7260e-01 0.0000e+00
+-6.4161e-01 -4.1668e-01 0.0000e+00
+-6.0642e-01 -4.5392e-01 0.0000e+00
+-5.8236e-01 -4.9181e-01 0.0000e+00
+-5.4238e-01 -5.3985e-01 0.0000e+00
+-5.1214e-01 -5.8051e-01 0.0000e+00
+-4.7484e-01 -6.1802e-01 0.0000e+00
+-7.6427e-01 -1.7568e-01 0.0000e+00
+-7.3307e-01 -2.2057e-01 0.0000e+00
+-6.9946e-01 -2.6248e-01 0.0000e+00
+-6.6669e-01 -3.0235e-01 0.0000e+00
+-6.3383e-01 -3.4033e-01 0.0000e+00
+-6.0622e-01 -3.7941e-01 0.0000e+00
+-5.7253e-01 -4.2222e-01 0.0000e+00
+-5.3754e-01 -4.5793e-01 0.0000e+00
+-4.9886e-01 -5.0319e-01 0.0000e+00
+-4.7081e-01 -5.3779e-01 0.0000e+00
+-4.3814e-01 -5.8506e-01 0.0000e+00
+-4.0271e-01 -6.2927e-01 0.0000e+00
+-3.7001e-01 -6.6468e-01 0.0000e+00
+-7.6239e-01 -1.0105e-01 0.0000e+00
+-7.2436e-01 -1.4844e-01 0.0000e+00
+-6.8912e-01 -1.7872e-01 0.0000e+00
+-6.6083e-01 -2.2548e-01 0.0000e+00
+-6.2805e-01 -2.6366e-01 0.0000e+00
+-5.9020e-01 -3.0716e-01 0.0000e+00
+-5.5699e-01 -3.4991e-01 0.0000e+00
+-5.3095e-01 -3.8886e-01 0.0000e+00
+-4.9561e-01 -4.3036e-01 0.0000e+00
+-4.5776e-01 -4.7013e-01 0.0000e+00
+-4.2906e-01 -5.1274e-01 0.0000e+00
+-3.9768e-01 -5.5306e-01 0.0000e+00
+-3.6376e-01 -5.9011e-01 0.0000e+00
+-3.3288e-01 -6.3432e-01 0.0000e+00
+-2.9409e-01 -6.7099e-01 0.0000e+00
+-2.6688e-01 -7.1532e-01 0.0000e+00
+-7.8122e-01 +8.6848e-03 0.0000e+00
+-7.4789e-01 -3.1830e-02 0.0000e+00
+-7.1808e-01 -6.6792e-02 0.0000e+00
+-6.7773e-01 -1.0719e-01 0.0000e+00
+-6.4695e-01 -1.4753e-01 0.0000e+00
+-6.1712e-01 -1.8991e-01 0.0000e+00
+-5.8623e-01 -2.3010e-01 0.0000e+00
+-5.5384e-01 -2.7533e-01 0.0000e+00
+-5.2100e-01 -3.1456e-01 0.0000e+00
+-4.8352e-01 -3.5087e-01 0.0000e+00
+-4.5184e-01 -3.9607e-01 0.0000e+00
+-4.1997e-01 -4.2976e-01 0.0000e+00
+-3.8668e-01 -4.7619e-01 0.0000e+00
+-3.5608e-01 -5.1336e-01 0.0000e+00
+-3.1986e-01 -5.5738e-01 0.0000e+00
+-2.9389e-01 -6.0397e-01 0.0000e+00
+-2.5680e-01 -6.4498e-01 0.0000e+00
+-2.1964e-01 -6.8222e-01 0.0000e+00
+-1.9543e-01 -7.2136e-01 0.0000e+00
+-1.6331e-01 -7.6269e-01 0.0000e+00
+-7.6817e-01 +8.8279e-02 0.0000e+00
+-7.4012e-01 +4.2736e-02 0.0000e+00
+-7.0240e-01 +7.6615e-03 0.0000e+00
+-6.7211e-01 -3.1676e-02 0.0000e+00
+-6.3756e-01 -7.5872e-02 0.0000e+00
+-6.1098e-01 -1.2111e-01 0.0000e+00
+-5.7550e-01 -1.6457e-01 0.0000e+00
+-5.4546e-01 -1.9900e-01 0.0000e+00
+-5.1527e-01 -2.4268e-01 0.0000e+00
+-4.7766e-01 -2.7502e-01 0.0000e+00
+-4.4350e-01 -3.2506e-01 0.0000e+00
+-4.1320e-01 -3.6937e-01 0.0000e+00
+-3.8124e-01 -4.0835e-01 0.0000e+00
+-3.4841e-01 -4.4777e-01 0.0000e+00
+-3.1172e-01 -4.8964e-01 0.0000e+00
+-2.7999e-01 -5.2881e-01 0.0000e+00
+-2.4874e-01 -5.7078e-01 0.0000e+00
+-2.1946e-01 -6.0736e-01 0.0000e+00
+-1.8581e-01 -6.4997e-01 0.0000e+00
+-1.5493e-01 -6.8811e-01 0.0000e+00
+-1.1763e-01 -7.3426e-01 0.0000e+00
+-8.8150e-02 -7.7540e-01 0.0000e+00
+-7.6402e-01 +1.6129e-01 0.0000e+00
+-7.3118e-01 +1.2463e-01 0.0000e+00
+-7.0179e-01 +7.6820e-02 0.0000e+00
+-6.6345e-01 +3.4718e-02 0.0000e+00
+-6.2744e-01 -5.0729e-03 0.0000e+00
+-5.9796e-01 -4.8027e-02 0.0000e+00
+-5.7234e-01 -8.3440e-02 0.0000e+00
+-5.3676e-01 -1.3049e-01 0.0000e+00
+-5.0700e-01 -1.6839e-01 0.0000e+00
+-4.6452e-01 -2.0815e-01 0.0000e+00
+-4.3845e-01 -2.5165e-01 0.0000e+00
+-4.0231e-01 -2.9091e-01 0.0000e+00
+-3.7599e-01 -3.3337e-01 0.0000e+00
+-3.3653e-01 -3.7056e-01 0.0000e+00
+-3.0967e-01 -4.1580e-01 0.0000e+00
+-2.7436e-01 -4.5401e-01 0.0000e+00
+-2.4309e-01 -4.9211e-01 0.0000e+00
+-2.0898e-01 -5.3170e-01 0.0000e+00
+-1.7738e-01 -5.8075e-01 0.0000e+00
+-1.4544e-01 -6.2052e-01 0.0000e+00
+-1.0458e-01 -6.5784e-01 0.0000e+00
+-8.0168e-02 -6.9312e-01 0.0000e+00
+-4.0108e-02 -7.3950e-01 0.0000e+00
+-1.0216e-02 -7.8217e-01 0.0000e+00
+-7.2690e-01 +1.9105e-01 0.0000e+00
+-6.9108e-01 +1.5514e-01 0.0000e+00
+-6.5792e-01 +1.1132e-01 0.0000e+00
+-6.2537e-01 +6.4995e-02 0.0000e+00
+-5.9151e-01 +3.4632e-02 0.0000e+00
+-5.5754e-01 -1.1560e-02 0.0000e+00
+-5.2542e-01 -4.7844e-02 0.0000e+00
+-4.8926e-01 -9.3276e-02 0.0000e+00
+-4.5864e-01 -1.3173e-01 0.0000e+00
+-4.3468e-01 -1.7333e-01 0.0000e+00
+-4.0076e-01 -2.1762e-01 0.0000e+00
+-3.6235e-01 -2.6062e-01 0.0000e+00
+-3.3287e-01 -2.9937e-01 0.0000e+00
+-2.9664e-01 -3.4243e-01 0.0000e+00
+-2.6528e-01 -3.7257e-01 0.0000e+00
+-2.3317e-01 -4.1574e-01 0.0000e+00
+-2.0150e-01 -4.6097e-01 0.0000e+00
+-1.7406e-01 -5.0202e-01 0.0000e+00
+-1.3453e-01 -5.3888e-01 0.0000e+00
+-9.7955e-02 -5.8447e-01 0.0000e+00
+-7.1260e-02 -6.2049e-01 0.0000e+00
+-3.4466e-02 -6.6897e-01 0.0000e+00
+-1.0755e-02 -7.0715e-01 0.0000e+00
++2.6057e-02 -7.4339e-01 0.0000e+00
+-7.1633e-01 +2.6601e-01 0.0000e+00
+-6.8308e-01 +2.2432e-01 0.0000e+00
+-6.4519e-01 +1.8515e-01 0.0000e+00
+-6.1683e-01 +1.4662e-01 0.0000e+00
+-5.8726e-01 +1.0626e-01 0.0000e+00
+-5.5386e-01 +6.1431e-02 0.0000e+00
+-5.1780e-01 +1.5784e-02 0.0000e+00
+-4.8891e-01 -1.7125e-02 0.0000e+00
+-4.5133e-01 -5.9524e-02 0.0000e+00
+-4.2092e-01 -1.0379e-01 0.0000e+00
+-3.8755e-01 -1.4364e-01 0.0000e+00
+-3.5299e-01 -1.8164e-01 0.0000e+00
+-3.2073e-01 -2.2202e-01 0.0000e+00
+-2.9686e-01 -2.6395e-01 0.0000e+00
+-2.5464e-01 -3.0443e-01 0.0000e+00
+-2.2612e-01 -3.4361e-01 0.0000e+00
+-1.8923e-01 -3.8404e-01 0.0000e+00
+-1.6565e-01 -4.2814e-01 0.0000e+00
+-1.2812e-01 -4.6673e-01 0.0000e+00
+-8.9197e-02 -5.0924e-01 0.0000e+00
+-6.1447e-02 -5.5330e-01 0.0000e+00
+-3.3464e-02 -5.9209e-01 0.0000e+00
+-1.5963e-03 -6.3449e-01 0.0000e+00
++3.7736e-02 -6.6982e-01 0.0000e+00
++6.3248e-02 -7.1408e-01 0.0000e+00
++1.0496e-01 -7.5707e-01 0.0000e+00
+-7.0555e-01 +3.3336e-01 0.0000e+00
+-6.6898e-01 +2.9725e-01 0.0000e+00
+-6.3639e-01 +2.5544e-01 0.0000e+00
+-6.0991e-01 +2.1162e-01 0.0000e+00
+-5.7218e-01 +1.7825e-01 0.0000e+00
+-5.4378e-01 +1.4044e-01 0.0000e+00
+-5.0983e-01 +9.1528e-02 0.0000e+00
+-4.7596e-01 +5.9022e-02 0.0000e+00
+-4.4575e-01 +1.8339e-02 0.0000e+00
+-4.1342e-01 -3.2813e-02 0.0000e+00
+-3.8125e-01 -7.5379e-02 0.0000e+00
+-3.4556e-01 -1.0487e-01 0.0000e+00
+-3.1595e-01 -1.5268e-01 0.0000e+00
+-2.8114e-01 -1.9178e-01 0.0000e+00
+-2.4294e-01 -2.3235e-01 0.0000e+00
+-2.1521e-01 -2.6832e-01 0.0000e+00
+-1.8189e-01 -3.0962e-01 0.0000e+00
+-1.5098e-01 -3.5458e-01 0.0000e+00
+-1.1971e-01 -3.9990e-01 0.0000e+00
+-8.9610e-02 -4.3869e-01 0.0000e+00
+-5.5289e-02 -4.7884e-01 0.0000e+00
+-1.7545e-02 -5.1786e-01 0.0000e+00
++1.0255e-02 -5.5948e-01 0.0000e+00
++4.0493e-02 -6.0272e-01 0.0000e+00
++7.5383e-02 -6.4180e-01 0.0000e+00
++1.0850e-01 -6.8039e-01 0.0000e+00
++1.4456e-01 -7.2562e-01 0.0000e+00
+-6.5818e-01 +3.7161e-01 0.0000e+00
+-6.3696e-01 +3.2903e-01 0.0000e+00
+-6.0507e-01 +2.9138e-01 0.0000e+00
+-5.7300e-01 +2.5117e-01 0.0000e+00
+-5.3758e-01 +2.0488e-01 0.0000e+00
+-5.0480e-01 +1.6612e-01 0.0000e+00
+-4.7032e-01 +1.2089e-01 0.0000e+00
+-4.3536e-01 +9.1413e-02 0.0000e+00
+-4.0515e-01 +4.1702e-02 0.0000e+00
+-3.7039e-01 +2.6777e-03 0.0000e+00
+-3.4252e-01 -3.3107e-02 0.0000e+00
+-3.0677e-01 -7.7881e-02 0.0000e+00
+-2.7485e-01 -1.1426e-01 0.0000e+00
+-2.4124e-01 -1.5476e-01 0.0000e+00
+-2.0578e-01 -2.0149e-01 0.0000e+00
+-1.7503e-01 -2.4037e-01 0.0000e+00
+-1.4133e-01 -2.7757e-01 0.0000e+00
+-1.0430e-01 -3.2280e-01 0.0000e+00
+-7.6792e-02 -3.6423e-01 0.0000e+00
+-4.5672e-02 -4.0337e-01 0.0000e+00
+-1.5920e-02 -4.4168e-01 0.0000e+00
++1.8893e-02 -4.8472e-01 0.0000e+00
++5.2114e-02 -5.2725e-01 0.0000e+00
++9.2036e-02 -5.6855e-01 0.0000e+00
++1.1799e-01 -6.1146e-01 0.0000e+00
++1.5162e-01 -6.4757e-01 0.0000e+00
++1.8348e-01 -6.9377e-01 0.0000e+00
++2.1623e-01 -7.3080e-01 0.0000e+00
+-6.2582e-01 +4.0327e-01 0.0000e+00
+-5.9367e-01 +3.6772e-01 0.0000e+00
+-5.5872e-01 +3.2200e-01 0.0000e+00
+-5.2888e-01 +2.7851e-01 0.0000e+00
+-4.8847e-01 +2.3933e-01 0.0000e+00
+-4.6063e-01 +2.0226e-01 0.0000e+00
+-4.3465e-01 +1.5938e-01 0.0000e+00
+-3.9810e-01 +1.1619e-01 0.0000e+00
+-3.5994e-01 +7.9733e-02 0.0000e+00
+-3.3019e-01 +3.4380e-02 0.0000e+00
+-3.0204e-01 -2.9032e-03 0.0000e+00
+-2.6778e-01 -4.9915e-02 0.0000e+00
+-2.2665e-01 -8.7048e-02 0.0000e+00
+-2.0305e-01 -1.2280e-01 0.0000e+00
+-1.6227e-01 -1.6771e-01 0.0000e+00
+-1.3647e-01 -2.1294e-01 0.0000e+00
+-1.0390e-01 -2.4536e-01 0.0000e+00
+-7.3620e-02 -2.9275e-01 0.0000e+00
+-3.6392e-02 -3.3171e-01 0.0000e+00
+-6.1340e-03 -3.7514e-01 0.0000e+00
++2.8800e-02 -4.0594e-01 0.0000e+00
++5.6084e-02 -4.5529e-01 0.0000e+00
++9.7715e-02 -4.9703e-01 0.0000e+00
++1.2129e-01 -5.3509e-01 0.0000e+00
++1.6234e-01 -5.7336e-01 0.0000e+00
++1.9688e-01 -6.1657e-01 0.0000e+00
++2.2167e-01 -6.5607e-01 0.0000e+00
++2.5838e-01 -6.9881e-01 0.0000e+00
+-6.1796e-01 +4.8243e-01 0.0000e+00
+-5.8156e-01 +4.3549e-01 0.0000e+00
+-5.4968e-01 +4.0226e-01 0.0000e+00
+-5.1298e-01 +3.5469e-01 0.0000e+00
+-4.8598e-01 +3.1714e-01 0.0000e+00
+-4.4712e-01 +2.7486e-01 0.0000e+00
+-4.1967e-01 +2.3706e-01 0.0000e+00
+-3.9137e-01 +1.8869e-01 0.0000e+00
+-3.5581e-01 +1.4853e-01 0.0000e+00
+-3.2030e-01 +1.0860e-01 0.0000e+00
+-2.8927e-01 +6.7649e-02 0.0000e+00
+-2.5887e-01 +2.9689e-02 0.0000e+00
+-2.2545e-01 -1.1707e-02 0.0000e+00
+-1.9436e-01 -5.0470e-02 0.0000e+00
+-1.5428e-01 -9.6234e-02 0.0000e+00
+-1.3239e-01 -1.3474e-01 0.0000e+00
+-9.8026e-02 -1.7838e-01 0.0000e+00
+-6.0708e-02 -2.1627e-01 0.0000e+00
+-3.0305e-02 -2.6129e-01 0.0000e+00
++2.9719e-03 -2.9576e-01 0.0000e+00
++3.6052e-02 -3.4258e-01 0.0000e+00
++6.6714e-02 -3.7681e-01 0.0000e+00
++9.9761e-02 -4.2184e-01 0.0000e+00
++1.3795e-01 -4.6312e-01 0.0000e+00
++1.6824e-01 -5.0004e-01 0.0000e+00
++1.9716e-01 -5.4673e-01 0.0000e+00
++2.3084e-01 -5.8247e-01 0.0000e+00
++2.6552e-01 -6.2532e-01 0.0000e+00
++2.9543e-01 -6.6854e-01 0.0000e+00
++3.2659e-01 -7.0670e-01 0.0000e+00
+-5.7288e-01 +5.1338e-01 0.0000e+00
+-5.4188e-01 +4.7228e-01 0.0000e+00
+-5.1140e-01 +4.2968e-01 0.0000e+00
+-4.7873e-01 +3.9236e-01 0.0000e+00
+-4.4752e-01 +3.4886e-01 0.0000e+00
+-4.0582e-01 +3.0692e-01 0.0000e+00
+-3.7886e-01 +2.6198e-01 0.0000e+00
+-3.4604e-01 +2.2847e-01 0.0000e+00
+-3.1599e-01 +1.8881e-01 0.0000e+00
+-2.7957e-01 +1.4042e-01 0.0000e+00
+-2.4969e-01 +9.9166e-02 0.0000e+00
+-2.1841e-01 +6.0802e-02 0.0000e+00
+-1.8592e-01 +2.3307e-02 0.0000e+00
+-1.4477e-01 -2.0191e-02 0.0000e+00
+-1.1611e-01 -5.9322e-02 0.0000e+00
+-8.0606e-02 -1.0306e-01 0.0000e+00
+-5.5369e-02 -1.4143e-01 0.0000e+00
+-2.4996e-02 -1.8455e-01 0.0000e+00
++1.0912e-02 -2.2525e-01 0.0000e+00
++4.4921e-02 -2.6672e-01 0.0000e+00
++7.2334e-02 -3.0588e-01 0.0000e+00
++1.0880e-01 -3.4938e-01 0.0000e+00
++1.3886e-01 -3.9143e-01 0.0000e+00
++1.7645e-01 -4.3025e-01 0.0000e+00
++2.0160e-01 -4.6830e-01 0.0000e+00
++2.4090e-01 -5.0355e-01 0.0000e+00
++2.7105e-01 -5.5275e-01 0.0000e+00
++3.0176e-01 -5.9230e-01 0.0000e+00
++3.3869e-01 -6.3597e-01 0.0000e+00
++3.7493e-01 -6.7236e-01 0.0000e+00
+-5.3491e-01 +5.3754e-01 0.0000e+00
+-4.9854e-01 +4.9938e-01 0.0000e+00
+-4.6507e-01 +4.6504e-01 0.0000e+00
+-4.4325e-01 +4.2161e-01 0.0000e+00
+-4.0728e-01 +3.8285e-01 0.0000e+00
+-3.7087e-01 +3.4559e-01 0.0000e+00
+-3.3997e-01 +2.9874e-01 0.0000e+00
+-3.0137e-01 +2.5515e-01 0.0000e+00
+-2.7097e-01 +2.1899e-01 0.0000e+00
+-2.3846e-01 +1.7396e-01 0.0000e+00
+-2.0536e-01 +1.3892e-01 0.0000e+00
+-1.7212e-01 +9.4063e-02 0.0000e+00
+-1.4883e-01 +5.2473e-02 0.0000e+00
+-1.0795e-01 +1.2609e-02 0.0000e+00
+-7.5915e-02 -3.0505e-02 0.0000e+00
+-4.2488e-02 -6.9155e-02 0.0000e+00
+-1.4172e-02 -1.1029e-01 0.0000e+00
++2.1641e-02 -1.5299e-01 0.0000e+00
++5.4763e-02 -1.9560e-01 0.0000e+00
++9.0272e-02 -2.3380e-01 0.0000e+00
++1.1783e-01 -2.7256e-01 0.0000e+00
++1.5737e-01 -3.1520e-01 0.0000e+00
++1.8219e-01 -3.6084e-01 0.0000e+00
++2.1347e-01 -3.9936e-01 0.0000e+00
++2.4966e-01 -4.3241e-01 0.0000e+00
++2.7691e-01 -4.7808e-01 0.0000e+00
++3.0923e-01 -5.1684e-01 0.0000e+00
++3.4227e-01 -5.5704e-01 0.0000e+00
++3.7639e-01 -6.0256e-01 0.0000e+00
++4.1482e-01 -6.3733e-01 0.0000e+00
+-4.9382e-01 +5.7791e-01 0.0000e+00
+-4.6373e-01 +5.3615e-01 0.0000e+00
+-4.2797e-01 +4.9876e-01 0.0000e+00
+-3.9564e-01 +4.5906e-01 0.0000e+00
+-3.6262e-01 +4.1071e-01 0.0000e+00
+-3.2765e-01 +3.7438e-01 0.0000e+00
+-2.9509e-01 +3.2844e-01 0.0000e+00
+-2.6281e-01 +2.9281e-01 0.0000e+00
+-2.3605e-01 +2.4864e-01 0.0000e+00
+-1.9665e-01 +2.1169e-01 0.0000e+00
+-1.6665e-01 +1.6516e-01 0.0000e+00
+-1.3960e-01 +1.2898e-01 0.0000e+00
+-9.6064e-02 +8.5412e-02 0.0000e+00
+-6.3485e-02 +4.5813e-02 0.0000e+00
+-3.8042e-02 -6.2852e-04 0.0000e+00
+-8.7808e-03 -3.6398e-02 0.0000e+00
++2.8644e-02 -8.0966e-02 0.0000e+00
++5.7024e-02 -1.1764e-01 0.0000e+00
++9.2627e-02 -1.6436e-01 0.0000e+00
++1.2897e-01 -2.0191e-01 0.0000e+00
++1.6093e-01 -2.4408e-01 0.0000e+00
++1.9349e-01 -2.7698e-01 0.0000e+00
++2.2269e-01 -3.2602e-01 0.0000e+00
++2.5901e-01 -3.6077e-01 0.0000e+00
++2.9324e-01 -4.0748e-01 0.0000e+00
++3.2091e-01 -4.4095e-01 0.0000e+00
++3.5493e-01 -4.8362e-01 0.0000e+00
++3.8833e-01 -5.3063e-01 0.0000e+00
++4.1968e-01 -5.6742e-01 0.0000e+00
++4.4936e-01 -6.0609e-01 0.0000e+00
+-4.4967e-01 +6.0584e-01 0.0000e+00
+-4.1668e-01 +5.7111e-01 0.0000e+00
+-3.8586e-01 +5.2574e-01 0.0000e+00
+-3.5501e-01 +4.9000e-01 0.0000e+00
+-3.2025e-01 +4.4658e-01 0.0000e+00
+-2.8933e-01 +4.0052e-01 0.0000e+00
+-2.5729e-01 +3.6130e-01 0.0000e+00
+-2.2871e-01 +3.2010e-01 0.0000e+00
+-1.9291e-01 +2.7832e-01 0.0000e+00
+-1.6184e-01 +2.4127e-01 0.0000e+00
+-1.2866e-01 +1.9837e-01 0.0000e+00
+-9.1826e-02 +1.6077e-01 0.0000e+00
+-6.0032e-02 +1.2318e-01 0.0000e+00
+-2.8062e-02 +7.3131e-02 0.0000e+00
++5.6991e-03 +3.9526e-02 0.0000e+00
++3.6983e-02 -9.6096e-03 0.0000e+00
++6.9674e-02 -3.9820e-02 0.0000e+00
++1.0478e-01 -8.4705e-02 0.0000e+00
++1.2936e-01 -1.2788e-01 0.0000e+00
++1.6689e-01 -1.7147e-01 0.0000e+00
++2.0207e-01 -2.1225e-01 0.0000e+00
++2.3086e-01 -2.4658e-01 0.0000e+00
++2.6123e-01 -2.8945e-01 0.0000e+00
++3.0278e-01 -3.3280e-01 0.0000e+00
++3.3272e-01 -3.6812e-01 0.0000e+00
++3.6463e-01 -4.1108e-01 0.0000e+00
++4.0074e-01 -4.5195e-01 0.0000e+00
++4.2455e-01 -4.9530e-01 0.0000e+00
++4.6538e-01 -5.3784e-01 0.0000e+00
++4.9054e-01 -5.7743e-01 0.0000e+00
+-4.0985e-01 +6.3910e-01 0.0000e+00
+-3.8140e-01 +6.0441e-01 0.0000e+00
+-3.4256e-01 +5.6303e-01 0.0000e+00
+-3.1274e-01 +5.1471e-01 0.0000e+00
+-2.7805e-01 +4.8094e-01 0.0000e+00
+-2.5003e-01 +4.3546e-01 0.0000e+00
+-2.1845e-01 +3.9510e-01 0.0000e+00
+-1.8158e-01 +3.5091e-01 0.0000e+00
+-1.4888e-01 +3.2038e-01 0.0000e+00
+-1.2058e-01 +2.6861e-01 0.0000e+00
+-9.0957e-02 +2.3403e-01 0.0000e+00
+-5.2430e-02 +1.8993e-01 0.0000e+00
+-1.9060e-02 +1.5508e-01 0.0000e+00
++9.7518e-03 +1.0858e-01 0.0000e+00
++4.8380e-02 +7.1615e-02 0.0000e+00
++7.5692e-02 +3.0912e-02 0.0000e+00
++1.1359e-01 -1.6206e-02 0.0000e+00
++1.4235e-01 -5.5374e-02 0.0000e+00
++1.8069e-01 -9.3877e-02 0.0000e+00
++2.0971e-01 -1.3220e-01 0.0000e+00
++2.3731e-01 -1.7756e-01 0.0000e+00
++2.7011e-01 -2.1478e-01 0.0000e+00
++3.0675e-01 -2.5654e-01 0.0000e+00
++3.3454e-01 -3.0156e-01 0.0000e+00
++3.7462e-01 -3.3682e-01 0.0000e+00
++4.0169e-01 -3.7792e-01 0.0000e+00
++4.3413e-01 -4.2209e-01 0.0000e+00
++4.7265e-01 -4.5803e-01 0.0000e+00
++5.0278e-01 -5.0430e-01 0.0000e+00
++5.2989e-01 -5.4564e-01 0.0000e+00
+-3.7207e-01 +6.7400e-01 0.0000e+00
+-3.3978e-01 +6.3417e-01 0.0000e+00
+-3.0640e-01 +5.9494e-01 0.0000e+00
+-2.6870e-01 +5.5355e-01 0.0000e+00
+-2.4440e-01 +5.1227e-01 0.0000e+00
+-2.1390e-01 +4.6999e-01 0.0000e+00
+-1.7801e-01 +4.2670e-01 0.0000e+00
+-1.4501e-01 +3.8920e-01 0.0000e+00
+-1.1140e-01 +3.4082e-01 0.0000e+00
+-7.2315e-02 +3.0627e-01 0.0000e+00
+-5.1159e-02 +2.6692e-01 0.0000e+00
+-1.7126e-02 +2.2567e-01 0.0000e+00
++1.5409e-02 +1.8547e-01 0.0000e+00
++5.6523e-02 +1.4557e-01 0.0000e+00
++8.6086e-02 +9.9190e-02 0.0000e+00
++1.2061e-01 +5.7192e-02 0.0000e+00
++1.4798e-01 +2.1061e-02 0.0000e+00
++1.8479e-01 -2.1824e-02 0.0000e+00
++2.1602e-01 -5.8802e-02 0.0000e+00
++2.4575e-01 -1.0297e-01 0.0000e+00
++2.8322e-01 -1.4710e-01 0.0000e+00
++3.1422e-01 -1.8486e-01 0.0000e+00
++3.4661e-01 -2.2094e-01 0.0000e+00
++3.7578e-01 -2.6745e-01 0.0000e+00
++4.1086e-01 -3.0678e-01 0.0000e+00
++4.3925e-01 -3.4670e-01 0.0000e+00
++4.7952e-01 -3.9059e-01 0.0000e+00
++5.1262e-01 -4.3239e-01 0.0000e+00
++5.4518e-01 -4.7312e-01 0.0000e+00
++5.7497e-01 -5.1691e-01 0.0000e+00
+-3.2393e-01 +7.0567e-01 0.0000e+00
+-3.0043e-01 +6.6394e-01 0.0000e+00
+-2.6857e-01 +6.2598e-01 0.0000e+00
+-2.3319e-01 +5.8413e-01 0.0000e+00
+-1.9725e-01 +5.4292e-01 0.0000e+00
+-1.7070e-01 +5.0408e-01 0.0000e+00
+-1.3173e-01 +4.6645e-01 0.0000e+00
+-1.0658e-01 +4.2040e-01 0.0000e+00
+-7.1449e-02 +3.7557e-01 0.0000e+00
+-4.0775e-02 +3.4146e-01 0.0000e+00
+-4.0614e-03 +2.9441e-01 0.0000e+00
++2.4037e-02 +2.5794e-01 0.0000e+00
++5.6106e-02 +2.1705e-01 0.0000e+00
++9.2996e-02 +1.7246e-01 0.0000e+00
++1.2989e-01 +1.3066e-01 0.0000e+00
++1.6490e-01 +9.3175e-02 0.0000e+00
++1.9345e-01 +5.0891e-02 0.0000e+00
++2.2110e-01 +1.3992e-02 0.0000e+00
++2.5395e-01 -2.7670e-02 0.0000e+00
++2.8674e-01 -6.6004e-02 0.0000e+00
++3.2241e-01 -1.1191e-01 0.0000e+00
++3.5809e-01 -1.4840e-01 0.0000e+00
++3.9079e-01 -1.8833e-01 0.0000e+00
++4.1762e-01 -2.3173e-01 0.0000e+00
++4.5384e-01 -2.6931e-01 0.0000e+00
++4.8150e-01 -3.1477e-01 0.0000e+00
++5.2206e-01 -3.5390e-01 0.0000e+00
++5.4896e-01 -3.9986e-01 0.0000e+00
++5.8245e-01 -4.3992e-01 0.0000e+00
++6.1777e-01 -4.7345e-01 0.0000e+00
+-2.5752e-01 +6.9811e-01 0.0000e+00
+-2.2782e-01 +6.5750e-01 0.0000e+00
+-1.9323e-01 +6.1307e-01 0.0000e+00
+-1.6296e-01 +5.7528e-01 0.0000e+00
+-1.2485e-01 +5.3969e-01 0.0000e+00
+-9.3480e-02 +4.8859e-01 0.0000e+00
+-5.9371e-02 +4.5102e-01 0.0000e+00
+-2.6509e-02 +4.1326e-01 0.0000e+00
++4.8855e-03 +3.6940e-01 0.0000e+00
++3.3935e-02 +3.2653e-01 0.0000e+00
++6.6081e-02 +2.9253e-01 0.0000e+00
++1.0855e-01 +2.4762e-01 0.0000e+00
++1.3170e-01 +2.0786e-01 0.0000e+00
++1.6523e-01 +1.6731e-01 0.0000e+00
++2.0197e-01 +1.2809e-01 0.0000e+00
++2.2652e-01 +8.5401e-02 0.0000e+00
++2.6347e-01 +4.7962e-02 0.0000e+00
++2.9552e-01 +6.6535e-03 0.0000e+00
++3.3562e-01 -3.8919e-02 0.0000e+00
++3.6481e-01 -7.6711e-02 0.0000e+00
++3.9156e-01 -1.1882e-01 0.0000e+00
++4.2969e-01 -1.5421e-01 0.0000e+00
++4.6384e-01 -1.9919e-01 0.0000e+00
++4.9045e-01 -2.4357e-01 0.0000e+00
++5.2343e-01 -2.8375e-01 0.0000e+00
++5.6539e-01 -3.2321e-01 0.0000e+00
++5.9084e-01 -3.6406e-01 0.0000e+00
++6.2072e-01 -4.0270e-01 0.0000e+00
+-2.1901e-01 +7.3449e-01 0.0000e+00
+-1.8326e-01 +6.9392e-01 0.0000e+00
+-1.4661e-01 +6.5105e-01 0.0000e+00
+-1.1866e-01 +6.0640e-01 0.0000e+00
+-8.8656e-02 +5.7153e-01 0.0000e+00
+-5.4363e-02 +5.2966e-01 0.0000e+00
+-2.2699e-02 +4.9030e-01 0.0000e+00
++6.0915e-03 +4.4540e-01 0.0000e+00
++4.3476e-02 +4.0800e-01 0.0000e+00
++7.8186e-02 +3.6458e-01 0.0000e+00
++1.0952e-01 +3.2818e-01 0.0000e+00
++1.4321e-01 +2.8636e-01 0.0000e+00
++1.7657e-01 +2.4168e-01 0.0000e+00
++2.0855e-01 +1.9402e-01 0.0000e+00
++2.4194e-01 +1.6322e-01 0.0000e+00
++2.7239e-01 +1.1287e-01 0.0000e+00
++3.0296e-01 +7.5565e-02 0.0000e+00
++3.3748e-01 +3.3769e-02 0.0000e+00
++3.6923e-01 -9.5256e-03 0.0000e+00
++4.0385e-01 -4.1248e-02 0.0000e+00
++4.3409e-01 -9.0516e-02 0.0000e+00
++4.6387e-01 -1.2837e-01 0.0000e+00
++4.9956e-01 -1.6330e-01 0.0000e+00
++5.3356e-01 -2.1198e-01 0.0000e+00
++5.6292e-01 -2.5198e-01 0.0000e+00
++6.0235e-01 -2.9295e-01 0.0000e+00
++6.3218e-01 -3.3394e-01 0.0000e+00
++6.6694e-01 -3.7543e-01 0.0000e+00
+-1.4240e-01 +7.2752e-01 0.0000e+00
+-1.1020e-01 +6.8666e-01 0.0000e+00
+-7.8643e-02 +6.4009e-01 0.0000e+00
+-4.4493e-02 +5.9889e-01 0.0000e+00
+-8.8926e-03 +5.6189e-01 0.0000e+00
++2.1645e-02 +5.1712e-01 0.0000e+00
++5.2330e-02 +4.8093e-01 0.0000e+00
++8.8014e-02 +4.3310e-01 0.0000e+00
++1.1820e-01 +3.9496e-01 0.0000e+00
++1.5400e-01 +3.5978e-01 0.0000e+00
++1.8008e-01 +3.1158e-01 0.0000e+00
++2.1427e-01 +2.7622e-01 0.0000e+00
++2.4245e-01 +2.3358e-01 0.0000e+00
++2.8155e-01 +1.8695e-01 0.0000e+00
++3.2052e-01 +1.5039e-01 0.0000e+00
++3.4782e-01 +1.1671e-01 0.0000e+00
++3.7855e-01 +7.0171e-02 0.0000e+00
++4.0672e-01 +3.0273e-02 0.0000e+00
++4.4698e-01 -1.1926e-02 0.0000e+00
++4.7462e-01 -5.7861e-02 0.0000e+00
++5.0818e-01 -9.1759e-02 0.0000e+00
++5.4104e-01 -1.3755e-01 0.0000e+00
++5.7581e-01 -1.8008e-01 0.0000e+00
++6.0345e-01 -2.1741e-01 0.0000e+00
++6.4361e-01 -2.5798e-01 0.0000e+00
++6.7418e-01 -2.9814e-01 0.0000e+00
++7.0131e-01 -3.3831e-01 0.0000e+00
+-1.0137e-01 +7.5957e-01 0.0000e+00
+-6.8874e-02 +7.1727e-01 0.0000e+00
+-4.3165e-02 +6.7459e-01 0.0000e+00
+-1.4263e-03 +6.3589e-01 0.0000e+00
++2.9002e-02 +5.8630e-01 0.0000e+00
++5.5504e-02 +5.5243e-01 0.0000e+00
++9.3025e-02 +5.1082e-01 0.0000e+00
++1.2833e-01 +4.6967e-01 0.0000e+00
++1.6407e-01 +4.2926e-01 0.0000e+00
++1.9397e-01 +3.9179e-01 0.0000e+00
++2.2449e-01 +3.4190e-01 0.0000e+00
++2.5568e-01 +3.0190e-01 0.0000e+00
++2.9097e-01 +2.6379e-01 0.0000e+00
++3.2456e-01 +2.2198e-01 0.0000e+00
++3.5118e-01 +1.8551e-01 0.0000e+00
++3.8770e-01 +1.4388e-01 0.0000e+00
++4.2001e-01 +9.4736e-02 0.0000e+00
++4.4991e-01 +5.9453e-02 0.0000e+00
++4.8540e-01 +2.4986e-02 0.0000e+00
++5.2186e-01 -1.9967e-02 0.0000e+00
++5.4826e-01 -6.2141e-02 0.0000e+00
++5.8306e-01 -1.0214e-01 0.0000e+00
++6.1552e-01 -1.4414e-01 0.0000e+00
++6.4987e-01 -1.8719e-01 0.0000e+00
++6.8714e-01 -2.2589e-01 0.0000e+00
++7.1508e-01 -2.6924e-01 0.0000e+00
+-3.1012e-02 +7.4604e-01 0.0000e+00
++3.7603e-03 +7.1012e-01 0.0000e+00
++4.0742e-02 +6.6220e-01 0.0000e+00
++6.7632e-02 +6.2693e-01 0.0000e+00
++1.0388e-01 +5.8724e-01 0.0000e+00
++1.3514e-01 +5.4168e-01 0.0000e+00
++1.7329e-01 +5.0308e-01 0.0000e+00
++1.9586e-01 +4.6012e-01 0.0000e+00
++2.3098e-01 +4.1786e-01 0.0000e+00
++2.6317e-01 +3.7552e-01 0.0000e+00
++2.9672e-01 +3.3412e-01 0.0000e+00
++3.3054e-01 +2.9125e-01 0.0000e+00
++3.6026e-01 +2.6018e-01 0.0000e+00
++3.9612e-01 +2.1387e-01 0.0000e+00
++4.2675e-01 +1.7709e-01 0.0000e+00
++4.6265e-01 +1.3119e-01 0.0000e+00
++4.9181e-01 +9.6114e-02 0.0000e+00
++5.2622e-01 +5.1802e-02 0.0000e+00
++5.6255e-01 +1.4583e-02 0.0000e+00
++5.8960e-01 -2.4638e-02 0.0000e+00
++6.2153e-01 -6.6241e-02 0.0000e+00
++6.5662e-01 -1.1420e-01 0.0000e+00
++6.8488e-01 -1.5117e-01 0.0000e+00
++7.2043e-01 -1.9446e-01 0.0000e+00
++1.2241e-02 +7.8404e-01 0.0000e+00
++4.9747e-02 +7.4021e-01 0.0000e+00
++8.0867e-02 +7.0147e-01 0.0000e+00
++1.1198e-01 +6.6215e-01 0.0000e+00
++1.4889e-01 +6.1616e-01 0.0000e+00
++1.7295e-01 +5.7746e-01 0.0000e+00
++2.0727e-01 +5.3311e-01 0.0000e+00
++2.3825e-01 +4.9703e-01 0.0000e+00
++2.6862e-01 +4.5448e-01 0.0000e+00
++3.1030e-01 +4.1580e-01 0.0000e+00
++3.3871e-01 +3.6952e-01 0.0000e+00
++3.7433e-01 +3.2751e-01 0.0000e+00
++4.0452e-01 +2.9490e-01 0.0000e+00
++4.3415e-01 +2.5140e-01 0.0000e+00
++4.7184e-01 +2.1248e-01 0.0000e+00
++5.0216e-01 +1.6792e-01 0.0000e+00
++5.3505e-01 +1.2964e-01 0.0000e+00
++5.6567e-01 +8.2976e-02 0.0000e+00
++5.9793e-01 +4.8980e-02 0.0000e+00
++6.3245e-01 +8.7019e-04 0.0000e+00
++6.6495e-01 -4.4015e-02 0.0000e+00
++6.9969e-01 -7.7927e-02 0.0000e+00
++7.2912e-01 -1.1616e-01 0.0000e+00
++7.6638e-01 -1.5920e-01 0.0000e+00
++8.9058e-02 +7.7347e-01 0.0000e+00
++1.2271e-01 +7.3026e-01 0.0000e+00
++1.5405e-01 +6.9135e-01 0.0000e+00
++1.8308e-01 +6.5153e-01 0.0000e+00
++2.1735e-01 +6.0863e-01 0.0000e+00
++2.4476e-01 +5.6796e-01 0.0000e+00
++2.8194e-01 +5.2305e-01 0.0000e+00
++3.1521e-01 +4.7919e-01 0.0000e+00
++3.5252e-01 +4.4502e-01 0.0000e+00
++3.8398e-01 +4.0532e-01 0.0000e+00
++4.1794e-01 +3.6170e-01 0.0000e+00
++4.4319e-01 +3.2600e-01 0.0000e+00
++4.7813e-01 +2.7864e-01 0.0000e+00
++5.1370e-01 +2.3766e-01 0.0000e+00
++5.4374e-01 +2.0618e-01 0.0000e+00
++5.7422e-01 +1.6221e-01 0.0000e+00
++6.1445e-01 +1.1683e-01 0.0000e+00
++6.4650e-01 +7.6448e-02 0.0000e+00
++6.7272e-01 +4.1273e-02 0.0000e+00
++7.0406e-01 -9.4843e-03 0.0000e+00
++7.3792e-01 -5.0614e-02 0.0000e+00
++7.7266e-01 -8.3768e-02 0.0000e+00
++1.6613e-01 +7.6401e-01 0.0000e+00
++1.9033e-01 +7.2686e-01 0.0000e+00
++2.2258e-01 +6.8475e-01 0.0000e+00
++2.5987e-01 +6.4357e-01 0.0000e+00
++2.8839e-01 +5.9917e-01 0.0000e+00
++3.2877e-01 +5.6019e-01 0.0000e+00
++3.6282e-01 +5.1729e-01 0.0000e+00
++3.8896e-01 +4.8201e-01 0.0000e+00
++4.1874e-01 +4.3146e-01 0.0000e+00
++4.5605e-01 +3.9460e-01 0.0000e+00
++4.8756e-01 +3.5710e-01 0.0000e+00
++5.1817e-01 +3.0860e-01 0.0000e+00
++5.5149e-01 +2.7255e-01 0.0000e+00
++5.8356e-01 +2.3731e-01 0.0000e+00
++6.1687e-01 +1.8987e-01 0.0000e+00
++6.5129e-01 +1.4689e-01 0.0000e+00
++6.8326e-01 +1.1592e-01 0.0000e+00
++7.1175e-01 +6.7203e-02 0.0000e+00
++7.4510e-01 +2.2433e-02 0.0000e+00
++7.8405e-01 -1.5728e-02 0.0000e+00
++2.6262e-01 +7.1412e-01 0.0000e+00
++3.0133e-01 +6.7601e-01 0.0000e+00
++3.3117e-01 +6.3495e-01 0.0000e+00
++3.6109e-01 +5.9379e-01 0.0000e+00
++3.9293e-01 +5.5357e-01 0.0000e+00
++4.2933e-01 +5.0947e-01 0.0000e+00
++4.5479e-01 +4.6966e-01 0.0000e+00
++4.9576e-01 +4.2315e-01 0.0000e+00
++5.2866e-01 +3.8514e-01 0.0000e+00
++5.5886e-01 +3.4072e-01 0.0000e+00
++5.9613e-01 +3.0559e-01 0.0000e+00
++6.2565e-01 +2.7088e-01 0.0000e+00
++6.5875e-01 +2.2403e-01 0.0000e+00
++6.9509e-01 +1.8296e-01 0.0000e+00
++7.2764e-01 +1.4035e-01 0.0000e+00
++7.5337e-01 +1.0165e-01 0.0000e+00
++3.7570e-01 +6.6513e-01 0.0000e+00
++4.0241e-01 +6.2298e-01 0.0000e+00
++4.3704e-01 +5.8069e-01 0.0000e+00
++4.6729e-01 +5.3832e-01 0.0000e+00
++5.0089e-01 +5.0324e-01 0.0000e+00
++5.4002e-01 +4.5937e-01 0.0000e+00
++5.6505e-01 +4.2080e-01 0.0000e+00
++6.0715e-01 +3.7821e-01 0.0000e+00
++6.3713e-01 +3.3956e-01 0.0000e+00
++6.6166e-01 +2.9872e-01 0.0000e+00
++7.0359e-01 +2.5625e-01 0.0000e+00
++7.3367e-01 +2.1590e-01 0.0000e+00
++4.7709e-01 +6.1697e-01 0.0000e+00
++5.1341e-01 +5.7762e-01 0.0000e+00
++5.4603e-01 +5.3418e-01 0.0000e+00
++5.7387e-01 +4.9773e-01 0.0000e+00
++6.0755e-01 +4.5214e-01 0.0000e+00
++6.4074e-01 +4.0633e-01 0.0000e+00
++6.7388e-01 +3.6865e-01 0.0000e+00
++7.0582e-01 +3.2871e-01 0.0000e+00
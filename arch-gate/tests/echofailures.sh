@@ -0,0 +1 @@
+echo dm_impls_swarm_tests-ex6_bsi_2d_mesh_1_par_3 dm_impls_swarm_tests-ex6_bsi_2d_mesh_1_par_4 vec_is_sf_tests-ex5_2_window_shared ts_tutorials-ex41_e ksp_ksp_tutorials-ex56_latebs
\ No newline at end of file
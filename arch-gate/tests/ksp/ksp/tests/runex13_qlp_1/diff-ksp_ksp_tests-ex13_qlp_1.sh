@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/49    3/49    1/g" -e "s/50    3/50    1/g" -e "s/CONVERGED_HAPPY_BREAKDOWN/CONVERGED_RTOL/g"'  /root/repo/src/ksp/ksp/tests/output/ex13_qlp_1.out ex13_qlp_1.tmp > diff-runex13_qlp_1.out 2> diff-runex13_qlp_1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex13_qlp_2.out ex13_qlp_2.tmp > diff-runex13_qlp_2.out 2> diff-runex13_qlp_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/24    2/24    6/g" -e "s/50    3/50    1/g" -e "s/CONVERGED_RTOL/CONVERGED_STEP_LENGTH/g"'  /root/repo/src/ksp/ksp/tests/output/ex13_qlp_3.out ex13_qlp_3.tmp > diff-runex13_qlp_3-0.out 2> diff-runex13_qlp_3-0.out || /root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/24    2/24    6/g" -e "s/50    3/50    1/g" -e "s/CONVERGED_RTOL/CONVERGED_STEP_LENGTH/g"'  /root/repo/src/ksp/ksp/tests/output/ex13_qlp_3_alt.out ex13_qlp_3.tmp > diff-runex13_qlp_3.out 2> diff-runex13_qlp_3.out
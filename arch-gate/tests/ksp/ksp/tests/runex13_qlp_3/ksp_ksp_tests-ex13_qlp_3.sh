@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex13 -petsc_ci -ksp_converged_reason -testcase 3 -ksp_minres_monitor  > ex13_qlp_3.tmp 2> runex13_qlp_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex13_qlp_sisc.out ex13_qlp_sisc.tmp > diff-runex13_qlp_sisc.out 2> diff-runex13_qlp_sisc.out
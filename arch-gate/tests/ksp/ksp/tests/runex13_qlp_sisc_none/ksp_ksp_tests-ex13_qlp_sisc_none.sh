@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex13 -petsc_ci -ksp_converged_reason -ksp_minres_monitor -ksp_view_solution -pc_type none  > ex13_qlp_sisc_none.tmp 2> runex13_qlp_sisc_none.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex19 -petsc_ci -ksp_gmres_cgs_refinement_type refine_always -pc_type jacobi -ksp_monitor_short -ksp_type gmres  > ex19_1.tmp 2> runex19_1.err
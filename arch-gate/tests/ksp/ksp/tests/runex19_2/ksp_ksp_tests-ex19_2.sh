@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex19 -petsc_ci -ksp_monitor_short  > ex19_2.tmp 2> runex19_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex20 -petsc_ci -ksp_monitor_short  > ex20_1.tmp 2> runex20_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex21_blockdiag_3.out ex21_blockdiag_3.tmp > diff-runex21_blockdiag_3.out 2> diff-runex21_blockdiag_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex21_diag_1.out ex21_diag_1.tmp > diff-runex21_diag_1.out 2> diff-runex21_diag_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex21 -petsc_ci -mat_schur_complement_ainv_type diag  > ex21_diag_1.tmp 2> runex21_diag_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex21 -petsc_ci -mat_schur_complement_ainv_type diag -ksp_rtol 1e-12  > ex21_diag_3.tmp 2> runex21_diag_3.err
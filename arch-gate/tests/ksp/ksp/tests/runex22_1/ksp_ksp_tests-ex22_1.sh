@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex22 -petsc_ci   > ex22_1.tmp 2> runex22_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex23_0.out ex23_0.tmp > diff-runex23_0.out 2> diff-runex23_0.out
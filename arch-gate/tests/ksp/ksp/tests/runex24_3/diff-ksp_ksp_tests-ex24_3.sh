@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex24_3.out ex24_3.tmp > diff-runex24_3.out 2> diff-runex24_3.out
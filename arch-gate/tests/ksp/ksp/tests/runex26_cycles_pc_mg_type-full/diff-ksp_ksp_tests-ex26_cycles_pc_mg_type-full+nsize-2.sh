@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex26_cycles_pc_mg_type-full.out ex26_cycles_pc_mg_type-full.tmp > diff-runex26_cycles_pc_mg_type-full.out 2> diff-runex26_cycles_pc_mg_type-full.out
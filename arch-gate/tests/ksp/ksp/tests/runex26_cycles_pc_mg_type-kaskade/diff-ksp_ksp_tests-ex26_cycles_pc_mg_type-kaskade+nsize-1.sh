@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex26_cycles_pc_mg_type-kaskade.out ex26_cycles_pc_mg_type-kaskade.tmp > diff-runex26_cycles_pc_mg_type-kaskade.out 2> diff-runex26_cycles_pc_mg_type-kaskade.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex26 -petsc_ci -ksp_view_final_residual -pc_type mg -mx 5 -my 5 -pc_mg_levels 3 -pc_mg_galerkin -ksp_monitor -mg_levels_ksp_type richardson -mg_levels_pc_type jacobi -nrhs 1 -pc_mg_type kaskade  > ex26_cycles_pc_mg_type-kaskade.tmp 2> runex26_cycles_pc_mg_type-kaskade.err
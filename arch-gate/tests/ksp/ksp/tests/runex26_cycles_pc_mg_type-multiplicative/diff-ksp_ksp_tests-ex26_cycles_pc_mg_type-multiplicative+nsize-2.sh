@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex26_cycles_pc_mg_type-multiplicative.out ex26_cycles_pc_mg_type-multiplicative.tmp > diff-runex26_cycles_pc_mg_type-multiplicative.out 2> diff-runex26_cycles_pc_mg_type-multiplicative.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex26 -petsc_ci -ksp_view_final_residual -ksp_type preonly -pc_type mg -mx 5 -my 5 -pc_mg_levels 3 -pc_mg_galerkin -ksp_monitor -mg_levels_ksp_type richardson -mg_levels_pc_type jacobi -nrhs 7 -pc_mg_type additive -ksp_matsolve_batch_size 4  > ex26_matcycles_pc_mg_type-additive_ksp_matsolve_batch_size-4.tmp 2> runex26_matcycles_pc_mg_type-additive_ksp_matsolve_batch_size-4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex26_matcycles_pc_mg_type-additive_ksp_matsolve_batch_size-7.out ex26_matcycles_pc_mg_type-additive_ksp_matsolve_batch_size-7.tmp > diff-runex26_matcycles_pc_mg_type-additive_ksp_matsolve_batch_size-7.out 2> diff-runex26_matcycles_pc_mg_type-additive_ksp_matsolve_batch_size-7.out
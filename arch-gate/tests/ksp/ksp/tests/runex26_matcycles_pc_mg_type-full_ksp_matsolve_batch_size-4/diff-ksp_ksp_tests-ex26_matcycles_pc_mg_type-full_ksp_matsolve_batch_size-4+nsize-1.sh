@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex26_matcycles_pc_mg_type-full_ksp_matsolve_batch_size-4.out ex26_matcycles_pc_mg_type-full_ksp_matsolve_batch_size-4.tmp > diff-runex26_matcycles_pc_mg_type-full_ksp_matsolve_batch_size-4.out 2> diff-runex26_matcycles_pc_mg_type-full_ksp_matsolve_batch_size-4.out
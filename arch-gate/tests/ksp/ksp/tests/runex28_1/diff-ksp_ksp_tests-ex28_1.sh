@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex28.out ex28_1.tmp > diff-runex28_1.out 2> diff-runex28_1.out
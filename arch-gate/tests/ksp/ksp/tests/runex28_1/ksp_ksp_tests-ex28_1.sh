@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex28 -petsc_ci   > ex28_1.tmp 2> runex28_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex32 -petsc_ci -ksp_monitor_short -sbaij -ksp_monitor_short -pc_type cholesky -ksp_view  > ex32_1.tmp 2> runex32_1.err
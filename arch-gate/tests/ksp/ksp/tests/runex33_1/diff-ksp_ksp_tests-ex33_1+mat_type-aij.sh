@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex33.out ex33_1.tmp > diff-runex33_1.out 2> diff-runex33_1.out
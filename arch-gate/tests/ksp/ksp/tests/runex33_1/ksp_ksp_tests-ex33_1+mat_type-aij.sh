@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex33 -petsc_ci -sigma 2.0  -mat_type aij > ex33_1.tmp 2> runex33_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex34_1.out ex34_1.tmp > diff-runex34_1.out 2> diff-runex34_1.out
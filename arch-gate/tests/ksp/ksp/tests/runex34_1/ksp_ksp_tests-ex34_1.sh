@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex34 -petsc_ci   > ex34_1.tmp 2> runex34_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex34_1_mpiaij.out ex34_1_mpiaij.tmp > diff-runex34_1_mpiaij.out 2> diff-runex34_1_mpiaij.out
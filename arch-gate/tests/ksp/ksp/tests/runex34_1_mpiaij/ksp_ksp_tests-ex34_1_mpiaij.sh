@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex34 -petsc_ci -mtype mpiaij  > ex34_1_mpiaij.tmp 2> runex34_1_mpiaij.err
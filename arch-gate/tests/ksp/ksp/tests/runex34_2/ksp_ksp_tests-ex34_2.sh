@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex34 -petsc_ci   > ex34_2.tmp 2> runex34_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex38_1.out ex38_2.tmp > diff-runex38_2.out 2> diff-runex38_2.out
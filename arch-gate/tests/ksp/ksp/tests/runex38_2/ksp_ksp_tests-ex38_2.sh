@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex38 -petsc_ci -ksp_type qmrcgs -ksp_rtol 1.e-6 -sub_ksp_type bcgs -sub_ksp_rtol 1.e-3 -pc_type bjacobi -ksp_converged_reason -n1 64 -n2 64  > ex38_2.tmp 2> runex38_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex39_1.out ex39_2.tmp > diff-runex39_2.out 2> diff-runex39_2.out
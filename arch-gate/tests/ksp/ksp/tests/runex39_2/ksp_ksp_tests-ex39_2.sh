@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex39 -petsc_ci -ksp_type fbcgsr -ksp_rtol 1.e-6 -sub_ksp_type bcgs -sub_ksp_rtol 1.e-3 -pc_type bjacobi -ksp_converged_reason -n1 32 -n2 32 -n3 32  > ex39_2.tmp 2> runex39_2.err
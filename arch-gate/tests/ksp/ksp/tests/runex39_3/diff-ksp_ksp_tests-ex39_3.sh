@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex39_1.out ex39_3.tmp > diff-runex39_3.out 2> diff-runex39_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v Norm'  /root/repo/src/ksp/ksp/tests/output/ex3_build_solution.out ex3_build_solution.tmp > diff-runex3_build_solution.out 2> diff-runex3_build_solution.out
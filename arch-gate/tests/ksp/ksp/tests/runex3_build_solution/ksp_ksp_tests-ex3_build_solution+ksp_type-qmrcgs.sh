@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -test_build_solution  -ksp_type qmrcgs > ex3_build_solution.tmp 2> runex3_build_solution.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/Iterations 19/Iterations 20/g"'  /root/repo/src/ksp/ksp/tests/output/ex3_chebyest.out ex3_chebyest.tmp > diff-runex3_chebyest.out 2> diff-runex3_chebyest.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -ksp_est_view -ksp_type chebyshev -ksp_chebyshev_esteig  > ex3_chebyest.tmp 2> runex3_chebyest.err
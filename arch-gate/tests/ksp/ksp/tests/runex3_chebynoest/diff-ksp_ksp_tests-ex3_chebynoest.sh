@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex3_chebynoest.out ex3_chebynoest.tmp > diff-runex3_chebynoest.out 2> diff-runex3_chebynoest.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant HERMITIAN" | sed -e "s/Iterations 4/Iterations 5/g"'  /root/repo/src/ksp/ksp/tests/output/ex3_gamg_provided_not_ok.out ex3_gamg_provided_not_ok.tmp > diff-runex3_gamg_provided_not_ok.out 2> diff-runex3_gamg_provided_not_ok.out
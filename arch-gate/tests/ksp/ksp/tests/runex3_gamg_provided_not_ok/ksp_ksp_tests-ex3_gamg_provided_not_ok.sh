@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -pc_type gamg -mg_levels_pc_type sor -mg_levels_esteig_ksp_type cg -ksp_view  > ex3_gamg_provided_not_ok.tmp 2> runex3_gamg_provided_not_ok.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex3_nocheby.out ex3_nocheby.tmp > diff-runex3_nocheby.out 2> diff-runex3_nocheby.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -ksp_est_view  > ex3_nocheby.tmp 2> runex3_nocheby.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex42 -petsc_ci -ksp_converged_reason  > ex42_1.tmp 2> runex42_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex42 -petsc_ci -ksp_converged_reason  > ex42_2.tmp 2> runex42_2.err
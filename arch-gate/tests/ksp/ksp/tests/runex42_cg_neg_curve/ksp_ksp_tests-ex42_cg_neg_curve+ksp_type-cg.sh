@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex42 -petsc_ci -ksp_converged_neg_curve -vv -1 -ksp_converged_reason  -ksp_type cg > ex42_cg_neg_curve.tmp 2> runex42_cg_neg_curve.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex42_minres_neg_curve.out ex42_minres_neg_curve.tmp > diff-runex42_minres_neg_curve.out 2> diff-runex42_minres_neg_curve.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex42_minres_qlp.out ex42_minres_qlp.tmp > diff-runex42_minres_qlp.out 2> diff-runex42_minres_qlp.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex42_minres_qlp_nonconsistent.out ex42_minres_qlp_nonconsistent.tmp > diff-runex42_minres_qlp_nonconsistent.out 2> diff-runex42_minres_qlp_nonconsistent.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex42 -petsc_ci -ksp_converged_reason -ksp_minres_qlp -ksp_minres_monitor -consistent 0  > ex42_minres_qlp_nonconsistent.tmp 2> runex42_minres_qlp_nonconsistent.err
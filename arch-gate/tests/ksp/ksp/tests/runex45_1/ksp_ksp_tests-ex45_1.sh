@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex45 -petsc_ci   > ex45_1.tmp 2> runex45_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex47 -petsc_ci -pc_type fieldsplit  > ex47_1.tmp 2> runex47_1.err
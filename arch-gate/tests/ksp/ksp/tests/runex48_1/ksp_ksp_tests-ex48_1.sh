@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex48 -petsc_ci -ksp_monitor_short -ksp_converged_reason -ksp_type minres -pc_type jacobi -ksp_error_if_not_converged  > ex48_1.tmp 2> runex48_1.err
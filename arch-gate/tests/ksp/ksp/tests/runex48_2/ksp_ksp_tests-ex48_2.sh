@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex48 -petsc_ci -ksp_monitor_short -ksp_converged_reason -ksp_type minres -pc_type jacobi -ksp_view_eigenvalues -ksp_view_singularvalues -shift 1.5 -ksp_rtol 0 -ksp_atol 0 -n 5 -ksp_max_it 5  > ex48_2.tmp 2> runex48_2.err
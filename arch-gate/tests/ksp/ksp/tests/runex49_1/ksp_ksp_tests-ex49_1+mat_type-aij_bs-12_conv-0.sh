@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex49 -petsc_ci -pc_type cholesky -herm 0  -mat_type aij -bs 12 -conv 0 > ex49_1.tmp 2> runex49_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex4_5.out ex4_5.tmp > diff-runex4_5.out 2> diff-runex4_5.out
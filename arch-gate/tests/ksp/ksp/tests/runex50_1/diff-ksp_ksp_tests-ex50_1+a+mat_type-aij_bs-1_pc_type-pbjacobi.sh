@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex50_1.out ex50_1.tmp > diff-runex50_1.out 2> diff-runex50_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex50 -petsc_ci   -mat_type aij -bs 3 -pc_type pbjacobi  > ex50_1.tmp 2> runex50_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex50 -petsc_ci   -mat_type baij -bs 15 -pc_type ilu  > ex50_1.tmp 2> runex50_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex51 -petsc_ci -reverse -pc_type cholesky  > ex51_2.tmp 2> runex51_2.err
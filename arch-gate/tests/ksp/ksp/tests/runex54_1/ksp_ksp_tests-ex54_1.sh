@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex54 -petsc_ci -ksp_monitor_true_residual -ksp_max_it 10 -sys_view -ksp_converged_reason -ksp_view -ksp_lsqr_compute_standard_error -ksp_lsqr_monitor  > ex54_1.tmp 2> runex54_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex54_3.out ex54_3.tmp > diff-runex54_3-0.out 2> diff-runex54_3-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex54_3_alt.out ex54_3.tmp > diff-runex54_3.out 2> diff-runex54_3.out
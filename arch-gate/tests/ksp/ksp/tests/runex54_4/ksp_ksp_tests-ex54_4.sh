@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex54 -petsc_ci -ksp_monitor_true_residual -ksp_max_it 10 -sys_view -ksp_converged_reason -ksp_view -ksp_lsqr_monitor -ksp_convergence_test lsqr -ksp_lsqr_compute_standard_error -se_view -ksp_lsqr_exact_mat_norm 1  > ex54_4.tmp 2> runex54_4.err
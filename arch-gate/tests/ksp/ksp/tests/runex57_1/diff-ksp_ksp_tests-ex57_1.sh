@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex57_1.out ex57_1.tmp > diff-runex57_1.out 2> diff-runex57_1.out
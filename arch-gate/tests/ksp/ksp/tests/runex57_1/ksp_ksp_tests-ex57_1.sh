@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex57 -petsc_ci -pc_type fieldsplit -ksp_monitor  > ex57_1.tmp 2> runex57_1.err
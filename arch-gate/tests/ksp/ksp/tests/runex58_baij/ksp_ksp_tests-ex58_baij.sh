@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex58 -petsc_ci -mat_type baij  > ex58_baij.tmp 2> runex58_baij.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex58 -petsc_ci -mat_type sbaij  > ex58_sbaij.tmp 2> runex58_sbaij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex5_mat_type-lmvmbadbroyden.out ex5_mat_type-lmvmbadbroyden.tmp > diff-runex5_mat_type-lmvmbadbroyden.out 2> diff-runex5_mat_type-lmvmbadbroyden.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -mat_type lmvmbfgs  > ex5_mat_type-lmvmbfgs.tmp 2> runex5_mat_type-lmvmbfgs.err
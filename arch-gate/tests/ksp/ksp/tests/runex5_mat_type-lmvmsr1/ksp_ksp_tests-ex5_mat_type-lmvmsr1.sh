@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -mat_type lmvmsr1  > ex5_mat_type-lmvmsr1.tmp 2> runex5_mat_type-lmvmsr1.err
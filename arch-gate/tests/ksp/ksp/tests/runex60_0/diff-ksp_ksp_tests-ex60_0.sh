@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex60_0.out ex60_0.tmp > diff-runex60_0.out 2> diff-runex60_0.out
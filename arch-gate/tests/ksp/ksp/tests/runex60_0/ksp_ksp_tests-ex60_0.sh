@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex60 -petsc_ci -ksp_view  > ex60_0.tmp 2> runex60_0.err
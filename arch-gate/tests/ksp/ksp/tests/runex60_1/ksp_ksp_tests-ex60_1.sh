@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex60 -petsc_ci -ksp_view  > ex60_1.tmp 2> runex60_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex60 -petsc_ci -user_subdomains -ksp_view  > ex60_2.tmp 2> runex60_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex61_1.out ex61_1.tmp > diff-runex61_1.out 2> diff-runex61_1.out
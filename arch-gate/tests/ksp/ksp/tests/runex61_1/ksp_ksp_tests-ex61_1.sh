@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex61 -petsc_ci   > ex61_1.tmp 2> runex61_1.err
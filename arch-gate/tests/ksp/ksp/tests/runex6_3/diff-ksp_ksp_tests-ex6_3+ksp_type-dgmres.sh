@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/CONVERGED_RTOL/CONVERGED_ATOL/g"'  /root/repo/src/ksp/ksp/tests/output/ex6_3.out ex6_3.tmp > diff-runex6_3.out 2> diff-runex6_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -f ${wPETSC_DIR}/share/petsc/datafiles/matrices/spd-real-int32-float64 -pc_type none -ksp_max_it 20 -ksp_error_if_not_converged -ksp_converged_reason -test_residual  -ksp_type cg > ex6_3.tmp 2> runex6_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex6_maxits.out ex6_3_maxits.tmp > diff-runex6_3_maxits.out 2> diff-runex6_3_maxits.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex6_skip.out ex6_3_skip.tmp > diff-runex6_3_skip.out 2> diff-runex6_3_skip.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex70 -petsc_ci -ksp_rtol 1e-18 -pc_type sor -ksp_converged_reason -ksp_gmres_breakdown_tolerance 1.e-10  > ex70_1.tmp 2> runex70_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -ksp_monitor_short -ksp_max_it 10  > ex7_1.tmp 2> runex7_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex80_1.out ex80_1.tmp > diff-runex80_1.out 2> diff-runex80_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex80 -petsc_ci -ksp_guess_type fischer -ksp_guess_fischer_model 3,10 -ksp_guess_fischer_monitor -ksp_guess_fischer_tol 1e-6  > ex80_1.tmp 2> runex80_1.err
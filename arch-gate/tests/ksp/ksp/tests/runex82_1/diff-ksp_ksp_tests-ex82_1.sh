@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex82_1.out ex82_1.tmp > diff-runex82_1.out 2> diff-runex82_1.out
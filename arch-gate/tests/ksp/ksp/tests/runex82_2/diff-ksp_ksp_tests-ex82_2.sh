@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex82_2.out ex82_2.tmp > diff-runex82_2.out 2> diff-runex82_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex82 -petsc_ci -f ${wPETSC_DIR}/share/petsc/datafiles/matrices/ritz5 -ksp_monitor  > ex82_2.tmp 2> runex82_2.err
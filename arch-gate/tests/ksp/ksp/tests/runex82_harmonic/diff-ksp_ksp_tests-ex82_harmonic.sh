@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex82_harmonic.out ex82_harmonic.tmp > diff-runex82_harmonic.out 2> diff-runex82_harmonic.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex83_1.out ex83_1.tmp > diff-runex83_1.out 2> diff-runex83_1.out
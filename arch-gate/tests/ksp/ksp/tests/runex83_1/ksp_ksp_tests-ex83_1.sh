@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex83 -petsc_ci -ksp_guess_type fischer -ksp_guess_fischer_model 1,3 -ksp_guess_fischer_monitor  > ex83_1.tmp 2> runex83_1.err
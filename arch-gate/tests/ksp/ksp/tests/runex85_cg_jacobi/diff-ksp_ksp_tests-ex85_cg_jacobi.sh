@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant HERMITIAN"'  /root/repo/src/ksp/ksp/tests/output/ex85_cg_jacobi.out ex85_cg_jacobi.tmp > diff-runex85_cg_jacobi.out 2> diff-runex85_cg_jacobi.out
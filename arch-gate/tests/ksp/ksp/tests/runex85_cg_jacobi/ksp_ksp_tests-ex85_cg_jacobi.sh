@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex85 -petsc_ci -ksp_type cg -pc_type jacobi -ksp_view_eigenvalues -ksp_view_singularvalues -ksp_converged_reason  > ex85_cg_jacobi.tmp 2> runex85_cg_jacobi.err
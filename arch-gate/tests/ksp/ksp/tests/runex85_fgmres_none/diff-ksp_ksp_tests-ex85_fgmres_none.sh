@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex85_fgmres_none.out ex85_fgmres_none.tmp > diff-runex85_fgmres_none.out 2> diff-runex85_fgmres_none.out
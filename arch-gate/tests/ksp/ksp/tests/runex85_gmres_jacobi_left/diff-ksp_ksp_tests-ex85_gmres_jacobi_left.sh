@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex85_gmres_jacobi_left.out ex85_gmres_jacobi_left.tmp > diff-runex85_gmres_jacobi_left.out 2> diff-runex85_gmres_jacobi_left.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex85_minres_jacobi.out ex85_minres_jacobi.tmp > diff-runex85_minres_jacobi.out 2> diff-runex85_minres_jacobi.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex87.out ex87_real.tmp > diff-runex87_real.out 2> diff-runex87_real.out
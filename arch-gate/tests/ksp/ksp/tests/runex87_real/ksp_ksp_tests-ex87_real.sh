@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex87 -petsc_ci -ksp_pc_side right  > ex87_real.tmp 2> runex87_real.err
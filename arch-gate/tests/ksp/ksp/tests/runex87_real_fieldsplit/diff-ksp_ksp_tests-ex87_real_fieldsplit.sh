@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex87.out ex87_real_fieldsplit.tmp > diff-runex87_real_fieldsplit.out 2> diff-runex87_real_fieldsplit.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex87 -petsc_ci -ksp_type preonly -pc_type fieldsplit -fieldsplit_ksp_type preonly -fieldsplit_0_pc_type lu -fieldsplit_1_pc_type cholesky -pc_fieldsplit_type schur -pc_fieldsplit_schur_fact_type full -pc_fieldsplit_schur_precondition full  > ex87_real_fieldsplit.tmp 2> runex87_real_fieldsplit.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tests/output/ex8_3_setfromoptions_first-0.out ex8_3_setfromoptions_first-0.tmp > diff-runex8_3_setfromoptions_first-0.out 2> diff-runex8_3_setfromoptions_first-0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex8 -petsc_ci -ksp_lsqr_monitor -ksp_type lsqr -setfromoptions_first 0  > ex8_3_setfromoptions_first-0.tmp 2> runex8_3_setfromoptions_first-0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex8 -petsc_ci -ksp_lsqr_monitor -ksp_type lsqr -setfromoptions_first 1  > ex8_3_setfromoptions_first-1.tmp 2> runex8_3_setfromoptions_first-1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/CONVERGED_RTOL/CONVERGED_ATOL/g"'  /root/repo/src/ksp/ksp/tests/output/ex9_schur.out ex9_schur.tmp > diff-runex9_schur.out 2> diff-runex9_schur.out
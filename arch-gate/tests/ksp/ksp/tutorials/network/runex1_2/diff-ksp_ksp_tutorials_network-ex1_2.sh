@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/network/output/ex1_2.out ex1_2.tmp > diff-runex1_2.out 2> diff-runex1_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex3 -petsc_ci -options_left no  > ex3_2.tmp 2> runex3_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex3 -petsc_ci -options_left no  > ex3_3.tmp 2> runex3_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex4 -petsc_ci -options_left no -petscpartitioner_type simple  > ex4_2.tmp 2> runex4_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex4 -petsc_ci -options_left no -petscpartitioner_type simple  > ex4_3.tmp 2> runex4_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/bench_kspsolve_ksp.out bench_kspsolve_ksp.tmp > diff-runbench_kspsolve_ksp.out 2> diff-runbench_kspsolve_ksp.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../bench_kspsolve -petsc_ci -print_timing false -its 10 -n 8  > bench_kspsolve_ksp.tmp 2> runbench_kspsolve_ksp.err
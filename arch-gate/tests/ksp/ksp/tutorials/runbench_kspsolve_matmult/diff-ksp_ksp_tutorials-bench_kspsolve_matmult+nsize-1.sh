@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/bench_kspsolve_matmult.out bench_kspsolve_matmult.tmp > diff-runbench_kspsolve_matmult.out 2> diff-runbench_kspsolve_matmult.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../bench_kspsolve -petsc_ci -print_timing false -matmult -its 10 -n 8  > bench_kspsolve_matmult.tmp 2> runbench_kspsolve_matmult.err
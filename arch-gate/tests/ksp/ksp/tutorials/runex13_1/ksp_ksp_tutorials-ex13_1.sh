@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex13 -petsc_ci -m 19 -n 20 -ksp_gmres_cgs_refinement_type refine_always  > ex13_1.tmp 2> runex13_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex15_tsirm.out ex15_tsirm.tmp > diff-runex15_tsirm.out 2> diff-runex15_tsirm.out
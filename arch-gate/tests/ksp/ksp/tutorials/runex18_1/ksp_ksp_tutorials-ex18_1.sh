@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex18 -petsc_ci -m 39 -n 18 -ksp_monitor_short -permute nd  > ex18_1.tmp 2> runex18_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant "'  /root/repo/src/ksp/ksp/tutorials/output/ex18_bas.out ex18_bas.tmp > diff-runex18_bas.out 2> diff-runex18_bas.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex1_3.out ex1_3.tmp > diff-runex1_3.out 2> diff-runex1_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex1_minit.out ex1_minit.tmp > diff-runex1_minit.out 2> diff-runex1_minit.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -ksp_monitor -pc_type none -ksp_min_it 8  > ex1_minit.tmp 2> runex1_minit.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed s?ATOL?RTOL?g | grep -v HERMITIAN | grep -v "shared memory"'  /root/repo/src/ksp/ksp/tutorials/output/ex1_mpi_linear_solver_server_1.out ex1_mpi_linear_solver_server_1.tmp > diff-runex1_mpi_linear_solver_server_1.out 2> diff-runex1_mpi_linear_solver_server_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex1 -petsc_ci -mpi_linear_solver_server -mpi_linear_solver_server_view -mpi_linear_solver_server_minimum_count_per_rank 5 -mpi_linear_solver_server_ksp_view -mpi_linear_solver_server_mat_view -ksp_monitor -ksp_converged_reason -mat_view -ksp_view -ksp_type cg -pc_type none -prefix_test_mpi_linear_solver_server_mat_view -prefix_test_ksp_monitor -prefix_test_mpi_linear_solver_server_minimum_count_per_rank 5  > ex1_mpi_linear_solver_server_1.tmp 2> runex1_mpi_linear_solver_server_1.err
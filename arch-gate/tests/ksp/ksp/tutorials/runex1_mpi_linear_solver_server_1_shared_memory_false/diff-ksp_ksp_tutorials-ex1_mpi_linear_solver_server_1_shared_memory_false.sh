@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed s?ATOL?RTOL?g | grep -v HERMITIAN'  /root/repo/src/ksp/ksp/tutorials/output/ex1_mpi_linear_solver_server_1_shared_memory_false.out ex1_mpi_linear_solver_server_1_shared_memory_false.tmp > diff-runex1_mpi_linear_solver_server_1_shared_memory_false.out 2> diff-runex1_mpi_linear_solver_server_1_shared_memory_false.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex23_1.out ex23_1.tmp > diff-runex23_1.out 2> diff-runex23_1.out
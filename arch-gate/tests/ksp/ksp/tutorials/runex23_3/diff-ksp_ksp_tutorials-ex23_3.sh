@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex23_3.out ex23_3.tmp > diff-runex23_3.out 2> diff-runex23_3.out
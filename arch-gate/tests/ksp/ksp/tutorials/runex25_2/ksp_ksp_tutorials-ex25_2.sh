@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex25 -petsc_ci -pc_type mg -ksp_type fgmres -da_refine 2 -ksp_monitor_short -mg_levels_ksp_monitor_short -mg_levels_ksp_norm_type unpreconditioned -ksp_view -pc_mg_type full  > ex25_2.tmp 2> runex25_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex27_3_nsize-1.out ex27_3_nsize-1.tmp > diff-runex27_3_nsize-1.out 2> diff-runex27_3_nsize-1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex27_3a_nsize-2.out ex27_3a_nsize-2.tmp > diff-runex27_3a_nsize-2.out 2> diff-runex27_3a_nsize-2.out
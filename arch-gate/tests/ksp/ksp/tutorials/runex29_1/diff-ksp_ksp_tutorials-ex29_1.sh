@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex29_1.out ex29_1.tmp > diff-runex29_1-0.out 2> diff-runex29_1-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex29_1_alt.out ex29_1.tmp > diff-runex29_1.out 2> diff-runex29_1.out
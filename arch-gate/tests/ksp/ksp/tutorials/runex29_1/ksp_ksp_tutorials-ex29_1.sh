@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex29 -petsc_ci -pc_type mg -pc_mg_type full -ksp_type fgmres -ksp_monitor_short -da_refine 8 -ksp_rtol 1.e-3  > ex29_1.tmp 2> runex29_1.err
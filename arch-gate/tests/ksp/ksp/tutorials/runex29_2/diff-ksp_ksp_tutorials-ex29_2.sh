@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex29_2.out ex29_2.tmp > diff-runex29_2.out 2> diff-runex29_2.out
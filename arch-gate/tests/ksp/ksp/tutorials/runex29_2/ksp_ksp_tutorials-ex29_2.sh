@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex29 -petsc_ci -bc_type neumann -pc_type mg -pc_mg_type full -ksp_type fgmres -ksp_monitor_short -da_refine 8 -mg_coarse_pc_factor_shift_type nonzero  > ex29_2.tmp 2> runex29_2.err
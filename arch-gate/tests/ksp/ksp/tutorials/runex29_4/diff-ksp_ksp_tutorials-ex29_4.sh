@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex29_4.out ex29_4.tmp > diff-runex29_4.out 2> diff-runex29_4.out
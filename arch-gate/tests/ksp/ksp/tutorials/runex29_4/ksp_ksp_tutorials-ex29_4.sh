@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex29 -petsc_ci -ksp_view -da_refine 2 -pc_type mg -pc_mg_distinct_smoothup -mg_levels_up_ksp_max_it 3 -mg_levels_ksp_max_it 4  > ex29_4.tmp 2> runex29_4.err
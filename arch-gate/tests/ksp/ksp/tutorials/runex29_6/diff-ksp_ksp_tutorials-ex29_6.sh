@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex29_6.out ex29_6.tmp > diff-runex29_6.out 2> diff-runex29_6.out
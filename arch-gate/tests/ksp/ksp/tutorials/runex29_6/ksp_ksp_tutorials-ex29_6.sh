@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex29 -petsc_ci -pc_type svd -pc_svd_monitor ::all  > ex29_6.tmp 2> runex29_6.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex29_aniso_first.out ex29_aniso_first.tmp > diff-runex29_aniso_first.out 2> diff-runex29_aniso_first.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex29 -petsc_ci -da_grid_x 10 -da_grid_y 2 -da_refine 2 -pc_type mg -ksp_monitor_short -mg_levels_ksp_max_it 6 -mg_levels_pc_type jacobi -mg_levels_ksp_chebyshev_kind fourth  > ex29_aniso_fourth.tmp 2> runex29_aniso_fourth.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex29_telescope.out ex29_telescope.tmp > diff-runex29_telescope.out 2> diff-runex29_telescope.out
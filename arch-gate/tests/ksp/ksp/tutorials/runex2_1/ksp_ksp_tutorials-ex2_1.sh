@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -ksp_monitor_short -m 5 -n 5 -ksp_gmres_cgs_refinement_type refine_always  > ex2_1.tmp 2> runex2_1.err
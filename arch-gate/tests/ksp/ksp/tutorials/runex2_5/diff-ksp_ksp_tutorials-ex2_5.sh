@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex2_2.out ex2_5.tmp > diff-runex2_5.out 2> diff-runex2_5.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex2 -petsc_ci -ksp_monitor_short -m 5 -n 5 -mat_view draw -ksp_gmres_cgs_refinement_type refine_always -nox  > ex2_5.tmp 2> runex2_5.err
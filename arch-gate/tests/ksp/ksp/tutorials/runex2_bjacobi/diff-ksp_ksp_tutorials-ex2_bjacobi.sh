@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex2_bjacobi.out ex2_bjacobi.tmp > diff-runex2_bjacobi.out 2> diff-runex2_bjacobi.out
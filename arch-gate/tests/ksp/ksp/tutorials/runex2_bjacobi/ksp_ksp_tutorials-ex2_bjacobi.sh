@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex2 -petsc_ci -pc_type bjacobi -pc_bjacobi_blocks 1 -ksp_monitor_short -sub_pc_type jacobi -sub_ksp_type gmres  > ex2_bjacobi.tmp 2> runex2_bjacobi.err
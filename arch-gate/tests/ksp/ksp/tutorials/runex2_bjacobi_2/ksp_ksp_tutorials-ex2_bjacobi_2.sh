@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex2 -petsc_ci -pc_type bjacobi -pc_bjacobi_blocks 2 -ksp_monitor_short -sub_pc_type jacobi -sub_ksp_type gmres -ksp_view  > ex2_bjacobi_2.tmp 2> runex2_bjacobi_2.err
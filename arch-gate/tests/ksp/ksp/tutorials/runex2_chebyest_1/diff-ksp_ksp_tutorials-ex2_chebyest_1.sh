@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex2_chebyest_1.out ex2_chebyest_1.tmp > diff-runex2_chebyest_1.out 2> diff-runex2_chebyest_1.out
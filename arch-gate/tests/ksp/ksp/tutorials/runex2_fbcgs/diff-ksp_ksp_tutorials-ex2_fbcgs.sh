@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex2_fbcgs.out ex2_fbcgs.tmp > diff-runex2_fbcgs.out 2> diff-runex2_fbcgs.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -ksp_type fbcgs -pc_type ilu  > ex2_fbcgs.tmp 2> runex2_fbcgs.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex2_fbcgs_2.out ex2_fbcgs_2.tmp > diff-runex2_fbcgs_2.out 2> diff-runex2_fbcgs_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex2 -petsc_ci -ksp_type fbcgsr -pc_type bjacobi  > ex2_fbcgs_2.tmp 2> runex2_fbcgs_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex2_groppcg.out ex2_groppcg.tmp > diff-runex2_groppcg.out 2> diff-runex2_groppcg.out
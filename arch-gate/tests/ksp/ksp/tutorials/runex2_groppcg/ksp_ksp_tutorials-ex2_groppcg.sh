@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -ksp_monitor_short -ksp_type groppcg -m 9 -n 9  > ex2_groppcg.tmp 2> runex2_groppcg.err
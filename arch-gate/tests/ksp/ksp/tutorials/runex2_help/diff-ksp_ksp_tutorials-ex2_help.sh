@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v -e "BLAS options" -e "blas_view" -e "^\-\-\-"'  /root/repo/src/ksp/ksp/tutorials/output/ex2_help.out ex2_help.tmp > diff-runex2_help.out 2> diff-runex2_help.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -ksp_monitor -help -petsc_ci_portable_error_output -error_output_stdout  > ex2_help.tmp 2> runex2_help.err
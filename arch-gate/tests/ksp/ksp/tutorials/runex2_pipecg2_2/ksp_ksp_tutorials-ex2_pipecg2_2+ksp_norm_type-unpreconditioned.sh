@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex2 -petsc_ci -ksp_monitor_short -ksp_type pipecg2 -m 15 -n 9  -ksp_norm_type unpreconditioned > ex2_pipecg2_2.tmp 2> runex2_pipecg2_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -ksp_monitor_short -ksp_type pipecgrr -m 9 -n 9  > ex2_pipecgrr.tmp 2> runex2_pipecgrr.err
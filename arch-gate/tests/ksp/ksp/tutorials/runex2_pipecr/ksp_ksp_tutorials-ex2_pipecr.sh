@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -ksp_monitor_short -ksp_type pipecr -m 9 -n 9  > ex2_pipecr.tmp 2> runex2_pipecr.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "sqrt breakdown in iteration"'  /root/repo/src/ksp/ksp/tutorials/output/ex2_pipelcg.out ex2_pipelcg.tmp > diff-runex2_pipelcg.out 2> diff-runex2_pipelcg.out
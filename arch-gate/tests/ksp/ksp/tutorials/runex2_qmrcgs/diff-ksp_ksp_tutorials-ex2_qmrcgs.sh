@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex2_fbcgs.out ex2_qmrcgs.tmp > diff-runex2_qmrcgs.out 2> diff-runex2_qmrcgs.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -ksp_type qmrcgs -pc_type ilu  > ex2_qmrcgs.tmp 2> runex2_qmrcgs.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex2 -petsc_ci -ksp_type qmrcgs -pc_type bjacobi  > ex2_qmrcgs_2.tmp 2> runex2_qmrcgs_2.err
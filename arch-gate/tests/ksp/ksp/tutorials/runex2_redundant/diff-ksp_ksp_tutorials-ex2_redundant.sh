@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex2_redundant.out ex2_redundant.tmp > diff-runex2_redundant.out 2> diff-runex2_redundant.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex2 -petsc_ci -ksp_view -pc_type redundant -redundant_pc_type redundant -redundant_redundant_pc_type redundant -redundant_redundant_redundant_pc_type redundant -redundant_redundant_redundant_redundant_pc_type redundant  > ex2_redundant.tmp 2> runex2_redundant.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex2_2.out ex2_sf_persistent_buffers.tmp > diff-runex2_sf_persistent_buffers.out 2> diff-runex2_sf_persistent_buffers.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex2 -petsc_ci -ksp_monitor_short -m 5 -n 5 -ksp_gmres_cgs_refinement_type refine_always -sf_basic_persistent_buffers  > ex2_sf_persistent_buffers.tmp 2> runex2_sf_persistent_buffers.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex2_symmetric_pc.out ex2_symmetric_pc.tmp > diff-runex2_symmetric_pc.out 2> diff-runex2_symmetric_pc.out
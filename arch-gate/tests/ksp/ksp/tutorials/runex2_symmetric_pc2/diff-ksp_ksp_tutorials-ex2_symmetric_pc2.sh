@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex2_symmetric_pc2.out ex2_symmetric_pc2.tmp > diff-runex2_symmetric_pc2.out 2> diff-runex2_symmetric_pc2.out
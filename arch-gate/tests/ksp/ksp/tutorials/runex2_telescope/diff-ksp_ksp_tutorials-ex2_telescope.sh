@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex2_telescope.out ex2_telescope.tmp > diff-runex2_telescope.out 2> diff-runex2_telescope.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex32_4.out ex32_4.tmp > diff-runex32_4.out 2> diff-runex32_4.out
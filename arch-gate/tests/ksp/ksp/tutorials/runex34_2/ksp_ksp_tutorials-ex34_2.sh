@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex34 -petsc_ci -ksp_monitor_short -da_grid_x 50 -da_grid_y 50 -pc_type ksp -ksp_ksp_type cg -ksp_pc_type bjacobi -ksp_ksp_rtol 1e-1 -ksp_ksp_monitor -ksp_type pipefgmres -ksp_gmres_restart 5  > ex34_2.tmp 2> runex34_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex42_2.out ex42_2.tmp > diff-runex42_2.out 2> diff-runex42_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex42 -petsc_ci -stokes_ksp_monitor_short -stokes_ksp_converged_reason -stokes_pc_type redundant -stokes_redundant_pc_type lu  > ex42_2.tmp 2> runex42_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex42_bddc_stokes.out ex42_bddc_stokes.tmp > diff-runex42_bddc_stokes.out 2> diff-runex42_bddc_stokes.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex42 -petsc_ci -mx 5 -my 4 -mz 3 -stokes_ksp_monitor_short -stokes_ksp_converged_reason -stokes_pc_type bddc -dm_mat_type is -stokes_pc_bddc_dirichlet_pc_type svd -stokes_pc_bddc_neumann_pc_type svd -stokes_pc_bddc_coarse_redundant_pc_type svd  > ex42_bddc_stokes.tmp 2> runex42_bddc_stokes.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex42_bddc_stokes_deluxe.out ex42_bddc_stokes_deluxe.tmp > diff-runex42_bddc_stokes_deluxe.out 2> diff-runex42_bddc_stokes_deluxe.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex42 -petsc_ci -stokes_ksp_monitor -stokes_pc_type fieldsplit -stokes_pc_fieldsplit_type schur  > ex42_tut_2.tmp 2> runex42_tut_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex42_tut_3.out ex42_tut_3.tmp > diff-runex42_tut_3.out 2> diff-runex42_tut_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex42 -petsc_ci -mx 20 -stokes_ksp_monitor -stokes_pc_type fieldsplit -stokes_pc_fieldsplit_type schur  > ex42_tut_3.tmp 2> runex42_tut_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex43_6.out ex43_6.tmp > diff-runex43_6.out 2> diff-runex43_6.out
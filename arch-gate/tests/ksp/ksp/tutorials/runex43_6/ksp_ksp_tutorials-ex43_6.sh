@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex43 -petsc_ci -stokes_ksp_view -stokes_pc_type mg -stokes_pc_mg_levels 2 -stokes_mg_coarse_pc_type telescope -stokes_mg_coarse_pc_telescope_reduction_factor 2 -stokes_pc_use_amat false -stokes_pc_mg_galerkin pmat -stokes_mg_coarse_pc_telescope_subcomm_type contiguous  > ex43_6.tmp 2> runex43_6.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex43_bddc_stokes_deluxe.out ex43_bddc_stokes_deluxe.tmp > diff-runex43_bddc_stokes_deluxe.out 2> diff-runex43_bddc_stokes_deluxe.out
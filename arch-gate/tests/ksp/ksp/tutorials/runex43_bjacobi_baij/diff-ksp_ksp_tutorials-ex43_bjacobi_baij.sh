@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex43_bjacobi.out ex43_bjacobi_baij.tmp > diff-runex43_bjacobi_baij.out 2> diff-runex43_bjacobi_baij.out
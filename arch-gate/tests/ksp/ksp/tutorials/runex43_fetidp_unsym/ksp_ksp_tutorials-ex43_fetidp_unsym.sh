@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex43 -petsc_ci -dm_mat_type is -stokes_ksp_type fetidp -stokes_ksp_monitor_true_residual -stokes_ksp_converged_reason -stokes_fetidp_bddc_pc_bddc_coarse_redundant_pc_type svd  > ex43_fetidp_unsym.tmp 2> runex43_fetidp_unsym.err
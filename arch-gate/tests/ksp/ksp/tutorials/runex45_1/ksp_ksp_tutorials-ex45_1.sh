@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex45 -petsc_ci -pc_type exotic -ksp_monitor_short -ksp_type fgmres -mg_levels_ksp_type gmres -mg_levels_ksp_max_it 1 -mg_levels_pc_type bjacobi  > ex45_1.tmp 2> runex45_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex45_telescope.out ex45_telescope.tmp > diff-runex45_telescope.out 2> diff-runex45_telescope.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex49_2.out ex49_2.tmp > diff-runex49_2.out 2> diff-runex49_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex49_3.out ex49_3.tmp > diff-runex49_3.out 2> diff-runex49_3.out
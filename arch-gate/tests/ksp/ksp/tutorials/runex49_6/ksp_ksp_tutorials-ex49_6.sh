@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex49 -petsc_ci -mx 20 -my 30 -elas_ksp_monitor_short -no_view -c_str 3 -sponge_E0 1 -sponge_E1 1000 -sponge_nu0 0.4 -sponge_nu1 0.2 -sponge_t 1 -sponge_w 8 -elas_ksp_type pipegcr -elas_pc_type asm -elas_sub_pc_type lu  > ex49_6.tmp 2> runex49_6.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex49_8.out ex49_8.tmp > diff-runex49_8.out 2> diff-runex49_8.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex49_bddc.out ex49_bddc.tmp > diff-runex49_bddc.out 2> diff-runex49_bddc.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex49_bddc_subdomainjump.out ex49_bddc_subdomainjump.tmp > diff-runex49_bddc_subdomainjump.out 2> diff-runex49_bddc_subdomainjump.out
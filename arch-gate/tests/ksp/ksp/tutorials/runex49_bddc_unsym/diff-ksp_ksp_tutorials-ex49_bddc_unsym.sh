@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex49_bddc_unsym.out ex49_bddc_unsym.tmp > diff-runex49_bddc_unsym.out 2> diff-runex49_bddc_unsym.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex4_component.out ex4_component.tmp > diff-runex4_component.out 2> diff-runex4_component.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v " MPI process" | grep -v " type:" | grep -v "Mat Object"'  /root/repo/src/ksp/ksp/tutorials/output/ex4_expl.out ex4_expl_aij.tmp > diff-runex4_expl_aij.out 2> diff-runex4_expl_aij.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex4 -petsc_ci -ksp_converged_reason -view_explicit_mat -pc_type none -mat_type aij  -ksp_type gmres > ex4_expl_aij.tmp 2> runex4_expl_aij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex4_gamg_asm.out ex4_gamg_asm.tmp > diff-runex4_gamg_asm.out 2> diff-runex4_gamg_asm.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex4_interface.out ex4_interface.tmp > diff-runex4_interface.out 2> diff-runex4_interface.out
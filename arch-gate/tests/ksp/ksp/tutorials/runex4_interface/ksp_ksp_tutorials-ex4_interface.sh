@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex4 -petsc_ci -ksp_monitor -ksp_rtol 1e-6 -test_hmg_interface 1 -bs 4  > ex4_interface.tmp 2> runex4_interface.err
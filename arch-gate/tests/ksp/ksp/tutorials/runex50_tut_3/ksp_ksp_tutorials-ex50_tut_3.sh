@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex50 -petsc_ci -da_grid_x 1025 -da_grid_y 1025 -pc_type mg -pc_mg_levels 9 -ksp_monitor  > ex50_tut_3.tmp 2> runex50_tut_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex52_2.out ex52_1.tmp > diff-runex52_1.out 2> diff-runex52_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex52 -petsc_ci -use_petsc_lu  > ex52_1.tmp 2> runex52_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex54 -petsc_ci -ne 49 -alpha 1.e-3 -ksp_type cg -pc_type gamg -mg_levels_ksp_max_it 2 -pc_gamg_type classical -ksp_monitor -ksp_converged_reason -mg_levels_esteig_ksp_type cg -mg_levels_ksp_chebyshev_esteig 0,0.25,0,1.1 -pc_gamg_mat_coarsen_type mis  > ex54_Classical.tmp 2> runex54_Classical.err
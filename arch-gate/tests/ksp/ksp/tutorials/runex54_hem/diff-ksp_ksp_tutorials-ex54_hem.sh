@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/Linear solve converged due to CONVERGED_RTOL iterations 8/Linear solve converged due to CONVERGED_RTOL iterations 7/g"'  /root/repo/src/ksp/ksp/tutorials/output/ex54_hem.out ex54_hem.tmp > diff-runex54_hem.out 2> diff-runex54_hem.out
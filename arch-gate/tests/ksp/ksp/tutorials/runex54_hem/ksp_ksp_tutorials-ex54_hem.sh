@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex54 -petsc_ci -ne 39 -ksp_type cg -pc_type gamg -pc_gamg_type agg -ksp_rtol 1e-4 -ksp_norm_type unpreconditioned -pc_gamg_mat_coarsen_type hem -ksp_converged_reason -ksp_norm_type unpreconditioned  > ex54_hem.tmp 2> runex54_hem.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex55_sa.out ex55_1.tmp > diff-runex55_1-0.out 2> diff-runex55_1-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex55_sa_alt.out ex55_1.tmp > diff-runex55_1.out 2> diff-runex55_1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/Linear solve converged due to CONVERGED_RTOL iterations 17/Linear solve converged due to CONVERGED_RTOL iterations 18/g"'  /root/repo/src/ksp/ksp/tutorials/output/ex55_classical.out ex55_Classical.tmp > diff-runex55_Classical.out 2> diff-runex55_Classical.out
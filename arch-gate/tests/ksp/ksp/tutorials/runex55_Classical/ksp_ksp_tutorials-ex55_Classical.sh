@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex55 -petsc_ci -ne 29 -alpha 1.e-3 -ksp_type gmres -pc_type gamg -pc_gamg_type classical -mg_levels_ksp_max_it 5 -ksp_converged_reason -ksp_rtol 1e-3 -pc_gamg_mat_coarsen_misk_distance 2 -pc_gamg_threshold 0  > ex55_Classical.tmp 2> runex55_Classical.err
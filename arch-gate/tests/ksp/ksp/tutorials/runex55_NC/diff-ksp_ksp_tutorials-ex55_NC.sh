@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/Linear solve converged due to CONVERGED_RTOL iterations 12/Linear solve converged due to CONVERGED_RTOL iterations 11/g"'  /root/repo/src/ksp/ksp/tutorials/output/ex55_NC.out ex55_NC.tmp > diff-runex55_NC.out 2> diff-runex55_NC.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/Linear solve converged due to CONVERGED_RTOL iterations 15/Linear solve converged due to CONVERGED_RTOL iterations 14/g"'  /root/repo/src/ksp/ksp/tutorials/output/ex56_1.out ex56_1.tmp > diff-runex56_1.out 2> diff-runex56_1.out
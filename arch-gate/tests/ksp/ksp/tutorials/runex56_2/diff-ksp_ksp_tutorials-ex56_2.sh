@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/Linear solve converged due to CONVERGED_RTOL iterations 1[3|4]/Linear solve converged due to CONVERGED_RTOL iterations 15/g"'  /root/repo/src/ksp/ksp/tutorials/output/ex56_2.out ex56_2.tmp > diff-runex56_2.out 2> diff-runex56_2.out
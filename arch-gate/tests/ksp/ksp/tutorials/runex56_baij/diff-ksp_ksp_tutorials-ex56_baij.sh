@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v variant'  /root/repo/src/ksp/ksp/tutorials/output/ex56_baij.out ex56_baij.tmp > diff-runex56_baij.out 2> diff-runex56_baij.out
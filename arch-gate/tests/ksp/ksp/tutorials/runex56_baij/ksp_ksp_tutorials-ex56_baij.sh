@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex56 -petsc_ci -ne 15 -alpha 1.e-3 -ksp_type cg -ksp_converged_reason -use_mat_nearnullspace -ksp_rtol 1e-4 -ksp_norm_type unpreconditioned -two_solves -pc_type jacobi -pc_jacobi_type rowl1 -ksp_type cg -mat_type baij -ksp_view -ksp_rtol 1e-1 -two_solves false  > ex56_baij.tmp 2> runex56_baij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex56_gamg.out ex56_gamg.tmp > diff-runex56_gamg.out 2> diff-runex56_gamg.out
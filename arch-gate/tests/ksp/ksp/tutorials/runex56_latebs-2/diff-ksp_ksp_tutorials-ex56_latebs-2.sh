@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v variant'  /root/repo/src/ksp/ksp/tutorials/output/ex56_latebs-2.out ex56_latebs-2.tmp > diff-runex56_latebs-2.out 2> diff-runex56_latebs-2.out
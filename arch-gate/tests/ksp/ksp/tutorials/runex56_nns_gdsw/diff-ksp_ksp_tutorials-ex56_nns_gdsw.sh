@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant HERMITIAN"'  /root/repo/src/ksp/ksp/tutorials/output/ex56_nns_gdsw.out ex56_nns_gdsw.tmp > diff-runex56_nns_gdsw.out 2> diff-runex56_nns_gdsw.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex56_nns_telescope.out ex56_nns_telescope.tmp > diff-runex56_nns_telescope.out 2> diff-runex56_nns_telescope.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex56 -petsc_ci -use_mat_nearnullspace -pc_type telescope -pc_telescope_reduction_factor 2 -telescope_pc_type gamg -telescope_pc_gamg_esteig_ksp_type cg -telescope_pc_gamg_esteig_ksp_max_it 10  > ex56_nns_telescope.tmp 2> runex56_nns_telescope.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex59_bddc_fetidp_3.out ex59_bddc_fetidp_3.tmp > diff-runex59_bddc_fetidp_3.out 2> diff-runex59_bddc_fetidp_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex59_bddc_fetidp_approximate.out ex59_bddc_fetidp_approximate.tmp > diff-runex59_bddc_fetidp_approximate.out 2> diff-runex59_bddc_fetidp_approximate.out
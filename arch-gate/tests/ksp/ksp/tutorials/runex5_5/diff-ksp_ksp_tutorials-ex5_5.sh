@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex5_5.out ex5_5.tmp > diff-runex5_5.out 2> diff-runex5_5.out
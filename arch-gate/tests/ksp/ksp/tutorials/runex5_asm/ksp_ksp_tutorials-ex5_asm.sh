@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex5 -petsc_ci -pc_type asm  > ex5_asm.tmp 2> runex5_asm.err
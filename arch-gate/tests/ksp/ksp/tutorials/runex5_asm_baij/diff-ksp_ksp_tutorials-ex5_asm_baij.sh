@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex5_asm.out ex5_asm_baij.tmp > diff-runex5_asm_baij.out 2> diff-runex5_asm_baij.out
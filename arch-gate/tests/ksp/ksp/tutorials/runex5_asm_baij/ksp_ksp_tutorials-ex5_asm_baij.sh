@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex5 -petsc_ci -pc_type asm -mat_type baij  > ex5_asm_baij.tmp 2> runex5_asm_baij.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex5 -petsc_ci -pc_type redundant -pc_redundant_number 3 -redundant_ksp_type gmres -redundant_pc_type jacobi  > ex5_redundant_2.tmp 2> runex5_redundant_2.err
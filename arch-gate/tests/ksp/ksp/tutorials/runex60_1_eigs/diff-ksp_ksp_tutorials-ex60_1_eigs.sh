@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex60_1_eigs.out ex60_1_eigs.tmp > diff-runex60_1_eigs.out 2> diff-runex60_1_eigs.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex60 -petsc_ci -ksp_monitor_short -diagfunc 3 -ksp_type fcg -ksp_fcg_mmax 10000 -eta 0.3333  > ex60_2.tmp 2> runex60_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex60_3.out ex60_3.tmp > diff-runex60_3.out 2> diff-runex60_3.out
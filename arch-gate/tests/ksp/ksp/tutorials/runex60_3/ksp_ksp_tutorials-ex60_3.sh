@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex60 -petsc_ci -ksp_monitor_short -ksp_rtol 1e-6 -diagfunc 2 -ksp_type fgmres -eta 0.1  > ex60_3.tmp 2> runex60_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex60 -petsc_ci -ksp_monitor_short -ksp_rtol 1e-6 -diagfunc 1 -ksp_type pipefcg -ksp_pipefcg_mmax 1 -eta 0.1  > ex60_4.tmp 2> runex60_4.err
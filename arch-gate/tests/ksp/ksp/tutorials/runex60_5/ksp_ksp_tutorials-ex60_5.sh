@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex60 -petsc_ci -ksp_monitor_short -ksp_rtol 1e-6 -diagfunc 3 -ksp_type pipefcg -ksp_pipefcg_mmax 10000 -eta 0.1  > ex60_5.tmp 2> runex60_5.err
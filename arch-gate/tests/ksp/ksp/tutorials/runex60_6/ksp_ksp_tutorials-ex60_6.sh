@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex60 -petsc_ci -ksp_monitor_short -ksp_rtol 1e-6 -diagfunc 3 -ksp_type fcg -ksp_fcg_mmax 10000 -eta 0 -pc_type ksp -ksp_ksp_type cg -ksp_pc_type none -ksp_ksp_rtol 1e-1 -ksp_ksp_max_it 5 -ksp_ksp_converged_reason  > ex60_6.tmp 2> runex60_6.err
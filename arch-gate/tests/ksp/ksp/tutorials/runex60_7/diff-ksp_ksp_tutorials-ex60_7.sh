@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex60_7.out ex60_7.tmp > diff-runex60_7.out 2> diff-runex60_7.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex60_9.out ex60_9.tmp > diff-runex60_9.out 2> diff-runex60_9.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex62 -petsc_ci -M 7 -N 9 -user_set_subdomains -Mdomains 1 -Ndomains 3 -overlap 1 -print_error -pc_gasm_print_subdomains  > ex62_2D_1.tmp 2> runex62_2D_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex62_gasm_view.out ex62_gasm_view.tmp > diff-runex62_gasm_view.out 2> diff-runex62_gasm_view.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex62 -petsc_ci -pc_type gasm -ksp_view -Mdomains 2 -Ndomains 2 -user_set_subdomains  > ex62_gasm_view.tmp 2> runex62_gasm_view.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed s/ATOL/RTOL/g'  /root/repo/src/ksp/ksp/tutorials/output/ex67_nonsymmetric_right.out ex67_nonsymmetric_right.tmp > diff-runex67_nonsymmetric_right.out 2> diff-runex67_nonsymmetric_right.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v atomic' -f $'grep -v atomic'  /root/repo/src/ksp/ksp/tutorials/output/ex70_fetidp.out ex70_fetidp.tmp > diff-runex70_fetidp.out 2> diff-runex70_fetidp.out
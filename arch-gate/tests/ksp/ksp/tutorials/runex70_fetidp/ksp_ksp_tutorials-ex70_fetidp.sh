@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex70 -petsc_ci -no_view -dm_mat_type is -stokes_ksp_type fetidp -mx 80 -my 80 -stokes_ksp_converged_reason -stokes_ksp_rtol 1.0e-8 -ppcell 2 -nt 4 -randomize_coords -stokes_ksp_error_if_not_converged -stokes_fetidp_bddc_pc_bddc_coarse_redundant_pc_type svd  > ex70_fetidp.tmp 2> runex70_fetidp.err
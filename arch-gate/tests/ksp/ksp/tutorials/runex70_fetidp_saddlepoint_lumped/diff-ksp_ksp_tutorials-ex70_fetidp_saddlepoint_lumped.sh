@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v atomic' -f $'grep -v atomic'  /root/repo/src/ksp/ksp/tutorials/output/ex70_fetidp_saddlepoint_lumped.out ex70_fetidp_saddlepoint_lumped.tmp > diff-runex70_fetidp_saddlepoint_lumped.out 2> diff-runex70_fetidp_saddlepoint_lumped.out
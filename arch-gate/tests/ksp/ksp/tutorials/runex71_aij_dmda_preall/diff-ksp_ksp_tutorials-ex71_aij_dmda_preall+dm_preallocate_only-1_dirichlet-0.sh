@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/CONVERGED_RTOL iterations 7/CONVERGED_RTOL iterations 6/g"'  /root/repo/src/ksp/ksp/tutorials/output/ex71_aij_dmda_preall.out ex71_aij_dmda_preall.tmp > diff-runex71_aij_dmda_preall.out 2> diff-runex71_aij_dmda_preall.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex71 -petsc_ci -pde_type Poisson -dim 1 -cells 6 -pc_type none -ksp_converged_reason -dm_mat_type aij  -dm_preallocate_only 0 -dirichlet 0 > ex71_aij_dmda_preall.tmp 2> runex71_aij_dmda_preall.err
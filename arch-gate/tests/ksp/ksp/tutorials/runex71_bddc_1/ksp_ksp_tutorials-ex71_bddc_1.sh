@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex71 -petsc_ci -pde_type Poisson -dim 3 -dirichlet 0 -ksp_view -pc_bddc_coarse_redundant_pc_type svd -ksp_error_if_not_converged  > ex71_bddc_1.tmp 2> runex71_bddc_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant HERMITIAN"'  /root/repo/src/ksp/ksp/tutorials/output/ex71_bddc_elast.out ex71_bddc_elast.tmp > diff-runex71_bddc_elast.out 2> diff-runex71_bddc_elast.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant HERMITIAN"'  /root/repo/src/ksp/ksp/tutorials/output/ex71_bddc_elast_3lev.out ex71_bddc_elast_3lev.tmp > diff-runex71_bddc_elast_3lev-0.out 2> diff-runex71_bddc_elast_3lev-0.out || /root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant HERMITIAN"'  /root/repo/src/ksp/ksp/tutorials/output/ex71_bddc_elast_3lev_alt.out ex71_bddc_elast_3lev.tmp > diff-runex71_bddc_elast_3lev.out 2> diff-runex71_bddc_elast_3lev.out
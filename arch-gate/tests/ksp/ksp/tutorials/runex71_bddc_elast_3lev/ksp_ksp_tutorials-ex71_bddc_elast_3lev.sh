@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex71 -petsc_ci -pde_type Elasticity -cells 7,9,8 -dim 3 -ksp_view -pc_bddc_levels 1 -pc_bddc_coarsening_ratio 1 -ksp_error_if_not_converged -pc_bddc_monolithic -pc_bddc_use_faces -pc_bddc_coarse_pc_bddc_corner_selection  > ex71_bddc_elast_3lev.tmp 2> runex71_bddc_elast_3lev.err
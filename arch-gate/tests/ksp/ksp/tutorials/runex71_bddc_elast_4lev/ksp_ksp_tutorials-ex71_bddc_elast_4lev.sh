@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex71 -petsc_ci -pde_type Elasticity -cells 7,9,8 -dim 3 -ksp_view -pc_bddc_levels 2 -pc_bddc_coarsening_ratio 2 -ksp_error_if_not_converged -pc_bddc_monolithic -pc_bddc_use_faces -pc_bddc_coarse_pc_bddc_corner_selection -pc_bddc_coarse_l1_pc_bddc_corner_selection -mat_partitioning_type average -options_left 0  > ex71_bddc_elast_4lev.tmp 2> runex71_bddc_elast_4lev.err
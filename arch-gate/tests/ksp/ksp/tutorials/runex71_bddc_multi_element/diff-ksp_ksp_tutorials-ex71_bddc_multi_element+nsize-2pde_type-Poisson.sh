@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex71_bddc_multi_element.out ex71_bddc_multi_element.tmp > diff-runex71_bddc_multi_element.out 2> diff-runex71_bddc_multi_element.out
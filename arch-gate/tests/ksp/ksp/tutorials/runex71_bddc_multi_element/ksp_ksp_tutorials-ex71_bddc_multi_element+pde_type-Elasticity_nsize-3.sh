@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex71 -petsc_ci -cells 3,3,3 -dim 3 -ksp_error_if_not_converged -multi_element -ksp_converged_reason  -pde_type Elasticity > ex71_bddc_multi_element.tmp 2> runex71_bddc_multi_element.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex71 -petsc_ci -cells 2,2 -dim 2 -ksp_error_if_not_converged -multi_element -pc_bddc_local_mat_graph_square 4 -ksp_converged_reason  > ex71_bddc_multi_square.tmp 2> runex71_bddc_multi_square.err
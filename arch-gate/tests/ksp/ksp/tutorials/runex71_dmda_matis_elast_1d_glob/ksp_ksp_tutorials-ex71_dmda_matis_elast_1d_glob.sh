@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 9  ../ex71 -petsc_ci -assembled_view -pc_bddc_coarse_redundant_pc_type svd -ksp_error_if_not_converged -dim 1 -cells 12 -pde_type Elasticity -use_global  > ex71_dmda_matis_elast_1d_glob.tmp 2> runex71_dmda_matis_elast_1d_glob.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex71_dmda_matis_elast_3d.out ex71_dmda_matis_elast_3d_loc.tmp > diff-runex71_dmda_matis_elast_3d_loc.out 2> diff-runex71_dmda_matis_elast_3d_loc.out
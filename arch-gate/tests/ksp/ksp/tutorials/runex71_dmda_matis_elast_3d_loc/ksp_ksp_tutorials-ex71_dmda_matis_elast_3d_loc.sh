@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 9  ../ex71 -petsc_ci -assembled_view -pc_bddc_coarse_redundant_pc_type svd -ksp_error_if_not_converged -dim 3 -cells 3,3,3 -pde_type Elasticity  > ex71_dmda_matis_elast_3d_loc.tmp 2> runex71_dmda_matis_elast_3d_loc.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex71_dmda_matis_poiss_3d.out ex71_dmda_matis_poiss_3d_glob.tmp > diff-runex71_dmda_matis_poiss_3d_glob.out 2> diff-runex71_dmda_matis_poiss_3d_glob.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant HERMITIAN"'  /root/repo/src/ksp/ksp/tutorials/output/ex71_fetidp_elast.out ex71_fetidp_elast.tmp > diff-runex71_fetidp_elast.out 2> diff-runex71_fetidp_elast.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant HERMITIAN"'  /root/repo/src/ksp/ksp/tutorials/output/ex71_gdsw_poisson.out ex71_gdsw_poisson.tmp > diff-runex71_gdsw_poisson.out 2> diff-runex71_gdsw_poisson.out
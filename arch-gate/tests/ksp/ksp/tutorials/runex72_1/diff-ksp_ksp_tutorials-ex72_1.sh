@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex72_1.out ex72_1.tmp > diff-runex72_1.out 2> diff-runex72_1.out
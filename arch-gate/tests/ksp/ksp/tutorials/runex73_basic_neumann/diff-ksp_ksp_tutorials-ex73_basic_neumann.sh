@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex73_basic_neumann.out ex73_basic_neumann.tmp > diff-runex73_basic_neumann.out 2> diff-runex73_basic_neumann.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex73 -petsc_ci -tid 0 -ksp_monitor_short -pc_type telescope -telescope_ksp_max_it 100000 -telescope_pc_type jacobi -telescope_ksp_type fgmres -telescope_ksp_monitor_short -ksp_type gcr -bc_type neumann  > ex73_basic_neumann.tmp 2> runex73_basic_neumann.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex73 -petsc_ci -tid 2 -ksp_monitor_short -ksp_type gcr -pc_type mg -pc_mg_levels 3 -level_nrefs 3 -ndecomps 2 -mg_coarse_pc_type telescope -mg_coarse_pc_telescope_use_coarse_dm -mg_coarse_telescope_pc_type mg -mg_coarse_telescope_pc_mg_levels 3 -level_comm_red_factor 6 -mg_coarse_telescope_mg_coarse_pc_type lu  > ex73_mg_2lv_2mg.tmp 2> runex73_mg_2lv_2mg.err
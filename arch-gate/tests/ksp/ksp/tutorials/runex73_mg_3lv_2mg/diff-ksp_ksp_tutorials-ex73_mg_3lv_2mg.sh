@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex73_mg_3lv_2mg.out ex73_mg_3lv_2mg.tmp > diff-runex73_mg_3lv_2mg.out 2> diff-runex73_mg_3lv_2mg.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex73_mg_3lv_2mg_customcommsize.out ex73_mg_3lv_2mg_customcommsize.tmp > diff-runex73_mg_3lv_2mg_customcommsize.out 2> diff-runex73_mg_3lv_2mg_customcommsize.out
@@ -0,0 +1,68 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+executable='../ex74'
+testname='runex74_1'
+label='ksp_ksp_tutorials-ex74_1'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter=''
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+# -petsc_ci must be a command line argument because if it is from the environment it will be listed by PetscOptionsMonitor()
+args='-petsc_ci -a 0.1 -dt .125 -niter 5 -imax 40 -ksp_monitor_short -pc_type pbjacobi -irk_type gauss -irk_nstages 2 -ksp_atol 1e-6'
+diff_args=''
+timeoutfactor=1
+export PETSC_OPTIONS="${PETSC_OPTIONS} -check_pointer_intensity 0 -error_output_stdout -malloc_dump -checkfunctionlist -use_gpu_aware_mpi 0 -nox_warning"
+
+mpiexec=${PETSCMPIEXEC:-"/usr/bin/mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+mpiexec_tail=''
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags} ${diff_args}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-1}
+vec_mdot_use_gemv_in=${vec_mdot_use_gemv:-0 1}
+vec_maxpy_use_gemv_in=${vec_maxpy_use_gemv:-0 1}
+
+
+for insize in ${nsize_in}; do
+   for ivec_mdot_use_gemv in ${vec_mdot_use_gemv_in}; do
+      for ivec_maxpy_use_gemv in ${vec_maxpy_use_gemv_in}; do
+
+         petsc_testrun "${mpiexec} -n ${insize} ${mpiexec_tail} ${executable} ${args}  -vec_mdot_use_gemv ${ivec_mdot_use_gemv} -vec_maxpy_use_gemv ${ivec_maxpy_use_gemv}" ex74_1.tmp ${testname}.err "${label}+vec_mdot_use_gemv-${ivec_mdot_use_gemv}_vec_maxpy_use_gemv-${ivec_maxpy_use_gemv}" 
+         res=$?
+
+         if test $res = 0; then
+            petsc_testrun "${diff_exe} /root/repo/src/ksp/ksp/tutorials/output/ex74_1.out ex74_1.tmp > diff-${testname}-0.out 2> diff-${testname}-0.out || ${diff_exe} /root/repo/src/ksp/ksp/tutorials/output/ex74_1_alt.out ex74_1.tmp > diff-${testname}-1.out 2> diff-${testname}-1.out || ${diff_exe} /root/repo/src/ksp/ksp/tutorials/output/ex74_1_alt_2.out ex74_1.tmp > diff-${testname}-2.out 2> diff-${testname}-2.out || ${diff_exe} /root/repo/src/ksp/ksp/tutorials/output/ex74_1_alt_3.out ex74_1.tmp > diff-${testname}-3.out 2> diff-${testname}-3.out || ${diff_exe} /root/repo/src/ksp/ksp/tutorials/output/ex74_1_alt_4.out ex74_1.tmp > diff-${testname}-4.out 2> diff-${testname}-4.out || ${diff_exe} /root/repo/src/ksp/ksp/tutorials/output/ex74_1_alt_5.out ex74_1.tmp" diff-${testname}.out diff-${testname}.out diff-${label}+vec_mdot_use_gemv-${ivec_mdot_use_gemv}_vec_maxpy_use_gemv-${ivec_maxpy_use_gemv} ""
+         else
+            petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+         fi
+
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex74 -petsc_ci -a 0.1 -dt .125 -niter 5 -imax 40 -ksp_monitor_short -pc_type pbjacobi -irk_type gauss -irk_nstages 2 -ksp_atol 1e-6  -vec_mdot_use_gemv 0 -vec_maxpy_use_gemv 1 > ex74_1.tmp 2> runex74_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex74_2.out ex74_2.tmp > diff-runex74_2-0.out 2> diff-runex74_2-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex74_2_alt.out ex74_2.tmp > diff-runex74_2-1.out 2> diff-runex74_2-1.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex74_2_alt_2.out ex74_2.tmp > diff-runex74_2-2.out 2> diff-runex74_2-2.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex74_2_alt_3.out ex74_2.tmp > diff-runex74_2.out 2> diff-runex74_2.out
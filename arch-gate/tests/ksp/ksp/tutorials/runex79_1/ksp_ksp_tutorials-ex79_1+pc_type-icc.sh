@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex79 -petsc_ci -ksp_type preonly  -pc_type icc > ex79_1.tmp 2> runex79_1.err
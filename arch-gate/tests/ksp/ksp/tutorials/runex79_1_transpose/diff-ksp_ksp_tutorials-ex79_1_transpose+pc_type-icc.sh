@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex77_preonly.out ex79_1_transpose.tmp > diff-runex79_1_transpose.out 2> diff-runex79_1_transpose.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex79 -petsc_ci -transpose -ksp_type preonly  -pc_type icc > ex79_1_transpose.tmp 2> runex79_1_transpose.err
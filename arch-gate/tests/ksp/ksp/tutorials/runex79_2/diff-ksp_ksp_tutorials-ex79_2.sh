@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex77_preonly.out ex79_2.tmp > diff-runex79_2.out 2> diff-runex79_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex79 -petsc_ci -pc_type ksp -ksp_ksp_type preonly -ksp_type preonly  > ex79_2.tmp 2> runex79_2.err
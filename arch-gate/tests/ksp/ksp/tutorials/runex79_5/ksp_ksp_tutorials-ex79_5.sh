@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex79 -petsc_ci -pc_type bjacobi -pc_bjacobi_blocks 1 -sub_pc_type none -ksp_type preonly -sub_ksp_type preonly  > ex79_5.tmp 2> runex79_5.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex79 -petsc_ci -pc_type gasm -pc_gasm_total_subdomains 1 -sub_pc_type none -ksp_type preonly -sub_ksp_type preonly  > ex79_6.tmp 2> runex79_6.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex7 -petsc_ci -ksp_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex7_1.tmp 2> runex7_1.err
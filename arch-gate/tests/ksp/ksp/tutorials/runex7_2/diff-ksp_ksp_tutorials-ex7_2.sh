@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex7_2.out ex7_2.tmp > diff-runex7_2.out 2> diff-runex7_2.out
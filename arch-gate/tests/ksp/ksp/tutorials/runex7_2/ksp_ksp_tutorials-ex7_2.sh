@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex7 -petsc_ci -ksp_view ::ascii_info_detail  > ex7_2.tmp 2> runex7_2.err
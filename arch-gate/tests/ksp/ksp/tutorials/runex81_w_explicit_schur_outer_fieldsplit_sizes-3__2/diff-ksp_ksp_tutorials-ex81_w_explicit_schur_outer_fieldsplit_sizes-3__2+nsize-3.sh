@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/seq/mpi/g" -e "s/CONVERGED_ATOL/CONVERGED_RTOL/g" -e "s/ 1 MPI process/ 3 MPI processes/g" -e "s/iterations [1-2]/iterations 1/g" -e "s/hermitiantranspose/transpose/g"'  /root/repo/src/ksp/ksp/tutorials/output/ex81_w_explicit_schur_outer_fieldsplit_sizes-3__2.out ex81_w_explicit_schur_outer_fieldsplit_sizes-3__2.tmp > diff-runex81_w_explicit_schur_outer_fieldsplit_sizes-3__2.out 2> diff-runex81_w_explicit_schur_outer_fieldsplit_sizes-3__2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex81 -petsc_ci -ksp_view_mat -pc_type fieldsplit -ksp_converged_reason -fieldsplit_pc_type jacobi -pc_fieldsplit_type schur -pc_fieldsplit_schur_fact_type full -pc_fieldsplit_schur_precondition full -outer_fieldsplit_sizes 4,1  > ex81_w_explicit_schur_outer_fieldsplit_sizes-4__1.tmp 2> runex81_w_explicit_schur_outer_fieldsplit_sizes-4__1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex81 -petsc_ci -ksp_view_mat -pc_type fieldsplit -ksp_converged_reason -fieldsplit_pc_type jacobi -test_matmult -outer_fieldsplit_sizes 1,2,2  > ex81_wo_explicit_schur_outer_fieldsplit_sizes-1__2__2.tmp 2> runex81_wo_explicit_schur_outer_fieldsplit_sizes-1__2__2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/seq/mpi/g" -e "s/CONVERGED_ATOL/CONVERGED_RTOL/g" -e "s/ 1 MPI process/ 3 MPI processes/g" -e "s/iterations [4-5]/iterations 4/g" -e "s/hermitiantranspose/transpose/g"'  /root/repo/src/ksp/ksp/tutorials/output/ex81_wo_explicit_schur_outer_fieldsplit_sizes-2__2__1.out ex81_wo_explicit_schur_outer_fieldsplit_sizes-2__2__1.tmp > diff-runex81_wo_explicit_schur_outer_fieldsplit_sizes-2__2__1.out 2> diff-runex81_wo_explicit_schur_outer_fieldsplit_sizes-2__2__1.out
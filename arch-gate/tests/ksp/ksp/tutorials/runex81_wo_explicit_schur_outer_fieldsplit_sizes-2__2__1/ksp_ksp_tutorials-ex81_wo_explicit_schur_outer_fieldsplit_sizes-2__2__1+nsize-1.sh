@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex81 -petsc_ci -ksp_view_mat -pc_type fieldsplit -ksp_converged_reason -fieldsplit_pc_type jacobi -test_matmult -outer_fieldsplit_sizes 2,2,1  > ex81_wo_explicit_schur_outer_fieldsplit_sizes-2__2__1.tmp 2> runex81_wo_explicit_schur_outer_fieldsplit_sizes-2__2__1.err
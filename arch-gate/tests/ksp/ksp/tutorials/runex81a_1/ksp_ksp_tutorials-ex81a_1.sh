@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex81a -petsc_ci -pc_fieldsplit_0_fields 0,1 -pc_fieldsplit_1_fields 2,3 -pc_fieldsplit_2_fields 4 -pc_type fieldsplit -ksp_converged_reason -fieldsplit_pc_type jacobi -ksp_view  > ex81a_1.tmp 2> runex81a_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed  -e "s/CONVERGED_ATOL/CONVERGED_RTOL/g" -e "s/iterations [4-5]/iterations 4/g" -e "s/hermitiantranspose/transpose/g"'  /root/repo/src/ksp/ksp/tutorials/output/ex81a_2.out ex81a_2.tmp > diff-runex81a_2.out 2> diff-runex81a_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex81a -petsc_ci -pc_type fieldsplit -ksp_converged_reason -fieldsplit_pc_type jacobi -ksp_view  > ex81a_2.tmp 2> runex81a_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex84_1.out ex84_1.tmp > diff-runex84_1.out 2> diff-runex84_1.out
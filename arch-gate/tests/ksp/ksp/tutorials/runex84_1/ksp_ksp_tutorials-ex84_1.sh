@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex84 -petsc_ci -ksp_monitor -redistribute_ksp_monitor -ksp_view -redistribute_pc_type fieldsplit -ksp_type preonly  > ex84_1.tmp 2> runex84_1.err
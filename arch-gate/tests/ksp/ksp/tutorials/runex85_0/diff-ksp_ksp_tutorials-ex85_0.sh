@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex85_0.out ex85_0.tmp > diff-runex85_0.out 2> diff-runex85_0.out
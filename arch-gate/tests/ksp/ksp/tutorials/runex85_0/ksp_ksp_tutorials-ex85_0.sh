@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex85 -petsc_ci -mat_type aij -G_view  > ex85_0.tmp 2> runex85_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex85_1.out ex85_1.tmp > diff-runex85_1.out 2> diff-runex85_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex85 -petsc_ci -mat_type nest -G_view -mat_view_nest_sub  > ex85_1.tmp 2> runex85_1.err
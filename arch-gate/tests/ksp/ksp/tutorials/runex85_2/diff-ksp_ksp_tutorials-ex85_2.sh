@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex85_2.out ex85_2.tmp > diff-runex85_2.out 2> diff-runex85_2.out
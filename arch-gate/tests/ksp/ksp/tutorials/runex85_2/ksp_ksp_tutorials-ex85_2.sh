@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex85 -petsc_ci -mat_type aij -G_view  > ex85_2.tmp 2> runex85_2.err
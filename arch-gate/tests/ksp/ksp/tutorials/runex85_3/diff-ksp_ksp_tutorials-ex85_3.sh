@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/tutorials/output/ex85_3.out ex85_3.tmp > diff-runex85_3.out 2> diff-runex85_3.out
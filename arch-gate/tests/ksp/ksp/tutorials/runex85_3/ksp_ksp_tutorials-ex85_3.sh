@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex85 -petsc_ci -mat_type nest -G_view  > ex85_3.tmp 2> runex85_3.err
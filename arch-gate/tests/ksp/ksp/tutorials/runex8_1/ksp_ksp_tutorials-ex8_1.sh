@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex8 -petsc_ci -print_error  > ex8_1.tmp 2> runex8_1.err
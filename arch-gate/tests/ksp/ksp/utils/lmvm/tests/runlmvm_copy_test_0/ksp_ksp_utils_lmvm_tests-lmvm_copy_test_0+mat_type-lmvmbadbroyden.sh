@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../lmvm_copy_test -petsc_ci   -mat_type lmvmbadbroyden > lmvm_copy_test_0.tmp 2> runlmvm_copy_test_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/utils/lmvm/tests/output/lmvm_test.out lmvm_test_0.tmp > diff-runlmvm_test_0.out 2> diff-runlmvm_test_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../lmvm_test -petsc_ci   -mat_lmvm_scale_type scalar -type 0 > lmvm_test_0.tmp 2> runlmvm_test_0.err
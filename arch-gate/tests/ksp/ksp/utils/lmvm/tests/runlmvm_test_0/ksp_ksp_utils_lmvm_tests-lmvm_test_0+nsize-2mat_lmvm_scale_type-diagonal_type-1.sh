@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../lmvm_test -petsc_ci   -mat_lmvm_scale_type diagonal -type 1 > lmvm_test_0.tmp 2> runlmvm_test_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/ksp/utils/lmvm/tests/output/solve_performance_0.out solve_performance_0.tmp > diff-runsolve_performance_0.out 2> diff-runsolve_performance_0.out
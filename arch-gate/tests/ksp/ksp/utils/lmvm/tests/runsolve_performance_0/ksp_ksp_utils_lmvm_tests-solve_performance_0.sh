@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../solve_performance -petsc_ci -mat_lmvm_scale_type none  > solve_performance_0.tmp 2> runsolve_performance_0.err
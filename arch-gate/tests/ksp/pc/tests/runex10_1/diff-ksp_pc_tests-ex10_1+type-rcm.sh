@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/pc/tests/output/empty.out ex10_1.tmp > diff-runex10_1.out 2> diff-runex10_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex10 -petsc_ci -locality_ksp_type cg -locality_pc_type jacobi -locality_ksp_rtol 1.e-10  -type rcm > ex10_1.tmp 2> runex10_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex10 -petsc_ci -locality_ksp_type cg -locality_pc_type jacobi -locality_ksp_rtol 1.e-10  -type hilbert > ex10_2.tmp 2> runex10_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/ksp/pc/tests/output/ex3_1.out ex3_sor_seqsbaij.tmp > diff-runex3_sor_seqsbaij.out 2> diff-runex3_sor_seqsbaij.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex4 -petsc_ci   > ex4_1.tmp 2> runex4_1.err
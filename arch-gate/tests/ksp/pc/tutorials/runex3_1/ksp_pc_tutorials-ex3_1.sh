@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex3 -petsc_ci -n 100 -ksp_type cg -pc_type bjacobi -sub_pc_type icc -ksp_rtol 1.e-8  > ex3_1.tmp 2> runex3_1.err
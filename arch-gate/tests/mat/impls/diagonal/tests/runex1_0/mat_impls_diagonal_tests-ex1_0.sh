@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci   > ex1_0.tmp 2> runex1_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/bench_spmv_1.out bench_spmv_1.tmp > diff-runbench_spmv_1.out 2> diff-runbench_spmv_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../bench_spmv -petsc_ci -AMTX ${wPETSC_DIR}/share/petsc/datafiles/matrices/amesos2_test_mat0.mtx  > bench_spmv_1.tmp 2> runbench_spmv_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex101.out ex101_1.tmp > diff-runex101_1.out 2> diff-runex101_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex101 -petsc_ci   > ex101_1.tmp 2> runex101_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex102_1.out ex102_standard.tmp > diff-runex102_standard.out 2> diff-runex102_standard.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex102 -petsc_ci   -low_rank 1 -use_c 1 > ex102_standard.tmp 2> runex102_standard.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex104.out ex104_1.tmp > diff-runex104_1.out 2> diff-runex104_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex104 -petsc_ci   > ex104_1.tmp 2> runex104_1.err
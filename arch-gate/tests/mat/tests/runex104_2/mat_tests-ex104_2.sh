@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex104 -petsc_ci   > ex104_2.tmp 2> runex104_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex104 -petsc_ci -M 23 -N 31  > ex104_3.tmp 2> runex104_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex104 -petsc_ci -M 23 -N 31 -matmattransmult_mpidense_mpidense_via cyclic  > ex104_4.tmp 2> runex104_4.err
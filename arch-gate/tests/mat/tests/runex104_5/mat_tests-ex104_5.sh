@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex104 -petsc_ci -M 23 -N 31 -matmattransmult_mpidense_mpidense_via allgatherv  > ex104_5.tmp 2> runex104_5.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex107 -petsc_ci   > ex107_1.tmp 2> runex107_1.err
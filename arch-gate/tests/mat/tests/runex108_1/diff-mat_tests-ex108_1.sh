@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex108_1.tmp > diff-runex108_1.out 2> diff-runex108_1.out
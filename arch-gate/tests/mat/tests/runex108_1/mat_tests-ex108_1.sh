@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex108 -petsc_ci   > ex108_1.tmp 2> runex108_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex109 -petsc_ci -M 10 -N 10  > ex109_1.tmp 2> runex109_1.err
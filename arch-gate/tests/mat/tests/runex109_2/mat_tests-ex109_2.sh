@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex109 -petsc_ci   > ex109_2.tmp 2> runex109_2.err
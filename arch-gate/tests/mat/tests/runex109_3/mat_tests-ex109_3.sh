@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex109 -petsc_ci -matmattransmult_mpidense_mpidense_via cyclic  > ex109_3.tmp 2> runex109_3.err
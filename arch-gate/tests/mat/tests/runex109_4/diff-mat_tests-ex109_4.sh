@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex109.out ex109_4.tmp > diff-runex109_4.out 2> diff-runex109_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex109 -petsc_ci -test_userAPI  > ex109_4.tmp 2> runex109_4.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex109 -petsc_ci -test_userAPI  > ex109_5.tmp 2> runex109_5.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex109 -petsc_ci -m 5 -n 3  > ex109_6.tmp 2> runex109_6.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex110 -petsc_ci   > ex110_1.tmp 2> runex110_1.err
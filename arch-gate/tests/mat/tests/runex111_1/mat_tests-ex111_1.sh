@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex111 -petsc_ci   > ex111_1.tmp 2> runex111_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex111_2.out ex111_2.tmp > diff-runex111_2.out 2> diff-runex111_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex111 -petsc_ci -matmatmatmult_via scalable  > ex111_2.tmp 2> runex111_2.err
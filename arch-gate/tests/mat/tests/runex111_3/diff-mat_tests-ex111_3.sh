@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex111_1.out ex111_3.tmp > diff-runex111_3.out 2> diff-runex111_3.out
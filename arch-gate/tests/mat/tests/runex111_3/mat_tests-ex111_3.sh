@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex111 -petsc_ci -matmatmatmult_via nonscalable  > ex111_3.tmp 2> runex111_3.err
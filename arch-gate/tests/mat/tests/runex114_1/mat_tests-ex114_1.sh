@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex114 -petsc_ci   > ex114_1.tmp 2> runex114_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex114.out ex114_2.tmp > diff-runex114_2.out 2> diff-runex114_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex114 -petsc_ci -testcase 1  > ex114_2.tmp 2> runex114_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex114 -petsc_ci -testcase 2  > ex114_3.tmp 2> runex114_3.err
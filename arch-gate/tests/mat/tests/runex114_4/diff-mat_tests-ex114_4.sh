@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex114_4.out ex114_4.tmp > diff-runex114_4.out 2> diff-runex114_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex114 -petsc_ci -testcase 3  > ex114_4.tmp 2> runex114_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex114_5.out ex114_5.tmp > diff-runex114_5.out 2> diff-runex114_5.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex114 -petsc_ci -testcase 0  > ex114_5.tmp 2> runex114_5.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex114_6.out ex114_6.tmp > diff-runex114_6.out 2> diff-runex114_6.out
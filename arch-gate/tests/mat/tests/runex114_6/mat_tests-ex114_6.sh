@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex114 -petsc_ci -testcase 1  > ex114_6.tmp 2> runex114_6.err
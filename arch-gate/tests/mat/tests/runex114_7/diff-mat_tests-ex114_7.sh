@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex114_7.out ex114_7.tmp > diff-runex114_7.out 2> diff-runex114_7.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex114 -petsc_ci -testcase 2  > ex114_7.tmp 2> runex114_7.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex114_8.out ex114_8.tmp > diff-runex114_8.out 2> diff-runex114_8.out
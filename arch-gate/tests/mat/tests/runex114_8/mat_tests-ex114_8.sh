@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex114 -petsc_ci -testcase 3  > ex114_8.tmp 2> runex114_8.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex11_2.out ex11_2.tmp > diff-runex11_2.out 2> diff-runex11_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex11 -petsc_ci -mat_type seqbaij -mat_block_size 5  > ex11_2.tmp 2> runex11_2.err
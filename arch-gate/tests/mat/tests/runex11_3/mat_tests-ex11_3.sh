@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex11 -petsc_ci -keep_nonzero_pattern  > ex11_3.tmp 2> runex11_3.err
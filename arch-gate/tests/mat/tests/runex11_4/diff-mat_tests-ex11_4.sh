@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex11_4.out ex11_4.tmp > diff-runex11_4.out 2> diff-runex11_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex122 -petsc_ci   > ex122_1.tmp 2> runex122_1.err
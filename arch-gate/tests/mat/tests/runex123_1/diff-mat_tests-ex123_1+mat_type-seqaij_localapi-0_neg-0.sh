@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type | grep -v "Mat Object"' -j /root/repo/src/mat/tests/output/ex123_1.out ex123_1.tmp > diff-runex123_1.out 2> diff-runex123_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex123 -petsc_ci   -mat_type seqaij -localapi 0 -neg 1 > ex123_1.tmp 2> runex123_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type | grep -v "Mat Object"' -j /root/repo/src/mat/tests/output/ex123_2.out ex123_2.tmp > diff-runex123_2.out 2> diff-runex123_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 7  ../ex123 -petsc_ci -mat_type mpiaij  -localapi 0 -neg 0 > ex123_2.tmp 2> runex123_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type | grep -v "Mat Object"' -j /root/repo/src/mat/tests/output/ex123_3.out ex123_3.tmp > diff-runex123_3.out 2> diff-runex123_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex123 -petsc_ci -mat_type mpiaij -loc  -localapi 1 -neg 0 > ex123_3.tmp 2> runex123_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type | grep -v "Mat Object"' -j /root/repo/src/mat/tests/output/ex123_4.out ex123_4.tmp > diff-runex123_4.out 2> diff-runex123_4.out
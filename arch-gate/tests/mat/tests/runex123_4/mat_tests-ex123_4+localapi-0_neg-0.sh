@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex123 -petsc_ci -mat_type mpiaij -loc -locdiag 0  -localapi 0 -neg 0 > ex123_4.tmp 2> runex123_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type | grep -v "Mat Object"' -j /root/repo/src/mat/tests/output/ex123_matis.out ex123_matis.tmp > diff-runex123_matis.out 2> diff-runex123_matis.out
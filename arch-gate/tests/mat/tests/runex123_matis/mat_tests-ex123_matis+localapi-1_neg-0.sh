@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex123 -petsc_ci -mat_type is  -localapi 1 -neg 0 > ex123_matis.tmp 2> runex123_matis.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex125.out ex125_2.tmp > diff-runex125_2.out 2> diff-runex125_2.out
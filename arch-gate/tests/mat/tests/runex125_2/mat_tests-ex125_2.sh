@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex125 -petsc_ci -mat_solver_type petsc  > ex125_2.tmp 2> runex125_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex128 -petsc_ci   > ex128_1.tmp 2> runex128_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex128 -petsc_ci -cholesky -triangular_solve  > ex128_2.tmp 2> runex128_2.err
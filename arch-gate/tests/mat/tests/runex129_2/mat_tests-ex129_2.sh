@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex129 -petsc_ci -dm_mat_type aij -dof 1 -inplacelu  > ex129_2.tmp 2> runex129_2.err
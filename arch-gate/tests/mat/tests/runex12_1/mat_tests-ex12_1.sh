@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex12 -petsc_ci   > ex12_1.tmp 2> runex12_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex12 -petsc_ci -mat_type mpiaij -keep_nonzero_pattern  > ex12_3.tmp 2> runex12_3.err
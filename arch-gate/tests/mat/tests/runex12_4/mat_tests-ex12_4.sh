@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex12 -petsc_ci -keep_nonzero_pattern -mat_type mpibaij -mat_block_size 3  > ex12_4.tmp 2> runex12_4.err
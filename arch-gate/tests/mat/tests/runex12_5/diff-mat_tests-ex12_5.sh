@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v " MPI process"'  /root/repo/src/mat/tests/output/ex12_5.out ex12_5.tmp > diff-runex12_5.out 2> diff-runex12_5.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex12 -petsc_ci -mat_type mpibaij -mat_block_size 3 -mat_view  > ex12_5.tmp 2> runex12_5.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex132 -petsc_ci -view  > ex132_1.tmp 2> runex132_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex132 -petsc_ci -view  > ex132_1_par.tmp 2> runex132_1_par.err
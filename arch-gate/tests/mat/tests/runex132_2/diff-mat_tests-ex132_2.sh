@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v " type:" | grep -v "Mat Object"' -j /root/repo/src/mat/tests/output/ex132_2.out ex132_2.tmp > diff-runex132_2.out 2> diff-runex132_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex132 -petsc_ci -view -mat_nonsym  > ex132_2.tmp 2> runex132_2.err
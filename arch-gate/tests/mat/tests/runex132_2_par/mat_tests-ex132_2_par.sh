@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex132 -petsc_ci -view -mat_nonsym  > ex132_2_par.tmp 2> runex132_2_par.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex134 -petsc_ci -mat_ignore_lower_triangular  > ex134_1.tmp 2> runex134_1.err
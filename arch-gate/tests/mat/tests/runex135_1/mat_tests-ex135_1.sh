@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex135 -petsc_ci -n 1000 -mat_view ascii::ascii_info_detail  > ex135_1.tmp 2> runex135_1.err
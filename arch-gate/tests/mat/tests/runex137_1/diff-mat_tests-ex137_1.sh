@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex137_1.out ex137_1.tmp > diff-runex137_1.out 2> diff-runex137_1.out
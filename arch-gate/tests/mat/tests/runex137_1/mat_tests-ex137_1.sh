@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex137 -petsc_ci   > ex137_1.tmp 2> runex137_1.err
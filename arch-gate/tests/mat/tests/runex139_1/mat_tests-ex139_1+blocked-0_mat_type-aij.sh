@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex139 -petsc_ci   -blocked 0 -mat_type aij > ex139_1.tmp 2> runex139_1.err
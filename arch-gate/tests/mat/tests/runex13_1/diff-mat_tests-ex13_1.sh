@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v " MPI process"'  /root/repo/src/mat/tests/output/ex13_1.out ex13_1.tmp > diff-runex13_1.out 2> diff-runex13_1.out
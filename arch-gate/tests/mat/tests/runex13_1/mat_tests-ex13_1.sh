@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex13 -petsc_ci   > ex13_1.tmp 2> runex13_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex141 -petsc_ci   > ex141_1.tmp 2> runex141_1.err
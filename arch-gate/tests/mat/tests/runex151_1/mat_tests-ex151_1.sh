@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex151 -petsc_ci -view_sparse  > ex151_1.tmp 2> runex151_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex151 -petsc_ci -view_sparse  > ex151_2.tmp 2> runex151_2.err
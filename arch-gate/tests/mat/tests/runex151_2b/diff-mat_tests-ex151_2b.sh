@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex151_2b.out ex151_2b.tmp > diff-runex151_2b.out 2> diff-runex151_2b.out
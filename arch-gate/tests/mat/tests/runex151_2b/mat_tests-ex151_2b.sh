@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex151 -petsc_ci -mat_type baij -view_sparse  > ex151_2b.tmp 2> runex151_2b.err
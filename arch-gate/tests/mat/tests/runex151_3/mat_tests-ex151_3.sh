@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex151 -petsc_ci -view_sparse  > ex151_3.tmp 2> runex151_3.err
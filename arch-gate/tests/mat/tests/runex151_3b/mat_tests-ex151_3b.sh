@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex151 -petsc_ci -mat_type baij -view_sparse  > ex151_3b.tmp 2> runex151_3b.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex151_dense.out ex151_dense.tmp > diff-runex151_dense.out 2> diff-runex151_dense.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex151 -petsc_ci -mat_type dense  > ex151_dense.tmp 2> runex151_dense.err
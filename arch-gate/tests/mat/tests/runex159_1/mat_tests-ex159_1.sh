@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex159 -petsc_ci   > ex159_1.tmp 2> runex159_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex159 -petsc_ci -nest  > ex159_nest.tmp 2> runex159_nest.err
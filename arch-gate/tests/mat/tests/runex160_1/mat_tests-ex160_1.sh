@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex160 -petsc_ci   > ex160_1.tmp 2> runex160_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex161 -petsc_ci   > ex161_1.tmp 2> runex161_1.err
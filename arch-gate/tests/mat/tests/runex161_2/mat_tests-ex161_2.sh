@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex161 -petsc_ci -matmattransmult_via color  > ex161_2.tmp 2> runex161_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex161 -petsc_ci -matmattransmult_via color -matden2sp_brows 3  > ex161_3.tmp 2> runex161_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex161.out ex161_4.tmp > diff-runex161_4.out 2> diff-runex161_4.out
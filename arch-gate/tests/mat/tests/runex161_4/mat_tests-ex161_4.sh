@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex161 -petsc_ci -matmattransmult_via color -matrart_via r*art  > ex161_4.tmp 2> runex161_4.err
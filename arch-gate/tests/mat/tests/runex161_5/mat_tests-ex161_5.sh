@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex161 -petsc_ci -matmattransmult_via color -matrart_via coloring_rart  > ex161_5.tmp 2> runex161_5.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex162 -petsc_ci   > ex162_1.tmp 2> runex162_1.err
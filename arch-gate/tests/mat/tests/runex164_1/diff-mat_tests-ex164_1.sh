@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex164_1.out ex164_1.tmp > diff-runex164_1.out 2> diff-runex164_1.out
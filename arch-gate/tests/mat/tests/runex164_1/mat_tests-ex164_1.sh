@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex164 -petsc_ci   > ex164_1.tmp 2> runex164_1.err
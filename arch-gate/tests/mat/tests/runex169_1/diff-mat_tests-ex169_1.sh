@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex169_1.out ex169_1.tmp > diff-runex169_1.out 2> diff-runex169_1.out
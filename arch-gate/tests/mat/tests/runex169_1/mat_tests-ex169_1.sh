@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex169 -petsc_ci -f0 ${wPETSC_DIR}/share/petsc/datafiles/matrices/ns-real-int32-float64 -malloc_dump  > ex169_1.tmp 2> runex169_1.err
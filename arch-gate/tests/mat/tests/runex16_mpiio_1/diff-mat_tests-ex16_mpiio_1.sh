@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex16.out ex16_mpiio_1.tmp > diff-runex16_mpiio_1.out 2> diff-runex16_mpiio_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex16 -petsc_ci -viewer_binary_mpiio 1  > ex16_mpiio_1.tmp 2> runex16_mpiio_1.err
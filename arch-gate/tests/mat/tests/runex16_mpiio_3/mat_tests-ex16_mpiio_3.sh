@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex16 -petsc_ci -viewer_binary_mpiio 1  > ex16_mpiio_3.tmp 2> runex16_mpiio_3.err
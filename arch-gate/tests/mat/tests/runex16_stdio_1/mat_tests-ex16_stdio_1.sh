@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex16 -petsc_ci -viewer_binary_mpiio 0 -mat_type seqdense  > ex16_stdio_1.tmp 2> runex16_stdio_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex16 -petsc_ci -viewer_binary_mpiio 0  > ex16_stdio_3.tmp 2> runex16_stdio_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex16 -petsc_ci -viewer_binary_mpiio 0  > ex16_stdio_4.tmp 2> runex16_stdio_4.err
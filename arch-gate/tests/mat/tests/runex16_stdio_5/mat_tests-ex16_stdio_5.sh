@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex16 -petsc_ci -viewer_binary_mpiio 0  > ex16_stdio_5.tmp 2> runex16_stdio_5.err
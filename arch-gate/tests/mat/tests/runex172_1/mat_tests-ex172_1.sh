@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex172 -petsc_ci   > ex172_1.tmp 2> runex172_1.err
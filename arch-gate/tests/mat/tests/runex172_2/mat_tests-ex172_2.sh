@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex172 -petsc_ci -different  > ex172_2.tmp 2> runex172_2.err
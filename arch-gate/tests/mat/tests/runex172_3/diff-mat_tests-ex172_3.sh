@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex172.out ex172_3.tmp > diff-runex172_3.out 2> diff-runex172_3.out
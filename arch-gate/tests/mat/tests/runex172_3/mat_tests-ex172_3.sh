@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex172 -petsc_ci -skip  > ex172_3.tmp 2> runex172_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex172.out ex172_4.tmp > diff-runex172_4.out 2> diff-runex172_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex172 -petsc_ci -different -skip  > ex172_4.tmp 2> runex172_4.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex172 -petsc_ci -mat_type baij> ex172.tmp 2>&1  > ex172_baij.tmp 2> runex172_baij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex172.out ex172_sbaij.tmp > diff-runex172_sbaij.out 2> diff-runex172_sbaij.out
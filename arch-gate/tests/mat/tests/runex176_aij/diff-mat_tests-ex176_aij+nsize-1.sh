@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex176_aij.tmp > diff-runex176_aij.out 2> diff-runex176_aij.out
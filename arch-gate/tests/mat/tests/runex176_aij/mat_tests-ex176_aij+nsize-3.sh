@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex176 -petsc_ci   > ex176_aij.tmp 2> runex176_aij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex178_1.out ex178_1.tmp > diff-runex178_1.out 2> diff-runex178_1.out
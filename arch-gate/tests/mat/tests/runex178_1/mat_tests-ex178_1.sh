@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex178 -petsc_ci   > ex178_1.tmp 2> runex178_1.err
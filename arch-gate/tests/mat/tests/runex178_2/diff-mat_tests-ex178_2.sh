@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex178_2.out ex178_2.tmp > diff-runex178_2.out 2> diff-runex178_2.out
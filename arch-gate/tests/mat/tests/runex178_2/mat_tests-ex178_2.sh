@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex178 -petsc_ci   > ex178_2.tmp 2> runex178_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex178_5.out ex178_5.tmp > diff-runex178_5.out 2> diff-runex178_5.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex178 -petsc_ci   > ex178_5.tmp 2> runex178_5.err
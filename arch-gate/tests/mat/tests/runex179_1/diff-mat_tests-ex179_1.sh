@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex179_1.out ex179_1.tmp > diff-runex179_1.out 2> diff-runex179_1.out
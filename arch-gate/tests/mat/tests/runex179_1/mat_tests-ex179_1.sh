@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex179 -petsc_ci   > ex179_1.tmp 2> runex179_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex180 -petsc_ci -mat_type sbaij -f ${wPETSC_DIR}/share/petsc/datafiles/matrices/ns-real-int32-float64 -malloc_dump  > ex180_6.tmp 2> runex180_6.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex181 -petsc_ci   > ex181_1.tmp 2> runex181_1.err
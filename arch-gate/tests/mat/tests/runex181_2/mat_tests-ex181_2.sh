@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex181 -petsc_ci -detect_bug  > ex181_2.tmp 2> runex181_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex182 -petsc_ci -info  > ex182_1.tmp 2> runex182_1.err
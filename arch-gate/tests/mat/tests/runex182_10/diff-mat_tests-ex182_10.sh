@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h malloc | sort -b'  /root/repo/src/mat/tests/output/ex182_10.out ex182_10.tmp > diff-runex182_10.out 2> diff-runex182_10.out
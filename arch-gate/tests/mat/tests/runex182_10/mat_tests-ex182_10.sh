@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex182 -petsc_ci -info :~sys  > ex182_10.tmp 2> runex182_10.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sort -b'  /root/repo/src/mat/tests/output/ex182_11.out ex182_11.tmp > diff-runex182_11.out 2> diff-runex182_11.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex182 -petsc_ci -info :~sys,mat  > ex182_11.tmp 2> runex182_11.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex182 -petsc_ci -info ex182info:sys,mat  > ex182_12.tmp 2> runex182_12.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h "ex182info.1" | sort -b'  /root/repo/src/mat/tests/output/ex182_13.out ex182_13.tmp > diff-runex182_13.out 2> diff-runex182_13.out
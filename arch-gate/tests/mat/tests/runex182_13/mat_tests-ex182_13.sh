@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex182 -petsc_ci -info ex182info:mat:~self  > ex182_13.tmp 2> runex182_13.err
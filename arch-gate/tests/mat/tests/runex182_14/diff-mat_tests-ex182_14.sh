@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h -ve Running -ve MPI_Comm -ve Initialize -ve communicator -ve HostName -ve PetscSetFPTrap -ve PetscDetermineInitialFPTrap "ex182info.1" | sort -b'  /root/repo/src/mat/tests/output/ex182_14.out ex182_14.tmp > diff-runex182_14.out 2> diff-runex182_14.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex182 -petsc_ci -info ex182info::~self  > ex182_14.tmp 2> runex182_14.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h -ve Running -ve MPI_Comm -ve Initialize -ve communicator -ve HostName -ve PetscSetFPTrap -ve PetscDetermineInitialFPTrap -ve libpetscbamg "ex182info.1" | grep -v PetscBLASSetNumThreads | sort -b'  /root/repo/src/mat/tests/output/ex182_15.out ex182_15.tmp > diff-runex182_15.out 2> diff-runex182_15.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex182 -petsc_ci -info ex182info::self  > ex182_15.tmp 2> runex182_15.err
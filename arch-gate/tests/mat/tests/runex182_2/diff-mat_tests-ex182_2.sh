@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h malloc "ex182info.0" | sort -b'  /root/repo/src/mat/tests/output/ex182_2.out ex182_2.tmp > diff-runex182_2.out 2> diff-runex182_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex182 -petsc_ci -info ex182info  > ex182_2.tmp 2> runex182_2.err
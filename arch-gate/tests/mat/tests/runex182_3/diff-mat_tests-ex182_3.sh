@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep malloc | sort -b'  /root/repo/src/mat/tests/output/ex182_3.out ex182_3.tmp > diff-runex182_3.out 2> diff-runex182_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex182 -petsc_ci -info -mat_type baij  > ex182_3.tmp 2> runex182_3.err
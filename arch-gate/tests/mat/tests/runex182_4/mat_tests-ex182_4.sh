@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex182 -petsc_ci -info ex182info -mat_type baij  > ex182_4.tmp 2> runex182_4.err
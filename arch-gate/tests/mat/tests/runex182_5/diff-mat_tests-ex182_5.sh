@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep malloc | sort  -b'  /root/repo/src/mat/tests/output/ex182_5.out ex182_5.tmp > diff-runex182_5.out 2> diff-runex182_5.out
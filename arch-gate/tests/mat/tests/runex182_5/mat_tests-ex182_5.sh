@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex182 -petsc_ci -info -mat_type sbaij  > ex182_5.tmp 2> runex182_5.err
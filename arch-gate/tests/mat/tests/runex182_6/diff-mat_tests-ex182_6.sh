@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h malloc "ex182info.0" | sort -b'  /root/repo/src/mat/tests/output/ex182_6.out ex182_6.tmp > diff-runex182_6.out 2> diff-runex182_6.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h malloc "ex182info.0" | grep -v Running | sort -b'  /root/repo/src/mat/tests/output/ex182_7.out ex182_7.tmp > diff-runex182_7.out 2> diff-runex182_7.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex182 -petsc_ci -info ex182info  > ex182_7.tmp 2> runex182_7.err
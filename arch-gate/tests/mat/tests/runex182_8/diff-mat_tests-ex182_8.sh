@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h malloc "ex182info.1" | sort -b'  /root/repo/src/mat/tests/output/ex182_8.out ex182_8.tmp > diff-runex182_8.out 2> diff-runex182_8.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex182 -petsc_ci -info ex182info:mat  > ex182_8.tmp 2> runex182_8.err
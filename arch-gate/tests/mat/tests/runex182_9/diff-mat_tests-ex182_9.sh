@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h -ve Running -ve MPI_Comm -ve Initialize -ve communicator -ve HostName -ve PetscSetFPTrap -ve PetscDetermineInitialFPTrap -ve libpetscbamg "ex182info.0" | grep -v PetscBLASSetNumThreads | sort -b'  /root/repo/src/mat/tests/output/ex182_9.out ex182_9.tmp > diff-runex182_9.out 2> diff-runex182_9.out
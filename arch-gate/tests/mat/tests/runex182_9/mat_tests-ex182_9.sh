@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex182 -petsc_ci -info ex182info:sys  > ex182_9.tmp 2> runex182_9.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex183_2_1.out ex183_1.tmp > diff-runex183_1.out 2> diff-runex183_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex183 -petsc_ci -total_subdomains 1  > ex183_1.tmp 2> runex183_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex183 -petsc_ci -total_subdomains 2  > ex183_2.tmp 2> runex183_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex183 -petsc_ci -total_subdomains 2  > ex183_3.tmp 2> runex183_3.err
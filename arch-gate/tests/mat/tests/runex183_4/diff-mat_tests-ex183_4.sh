@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex183_6_2.out ex183_4.tmp > diff-runex183_4.out 2> diff-runex183_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex183 -petsc_ci -total_subdomains 2  > ex183_4.tmp 2> runex183_4.err
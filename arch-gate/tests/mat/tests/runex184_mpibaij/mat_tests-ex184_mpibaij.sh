@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex184 -petsc_ci -mat_type mpibaij -mat_size 12 -mat_block_size 3  > ex184_mpibaij.tmp 2> runex184_mpibaij.err
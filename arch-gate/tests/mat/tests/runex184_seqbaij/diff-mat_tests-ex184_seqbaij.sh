@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex184_seqbaij.out ex184_seqbaij.tmp > diff-runex184_seqbaij.out 2> diff-runex184_seqbaij.out
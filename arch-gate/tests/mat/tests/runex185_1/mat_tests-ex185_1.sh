@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex185 -petsc_ci   > ex185_1.tmp 2> runex185_1.err
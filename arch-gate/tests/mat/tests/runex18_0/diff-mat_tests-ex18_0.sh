@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_0.out ex18_0.tmp > diff-runex18_0.out 2> diff-runex18_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex18 -petsc_ci   > ex18_0.tmp 2> runex18_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_1.out ex18_1.tmp > diff-runex18_1.out 2> diff-runex18_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex18 -petsc_ci -bs 2 -nonlocal_bc  > ex18_10.tmp 2> runex18_10.err
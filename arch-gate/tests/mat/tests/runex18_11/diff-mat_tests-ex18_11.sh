@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_11.out ex18_11.tmp > diff-runex18_11.out 2> diff-runex18_11.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 7  ../ex18 -petsc_ci -bs 2 -nonlocal_bc  > ex18_11.tmp 2> runex18_11.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_12.out ex18_12.tmp > diff-runex18_12.out 2> diff-runex18_12.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex18 -petsc_ci -bs 2 -nonlocal_bc -mat_type baij  > ex18_12.tmp 2> runex18_12.err
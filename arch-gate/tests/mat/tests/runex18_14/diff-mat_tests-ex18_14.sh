@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_14.out ex18_14.tmp > diff-runex18_14.out 2> diff-runex18_14.out
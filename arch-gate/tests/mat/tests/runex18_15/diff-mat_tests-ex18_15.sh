@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_15.out ex18_15.tmp > diff-runex18_15.out 2> diff-runex18_15.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex18 -petsc_ci -bs 2 -nonlocal_bc -convname shell  > ex18_15.tmp 2> runex18_15.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_2.out ex18_2.tmp > diff-runex18_2.out 2> diff-runex18_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 7  ../ex18 -petsc_ci   > ex18_2.tmp 2> runex18_2.err
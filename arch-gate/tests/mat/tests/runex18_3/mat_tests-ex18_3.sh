@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex18 -petsc_ci -mat_type baij  > ex18_3.tmp 2> runex18_3.err
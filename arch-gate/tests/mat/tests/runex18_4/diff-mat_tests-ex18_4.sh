@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_4.out ex18_4.tmp > diff-runex18_4.out 2> diff-runex18_4.out
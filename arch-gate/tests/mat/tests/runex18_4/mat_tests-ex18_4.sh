@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex18 -petsc_ci -mat_type baij  > ex18_4.tmp 2> runex18_4.err
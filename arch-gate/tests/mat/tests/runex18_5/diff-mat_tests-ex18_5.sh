@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_5.out ex18_5.tmp > diff-runex18_5.out 2> diff-runex18_5.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 7  ../ex18 -petsc_ci -mat_type baij  > ex18_5.tmp 2> runex18_5.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_6.out ex18_6.tmp > diff-runex18_6.out 2> diff-runex18_6.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex18 -petsc_ci -bs 2 -mat_type baij  > ex18_6.tmp 2> runex18_6.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_7.out ex18_7.tmp > diff-runex18_7.out 2> diff-runex18_7.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_8.out ex18_8.tmp > diff-runex18_8.out 2> diff-runex18_8.out
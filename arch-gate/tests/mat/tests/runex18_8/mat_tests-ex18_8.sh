@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 7  ../ex18 -petsc_ci -bs 2 -mat_type baij  > ex18_8.tmp 2> runex18_8.err
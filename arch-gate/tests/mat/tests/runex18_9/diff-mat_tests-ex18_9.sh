@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_9.out ex18_9.tmp > diff-runex18_9.out 2> diff-runex18_9.out
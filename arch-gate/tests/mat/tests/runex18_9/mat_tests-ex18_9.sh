@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex18 -petsc_ci -bs 2 -nonlocal_bc  > ex18_9.tmp 2> runex18_9.err
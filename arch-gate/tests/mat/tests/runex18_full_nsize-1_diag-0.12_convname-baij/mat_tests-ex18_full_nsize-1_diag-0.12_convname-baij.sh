@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex18 -petsc_ci -zerorhs 0 -diag 0.12 -convname baij  > ex18_full_nsize-1_diag-0.12_convname-baij.tmp 2> runex18_full_nsize-1_diag-0.12_convname-baij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_full_nsize-1_diag-0.12_convname-shell.out ex18_full_nsize-1_diag-0.12_convname-shell.tmp > diff-runex18_full_nsize-1_diag-0.12_convname-shell.out 2> diff-runex18_full_nsize-1_diag-0.12_convname-shell.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex18 -petsc_ci -zerorhs 0 -diag -0.13 -convname aij  > ex18_full_nsize-3_diag--0.13_convname-aij.tmp 2> runex18_full_nsize-3_diag--0.13_convname-aij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex18_full_nsize-3_diag-0.12_convname-baij.out ex18_full_nsize-3_diag-0.12_convname-baij.tmp > diff-runex18_full_nsize-3_diag-0.12_convname-baij.out 2> diff-runex18_full_nsize-3_diag-0.12_convname-baij.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex190_1.out ex190_1.tmp > diff-runex190_1.out 2> diff-runex190_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex190 -petsc_ci -mat_type sbaij -mat_view -f ${wPETSC_DIR}/share/petsc/datafiles/matrices/ns-real-int32-float64  > ex190_3.tmp 2> runex190_3.err
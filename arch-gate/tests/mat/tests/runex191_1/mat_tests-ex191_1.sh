@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex191 -petsc_ci   > ex191_1.tmp 2> runex191_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex194 -petsc_ci   > ex194_1.tmp 2> runex194_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex195_1.out ex195_1.tmp > diff-runex195_1.out 2> diff-runex195_1.out
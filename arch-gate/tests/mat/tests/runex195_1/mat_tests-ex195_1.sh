@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex195 -petsc_ci   > ex195_1.tmp 2> runex195_1.err
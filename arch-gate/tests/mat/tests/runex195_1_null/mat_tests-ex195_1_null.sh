@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex195 -petsc_ci -test_null  > ex195_1_null.tmp 2> runex195_1_null.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex195_2.out ex195_2.tmp > diff-runex195_2.out 2> diff-runex195_2.out
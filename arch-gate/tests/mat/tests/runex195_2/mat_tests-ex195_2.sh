@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex195 -petsc_ci   > ex195_2.tmp 2> runex195_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex195_2_null.out ex195_2_null.tmp > diff-runex195_2_null.out 2> diff-runex195_2_null.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex195 -petsc_ci -test_null  > ex195_2_null.tmp 2> runex195_2_null.err
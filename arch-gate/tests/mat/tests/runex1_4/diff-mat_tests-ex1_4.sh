@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex1_1.out ex1_4.tmp > diff-runex1_4.out 2> diff-runex1_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -m 10 -n 10  > ex1_4.tmp 2> runex1_4.err
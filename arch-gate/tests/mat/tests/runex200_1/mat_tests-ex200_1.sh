@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex200 -petsc_ci   > ex200_1.tmp 2> runex200_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex202 -petsc_ci -malloc_dump  > ex202_1.tmp 2> runex202_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex203 -petsc_ci -malloc_dump  > ex203_1.tmp 2> runex203_1.err
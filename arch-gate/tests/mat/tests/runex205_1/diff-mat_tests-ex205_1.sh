@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex205_1.out ex205_1.tmp > diff-runex205_1.out 2> diff-runex205_1.out
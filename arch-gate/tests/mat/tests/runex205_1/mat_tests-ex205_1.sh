@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex205 -petsc_ci -malloc_dump  > ex205_1.tmp 2> runex205_1.err
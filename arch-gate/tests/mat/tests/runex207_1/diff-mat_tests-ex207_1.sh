@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex207_1.out ex207_1.tmp > diff-runex207_1.out 2> diff-runex207_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex207 -petsc_ci   > ex207_1.tmp 2> runex207_1.err
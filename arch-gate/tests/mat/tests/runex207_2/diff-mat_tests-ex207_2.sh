@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex207_2.out ex207_2.tmp > diff-runex207_2.out 2> diff-runex207_2.out
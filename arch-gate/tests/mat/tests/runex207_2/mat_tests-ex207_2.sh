@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex207 -petsc_ci   > ex207_2.tmp 2> runex207_2.err
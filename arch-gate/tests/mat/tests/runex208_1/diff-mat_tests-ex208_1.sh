@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex208_1.out ex208_1.tmp > diff-runex208_1.out 2> diff-runex208_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex208 -petsc_ci   > ex208_1.tmp 2> runex208_1.err
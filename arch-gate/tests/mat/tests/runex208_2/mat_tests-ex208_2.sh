@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex208 -petsc_ci   > ex208_2.tmp 2> runex208_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex208_baij.out ex208_baij.tmp > diff-runex208_baij.out 2> diff-runex208_baij.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex208 -petsc_ci -mat_type baij  > ex208_baij.tmp 2> runex208_baij.err
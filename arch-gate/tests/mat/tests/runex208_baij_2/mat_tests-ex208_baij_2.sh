@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex208 -petsc_ci -mat_type baij  > ex208_baij_2.tmp 2> runex208_baij_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex208_dense.out ex208_dense.tmp > diff-runex208_dense.out 2> diff-runex208_dense.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex208 -petsc_ci -mat_type dense  > ex208_dense.tmp 2> runex208_dense.err
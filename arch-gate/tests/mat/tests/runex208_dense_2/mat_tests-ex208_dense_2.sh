@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex208 -petsc_ci -mat_type dense  > ex208_dense_2.tmp 2> runex208_dense_2.err
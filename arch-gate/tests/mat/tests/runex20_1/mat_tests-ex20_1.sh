@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex20 -petsc_ci -conv_mat_type seqaij  > ex20_1.tmp 2> runex20_1.err
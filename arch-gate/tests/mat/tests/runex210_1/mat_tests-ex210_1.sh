@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex210 -petsc_ci   > ex210_1.tmp 2> runex210_1.err
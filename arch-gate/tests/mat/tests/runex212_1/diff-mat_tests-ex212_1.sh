@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex212_1.out ex212_1.tmp > diff-runex212_1.out 2> diff-runex212_1.out
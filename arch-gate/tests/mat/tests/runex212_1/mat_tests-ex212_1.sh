@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex212 -petsc_ci   > ex212_1.tmp 2> runex212_1.err
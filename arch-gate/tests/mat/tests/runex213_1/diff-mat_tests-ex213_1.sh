@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex213_1.out ex213_1.tmp > diff-runex213_1.out 2> diff-runex213_1.out
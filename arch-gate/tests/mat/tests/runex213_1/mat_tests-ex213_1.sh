@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex213 -petsc_ci   > ex213_1.tmp 2> runex213_1.err
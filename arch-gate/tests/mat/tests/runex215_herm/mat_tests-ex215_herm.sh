@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex215 -petsc_ci -hermitian_solve  > ex215_herm.tmp 2> runex215_herm.err
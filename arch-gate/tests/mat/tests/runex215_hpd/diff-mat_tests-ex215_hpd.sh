@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex215.out ex215_hpd.tmp > diff-runex215_hpd.out 2> diff-runex215_hpd.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex215 -petsc_ci -hpd_solve  > ex215_hpd.tmp 2> runex215_hpd.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex215 -petsc_ci   > ex215_ns.tmp 2> runex215_ns.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex215 -petsc_ci -ftype qr  > ex215_qr.tmp 2> runex215_qr.err
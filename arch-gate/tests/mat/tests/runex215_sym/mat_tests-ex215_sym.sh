@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex215 -petsc_ci -symmetric_solve  > ex215_sym.tmp 2> runex215_sym.err
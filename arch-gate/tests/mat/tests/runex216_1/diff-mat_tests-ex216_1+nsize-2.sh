@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex216_1.tmp > diff-runex216_1.out 2> diff-runex216_1.out
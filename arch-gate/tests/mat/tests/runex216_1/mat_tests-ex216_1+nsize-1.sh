@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex216 -petsc_ci   > ex216_1.tmp 2> runex216_1.err
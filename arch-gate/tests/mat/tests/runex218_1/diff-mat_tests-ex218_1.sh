@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex218_1.out ex218_1.tmp > diff-runex218_1.out 2> diff-runex218_1.out
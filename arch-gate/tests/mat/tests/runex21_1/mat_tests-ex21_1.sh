@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex21 -petsc_ci -mat_type seqaij  > ex21_1.tmp 2> runex21_1.err
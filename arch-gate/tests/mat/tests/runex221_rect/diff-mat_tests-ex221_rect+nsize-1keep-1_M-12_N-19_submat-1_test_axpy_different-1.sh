@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex221_1.out ex221_rect.tmp > diff-runex221_rect.out 2> diff-runex221_rect.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex221 -petsc_ci -loop 3  -keep 0 -M 19 -N 19 -submat 1 -test_axpy_different 0 > ex221_rect.tmp 2> runex221_rect.err
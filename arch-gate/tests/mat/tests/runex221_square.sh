@@ -0,0 +1,74 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+executable='../ex221'
+testname='runex221_square'
+label='mat_tests-ex221_square'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter=''
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+# -petsc_ci must be a command line argument because if it is from the environment it will be listed by PetscOptionsMonitor()
+args='-petsc_ci -M 21 -N 21 -loop 4'
+diff_args=''
+timeoutfactor=1
+export PETSC_OPTIONS="${PETSC_OPTIONS} -check_pointer_intensity 0 -error_output_stdout -malloc_dump -checkfunctionlist -use_gpu_aware_mpi 0 -nox_warning"
+
+mpiexec=${PETSCMPIEXEC:-"/usr/bin/mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+mpiexec_tail=''
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags} ${diff_args}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-1 3}
+rows_only_in=${rows_only:-0 1}
+keep_in=${keep:-0 1}
+submat_in=${submat:-0 1}
+test_axpy_different_in=${test_axpy_different:-0 1}
+
+
+for insize in ${nsize_in}; do
+   for irows_only in ${rows_only_in}; do
+      for ikeep in ${keep_in}; do
+         for isubmat in ${submat_in}; do
+            for itest_axpy_different in ${test_axpy_different_in}; do
+
+               petsc_testrun "${mpiexec} -n ${insize} ${mpiexec_tail} ${executable} ${args}  -rows_only ${irows_only} -keep ${ikeep} -submat ${isubmat} -test_axpy_different ${itest_axpy_different}" ex221_square.tmp ${testname}.err "${label}+nsize-${insize}rows_only-${irows_only}_keep-${ikeep}_submat-${isubmat}_test_axpy_different-${itest_axpy_different}" 
+               res=$?
+
+               if test $res = 0; then
+                  petsc_testrun "${diff_exe} /root/repo/src/mat/tests/output/ex221_1.out ex221_square.tmp" diff-${testname}.out diff-${testname}.out diff-${label}+nsize-${insize}rows_only-${irows_only}_keep-${ikeep}_submat-${isubmat}_test_axpy_different-${itest_axpy_different} ""
+               else
+                  petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+               fi
+
+            done
+         done
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
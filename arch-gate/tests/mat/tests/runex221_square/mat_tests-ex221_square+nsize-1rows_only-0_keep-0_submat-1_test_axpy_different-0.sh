@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex221 -petsc_ci -M 21 -N 21 -loop 4  -rows_only 0 -keep 0 -submat 1 -test_axpy_different 0 > ex221_square.tmp 2> runex221_square.err
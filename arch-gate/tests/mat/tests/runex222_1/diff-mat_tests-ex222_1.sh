@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex222_null.out ex222_1.tmp > diff-runex222_1.out 2> diff-runex222_1.out
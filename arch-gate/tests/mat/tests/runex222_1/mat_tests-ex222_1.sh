@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex222 -petsc_ci   > ex222_1.tmp 2> runex222_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex222 -petsc_ci   -expl_type dense > ex222_matexpl_rect.tmp 2> runex222_matexpl_rect.err
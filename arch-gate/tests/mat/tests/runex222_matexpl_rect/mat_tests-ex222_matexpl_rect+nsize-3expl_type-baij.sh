@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex222 -petsc_ci   -expl_type baij > ex222_matexpl_rect.tmp 2> runex222_matexpl_rect.err
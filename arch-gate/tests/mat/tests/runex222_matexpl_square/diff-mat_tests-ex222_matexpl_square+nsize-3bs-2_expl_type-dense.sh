@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex222_null.out ex222_matexpl_square.tmp > diff-runex222_matexpl_square.out 2> diff-runex222_matexpl_square.out
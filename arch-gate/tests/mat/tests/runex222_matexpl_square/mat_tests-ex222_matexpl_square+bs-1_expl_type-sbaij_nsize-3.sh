@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex222 -petsc_ci -M 36 -N 36  -bs 1 -expl_type sbaij > ex222_matexpl_square.tmp 2> runex222_matexpl_square.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex222 -petsc_ci -M 36 -N 36  -bs 3 -expl_type baij > ex222_matexpl_square.tmp 2> runex222_matexpl_square.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex226_1.out ex226_1.tmp > diff-runex226_1.out 2> diff-runex226_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex226 -petsc_ci -m 8 -n 8 -stencil 2d5point -matmatmult_via sorted  > ex226_1.tmp 2> runex226_1.err
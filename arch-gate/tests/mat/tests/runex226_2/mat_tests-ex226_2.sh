@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex226 -petsc_ci -m 5 -n 5 -o 5 -stencil 3d27point -matmatmult_via rowmerge  > ex226_2.tmp 2> runex226_2.err
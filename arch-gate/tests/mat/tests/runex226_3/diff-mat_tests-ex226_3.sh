@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex226_3.out ex226_3.tmp > diff-runex226_3.out 2> diff-runex226_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex227_no_prefix.out ex227_no_prefix.tmp > diff-runex227_no_prefix.out 2> diff-runex227_no_prefix.out
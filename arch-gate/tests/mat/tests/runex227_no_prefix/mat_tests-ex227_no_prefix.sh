@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex227 -petsc_ci -mat_null_space_test_view -mat_view  > ex227_no_prefix.tmp 2> runex227_no_prefix.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex229_1.out ex229_1.tmp > diff-runex229_1.out 2> diff-runex229_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex229 -petsc_ci   > ex229_1.tmp 2> runex229_1.err
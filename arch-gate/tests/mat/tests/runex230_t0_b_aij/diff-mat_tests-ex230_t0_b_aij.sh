@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex230_t0_b_aij.out ex230_t0_b_aij.tmp > diff-runex230_t0_b_aij.out 2> diff-runex230_t0_b_aij.out
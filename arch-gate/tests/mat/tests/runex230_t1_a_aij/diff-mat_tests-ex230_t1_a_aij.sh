@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex230_t1_a_aij.out ex230_t1_a_aij.tmp > diff-runex230_t1_a_aij.out 2> diff-runex230_t1_a_aij.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex230 -petsc_ci -test_id 1 -mat_type aij  > ex230_t1_a_aij.tmp 2> runex230_t1_a_aij.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex230 -petsc_ci -test_id 1 -mat_type baij  > ex230_t2_a_baij.tmp 2> runex230_t2_a_baij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex230_t3_a_sbaij.out ex230_t3_a_sbaij.tmp > diff-runex230_t3_a_sbaij.out 2> diff-runex230_t3_a_sbaij.out
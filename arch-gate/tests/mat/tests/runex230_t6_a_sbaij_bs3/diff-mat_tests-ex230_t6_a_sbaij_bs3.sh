@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex230_t6_a_sbaij_bs3.out ex230_t6_a_sbaij_bs3.tmp > diff-runex230_t6_a_sbaij_bs3.out 2> diff-runex230_t6_a_sbaij_bs3.out
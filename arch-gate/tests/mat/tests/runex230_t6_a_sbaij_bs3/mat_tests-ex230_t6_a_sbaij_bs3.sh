@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex230 -petsc_ci -test_id 1 -mat_type sbaij -block_size 3  > ex230_t6_a_sbaij_bs3.tmp 2> runex230_t6_a_sbaij_bs3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex232 -petsc_ci   > ex232_1.tmp 2> runex232_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed "s?\.??g"'  /root/repo/src/mat/tests/output/ex232_1.out ex232_2.tmp > diff-runex232_2.out 2> diff-runex232_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex232 -petsc_ci -v2  > ex232_2.tmp 2> runex232_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex233 -petsc_ci -view  -mat_type baij -rect 1 > ex233_aijbaij_csr.tmp 2> runex233_aijbaij_csr.err
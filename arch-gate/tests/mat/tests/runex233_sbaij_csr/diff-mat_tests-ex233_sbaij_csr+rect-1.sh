@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/\.//g"'  /root/repo/src/mat/tests/output/ex233_sbaij_csr.out ex233_sbaij_csr.tmp > diff-runex233_sbaij_csr.out 2> diff-runex233_sbaij_csr.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex234 -petsc_ci   > ex234_1.tmp 2> runex234_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex235_1.out ex235_1.tmp > diff-runex235_1.out 2> diff-runex235_1.out
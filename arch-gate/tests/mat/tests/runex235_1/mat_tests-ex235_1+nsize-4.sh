@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex235 -petsc_ci   > ex235_1.tmp 2> runex235_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type'  /root/repo/src/mat/tests/output/ex236_1.out ex236_1.tmp > diff-runex236_1.out 2> diff-runex236_1.out
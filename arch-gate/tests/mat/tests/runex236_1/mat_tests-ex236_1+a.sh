@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex236 -petsc_ci   -mat_type aij > ex236_1.tmp 2> runex236_1.err
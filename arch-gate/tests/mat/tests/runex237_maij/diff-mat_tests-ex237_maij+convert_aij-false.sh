@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed "/Benchmarking/d"'  /root/repo/src/mat/tests/output/ex237.out ex237_maij.tmp > diff-runex237_maij.out 2> diff-runex237_maij.out
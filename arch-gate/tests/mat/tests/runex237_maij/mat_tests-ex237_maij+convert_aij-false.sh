@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex237 -petsc_ci -f ${wPETSC_DIR}/share/petsc/datafiles/matrices/spd-real-int32-float64 -bs 1,2,3 -N 1,2,18 -check -trans -type aij,maij  -convert_aij false > ex237_maij.tmp 2> runex237_maij.err
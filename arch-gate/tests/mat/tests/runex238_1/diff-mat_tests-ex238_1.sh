@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex238_1.out ex238_1.tmp > diff-runex238_1.out 2> diff-runex238_1.out
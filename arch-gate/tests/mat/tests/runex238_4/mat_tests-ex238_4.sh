@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex238 -petsc_ci -mat_block_size 4 -mat_size 1000 -its 2  > ex238_4.tmp 2> runex238_4.err
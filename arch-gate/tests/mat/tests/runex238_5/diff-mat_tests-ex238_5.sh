@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex238_1.out ex238_5.tmp > diff-runex238_5.out 2> diff-runex238_5.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex238 -petsc_ci -mat_block_size 5 -mat_size 1000 -its 2  > ex238_5.tmp 2> runex238_5.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex23_10.out ex23_10.tmp > diff-runex23_10.out 2> diff-runex23_10.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex23 -petsc_ci -m 11 -n 10 -mat_is_convert_local_nest -nr 2 -nc 1 -cbs 2  > ex23_3.tmp 2> runex23_3.err
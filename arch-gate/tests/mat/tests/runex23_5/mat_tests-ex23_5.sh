@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex23 -petsc_ci -m 12 -n 12 -test_trans -nr 3 -nc 1 -rbs 2  > ex23_5.tmp 2> runex23_5.err
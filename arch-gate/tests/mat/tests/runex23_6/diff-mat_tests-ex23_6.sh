@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex23_6.out ex23_6.tmp > diff-runex23_6.out 2> diff-runex23_6.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex23_7.out ex23_7.tmp > diff-runex23_7.out 2> diff-runex23_7.out
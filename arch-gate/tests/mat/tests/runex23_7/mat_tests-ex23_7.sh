@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex23 -petsc_ci -m 12 -n 12 -test_trans -nr 2 -nc 3 -diffmap -permmap  > ex23_7.tmp 2> runex23_7.err
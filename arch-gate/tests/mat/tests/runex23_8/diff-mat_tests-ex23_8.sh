@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex23_8.out ex23_8.tmp > diff-runex23_8.out 2> diff-runex23_8.out
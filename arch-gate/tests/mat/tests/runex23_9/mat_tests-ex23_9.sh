@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex23 -petsc_ci -m 12 -n 12 -test_trans -nr 2 -nc 3 -diffmap  > ex23_9.tmp 2> runex23_9.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex23 -petsc_ci -m 12 -n 17 -test_trans -nr 2 -nc 3 -diffmap -permmap -mat_is_localmat_type baij  > ex23_baij.tmp 2> runex23_baij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex23_negrep_allowrep_nsize-1_m-5_n-5_negmap-0_repmap-0_diffmap-1.out ex23_negrep_allowrep_nsize-1_m-5_n-5_negmap-0_repmap-0_diffmap-1.tmp > diff-runex23_negrep_allowrep_nsize-1_m-5_n-5_negmap-0_repmap-0_diffmap-1.out 2> diff-runex23_negrep_allowrep_nsize-1_m-5_n-5_negmap-0_repmap-0_diffmap-1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex23 -petsc_ci -test_trans -nr 2 -nc 3 -permmap -allow_repeated -m 5 -n 7 -negmap 0 -repmap 0 -diffmap 1  > ex23_negrep_allowrep_nsize-1_m-5_n-7_negmap-0_repmap-0_diffmap-1.tmp 2> runex23_negrep_allowrep_nsize-1_m-5_n-7_negmap-0_repmap-0_diffmap-1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex23 -petsc_ci -test_trans -nr 2 -nc 3 -permmap -allow_repeated -m 7 -n 5 -negmap 0 -repmap 0 -diffmap 0  > ex23_negrep_allowrep_nsize-3_m-7_n-5_negmap-0_repmap-0_diffmap-0.tmp 2> runex23_negrep_allowrep_nsize-3_m-7_n-5_negmap-0_repmap-0_diffmap-0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex23_negrep_nsize-1_m-7_n-7_negmap-0_repmap-0_diffmap-0.out ex23_negrep_nsize-1_m-7_n-7_negmap-0_repmap-0_diffmap-0.tmp > diff-runex23_negrep_nsize-1_m-7_n-7_negmap-0_repmap-0_diffmap-0.out 2> diff-runex23_negrep_nsize-1_m-7_n-7_negmap-0_repmap-0_diffmap-0.out
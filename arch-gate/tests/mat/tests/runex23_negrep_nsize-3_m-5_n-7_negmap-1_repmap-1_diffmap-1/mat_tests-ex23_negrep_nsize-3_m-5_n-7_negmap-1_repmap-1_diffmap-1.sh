@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex23 -petsc_ci -test_trans -nr 2 -nc 3 -permmap -allow_repeated 0 -m 5 -n 7 -negmap 1 -repmap 1 -diffmap 1  > ex23_negrep_nsize-3_m-5_n-7_negmap-1_repmap-1_diffmap-1.tmp 2> runex23_negrep_nsize-3_m-5_n-7_negmap-1_repmap-1_diffmap-1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex23_negrep_nsize-3_m-7_n-5_negmap-1_repmap-1_diffmap-1.out ex23_negrep_nsize-3_m-7_n-5_negmap-1_repmap-1_diffmap-1.tmp > diff-runex23_negrep_nsize-3_m-7_n-5_negmap-1_repmap-1_diffmap-1.out 2> diff-runex23_negrep_nsize-3_m-7_n-5_negmap-1_repmap-1_diffmap-1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex23 -petsc_ci -m 12 -n 17 -test_trans -nr 2 -nc 3 -permmap  > ex23_vscat_default.tmp 2> runex23_vscat_default.err
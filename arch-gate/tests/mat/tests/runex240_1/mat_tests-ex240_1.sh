@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex240 -petsc_ci   > ex240_1.tmp 2> runex240_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex240_2.out ex240_2.tmp > diff-runex240_2.out 2> diff-runex240_2.out
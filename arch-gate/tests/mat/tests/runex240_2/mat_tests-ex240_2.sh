@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex240 -petsc_ci   > ex240_2.tmp 2> runex240_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex240 -petsc_ci -single_block  > ex240_single.tmp 2> runex240_single.err
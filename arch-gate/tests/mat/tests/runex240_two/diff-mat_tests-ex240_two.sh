@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex240_1.out ex240_two.tmp > diff-runex240_two.out 2> diff-runex240_two.out
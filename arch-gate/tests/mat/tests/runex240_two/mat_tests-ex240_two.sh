@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex240 -petsc_ci -two_block  > ex240_two.tmp 2> runex240_two.err
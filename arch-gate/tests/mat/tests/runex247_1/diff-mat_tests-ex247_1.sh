@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex247.out ex247_1.tmp > diff-runex247_1.out 2> diff-runex247_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex247 -petsc_ci   > ex247_1.tmp 2> runex247_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex247 -petsc_ci   > ex247_2.tmp 2> runex247_2.err
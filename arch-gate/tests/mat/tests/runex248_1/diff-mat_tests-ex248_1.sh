@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex248_1.out ex248_1.tmp > diff-runex248_1.out 2> diff-runex248_1.out
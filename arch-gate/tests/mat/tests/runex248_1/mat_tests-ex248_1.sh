@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex248 -petsc_ci   > ex248_1.tmp 2> runex248_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex24 -petsc_ci -mat_coloring_type id  > ex24_id.tmp 2> runex24_id.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex24 -petsc_ci -mat_coloring_type lf  > ex24_lf.tmp 2> runex24_lf.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex24 -petsc_ci -mat_coloring_type sl  > ex24_sl.tmp 2> runex24_sl.err
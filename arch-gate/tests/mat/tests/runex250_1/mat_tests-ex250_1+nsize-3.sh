@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex250 -petsc_ci -mat_type aij  > ex250_1.tmp 2> runex250_1.err
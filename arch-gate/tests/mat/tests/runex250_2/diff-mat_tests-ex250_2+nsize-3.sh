@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -ve type -ve "Mat Object"'  /root/repo/src/mat/tests/output/ex250_1.out ex250_2.tmp > diff-runex250_2.out 2> diff-runex250_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex250 -petsc_ci -mat_type aij -matmatmult_via backend -matptap_via backend -mattransposematmult_via backend  > ex250_2.tmp 2> runex250_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -ve type -ve "Mat Object"'  /root/repo/src/mat/tests/output/ex251_1.out ex251_1.tmp > diff-runex251_1.out 2> diff-runex251_1.out
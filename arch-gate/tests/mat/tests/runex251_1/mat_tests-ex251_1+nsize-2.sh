@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex251 -petsc_ci -mat_type aij  > ex251_1.tmp 2> runex251_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex253_1.out ex253_1.tmp > diff-runex253_1.out 2> diff-runex253_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex253 -petsc_ci   > ex253_1.tmp 2> runex253_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type | grep -v "Mat Object"'  /root/repo/src/mat/tests/output/ex254_2.out ex254_2_aij.tmp > diff-runex254_2_aij.out 2> diff-runex254_2_aij.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex254 -petsc_ci -ncoos 3 -mat_type aij  > ex254_2_aij.tmp 2> runex254_2_aij.err
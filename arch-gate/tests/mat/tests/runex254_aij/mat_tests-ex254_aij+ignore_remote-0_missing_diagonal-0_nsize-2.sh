@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex254 -petsc_ci -mat_type aij  -ignore_remote 0 -missing_diagonal 0 > ex254_aij.tmp 2> runex254_aij.err
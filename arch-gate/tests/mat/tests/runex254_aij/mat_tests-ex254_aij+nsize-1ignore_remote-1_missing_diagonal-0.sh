@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex254 -petsc_ci -mat_type aij  -ignore_remote 1 -missing_diagonal 0 > ex254_aij.tmp 2> runex254_aij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -j /root/repo/src/mat/tests/output/ex257_1.out ex257_1.tmp > diff-runex257_1.out 2> diff-runex257_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex257 -petsc_ci   > ex257_1.tmp 2> runex257_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex258 -petsc_ci -conjugate false -atb  > ex258_1.tmp 2> runex258_1.err
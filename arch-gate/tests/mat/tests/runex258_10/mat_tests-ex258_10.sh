@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex258 -petsc_ci -abt  > ex258_10.tmp 2> runex258_10.err
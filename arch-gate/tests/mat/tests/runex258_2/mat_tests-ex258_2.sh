@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex258 -petsc_ci -conjugate true -atb  > ex258_2.tmp 2> runex258_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex258 -petsc_ci -conjugate false  > ex258_3.tmp 2> runex258_3.err
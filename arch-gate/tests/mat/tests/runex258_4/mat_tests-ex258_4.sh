@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex258 -petsc_ci -ptap  > ex258_4.tmp 2> runex258_4.err
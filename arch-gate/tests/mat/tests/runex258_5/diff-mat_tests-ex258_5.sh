@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex258_1.out ex258_5.tmp > diff-runex258_5.out 2> diff-runex258_5.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex258 -petsc_ci -abt  > ex258_5.tmp 2> runex258_5.err
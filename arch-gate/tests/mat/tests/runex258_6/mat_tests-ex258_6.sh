@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex258 -petsc_ci -conjugate false -atb  > ex258_6.tmp 2> runex258_6.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex258 -petsc_ci -conjugate true -atb  > ex258_7.tmp 2> runex258_7.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex258 -petsc_ci -conjugate false  > ex258_8.tmp 2> runex258_8.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex258 -petsc_ci -ptap  > ex258_9.tmp 2> runex258_9.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex259 -petsc_ci   -bs 1 -type baij  > ex259_1.tmp 2> runex259_1.err
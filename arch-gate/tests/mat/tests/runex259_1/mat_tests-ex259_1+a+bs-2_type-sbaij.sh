@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex259 -petsc_ci   -bs 2 -type sbaij  > ex259_1.tmp 2> runex259_1.err
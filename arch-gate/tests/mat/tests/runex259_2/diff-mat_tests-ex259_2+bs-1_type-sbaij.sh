@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "type:"'  /root/repo/src/mat/tests/output/ex259_2.out ex259_2.tmp > diff-runex259_2.out 2> diff-runex259_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex259 -petsc_ci   -bs 1 -type baij > ex259_2.tmp 2> runex259_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/./output/empty.out ex261_aij_standard.tmp > diff-runex261_aij_standard.out 2> diff-runex261_aij_standard.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex261 -petsc_ci -mat_type aij  > ex261_aij_standard.tmp 2> runex261_aij_standard.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/./output/empty.out ex261_dense_standard.tmp > diff-runex261_dense_standard.out 2> diff-runex261_dense_standard.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex261 -petsc_ci -mat_type dense  > ex261_dense_standard.tmp 2> runex261_dense_standard.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex265_2_dm_mat_type-aij.out ex265_2_dm_mat_type-aij.tmp > diff-runex265_2_dm_mat_type-aij.out 2> diff-runex265_2_dm_mat_type-aij.out
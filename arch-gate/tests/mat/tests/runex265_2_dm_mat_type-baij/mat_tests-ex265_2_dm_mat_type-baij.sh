@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex265 -petsc_ci -mat_view -dm_mat_type baij  > ex265_2_dm_mat_type-baij.tmp 2> runex265_2_dm_mat_type-baij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex265_2_dm_mat_type-sbaij.out ex265_2_dm_mat_type-sbaij.tmp > diff-runex265_2_dm_mat_type-sbaij.out 2> diff-runex265_2_dm_mat_type-sbaij.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex265 -petsc_ci -mat_view -dm_mat_type sbaij  > ex265_2_dm_mat_type-sbaij.tmp 2> runex265_2_dm_mat_type-sbaij.err
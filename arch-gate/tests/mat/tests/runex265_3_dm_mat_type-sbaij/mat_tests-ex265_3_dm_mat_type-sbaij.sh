@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex265 -petsc_ci -mat_view -dm_mat_type sbaij  > ex265_3_dm_mat_type-sbaij.tmp 2> runex265_3_dm_mat_type-sbaij.err
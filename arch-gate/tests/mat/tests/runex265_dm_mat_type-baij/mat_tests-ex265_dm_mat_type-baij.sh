@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex265 -petsc_ci -mat_view -dm_mat_type baij  > ex265_dm_mat_type-baij.tmp 2> runex265_dm_mat_type-baij.err
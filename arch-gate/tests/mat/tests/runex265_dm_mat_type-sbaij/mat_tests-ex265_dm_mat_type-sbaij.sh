@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex265 -petsc_ci -mat_view -dm_mat_type sbaij  > ex265_dm_mat_type-sbaij.tmp 2> runex265_dm_mat_type-sbaij.err
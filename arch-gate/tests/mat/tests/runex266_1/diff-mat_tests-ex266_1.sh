@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex266_1.tmp > diff-runex266_1.out 2> diff-runex266_1.out
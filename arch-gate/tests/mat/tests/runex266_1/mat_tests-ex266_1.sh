@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex266 -petsc_ci   > ex266_1.tmp 2> runex266_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex267_1.tmp > diff-runex267_1.out 2> diff-runex267_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex267 -petsc_ci   -inplace 1 -mat_type aij > ex267_1.tmp 2> runex267_1.err
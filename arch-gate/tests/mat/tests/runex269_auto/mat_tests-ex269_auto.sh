@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex269 -petsc_ci -mat_no_inode  > ex269_auto.tmp 2> runex269_auto.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex269 -petsc_ci -mat_autotune  > ex269_autotune.tmp 2> runex269_autotune.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex269 -petsc_ci -mat_autotune -m 300 -maxnz 5  > ex269_autotune_inode.tmp 2> runex269_autotune_inode.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex269 -petsc_ci -mat_no_inode -info :mat -mat_seqaij_spmv avx2  > ex269_avx2.tmp 2> runex269_avx2.err
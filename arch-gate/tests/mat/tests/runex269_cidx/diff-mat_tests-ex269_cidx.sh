@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex269_cidx.tmp > diff-runex269_cidx.out 2> diff-runex269_cidx.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex269 -petsc_ci -mat_seqaij_compressed_indices  > ex269_cidx.tmp 2> runex269_cidx.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex269_cidx_inode.tmp > diff-runex269_cidx_inode.out 2> diff-runex269_cidx_inode.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex269 -petsc_ci -mat_seqaij_compressed_indices -n 300 -m 300 -maxnz 5  > ex269_cidx_inode.tmp 2> runex269_cidx_inode.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex269 -petsc_ci -mat_seqaij_compressed_indices -n 200  > ex269_cidx_sor.tmp 2> runex269_cidx_sor.err
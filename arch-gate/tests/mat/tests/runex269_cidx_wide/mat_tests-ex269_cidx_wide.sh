@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex269 -petsc_ci -mat_seqaij_compressed_indices -m 130 -n 70000  > ex269_cidx_wide.tmp 2> runex269_cidx_wide.err
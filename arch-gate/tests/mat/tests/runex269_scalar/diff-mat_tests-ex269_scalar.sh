@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -o "Using [a-z0-9]* SpMV kernels" | sort -u'  /root/repo/src/mat/tests/output/ex269_scalar.out ex269_scalar.tmp > diff-runex269_scalar.out 2> diff-runex269_scalar.out
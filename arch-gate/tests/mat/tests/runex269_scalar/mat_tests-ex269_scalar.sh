@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex269 -petsc_ci -mat_no_inode -info :mat -mat_seqaij_spmv scalar  > ex269_scalar.tmp 2> runex269_scalar.err
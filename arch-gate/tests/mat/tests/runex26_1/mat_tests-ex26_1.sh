@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex26 -petsc_ci   > ex26_1.tmp 2> runex26_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex26 -petsc_ci -bs 2  > ex26_2.tmp 2> runex26_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex270_aij.tmp > diff-runex270_aij.out 2> diff-runex270_aij.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex270_aij_mpi.tmp > diff-runex270_aij_mpi.out 2> diff-runex270_aij_mpi.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex270 -petsc_ci -mat_mixed_precision -mat_type aij  > ex270_aij_mpi.tmp 2> runex270_aij_mpi.err
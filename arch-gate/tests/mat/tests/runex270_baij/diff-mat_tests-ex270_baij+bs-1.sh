@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex270_baij.tmp > diff-runex270_baij.out 2> diff-runex270_baij.out
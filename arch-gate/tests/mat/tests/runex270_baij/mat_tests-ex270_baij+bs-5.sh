@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex270 -petsc_ci -mat_mixed_precision -mat_type baij  -bs 5 > ex270_baij.tmp 2> runex270_baij.err
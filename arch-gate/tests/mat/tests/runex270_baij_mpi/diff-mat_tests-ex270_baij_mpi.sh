@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex270_baij_mpi.tmp > diff-runex270_baij_mpi.out 2> diff-runex270_baij_mpi.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex270 -petsc_ci -mat_mixed_precision -mat_type baij -bs 4  > ex270_baij_mpi.tmp 2> runex270_baij_mpi.err
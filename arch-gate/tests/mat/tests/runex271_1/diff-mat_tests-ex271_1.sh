@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex271_1.tmp > diff-runex271_1.out 2> diff-runex271_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex271 -petsc_ci   > ex271_1.tmp 2> runex271_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex271_2.tmp > diff-runex271_2.out 2> diff-runex271_2.out
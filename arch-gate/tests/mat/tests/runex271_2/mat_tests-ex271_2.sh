@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex271 -petsc_ci -mat_no_inode -n 37  > ex271_2.tmp 2> runex271_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex272 -petsc_ci -matstash_freeze  > ex272_1.tmp 2> runex272_1.err
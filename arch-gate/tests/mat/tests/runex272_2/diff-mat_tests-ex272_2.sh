@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex272_2.tmp > diff-runex272_2.out 2> diff-runex272_2.out
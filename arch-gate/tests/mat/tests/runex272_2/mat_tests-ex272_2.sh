@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex272 -petsc_ci   > ex272_2.tmp 2> runex272_2.err
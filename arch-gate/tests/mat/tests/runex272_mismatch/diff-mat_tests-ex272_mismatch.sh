@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -E -o "requires the same off-process entries" | sort -u'  /root/repo/src/mat/tests/output/ex272_mismatch.out ex272_mismatch.tmp > diff-runex272_mismatch.out 2> diff-runex272_mismatch.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex272 -petsc_ci -matstash_freeze -mismatch -petsc_ci_portable_error_output -error_output_stdout  > ex272_mismatch.tmp 2> runex272_mismatch.err
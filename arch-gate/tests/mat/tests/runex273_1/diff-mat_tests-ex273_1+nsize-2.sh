@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex273_1.tmp > diff-runex273_1.out 2> diff-runex273_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex273 -petsc_ci -mat_mpiaij_split_mult  > ex273_1.tmp 2> runex273_1.err
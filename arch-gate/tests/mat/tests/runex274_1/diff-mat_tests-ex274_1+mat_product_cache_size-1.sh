@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex274_1.tmp > diff-runex274_1.out 2> diff-runex274_1.out
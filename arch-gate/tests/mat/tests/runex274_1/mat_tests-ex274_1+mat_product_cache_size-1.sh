@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex274 -petsc_ci   -mat_product_cache_size 1 > ex274_1.tmp 2> runex274_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h "Reusing the cached"'  /root/repo/src/mat/tests/output/ex274_info.out ex274_info.tmp > diff-runex274_info.out 2> diff-runex274_info.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex274 -petsc_ci -mat_product_cache_size 8 -info  > ex274_info.tmp 2> runex274_info.err
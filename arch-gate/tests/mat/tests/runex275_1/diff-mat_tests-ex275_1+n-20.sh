@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex275_1.tmp > diff-runex275_1.out 2> diff-runex275_1.out
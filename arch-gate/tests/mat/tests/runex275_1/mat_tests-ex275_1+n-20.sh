@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex275 -petsc_ci -mat_factor_supernodal  -n 20 > ex275_1.tmp 2> runex275_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex276_1.tmp > diff-runex276_1.out 2> diff-runex276_1.out
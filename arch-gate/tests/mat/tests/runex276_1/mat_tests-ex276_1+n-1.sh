@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex276 -petsc_ci -f_mat_factor_level_solve  -n 1 > ex276_1.tmp 2> runex276_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep "Level-scheduled" | sed -e "s/, [0-9]* threads//"'  /root/repo/src/mat/tests/output/ex276_multicolor.out ex276_multicolor.tmp > diff-runex276_multicolor.out 2> diff-runex276_multicolor.out
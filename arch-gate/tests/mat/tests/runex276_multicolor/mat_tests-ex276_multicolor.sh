@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex276 -petsc_ci -f_mat_factor_level_solve -otype multicolor -info :mat  > ex276_multicolor.tmp 2> runex276_multicolor.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex276 -petsc_ci -n 8 -f_mat_factor_jacobi_solve_sweeps 64  -f_mat_factor_parilu_sweeps 30 > ex276_parilu.tmp 2> runex276_parilu.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex276 -petsc_ci -n 8 -f_mat_factor_parilu_sweeps 3 -f_mat_factor_jacobi_solve_sweeps 10 -residual_ratio 1.5  > ex276_parilu_approx.tmp 2> runex276_parilu_approx.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex276_parilu_levelsolve.tmp > diff-runex276_parilu_levelsolve.out 2> diff-runex276_parilu_levelsolve.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex276 -petsc_ci -n 8 -f_mat_factor_parilu_sweeps 30 -f_mat_factor_level_solve  > ex276_parilu_levelsolve.tmp 2> runex276_parilu_levelsolve.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -E -o "ParILU does not support shifts of the diagonal"'  /root/repo/src/mat/tests/output/ex276_parilu_shift.out ex276_parilu_shift.tmp > diff-runex276_parilu_shift.out 2> diff-runex276_parilu_shift.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex276 -petsc_ci -f_mat_factor_parilu_sweeps 3 -shift -petsc_ci_portable_error_output -error_output_stdout  > ex276_parilu_shift.tmp 2> runex276_parilu_shift.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex276 -petsc_ci -complete -f_mat_factor_supernodal  -n 16 > ex276_supernodal.tmp 2> runex276_supernodal.err
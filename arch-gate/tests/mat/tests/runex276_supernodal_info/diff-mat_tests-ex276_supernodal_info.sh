@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -o "[0-9]* supernodes in [0-9]* levels, nonzeros in L [0-9]*"'  /root/repo/src/mat/tests/output/ex276_supernodal_info.out ex276_supernodal_info.tmp > diff-runex276_supernodal_info.out 2> diff-runex276_supernodal_info.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex276 -petsc_ci -complete -f_mat_factor_supernodal -otype rcm -n 8 -info :mat  > ex276_supernodal_info.tmp 2> runex276_supernodal_info.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex277_1.tmp > diff-runex277_1.out 2> diff-runex277_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex277 -petsc_ci -pi_mat_factor_jacobi_solve_sweeps 64  -pi_mat_factor_parilu_sweeps 30 > ex277_1.tmp 2> runex277_1.err
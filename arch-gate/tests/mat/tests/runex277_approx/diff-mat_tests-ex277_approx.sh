@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex277_approx.tmp > diff-runex277_approx.out 2> diff-runex277_approx.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex277 -petsc_ci -pi_mat_factor_parilu_sweeps 3 -pi_mat_factor_jacobi_solve_sweeps 3 -tol 0.5  > ex277_approx.tmp 2> runex277_approx.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex277_levelsolve.tmp > diff-runex277_levelsolve.out 2> diff-runex277_levelsolve.out
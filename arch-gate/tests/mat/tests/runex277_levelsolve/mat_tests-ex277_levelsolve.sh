@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex277 -petsc_ci -pi_mat_factor_parilu_sweeps 30 -pi_mat_factor_level_solve  > ex277_levelsolve.tmp 2> runex277_levelsolve.err
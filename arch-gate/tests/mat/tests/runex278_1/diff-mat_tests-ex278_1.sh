@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex278_1.tmp > diff-runex278_1.out 2> diff-runex278_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex278 -petsc_ci -ref_mat_no_unroll  > ex278_1.tmp 2> runex278_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex278_2.tmp > diff-runex278_2.out 2> diff-runex278_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex278 -petsc_ci -ref_mat_no_unroll -n 1 -bs 8,12,16  > ex278_2.tmp 2> runex278_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex279 -petsc_ci -dim 1 -n 20  > ex279_1.tmp 2> runex279_1.err
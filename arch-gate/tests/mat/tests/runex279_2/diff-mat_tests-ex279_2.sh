@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex279_2.tmp > diff-runex279_2.out 2> diff-runex279_2.out
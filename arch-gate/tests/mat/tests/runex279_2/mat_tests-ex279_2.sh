@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex279 -petsc_ci -dim 1 -n 10 -bs 5,8,6,1  > ex279_2.tmp 2> runex279_2.err
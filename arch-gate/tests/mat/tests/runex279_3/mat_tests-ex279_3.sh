@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex279 -petsc_ci -bs 4,1,3,2  > ex279_3.tmp 2> runex279_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex279 -petsc_ci -bs 3  > ex279_4.tmp 2> runex279_4.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex279 -petsc_ci -bs 1 -omega 1.3  > ex279_5.tmp 2> runex279_5.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex27_1.out ex27_1.tmp > diff-runex27_1.out 2> diff-runex27_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex27 -petsc_ci   > ex27_1.tmp 2> runex27_1.err
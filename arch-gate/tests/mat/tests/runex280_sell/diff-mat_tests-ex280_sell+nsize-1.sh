@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex280_sell.tmp > diff-runex280_sell.out 2> diff-runex280_sell.out
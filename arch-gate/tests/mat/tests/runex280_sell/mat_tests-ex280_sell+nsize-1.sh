@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex280 -petsc_ci -n 13  > ex280_sell.tmp 2> runex280_sell.err
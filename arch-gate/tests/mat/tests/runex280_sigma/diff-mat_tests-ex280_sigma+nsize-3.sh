@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex280_sigma.tmp > diff-runex280_sigma.out 2> diff-runex280_sigma.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex280 -petsc_ci -n 13 -mat_sell_sigma 32  > ex280_sigma.tmp 2> runex280_sigma.err
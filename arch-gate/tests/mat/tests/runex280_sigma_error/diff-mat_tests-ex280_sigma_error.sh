@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -E -o "must be a multiple of the slice height"'  /root/repo/src/mat/tests/output/ex280_sigma_error.out ex280_sigma_error.tmp > diff-runex280_sigma_error.out 2> diff-runex280_sigma_error.out
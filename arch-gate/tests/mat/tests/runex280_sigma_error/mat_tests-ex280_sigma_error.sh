@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex280 -petsc_ci -n 9 -mat_sell_slice_height 4 -mat_sell_sigma 6 -petsc_ci_portable_error_output -error_output_stdout  > ex280_sigma_error.tmp 2> runex280_sigma_error.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex280_sigma_sh4.tmp > diff-runex280_sigma_sh4.out 2> diff-runex280_sigma_sh4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex280 -petsc_ci -n 13 -mat_sell_slice_height 4 -mat_sell_sigma 64  > ex280_sigma_sh4.tmp 2> runex280_sigma_sh4.err
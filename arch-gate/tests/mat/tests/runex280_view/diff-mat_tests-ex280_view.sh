@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex280_view.out ex280_view.tmp > diff-runex280_view.out 2> diff-runex280_view.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex280 -petsc_ci -n 9 -mat_sell_sigma 16 -view_info  > ex280_view.tmp 2> runex280_view.err
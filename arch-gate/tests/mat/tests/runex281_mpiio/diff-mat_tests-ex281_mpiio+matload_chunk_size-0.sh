@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex281_mpiio.tmp > diff-runex281_mpiio.out 2> diff-runex281_mpiio.out
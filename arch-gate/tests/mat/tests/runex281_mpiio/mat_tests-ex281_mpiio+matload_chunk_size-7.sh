@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex281 -petsc_ci -viewer_binary_skip_info -viewer_binary_mpiio  -matload_chunk_size 7 > ex281_mpiio.tmp 2> runex281_mpiio.err
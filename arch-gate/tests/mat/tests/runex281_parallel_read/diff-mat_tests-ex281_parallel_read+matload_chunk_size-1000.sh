@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex281_parallel_read.tmp > diff-runex281_parallel_read.out 2> diff-runex281_parallel_read.out
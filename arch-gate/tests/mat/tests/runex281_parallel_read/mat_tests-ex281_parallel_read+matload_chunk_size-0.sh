@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex281 -petsc_ci -viewer_binary_skip_info -viewer_binary_parallel_read  -matload_chunk_size 0 > ex281_parallel_read.tmp 2> runex281_parallel_read.err
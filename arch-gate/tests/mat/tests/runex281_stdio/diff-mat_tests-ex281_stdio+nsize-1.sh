@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex281_stdio.tmp > diff-runex281_stdio.out 2> diff-runex281_stdio.out
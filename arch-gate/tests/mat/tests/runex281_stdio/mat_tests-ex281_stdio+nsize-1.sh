@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex281 -petsc_ci -viewer_binary_skip_info  > ex281_stdio.tmp 2> runex281_stdio.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex282_1.tmp > diff-runex282_1.out 2> diff-runex282_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex282 -petsc_ci -viewer_binary_skip_info  -viewer_binary_mmap 0 -extra 1 > ex282_1.tmp 2> runex282_1.err
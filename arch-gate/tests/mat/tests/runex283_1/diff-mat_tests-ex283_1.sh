@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex283_1.tmp > diff-runex283_1.out 2> diff-runex283_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex283 -petsc_ci   > ex283_1.tmp 2> runex283_1.err
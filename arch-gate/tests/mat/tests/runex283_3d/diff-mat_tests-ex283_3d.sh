@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex283_3d.tmp > diff-runex283_3d.out 2> diff-runex283_3d.out
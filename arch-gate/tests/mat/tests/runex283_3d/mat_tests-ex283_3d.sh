@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex283 -petsc_ci -m 12 -p 10 -mat_ordering_mlnd_leaf_size 20  > ex283_3d.tmp 2> runex283_3d.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex283_disconnected.tmp > diff-runex283_disconnected.out 2> diff-runex283_disconnected.out
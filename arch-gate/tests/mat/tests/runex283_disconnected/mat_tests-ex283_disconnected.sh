@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex283 -petsc_ci -m 10 -ncomp 3 -mat_ordering_mlnd_leaf_size 8 -mat_ordering_mlnd_coarse_size 4 -mat_ordering_mlnd_nseps 1  > ex283_disconnected.tmp 2> runex283_disconnected.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex284_1.tmp > diff-runex284_1.out 2> diff-runex284_1.out
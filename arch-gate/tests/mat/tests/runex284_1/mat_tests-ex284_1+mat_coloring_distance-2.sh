@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex284 -petsc_ci   -mat_coloring_distance 2 > ex284_1.tmp 2> runex284_1.err
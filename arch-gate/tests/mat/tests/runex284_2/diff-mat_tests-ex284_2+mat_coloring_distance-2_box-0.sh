@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex284_2.tmp > diff-runex284_2.out 2> diff-runex284_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex284 -petsc_ci -dof 2  -mat_coloring_distance 2 -box 1 > ex284_2.tmp 2> runex284_2.err
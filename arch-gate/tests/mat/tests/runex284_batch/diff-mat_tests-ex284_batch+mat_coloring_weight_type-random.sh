@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex284_batch.tmp > diff-runex284_batch.out 2> diff-runex284_batch.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex284 -petsc_ci -types speculative -mat_coloring_speculative_batch 10  -mat_coloring_weight_type lf > ex284_batch.tmp 2> runex284_batch.err
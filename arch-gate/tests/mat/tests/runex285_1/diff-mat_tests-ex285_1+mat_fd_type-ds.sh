@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "type"'  /root/repo/src/mat/tests/output/ex285_1.out ex285_1.tmp > diff-runex285_1.out 2> diff-runex285_1.out
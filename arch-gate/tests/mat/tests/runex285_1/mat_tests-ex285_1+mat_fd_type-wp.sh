@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex285 -petsc_ci -mat_fd_coloring_batch 4 -threadsafe_function -mat_fd_coloring_view ::ascii_info  -mat_fd_type wp > ex285_1.tmp 2> runex285_1.err
@@ -0,0 +1,71 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+executable='../ex285'
+testname='runex285_2'
+label='mat_tests-ex285_2'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter=''
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+# -petsc_ci must be a command line argument because if it is from the environment it will be listed by PetscOptionsMonitor()
+args='-petsc_ci -batch_function'
+diff_args=''
+timeoutfactor=1
+export PETSC_OPTIONS="${PETSC_OPTIONS} -check_pointer_intensity 0 -error_output_stdout -malloc_dump -checkfunctionlist -use_gpu_aware_mpi 0 -nox_warning"
+
+mpiexec=${PETSCMPIEXEC:-"/usr/bin/mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+mpiexec_tail=''
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags} ${diff_args}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-3}
+mat_fd_coloring_batch_in=${mat_fd_coloring_batch:-1 4}
+mat_fd_coloring_bcols_in=${mat_fd_coloring_bcols:-1 3}
+mat_fd_type_in=${mat_fd_type:-wp ds}
+
+
+for insize in ${nsize_in}; do
+   for imat_fd_coloring_batch in ${mat_fd_coloring_batch_in}; do
+      for imat_fd_coloring_bcols in ${mat_fd_coloring_bcols_in}; do
+         for imat_fd_type in ${mat_fd_type_in}; do
+
+            petsc_testrun "${mpiexec} -n ${insize} ${mpiexec_tail} ${executable} ${args}  -mat_fd_coloring_batch ${imat_fd_coloring_batch} -mat_fd_coloring_bcols ${imat_fd_coloring_bcols} -mat_fd_type ${imat_fd_type}" ex285_2.tmp ${testname}.err "${label}+mat_fd_coloring_batch-${imat_fd_coloring_batch}_mat_fd_coloring_bcols-${imat_fd_coloring_bcols}_mat_fd_type-${imat_fd_type}" 
+            res=$?
+
+            if test $res = 0; then
+               petsc_testrun "${diff_exe} /root/repo/src/mat/tests/output/empty.out ex285_2.tmp" diff-${testname}.out diff-${testname}.out diff-${label}+mat_fd_coloring_batch-${imat_fd_coloring_batch}_mat_fd_coloring_bcols-${imat_fd_coloring_bcols}_mat_fd_type-${imat_fd_type} ""
+            else
+               petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+            fi
+
+         done
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex285_2.tmp > diff-runex285_2.out 2> diff-runex285_2.out
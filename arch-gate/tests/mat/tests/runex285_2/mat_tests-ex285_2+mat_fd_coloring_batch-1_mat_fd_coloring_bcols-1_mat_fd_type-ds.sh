@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex285 -petsc_ci -batch_function  -mat_fd_coloring_batch 1 -mat_fd_coloring_bcols 1 -mat_fd_type ds > ex285_2.tmp 2> runex285_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex286_1.tmp > diff-runex286_1.out 2> diff-runex286_1.out
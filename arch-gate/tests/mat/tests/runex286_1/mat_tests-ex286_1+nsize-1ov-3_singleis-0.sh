@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex286 -petsc_ci   -ov 3 -singleis 0 > ex286_1.tmp 2> runex286_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/empty.out ex286_2.tmp > diff-runex286_2.out 2> diff-runex286_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex286 -petsc_ci -ov 4 -da_grid_x 24 -da_grid_y 10  -singleis 1 > ex286_2.tmp 2> runex286_2.err
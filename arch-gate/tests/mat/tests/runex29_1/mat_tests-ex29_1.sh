@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex29 -petsc_ci   > ex29_1.tmp 2> runex29_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -mat_type seqaij -rectA  > ex2_11_A.tmp 2> runex2_11_A.err
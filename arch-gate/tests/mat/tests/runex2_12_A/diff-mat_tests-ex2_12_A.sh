@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type | grep -v "Mat Object"'  /root/repo/src/mat/tests/output/ex2_12_A.out ex2_12_A.tmp > diff-runex2_12_A.out 2> diff-runex2_12_A.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -mat_type seqdense -rectB  > ex2_12_B.tmp 2> runex2_12_B.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type | grep -v "Mat Object"'  /root/repo/src/mat/tests/output/ex2_12_B.out ex2_12_B_aij.tmp > diff-runex2_12_B_aij.out 2> diff-runex2_12_B_aij.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -rectB -mat_type aij  > ex2_12_B_aij.tmp 2> runex2_12_B_aij.err
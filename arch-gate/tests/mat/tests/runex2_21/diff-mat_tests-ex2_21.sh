@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type | grep -v " MPI process"'  /root/repo/src/mat/tests/output/ex2_21.out ex2_21.tmp > diff-runex2_21.out 2> diff-runex2_21.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -mat_type mpiaij  > ex2_21.tmp 2> runex2_21.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type | grep -v "Mat Object"'  /root/repo/src/mat/tests/output/ex2_22.out ex2_22.tmp > diff-runex2_22.out 2> diff-runex2_22.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -mat_type mpidense  > ex2_22.tmp 2> runex2_22.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type | grep -v " MPI process"'  /root/repo/src/mat/tests/output/ex2_23.out ex2_23.tmp > diff-runex2_23.out 2> diff-runex2_23.out
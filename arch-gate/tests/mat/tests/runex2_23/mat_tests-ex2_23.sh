@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex2 -petsc_ci -mat_type mpiaij  > ex2_23.tmp 2> runex2_23.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type | grep -v "Mat Object"'  /root/repo/src/mat/tests/output/ex2_24.out ex2_24.tmp > diff-runex2_24.out 2> diff-runex2_24.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex2 -petsc_ci -mat_type mpidense  > ex2_24.tmp 2> runex2_24.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex300 -petsc_ci   > ex300_1.tmp 2> runex300_1.err
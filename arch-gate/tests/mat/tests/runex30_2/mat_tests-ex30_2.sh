@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex30 -petsc_ci -mat_ordering -display_matrices -nox -lu -chol  > ex30_2.tmp 2> runex30_2.err
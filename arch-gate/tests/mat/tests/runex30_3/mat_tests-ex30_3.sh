@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex30 -petsc_ci -mat_ordering -lu -chol -triangular_solve  > ex30_3.tmp 2> runex30_3.err
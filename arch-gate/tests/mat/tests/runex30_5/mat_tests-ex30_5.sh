@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex30 -petsc_ci -lu -chol  > ex30_5.tmp 2> runex30_5.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex30 -petsc_ci -lu -chol -triangular_solve  > ex30_6.tmp 2> runex30_6.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex33 -petsc_ci   > ex33_1.tmp 2> runex33_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex33.out ex33_2.tmp > diff-runex33_2.out 2> diff-runex33_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 8  ../ex33 -petsc_ci   > ex33_2.tmp 2> runex33_2.err
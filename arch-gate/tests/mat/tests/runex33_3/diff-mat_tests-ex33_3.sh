@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex33_3.out ex33_3.tmp > diff-runex33_3.out 2> diff-runex33_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex33 -petsc_ci -test_mpiderivedtype  > ex33_3.tmp 2> runex33_3.err
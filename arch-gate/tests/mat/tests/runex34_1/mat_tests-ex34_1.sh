@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex34 -petsc_ci   > ex34_1.tmp 2> runex34_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex35_1.out ex35_1.tmp > diff-runex35_1.out 2> diff-runex35_1.out
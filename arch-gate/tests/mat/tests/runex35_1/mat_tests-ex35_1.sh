@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex35 -petsc_ci   > ex35_1.tmp 2> runex35_1.err
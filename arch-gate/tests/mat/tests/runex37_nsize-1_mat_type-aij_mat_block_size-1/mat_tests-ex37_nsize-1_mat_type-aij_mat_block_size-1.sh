@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex37 -petsc_ci -view ::ascii_info -mat_type aij -mat_block_size 1  > ex37_nsize-1_mat_type-aij_mat_block_size-1.tmp 2> runex37_nsize-1_mat_type-aij_mat_block_size-1.err
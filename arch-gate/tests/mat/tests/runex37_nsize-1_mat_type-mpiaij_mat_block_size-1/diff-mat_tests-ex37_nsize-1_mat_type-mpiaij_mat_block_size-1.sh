@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex37_nsize-1_mat_type-mpiaij_mat_block_size-1.out ex37_nsize-1_mat_type-mpiaij_mat_block_size-1.tmp > diff-runex37_nsize-1_mat_type-mpiaij_mat_block_size-1.out 2> diff-runex37_nsize-1_mat_type-mpiaij_mat_block_size-1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex37 -petsc_ci -view ::ascii_info -mat_type mpibaij -mat_block_size 2  > ex37_nsize-2_mat_type-mpibaij_mat_block_size-2.tmp 2> runex37_nsize-2_mat_type-mpibaij_mat_block_size-2.err
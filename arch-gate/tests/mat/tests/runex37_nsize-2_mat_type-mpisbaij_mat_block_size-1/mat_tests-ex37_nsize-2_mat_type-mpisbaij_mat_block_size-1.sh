@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex37 -petsc_ci -view ::ascii_info -mat_type mpisbaij -mat_block_size 1  > ex37_nsize-2_mat_type-mpisbaij_mat_block_size-1.tmp 2> runex37_nsize-2_mat_type-mpisbaij_mat_block_size-1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex40_1.out ex40_2.tmp > diff-runex40_2.out 2> diff-runex40_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex43 -petsc_ci   > ex43_1.tmp 2> runex43_1.err
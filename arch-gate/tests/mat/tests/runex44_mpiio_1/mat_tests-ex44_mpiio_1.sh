@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex44 -petsc_ci -viewer_binary_mpiio 1  > ex44_mpiio_1.tmp 2> runex44_mpiio_1.err
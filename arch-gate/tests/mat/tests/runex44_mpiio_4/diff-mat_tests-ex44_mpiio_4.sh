@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex44.out ex44_mpiio_4.tmp > diff-runex44_mpiio_4.out 2> diff-runex44_mpiio_4.out
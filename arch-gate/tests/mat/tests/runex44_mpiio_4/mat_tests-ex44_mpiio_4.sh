@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex44 -petsc_ci -viewer_binary_mpiio 1  > ex44_mpiio_4.tmp 2> runex44_mpiio_4.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex44 -petsc_ci -viewer_binary_mpiio 0  > ex44_stdio_1.tmp 2> runex44_stdio_1.err
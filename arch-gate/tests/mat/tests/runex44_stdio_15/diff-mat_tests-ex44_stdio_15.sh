@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex44.out ex44_stdio_15.tmp > diff-runex44_stdio_15.out 2> diff-runex44_stdio_15.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 15  ../ex44 -petsc_ci -viewer_binary_mpiio 0  > ex44_stdio_15.tmp 2> runex44_stdio_15.err
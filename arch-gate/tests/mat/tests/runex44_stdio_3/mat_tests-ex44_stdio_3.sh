@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex44 -petsc_ci -viewer_binary_mpiio 0  > ex44_stdio_3.tmp 2> runex44_stdio_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex44 -petsc_ci -viewer_binary_mpiio 0  > ex44_stdio_4.tmp 2> runex44_stdio_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex45.out ex45_mpiio_1.tmp > diff-runex45_mpiio_1.out 2> diff-runex45_mpiio_1.out
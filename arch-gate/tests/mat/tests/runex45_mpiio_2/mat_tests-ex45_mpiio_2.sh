@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex45 -petsc_ci -viewer_binary_mpiio 1  > ex45_mpiio_2.tmp 2> runex45_mpiio_2.err
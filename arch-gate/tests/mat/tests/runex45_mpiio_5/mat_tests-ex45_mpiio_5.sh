@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex45 -petsc_ci -viewer_binary_mpiio 1  > ex45_mpiio_5.tmp 2> runex45_mpiio_5.err
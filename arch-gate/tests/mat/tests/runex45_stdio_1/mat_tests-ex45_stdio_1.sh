@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex45 -petsc_ci -viewer_binary_mpiio 0  > ex45_stdio_1.tmp 2> runex45_stdio_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex45 -petsc_ci -viewer_binary_mpiio 0  > ex45_stdio_3.tmp 2> runex45_stdio_3.err
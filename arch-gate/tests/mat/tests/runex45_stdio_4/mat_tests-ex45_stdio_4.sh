@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex45 -petsc_ci -viewer_binary_mpiio 0  > ex45_stdio_4.tmp 2> runex45_stdio_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex45.out ex45_stdio_5.tmp > diff-runex45_stdio_5.out 2> diff-runex45_stdio_5.out
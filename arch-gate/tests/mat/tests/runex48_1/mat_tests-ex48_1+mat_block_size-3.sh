@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex48 -petsc_ci   -mat_block_size 3 > ex48_1.tmp 2> runex48_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex49_1.out ex49_1.tmp > diff-runex49_1.out 2> diff-runex49_1.out
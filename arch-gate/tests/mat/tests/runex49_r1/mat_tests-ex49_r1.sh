@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex49 -petsc_ci -rect1  > ex49_r1.tmp 2> runex49_r1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex49 -petsc_ci -rect1  > ex49_r1_par.tmp 2> runex49_r1_par.err
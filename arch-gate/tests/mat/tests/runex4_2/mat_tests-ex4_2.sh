@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex4 -petsc_ci -mat_type dense  > ex4_2.tmp 2> runex4_2.err
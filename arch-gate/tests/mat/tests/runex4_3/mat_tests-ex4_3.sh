@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex4 -petsc_ci -mat_type aij  > ex4_3.tmp 2> runex4_3.err
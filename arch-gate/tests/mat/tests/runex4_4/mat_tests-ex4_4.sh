@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex4 -petsc_ci -mat_type dense  > ex4_4.tmp 2> runex4_4.err
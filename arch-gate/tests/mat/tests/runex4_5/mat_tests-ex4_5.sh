@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex4 -petsc_ci -mat_type aij -test_all  > ex4_5.tmp 2> runex4_5.err
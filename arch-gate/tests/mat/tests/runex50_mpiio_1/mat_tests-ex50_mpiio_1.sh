@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex50 -petsc_ci -viewer_binary_mpiio 1  > ex50_mpiio_1.tmp 2> runex50_mpiio_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex50 -petsc_ci -viewer_binary_mpiio 1  > ex50_mpiio_3.tmp 2> runex50_mpiio_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex50.out ex50_mpiio_4.tmp > diff-runex50_mpiio_4.out 2> diff-runex50_mpiio_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex50 -petsc_ci -viewer_binary_mpiio 1  > ex50_mpiio_4.tmp 2> runex50_mpiio_4.err
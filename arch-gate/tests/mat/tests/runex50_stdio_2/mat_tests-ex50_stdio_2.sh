@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex50 -petsc_ci -viewer_binary_mpiio 0  > ex50_stdio_2.tmp 2> runex50_stdio_2.err
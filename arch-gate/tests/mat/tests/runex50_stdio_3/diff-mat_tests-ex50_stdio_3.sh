@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex50.out ex50_stdio_3.tmp > diff-runex50_stdio_3.out 2> diff-runex50_stdio_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex50 -petsc_ci -viewer_binary_mpiio 0  > ex50_stdio_3.tmp 2> runex50_stdio_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex50 -petsc_ci -viewer_binary_mpiio 0  > ex50_stdio_4.tmp 2> runex50_stdio_4.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex51 -petsc_ci   -mat_block_size 8 -ov 1 -mat_size 13 -nd 7 > ex51_1.tmp 2> runex51_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex52_3.out ex52_3.tmp > diff-runex52_3.out 2> diff-runex52_3.out
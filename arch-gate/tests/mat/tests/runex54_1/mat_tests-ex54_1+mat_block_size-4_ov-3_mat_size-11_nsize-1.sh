@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex54 -petsc_ci -nd 7  -mat_block_size 4 -ov 3 -mat_size 11 > ex54_1.tmp 2> runex54_1.err
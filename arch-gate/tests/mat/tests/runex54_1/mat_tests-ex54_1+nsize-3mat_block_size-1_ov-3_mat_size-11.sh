@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex54 -petsc_ci -nd 7  -mat_block_size 1 -ov 3 -mat_size 11 > ex54_1.tmp 2> runex54_1.err
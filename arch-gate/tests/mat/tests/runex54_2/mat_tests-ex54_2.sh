@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex54 -petsc_ci -nd 2 -test_nd0  > ex54_2.tmp 2> runex54_2.err
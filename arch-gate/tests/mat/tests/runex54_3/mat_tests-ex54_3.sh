@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex54 -petsc_ci -nd 2 -test_nd0  > ex54_3.tmp 2> runex54_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex55 -petsc_ci   > ex55_1.tmp 2> runex55_1.err
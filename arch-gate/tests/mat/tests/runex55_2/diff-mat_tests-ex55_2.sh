@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex55_2.out ex55_2.tmp > diff-runex55_2.out 2> diff-runex55_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex55 -petsc_ci   > ex55_2.tmp 2> runex55_2.err
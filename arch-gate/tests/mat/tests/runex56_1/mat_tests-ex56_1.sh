@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex56 -petsc_ci   > ex56_1.tmp 2> runex56_1.err
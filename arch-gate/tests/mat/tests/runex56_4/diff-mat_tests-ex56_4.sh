@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v " MPI process"'  /root/repo/src/mat/tests/output/ex56_4.out ex56_4.tmp > diff-runex56_4.out 2> diff-runex56_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex56 -petsc_ci -ass_extern  > ex56_4.tmp 2> runex56_4.err
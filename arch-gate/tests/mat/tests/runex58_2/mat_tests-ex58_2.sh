@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex58 -petsc_ci   > ex58_2.tmp 2> runex58_2.err
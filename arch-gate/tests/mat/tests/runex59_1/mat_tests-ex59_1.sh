@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex59 -petsc_ci   > ex59_1.tmp 2> runex59_1.err
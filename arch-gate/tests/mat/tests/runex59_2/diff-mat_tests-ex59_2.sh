@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex59_2.out ex59_2.tmp > diff-runex59_2.out 2> diff-runex59_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex59 -petsc_ci   > ex59_2.tmp 2> runex59_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex59_2_baij.out ex59_2_baij.tmp > diff-runex59_2_baij.out 2> diff-runex59_2_baij.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex59 -petsc_ci -mat_type baij  > ex59_2_baij.tmp 2> runex59_2_baij.err
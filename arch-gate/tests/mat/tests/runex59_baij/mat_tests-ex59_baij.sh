@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex59 -petsc_ci -mat_type baij  > ex59_baij.tmp 2> runex59_baij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex59_1_sbaij.out ex59_sbaij.tmp > diff-runex59_sbaij.out 2> diff-runex59_sbaij.out
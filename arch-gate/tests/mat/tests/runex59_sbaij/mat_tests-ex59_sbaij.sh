@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex59 -petsc_ci -mat_type sbaij  > ex59_sbaij.tmp 2> runex59_sbaij.err
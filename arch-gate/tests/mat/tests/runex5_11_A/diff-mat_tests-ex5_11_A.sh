@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type'  /root/repo/src/mat/tests/output/ex5_11_A.out ex5_11_A.tmp > diff-runex5_11_A.out 2> diff-runex5_11_A.out
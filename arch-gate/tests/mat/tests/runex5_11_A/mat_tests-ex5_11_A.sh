@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -mat_type seqaij -rectA  > ex5_11_A.tmp 2> runex5_11_A.err
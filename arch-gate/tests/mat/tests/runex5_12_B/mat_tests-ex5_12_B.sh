@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -mat_type seqdense -rectB  > ex5_12_B.tmp 2> runex5_12_B.err
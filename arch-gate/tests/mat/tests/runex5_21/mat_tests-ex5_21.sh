@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -mat_type mpiaij  > ex5_21.tmp 2> runex5_21.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -mat_type mpidense  > ex5_22.tmp 2> runex5_22.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type'  /root/repo/src/mat/tests/output/ex5_23.out ex5_23.tmp > diff-runex5_23.out 2> diff-runex5_23.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex5 -petsc_ci -mat_type mpiaij  > ex5_23.tmp 2> runex5_23.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex5_24.out ex5_24.tmp > diff-runex5_24.out 2> diff-runex5_24.out
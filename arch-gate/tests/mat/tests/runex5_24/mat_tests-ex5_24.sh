@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex5 -petsc_ci -mat_type mpidense  > ex5_24.tmp 2> runex5_24.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type'  /root/repo/src/mat/tests/output/ex5_31.out ex5_31.tmp > diff-runex5_31.out 2> diff-runex5_31.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -mat_type mpiaij -test_diagonalscale  > ex5_31.tmp 2> runex5_31.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -mat_type mpibaij -test_diagonalscale  > ex5_32.tmp 2> runex5_32.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex5 -petsc_ci -mat_type mpiaij -test_diagonalscale  > ex5_33.tmp 2> runex5_33.err
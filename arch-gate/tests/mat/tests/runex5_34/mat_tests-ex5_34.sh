@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex5 -petsc_ci -mat_type mpibaij -test_diagonalscale  > ex5_34.tmp 2> runex5_34.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -mat_type sell -mat_sell_slice_height 8  > ex5_sell_1.tmp 2> runex5_sell_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex5_51.out ex5_sell_3.tmp > diff-runex5_sell_3.out 2> diff-runex5_sell_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -mat_type sell -test_diagonalscale -mat_sell_slice_height 8  > ex5_sell_3.tmp 2> runex5_sell_3.err
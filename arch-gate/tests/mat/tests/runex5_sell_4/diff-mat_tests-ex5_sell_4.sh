@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex5_53.out ex5_sell_4.tmp > diff-runex5_sell_4.out 2> diff-runex5_sell_4.out
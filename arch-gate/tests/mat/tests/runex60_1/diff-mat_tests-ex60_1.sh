@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex60_1.out ex60_1.tmp > diff-runex60_1.out 2> diff-runex60_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex60 -petsc_ci -col 7  > ex60_1.tmp 2> runex60_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex60 -petsc_ci -col 7 -mat_type dense  -vec_type standard > ex60_dense.tmp 2> runex60_dense.err
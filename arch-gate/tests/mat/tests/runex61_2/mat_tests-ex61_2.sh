@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex61 -petsc_ci -baij  > ex61_2.tmp 2> runex61_2.err
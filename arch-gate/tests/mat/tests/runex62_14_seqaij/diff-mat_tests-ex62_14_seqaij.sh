@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex62_1.out ex62_14_seqaij.tmp > diff-runex62_14_seqaij.out 2> diff-runex62_14_seqaij.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex62 -petsc_ci -fA ${wPETSC_DIR}/share/petsc/datafiles/matrices/tiny_system -fB ${wPETSC_DIR}/share/petsc/datafiles/matrices/tiny_system  > ex62_14_seqaij.tmp 2> runex62_14_seqaij.err
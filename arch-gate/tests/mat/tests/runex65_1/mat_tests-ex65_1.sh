@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex65 -petsc_ci   > ex65_1.tmp 2> runex65_1.err
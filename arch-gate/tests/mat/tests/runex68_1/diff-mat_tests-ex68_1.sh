@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex68_1.out ex68_1.tmp > diff-runex68_1.out 2> diff-runex68_1.out
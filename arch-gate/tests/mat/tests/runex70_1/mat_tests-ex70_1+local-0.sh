@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex70 -petsc_ci -testshellops  -local 0 > ex70_1.tmp 2> runex70_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex70 -petsc_ci -testmatmatt 0  -local 0 > ex70_1_par.tmp 2> runex70_1_par.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex70 -petsc_ci   -M 11 -N 12 -K 1 -local 0 > ex70_2.tmp 2> runex70_2.err
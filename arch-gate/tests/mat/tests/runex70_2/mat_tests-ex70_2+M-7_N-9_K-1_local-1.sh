@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex70 -petsc_ci   -M 7 -N 9 -K 1 -local 1 > ex70_2.tmp 2> runex70_2.err
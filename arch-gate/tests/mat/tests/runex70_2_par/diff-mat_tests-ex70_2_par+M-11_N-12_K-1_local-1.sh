@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex70_1.out ex70_2_par.tmp > diff-runex70_2_par.out 2> diff-runex70_2_par.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex70 -petsc_ci -testcircular -testmatmatt 0  -M 11 -N 9 -K 1 -local 1 > ex70_2_par.tmp 2> runex70_2_par.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex70 -petsc_ci -M 13 -N 13 -A_mat_type sbaij -symm -testproj 0 -testmatmatt 0  -K 3 -local 1 > ex70_3.tmp 2> runex70_3.err
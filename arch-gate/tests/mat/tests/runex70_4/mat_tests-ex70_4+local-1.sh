@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex70 -petsc_ci -M 3 -N 3 -K 3 -testcircular  -local 1 > ex70_4.tmp 2> runex70_4.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex70 -petsc_ci -M 3 -N 3 -K 3 -testcircular -testmatmatt 0  -local 0 > ex70_5.tmp 2> runex70_5.err
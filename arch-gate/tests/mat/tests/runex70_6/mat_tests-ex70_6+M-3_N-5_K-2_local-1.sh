@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex70 -petsc_ci -testcircular  -M 3 -N 5 -K 2 -local 1 > ex70_6.tmp 2> runex70_6.err
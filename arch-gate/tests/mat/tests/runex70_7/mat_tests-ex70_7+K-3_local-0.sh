@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex70 -petsc_ci -M 13 -N 13 -A_mat_type dense -testnest -testcircular  -K 3 -local 0 > ex70_7.tmp 2> runex70_7.err
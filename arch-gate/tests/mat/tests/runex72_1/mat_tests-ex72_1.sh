@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex72 -petsc_ci -fin ${wPETSC_DIR}/share/petsc/datafiles/matrices/amesos2_test_mat0.mtx -fout petscmat.aij  > ex72_1.tmp 2> runex72_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex72_2.out ex72_2.tmp > diff-runex72_2.out 2> diff-runex72_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex72 -petsc_ci -fin ${wPETSC_DIR}/share/petsc/datafiles/matrices/LFAT5.mtx -fout petscmat.sbaij  > ex72_2.tmp 2> runex72_2.err
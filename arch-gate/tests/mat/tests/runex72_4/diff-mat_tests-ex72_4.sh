@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex72_4.out ex72_4.tmp > diff-runex72_4.out 2> diff-runex72_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex74 -petsc_ci   -bs 1 > ex74_1.tmp 2> runex74_1.err
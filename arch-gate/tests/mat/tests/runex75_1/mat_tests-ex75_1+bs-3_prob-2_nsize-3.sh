@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex75 -petsc_ci -mat_ignore_lower_triangular  -bs 3 -prob 2 > ex75_1.tmp 2> runex75_1.err
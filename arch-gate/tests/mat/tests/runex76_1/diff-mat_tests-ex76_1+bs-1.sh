@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex76_1.out ex76_1.tmp > diff-runex76_1.out 2> diff-runex76_1.out
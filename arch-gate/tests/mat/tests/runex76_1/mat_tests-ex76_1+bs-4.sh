@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex76 -petsc_ci   -bs 4 > ex76_1.tmp 2> runex76_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex76_1.out ex76_3.tmp > diff-runex76_3.out 2> diff-runex76_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex76 -petsc_ci -testaij  > ex76_3.tmp 2> runex76_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex77 -petsc_ci   -bs 2 > ex77_1.tmp 2> runex77_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -m 1 -n 1 -fill 0.49  > ex7_2.tmp 2> runex7_2.err
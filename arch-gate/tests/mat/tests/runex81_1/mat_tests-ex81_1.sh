@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex81 -petsc_ci   > ex81_1.tmp 2> runex81_1.err
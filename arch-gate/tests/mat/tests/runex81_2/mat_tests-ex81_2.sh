@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex81 -petsc_ci -AtB_mat_product_algorithm at*b  > ex81_2.tmp 2> runex81_2.err
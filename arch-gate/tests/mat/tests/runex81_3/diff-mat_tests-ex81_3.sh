@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex81_1.out ex81_3.tmp > diff-runex81_3.out 2> diff-runex81_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex81 -petsc_ci -AtB_mat_product_algorithm outerproduct  > ex81_3.tmp 2> runex81_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex81_3.out ex81_4.tmp > diff-runex81_4.out 2> diff-runex81_4.out
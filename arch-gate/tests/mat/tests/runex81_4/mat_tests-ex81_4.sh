@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex81 -petsc_ci -AtB_mat_product_algorithm nonscalable  > ex81_4.tmp 2> runex81_4.err
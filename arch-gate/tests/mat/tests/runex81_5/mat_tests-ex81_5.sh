@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex81 -petsc_ci -AtB_mat_product_algorithm scalable  > ex81_5.tmp 2> runex81_5.err
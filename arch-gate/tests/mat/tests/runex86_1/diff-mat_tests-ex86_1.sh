@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex86_1.out ex86_1.tmp > diff-runex86_1.out 2> diff-runex86_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex86 -petsc_ci   > ex86_1.tmp 2> runex86_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex86 -petsc_ci -mat_type baij  > ex86_2.tmp 2> runex86_2.err
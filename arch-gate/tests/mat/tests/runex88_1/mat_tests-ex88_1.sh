@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex88 -petsc_ci   > ex88_1.tmp 2> runex88_1.err
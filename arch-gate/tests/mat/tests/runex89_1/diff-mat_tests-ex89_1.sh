@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex89_1.out ex89_1.tmp > diff-runex89_1.out 2> diff-runex89_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex89 -petsc_ci -M 10 -N 10 -Z 10  > ex89_1.tmp 2> runex89_1.err
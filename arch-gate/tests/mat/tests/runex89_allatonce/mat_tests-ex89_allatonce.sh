@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex89 -petsc_ci -M 10 -N 10 -Z 10  > ex89_allatonce.tmp 2> runex89_allatonce.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex89 -petsc_ci -M 10 -M 5 -M 10 -mat_product_algorithm allatonce_merged  > ex89_allatonce_merged.tmp 2> runex89_allatonce_merged.err
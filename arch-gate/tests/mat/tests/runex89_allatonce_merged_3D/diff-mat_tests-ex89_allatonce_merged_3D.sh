@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex89_3.out ex89_allatonce_merged_3D.tmp > diff-runex89_allatonce_merged_3D.out 2> diff-runex89_allatonce_merged_3D.out
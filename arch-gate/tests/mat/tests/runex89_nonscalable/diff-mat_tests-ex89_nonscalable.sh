@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex89_5.out ex89_nonscalable.tmp > diff-runex89_nonscalable.out 2> diff-runex89_nonscalable.out
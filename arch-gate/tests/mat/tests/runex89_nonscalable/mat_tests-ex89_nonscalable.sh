@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex89 -petsc_ci -M 10 -N 10 -Z 10 -mat_product_algorithm nonscalable  > ex89_nonscalable.tmp 2> runex89_nonscalable.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex89_4.out ex89_nonscalable_3D.tmp > diff-runex89_nonscalable_3D.out 2> diff-runex89_nonscalable_3D.out
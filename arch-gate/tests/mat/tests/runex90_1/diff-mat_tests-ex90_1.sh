@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex90_1.out ex90_1.tmp > diff-runex90_1.out 2> diff-runex90_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex90 -petsc_ci -matptap_via allatonce  > ex90_1.tmp 2> runex90_1.err
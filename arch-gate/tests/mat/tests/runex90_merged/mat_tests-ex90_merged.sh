@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex90 -petsc_ci -matptap_via allatonce_merged  > ex90_merged.tmp 2> runex90_merged.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex91 -petsc_ci -ov 2  > ex91_1.tmp 2> runex91_1.err
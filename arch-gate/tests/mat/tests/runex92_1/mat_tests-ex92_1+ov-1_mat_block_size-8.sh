@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex92 -petsc_ci -test_overlap -test_submat  -ov 1 -mat_block_size 8 > ex92_1.tmp 2> runex92_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex92 -petsc_ci -test_overlap -test_allcols  -ov 1 -mat_block_size 8 > ex92_3.tmp 2> runex92_3.err
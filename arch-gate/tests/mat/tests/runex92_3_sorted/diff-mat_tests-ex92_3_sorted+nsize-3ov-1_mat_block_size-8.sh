@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex92_1.out ex92_3_sorted.tmp > diff-runex92_3_sorted.out 2> diff-runex92_3_sorted.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex92 -petsc_ci -test_overlap -test_allcols -test_sorted  -ov 3 -mat_block_size 8 > ex92_3_sorted.tmp 2> runex92_3_sorted.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex92 -petsc_ci -test_submat -test_allcols  -ov 1 -mat_block_size 2 > ex92_4.tmp 2> runex92_4.err
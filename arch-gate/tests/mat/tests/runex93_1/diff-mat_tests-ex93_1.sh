@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex93_1.out ex93_1.tmp > diff-runex93_1.out 2> diff-runex93_1.out
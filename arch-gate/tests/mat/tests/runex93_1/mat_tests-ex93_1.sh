@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex93 -petsc_ci   > ex93_1.tmp 2> runex93_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex93 -petsc_ci -matmatmult_via nonscalable  > ex93_2.tmp 2> runex93_2.err
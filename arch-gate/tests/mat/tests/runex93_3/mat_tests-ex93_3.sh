@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex93 -petsc_ci   > ex93_3.tmp 2> runex93_3.err
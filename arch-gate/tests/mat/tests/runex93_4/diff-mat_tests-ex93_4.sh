@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex93_1.out ex93_4.tmp > diff-runex93_4.out 2> diff-runex93_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex93 -petsc_ci -matptap_via scalable  > ex93_4.tmp 2> runex93_4.err
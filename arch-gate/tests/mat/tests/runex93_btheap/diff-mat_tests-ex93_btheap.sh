@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex93_1.out ex93_btheap.tmp > diff-runex93_btheap.out 2> diff-runex93_btheap.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex93 -petsc_ci -matmatmult_via btheap -matmattransmult_via color  > ex93_btheap.tmp 2> runex93_btheap.err
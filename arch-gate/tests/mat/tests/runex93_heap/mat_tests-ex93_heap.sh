@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex93 -petsc_ci -matmatmult_via heap  > ex93_heap.tmp 2> runex93_heap.err
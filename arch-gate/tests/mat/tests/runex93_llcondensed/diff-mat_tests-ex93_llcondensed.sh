@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex93_1.out ex93_llcondensed.tmp > diff-runex93_llcondensed.out 2> diff-runex93_llcondensed.out
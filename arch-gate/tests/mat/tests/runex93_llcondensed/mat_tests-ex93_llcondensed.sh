@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex93 -petsc_ci -matmatmult_via llcondensed  > ex93_llcondensed.tmp 2> runex93_llcondensed.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex93 -petsc_ci -matmatmult_via scalable  > ex93_scalable.tmp 2> runex93_scalable.err
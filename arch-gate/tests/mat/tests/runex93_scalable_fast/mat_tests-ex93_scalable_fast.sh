@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex93 -petsc_ci -matmatmult_via scalable_fast  > ex93_scalable_fast.tmp 2> runex93_scalable_fast.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex93 -petsc_ci -matmatmult_via threaded -matptap_via threaded  -mat_product_threaded_hash 1 > ex93_threaded.tmp 2> runex93_threaded.err
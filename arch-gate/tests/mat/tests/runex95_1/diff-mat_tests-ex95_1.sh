@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v " MPI process"'  /root/repo/src/mat/tests/output/ex95_1.out ex95_1.tmp > diff-runex95_1.out 2> diff-runex95_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex95 -petsc_ci   > ex95_1.tmp 2> runex95_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v " MPI process"'  /root/repo/src/mat/tests/output/ex95_2.out ex95_2.tmp > diff-runex95_2.out 2> diff-runex95_2.out
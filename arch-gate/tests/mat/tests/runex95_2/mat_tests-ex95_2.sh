@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex95 -petsc_ci   > ex95_2.tmp 2> runex95_2.err
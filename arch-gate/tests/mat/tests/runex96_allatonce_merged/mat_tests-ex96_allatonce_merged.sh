@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex96 -petsc_ci -Mx 10 -My 5 -Mz 10 -matmatmult_via scalable -matptap_via allatonce_merged  > ex96_allatonce_merged.tmp 2> runex96_allatonce_merged.err
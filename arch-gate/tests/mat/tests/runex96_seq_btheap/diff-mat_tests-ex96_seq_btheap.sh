@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex96_1.out ex96_seq_btheap.tmp > diff-runex96_seq_btheap.out 2> diff-runex96_seq_btheap.out
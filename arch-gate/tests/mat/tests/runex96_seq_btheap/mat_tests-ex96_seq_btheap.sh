@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex96 -petsc_ci -Mx 10 -My 5 -Mz 10 -matmatmult_via scalable -matptap_via scalable -inner_diag_mat_product_algorithm btheap -inner_offdiag_mat_product_algorithm btheap  > ex96_seq_btheap.tmp 2> runex96_seq_btheap.err
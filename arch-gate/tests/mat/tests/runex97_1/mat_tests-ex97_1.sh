@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex97 -petsc_ci   > ex97_1.tmp 2> runex97_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex98_1.out ex98_1.tmp > diff-runex98_1.out 2> diff-runex98_1.out
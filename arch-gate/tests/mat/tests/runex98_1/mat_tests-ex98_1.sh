@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex98 -petsc_ci   > ex98_1.tmp 2> runex98_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex99_1.out ex99_1.tmp > diff-runex99_1.out 2> diff-runex99_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex99 -petsc_ci   > ex99_1.tmp 2> runex99_1.err
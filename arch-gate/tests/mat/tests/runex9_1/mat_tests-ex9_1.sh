@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex9 -petsc_ci -view_info  > ex9_1.tmp 2> runex9_1.err
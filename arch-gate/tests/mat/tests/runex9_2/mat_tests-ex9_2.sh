@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex9 -petsc_ci -nsubcomms 2 -view_mat -psubcomm_type interlaced  > ex9_2.tmp 2> runex9_2.err
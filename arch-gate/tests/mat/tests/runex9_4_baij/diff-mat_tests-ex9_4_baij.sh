@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex9_4_baij.out ex9_4_baij.tmp > diff-runex9_4_baij.out 2> diff-runex9_4_baij.out
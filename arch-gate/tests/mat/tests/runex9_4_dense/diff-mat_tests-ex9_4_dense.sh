@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex9_4_dense.out ex9_4_dense.tmp > diff-runex9_4_dense.out 2> diff-runex9_4_dense.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/mat/tests/output/ex9_4_sbaij.out ex9_4_sbaij.tmp > diff-runex9_4_sbaij.out 2> diff-runex9_4_sbaij.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex9 -petsc_ci -mat_type sbaij -nsubcomms 2 -view_mat -psubcomm_type interlaced  > ex9_4_sbaij.tmp 2> runex9_4_sbaij.err
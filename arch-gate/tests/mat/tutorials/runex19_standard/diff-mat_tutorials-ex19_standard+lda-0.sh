@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v -i type'  /root/repo/src/mat/tutorials/output/ex19.out ex19_standard.tmp > diff-runex19_standard.out 2> diff-runex19_standard.out
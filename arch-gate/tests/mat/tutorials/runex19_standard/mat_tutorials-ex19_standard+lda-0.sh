@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex19 -petsc_ci -ex19_mat_view -vec_type standard  -lda 0 > ex19_standard.tmp 2> runex19_standard.err
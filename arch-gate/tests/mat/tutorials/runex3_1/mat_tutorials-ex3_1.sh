@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex3 -petsc_ci   > ex3_1.tmp 2> runex3_1.err
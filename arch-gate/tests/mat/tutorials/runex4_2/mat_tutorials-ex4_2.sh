@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex4 -petsc_ci   > ex4_2.tmp 2> runex4_2.err
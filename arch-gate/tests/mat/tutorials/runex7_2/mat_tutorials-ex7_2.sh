@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -info ex7info.2  > ex7_2.tmp 2> runex7_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex7 -petsc_ci -info ex7info.3  > ex7_3.tmp 2> runex7_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h -ve Running -ve communicator -ve MPI_Comm -ve OpenMP -ve PetscGetHostName -ve PetscSetFPTrap -ve PetscDetermineInitialFPTrap'  /root/repo/src/mat/tutorials/output/ex7_4.out ex7_4.tmp > diff-runex7_4.out 2> diff-runex7_4.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h  -ve PetscSetFPTrap -ve PetscDetermineInitialFPTrap'  /root/repo/src/mat/tutorials/output/ex7_5.out ex7_5.tmp > diff-runex7_5.out 2> diff-runex7_5.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -info :~sys:  > ex7_5.tmp 2> runex7_5.err
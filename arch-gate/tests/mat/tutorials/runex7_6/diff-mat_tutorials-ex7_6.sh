@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h "ex7info.6.0" | sort -b'  /root/repo/src/mat/tutorials/output/ex7_6.out ex7_6.tmp > diff-runex7_6.out 2> diff-runex7_6.out
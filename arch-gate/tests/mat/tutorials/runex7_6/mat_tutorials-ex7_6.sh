@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex7 -petsc_ci -info ex7info.6:mat:self  > ex7_6.tmp 2> runex7_6.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h "ex7info.7.0" | sort -b'  /root/repo/src/mat/tutorials/output/ex7_7.out ex7_7.tmp > diff-runex7_7.out 2> diff-runex7_7.out
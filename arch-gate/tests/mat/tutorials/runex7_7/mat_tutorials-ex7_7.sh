@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex7 -petsc_ci -info ex7info.7:mat:~self  > ex7_7.tmp 2> runex7_7.err
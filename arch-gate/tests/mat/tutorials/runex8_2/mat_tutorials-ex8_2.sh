@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex8 -petsc_ci   > ex8_2.tmp 2> runex8_2.err
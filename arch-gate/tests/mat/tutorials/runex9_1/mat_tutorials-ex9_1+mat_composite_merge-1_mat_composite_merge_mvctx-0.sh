@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex9 -petsc_ci   -mat_composite_merge 1 -mat_composite_merge_mvctx 0 > ex9_1.tmp 2> runex9_1.err
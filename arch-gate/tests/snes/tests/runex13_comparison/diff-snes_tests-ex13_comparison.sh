@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex13_comparison.out ex13_comparison.tmp > diff-runex13_comparison.out 2> diff-runex13_comparison.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex15_particle_hdiv_5.out ex15_particle_hdiv_5.tmp > diff-runex15_particle_hdiv_5.out 2> diff-runex15_particle_hdiv_5.out
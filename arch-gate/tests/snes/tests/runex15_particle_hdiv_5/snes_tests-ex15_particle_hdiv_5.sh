@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex15 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_bd periodic,none -dm_plex_box_faces 3,1 -dm_plex_box_lower 0,-1 -dm_plex_box_upper 6.283185307179586,1 -phi_petscspace_degree 0 -phi_petscdualspace_lagrange_use_moments -phi_petscdualspace_lagrange_moment_order 2 -q_petscfe_default_quadrature_order 1 -q_petscspace_type sum -q_petscspace_variables 2 -q_petscspace_components 2 -q_petscspace_sum_spaces 2 -q_petscspace_sum_concatenate true -q_sumcomp_0_petscspace_variables 2 -q_sumcomp_0_petscspace_type tensor -q_sumcomp_0_petscspace_tensor_spaces 2 -q_sumcomp_0_petscspace_tensor_uniform false -q_sumcomp_0_tensorcomp_0_petscspace_degree 1 -q_sumcomp_0_tensorcomp_1_petscspace_degree 0 -q_sumcomp_1_petscspace_variables 2 -q_sumcomp_1_petscspace_type tensor -q_sumcomp_1_petscspace_tensor_spaces 2 -q_sumcomp_1_petscspace_tensor_uniform false -q_sumcomp_1_tensorcomp_0_petscspace_degree 0 -q_sumcomp_1_tensorcomp_1_petscspace_degree 1 -q_petscdualspace_form_degree -1 -q_petscdualspace_order 1 -q_petscdualspace_lagrange_trimmed true -ksp_error_if_not_converged -pc_type fieldsplit -pc_fieldsplit_type schur -pc_fieldsplit_schur_fact_type full -pc_fieldsplit_schur_precondition full -dm_swarm_num_particles 100 -dm_swarm_coordinate_density constant -particleRHS -sol_type particles -fieldsplit_q_pc_type lu -fieldsplit_phi_pc_type svd  > ex15_particle_hdiv_5.tmp 2> runex15_particle_hdiv_5.err
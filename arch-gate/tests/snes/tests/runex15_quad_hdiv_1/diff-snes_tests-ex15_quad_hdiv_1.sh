@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/Taylor approximation converging at order.*//"'  /root/repo/src/snes/tests/output/ex15_quad_hdiv_1.out ex15_quad_hdiv_1.tmp > diff-runex15_quad_hdiv_1.out 2> diff-runex15_quad_hdiv_1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex15_quad_hdiv_4.out ex15_quad_hdiv_4.tmp > diff-runex15_quad_hdiv_4.out 2> diff-runex15_quad_hdiv_4.out
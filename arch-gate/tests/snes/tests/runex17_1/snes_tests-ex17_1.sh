@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex17 -petsc_ci -snes_monitor_short  > ex17_1.tmp 2> runex17_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -ksp_gmres_cgs_refinement_type refine_always  > ex1_1.tmp 2> runex1_1.err
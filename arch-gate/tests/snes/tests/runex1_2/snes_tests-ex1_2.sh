@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -snes_monitor_short -snes_type newtontr -ksp_gmres_cgs_refinement_type refine_always  > ex1_2.tmp 2> runex1_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -i KSPConvergedDefault > /dev/null && echo "Found KSPConvergedDefault"'  /root/repo/src/snes/tests/output/ex1_2a.out ex1_2a.tmp > diff-runex1_2a.out 2> diff-runex1_2a.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -snes_monitor_short -snes_type newtontr -ksp_gmres_cgs_refinement_type refine_always -info  > ex1_2a.tmp 2> runex1_2a.err
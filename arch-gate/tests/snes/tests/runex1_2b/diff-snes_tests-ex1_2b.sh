@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -i  "User provided convergence test" > /dev/null  && echo "Found User provided convergence test"'  /root/repo/src/snes/tests/output/ex1_2b.out ex1_2b.tmp > diff-runex1_2b.out 2> diff-runex1_2b.out
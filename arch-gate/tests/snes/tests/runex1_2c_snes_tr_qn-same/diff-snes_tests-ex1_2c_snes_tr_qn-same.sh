@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex1_2c_snes_tr_qn-same.out ex1_2c_snes_tr_qn-same.tmp > diff-runex1_2c_snes_tr_qn-same.out 2> diff-runex1_2c_snes_tr_qn-same.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -snes_converged_reason -snes_type newtontr -pc_type mat -snes_view -snes_tr_qn_mat_type lmvmdfp -snes_tr_norm_type infinity -snes_tr_qn same  > ex1_2c_snes_tr_qn-same.tmp 2> runex1_2c_snes_tr_qn-same.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex1_4.out ex1_4.tmp > diff-runex1_4.out 2> diff-runex1_4.out
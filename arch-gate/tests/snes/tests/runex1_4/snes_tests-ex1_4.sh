@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -pc -par 6.807 -snes_monitor -snes_converged_reason  > ex1_4.tmp 2> runex1_4.err
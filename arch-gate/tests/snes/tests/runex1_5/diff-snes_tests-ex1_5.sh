@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex1_3.out ex1_5.tmp > diff-runex1_5.out 2> diff-runex1_5.out
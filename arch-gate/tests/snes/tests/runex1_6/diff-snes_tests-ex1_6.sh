@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex1_6.out ex1_6.tmp > diff-runex1_6.out 2> diff-runex1_6.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -snes_monitor draw:image:testfile -viewer_view  > ex1_6.tmp 2> runex1_6.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex20 -petsc_ci -snes_monitor_short -pc_mg_type full -ksp_type fgmres -pc_type mg -snes_view -pc_mg_levels 2 -pc_mg_galerkin pmat  > ex20_1.tmp 2> runex20_1.err
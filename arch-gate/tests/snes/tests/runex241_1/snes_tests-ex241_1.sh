@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex241 -petsc_ci -snes_monitor_solution -snes_linesearch_monitor  > ex241_1.tmp 2> runex241_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex4 -petsc_ci -snes_converged_reason -snes_linesearch_monitor -snes_linesearch_type l2  > ex4_1.tmp 2> runex4_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex68_2.out ex68_2.tmp > diff-runex68_2.out 2> diff-runex68_2.out
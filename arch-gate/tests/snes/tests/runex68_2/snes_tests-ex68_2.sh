@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex68 -petsc_ci -problem 2 -pc_type jacobi -snes_monitor  > ex68_2.tmp 2> runex68_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex69_1.out ex69_1.tmp > diff-runex69_1.out 2> diff-runex69_1.out
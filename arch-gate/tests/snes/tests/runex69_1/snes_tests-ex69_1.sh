@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex69 -petsc_ci -snes_converged_reason -ksp_converged_reason  > ex69_1.tmp 2> runex69_1.err
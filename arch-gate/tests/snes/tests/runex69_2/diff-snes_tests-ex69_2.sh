@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex69_2.out ex69_2.tmp > diff-runex69_2.out 2> diff-runex69_2.out
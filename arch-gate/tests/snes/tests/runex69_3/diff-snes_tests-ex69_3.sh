@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex69_3.out ex69_3.tmp > diff-runex69_3.out 2> diff-runex69_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex69_4.out ex69_4.tmp > diff-runex69_4.out 2> diff-runex69_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex69 -petsc_ci -snes_converged_reason -ksp_converged_reason -error_in_pcsetup -fp_trap 0  > ex69_4.tmp 2> runex69_4.err
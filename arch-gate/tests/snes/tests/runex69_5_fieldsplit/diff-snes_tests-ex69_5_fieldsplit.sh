@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex69_5.out ex69_5_fieldsplit.tmp > diff-runex69_5_fieldsplit.out 2> diff-runex69_5_fieldsplit.out
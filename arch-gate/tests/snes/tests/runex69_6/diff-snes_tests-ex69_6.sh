@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex69_6.out ex69_6.tmp > diff-runex69_6.out 2> diff-runex69_6.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex69_7.out ex69_7.tmp > diff-runex69_7.out 2> diff-runex69_7.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex69 -petsc_ci -snes_converged_reason -ksp_converged_reason -error_in_domain -fp_trap 0  > ex69_7.tmp 2> runex69_7.err
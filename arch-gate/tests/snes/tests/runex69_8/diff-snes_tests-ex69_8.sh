@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex69_8.out ex69_8.tmp > diff-runex69_8-0.out 2> diff-runex69_8-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex69_8_alt.out ex69_8.tmp > diff-runex69_8.out 2> diff-runex69_8.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex69 -petsc_ci -snes_converged_reason -ksp_converged_reason -error_in_domain -snes_mf -pc_type none  > ex69_8.tmp 2> runex69_8.err
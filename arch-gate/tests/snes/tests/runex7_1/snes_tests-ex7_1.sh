@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -ksp_gmres_cgs_refinement_type refine_always -snes_monitor_short  > ex7_1.tmp 2> runex7_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -variant -ksp_gmres_cgs_refinement_type refine_always -snes_monitor_short  > ex7_2.tmp 2> runex7_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex7_3.out ex7_3.tmp > diff-runex7_3-0.out 2> diff-runex7_3-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex7_3_alt.out ex7_3.tmp > diff-runex7_3.out 2> diff-runex7_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex7_4.out ex7_4.tmp > diff-runex7_4-0.out 2> diff-runex7_4-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex7_4_alt.out ex7_4.tmp > diff-runex7_4-1.out 2> diff-runex7_4-1.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex7_4_alt_2.out ex7_4.tmp > diff-runex7_4.out 2> diff-runex7_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -variant -pc_type jacobi -puremf -snes_view -ksp_monitor  > ex7_4.tmp 2> runex7_4.err
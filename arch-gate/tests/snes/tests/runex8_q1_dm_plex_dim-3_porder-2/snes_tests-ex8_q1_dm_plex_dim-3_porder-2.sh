@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex8 -petsc_ci -dm_plex_box_faces 2,2,2 -dm_plex_simplex 0 -petscspace_degree 1 -qorder 1 -dm_plex_dim 3 -porder 2  > ex8_q1_dm_plex_dim-3_porder-2.tmp 2> runex8_q1_dm_plex_dim-3_porder-2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tests/output/ex8_q2_dm_plex_dim-2_porder-1.out ex8_q2_dm_plex_dim-2_porder-1.tmp > diff-runex8_q2_dm_plex_dim-2_porder-1.out 2> diff-runex8_q2_dm_plex_dim-2_porder-1.out
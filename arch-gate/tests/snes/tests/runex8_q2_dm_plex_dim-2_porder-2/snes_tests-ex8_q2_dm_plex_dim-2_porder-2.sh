@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex8 -petsc_ci -dm_plex_box_faces 2,2,2 -dm_plex_simplex 0 -petscspace_degree 2 -qorder 2 -dm_plex_dim 2 -porder 2  > ex8_q2_dm_plex_dim-2_porder-2.tmp 2> runex8_q2_dm_plex_dim-2_porder-2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex10 -petsc_ci -snes_monitor_short  > ex10_1.tmp 2> runex10_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/ex10d/output/ex10_2.out ex10_2.tmp > diff-runex10_2.out 2> diff-runex10_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex10 -petsc_ci -snes_monitor_short -fd_jacobian_coloring  > ex10_2.tmp 2> runex10_2.err
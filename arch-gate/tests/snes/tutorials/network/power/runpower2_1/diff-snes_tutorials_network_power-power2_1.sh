@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/network/power/output/power_1.out power2_1.tmp > diff-runpower2_1.out 2> diff-runpower2_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../power2 -petsc_ci -snes_rtol 1.e-3  > power2_1.tmp 2> runpower2_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/network/power/output/power_1.out power2_2.tmp > diff-runpower2_2.out 2> diff-runpower2_2.out
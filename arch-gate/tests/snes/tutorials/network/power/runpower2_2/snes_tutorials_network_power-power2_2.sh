@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../power2 -petsc_ci -snes_rtol 1.e-3 -petscpartitioner_type simple  > power2_2.tmp 2> runpower2_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/network/power/output/power_1.out power_1.tmp > diff-runpower_1.out 2> diff-runpower_1.out
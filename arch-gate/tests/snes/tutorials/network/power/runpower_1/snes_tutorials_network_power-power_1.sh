@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../power -petsc_ci -snes_rtol 1.e-3  > power_1.tmp 2> runpower_1.err
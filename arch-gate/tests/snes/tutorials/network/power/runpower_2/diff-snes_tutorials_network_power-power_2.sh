@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/network/power/output/power_1.out power_2.tmp > diff-runpower_2.out 2> diff-runpower_2.out
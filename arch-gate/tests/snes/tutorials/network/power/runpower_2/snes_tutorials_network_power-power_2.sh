@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../power -petsc_ci -snes_rtol 1.e-3 -petscpartitioner_type simple  > power_2.tmp 2> runpower_2.err
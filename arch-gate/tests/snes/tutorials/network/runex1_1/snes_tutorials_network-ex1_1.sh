@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -options_left no -dmnetwork_view -fp_trap 0  > ex1_1.tmp 2> runex1_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex1 -petsc_ci -options_left no -distribute false -fp_trap 0  > ex1_3.tmp 2> runex1_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -options_left no -viewCSV -fp_trap 0  > ex1_5.tmp 2> runex1_5.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/network/water/output/water.out water_1.tmp > diff-runwater_1.out 2> diff-runwater_1.out
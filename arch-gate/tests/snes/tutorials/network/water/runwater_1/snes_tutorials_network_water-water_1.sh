@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../water -petsc_ci -water_snes_converged_reason -options_left no -fp_trap 0  > water_1.tmp 2> runwater_1.err
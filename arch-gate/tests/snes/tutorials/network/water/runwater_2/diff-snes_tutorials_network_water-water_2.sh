@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/network/water/output/water.out water_2.tmp > diff-runwater_2.out 2> diff-runwater_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../water -petsc_ci -water_snes_converged_reason -options_left no -fp_trap 0  > water_2.tmp 2> runwater_2.err
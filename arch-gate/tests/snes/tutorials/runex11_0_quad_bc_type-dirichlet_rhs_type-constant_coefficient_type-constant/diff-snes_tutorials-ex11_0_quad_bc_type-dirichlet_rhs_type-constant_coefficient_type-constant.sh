@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex11_0_quad_bc_type-dirichlet_rhs_type-constant_coefficient_type-constant.out ex11_0_quad_bc_type-dirichlet_rhs_type-constant_coefficient_type-constant.tmp > diff-runex11_0_quad_bc_type-dirichlet_rhs_type-constant_coefficient_type-constant.out 2> diff-runex11_0_quad_bc_type-dirichlet_rhs_type-constant_coefficient_type-constant.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex11_0_quad_bc_type-neumann_rhs_type-analytical_coefficient_type-checkerboard.out ex11_0_quad_bc_type-neumann_rhs_type-analytical_coefficient_type-checkerboard.tmp > diff-runex11_0_quad_bc_type-neumann_rhs_type-analytical_coefficient_type-checkerboard.out 2> diff-runex11_0_quad_bc_type-neumann_rhs_type-analytical_coefficient_type-checkerboard.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex11 -petsc_ci -initial_dm_plex_simplex 0 -pc_type svd -snes_type newtonls -snes_error_if_not_converged -bc_type neumann -rhs_type analytical -coefficient_type constant  > ex11_0_quad_bc_type-neumann_rhs_type-analytical_coefficient_type-constant.tmp 2> runex11_0_quad_bc_type-neumann_rhs_type-analytical_coefficient_type-constant.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex11_asm_seq.out ex11_asm_seq.tmp > diff-runex11_asm_seq.out 2> diff-runex11_asm_seq.out
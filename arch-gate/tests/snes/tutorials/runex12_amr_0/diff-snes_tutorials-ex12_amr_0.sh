@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex12_amr_0.out ex12_amr_0.tmp > diff-runex12_amr_0.out 2> diff-runex12_amr_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex12 -petsc_ci -run_type test -petscpartitioner_type simple -dm_plex_simplex 0 -bc_type dirichlet -petscspace_degree 1 -dm_refine 1  > ex12_amr_0.tmp 2> runex12_amr_0.err
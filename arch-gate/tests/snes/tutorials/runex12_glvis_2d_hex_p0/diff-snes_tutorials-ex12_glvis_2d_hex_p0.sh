@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex12_glvis_2d_hex_p0.out ex12_glvis_2d_hex_p0.tmp > diff-runex12_glvis_2d_hex_p0.out 2> diff-runex12_glvis_2d_hex_p0.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex12_glvis_2d_tet_p2.out ex12_glvis_2d_tet_p2.tmp > diff-runex12_glvis_2d_tet_p2.out 2> diff-runex12_glvis_2d_tet_p2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/aijcusparse/aij/g" -e "s/aijviennacl/aij/g" -e "s/factorization: cusparse/factorization: petsc/g"'  /root/repo/src/snes/tutorials/output/ex12_quad_bddc.out ex12_quad_bddc.tmp > diff-runex12_quad_bddc.out 2> diff-runex12_quad_bddc.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex12 -petsc_ci -run_type full -dm_plex_simplex 0 -dm_plex_box_faces 3,3 -petscpartitioner_type simple -dm_refine 2 -bc_type dirichlet -petscspace_degree 2 -dm_mat_type is -pc_type bddc -ksp_type gmres -snes_monitor_short -ksp_monitor_short -snes_view -petscspace_poly_tensor -pc_bddc_corner_selection -ksp_rtol 1.e-9 -pc_bddc_use_edges 0  > ex12_quad_bddc.tmp 2> runex12_quad_bddc.err
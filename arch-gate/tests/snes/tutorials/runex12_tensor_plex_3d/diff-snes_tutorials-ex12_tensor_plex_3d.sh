@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex12_tensor_plex_3d.out ex12_tensor_plex_3d.tmp > diff-runex12_tensor_plex_3d.out 2> diff-runex12_tensor_plex_3d.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex12_vtu_empty.out ex12_vtu_empty.tmp > diff-runex12_vtu_empty.out 2> diff-runex12_vtu_empty.out
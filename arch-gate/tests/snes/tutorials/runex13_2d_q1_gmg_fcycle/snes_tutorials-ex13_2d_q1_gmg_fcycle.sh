@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex13 -petsc_ci -potential_petscspace_degree 1 -dm_refine_hierarchy 2 -ksp_rtol 5e-10 -pc_type mg -pc_mg_type full -mg_levels_ksp_max_it 2 -mg_levels_esteig_ksp_type cg -mg_levels_esteig_ksp_max_it 10 -mg_levels_ksp_chebyshev_esteig 0,0.1,0,1.1 -mg_levels_pc_type jacobi -dm_plex_simplex 0 -dm_plex_box_faces 2,2  > ex13_2d_q1_gmg_fcycle.tmp 2> runex13_2d_q1_gmg_fcycle.err
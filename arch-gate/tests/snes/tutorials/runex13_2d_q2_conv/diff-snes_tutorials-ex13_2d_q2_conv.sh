@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex13_2d_q2_conv.out ex13_2d_q2_conv.tmp > diff-runex13_2d_q2_conv.out 2> diff-runex13_2d_q2_conv.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex13_3d_q1_conv.out ex13_3d_q1_conv.tmp > diff-runex13_3d_q1_conv.out 2> diff-runex13_3d_q1_conv.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex13_3d_q1_gmg_fcycle.out ex13_3d_q1_gmg_fcycle.tmp > diff-runex13_3d_q1_gmg_fcycle.out 2> diff-runex13_3d_q1_gmg_fcycle.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex14 -petsc_ci -snes_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex14_2.tmp 2> runex14_2.err
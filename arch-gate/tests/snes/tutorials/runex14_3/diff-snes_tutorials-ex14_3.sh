@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex14_3.out ex14_3.tmp > diff-runex14_3.out 2> diff-runex14_3.out
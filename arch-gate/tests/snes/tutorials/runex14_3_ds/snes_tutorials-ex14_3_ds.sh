@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex14 -petsc_ci -fdcoloring -fdcoloring_ds -snes_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex14_3_ds.tmp 2> runex14_3_ds.err
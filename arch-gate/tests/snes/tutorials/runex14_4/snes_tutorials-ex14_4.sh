@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex14 -petsc_ci -fdcoloring_local -fdcoloring -ksp_monitor_short -da_refine 1  > ex14_4.tmp 2> runex14_4.err
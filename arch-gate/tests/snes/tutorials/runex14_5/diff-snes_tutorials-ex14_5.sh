@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex14_5.out ex14_5.tmp > diff-runex14_5.out 2> diff-runex14_5.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex14_6.out ex14_6.tmp > diff-runex14_6.out 2> diff-runex14_6.out
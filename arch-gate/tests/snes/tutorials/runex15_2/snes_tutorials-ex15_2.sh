@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex15 -petsc_ci -snes_monitor_short -da_grid_x 20 -da_grid_y 20 -p 1.3 -lambda 1 -jtype PICARD -precheck 1  > ex15_2.tmp 2> runex15_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex15_3.out ex15_3_star.tmp > diff-runex15_3_star.out 2> diff-runex15_3_star.out
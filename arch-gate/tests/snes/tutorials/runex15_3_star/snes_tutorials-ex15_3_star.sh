@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex15 -petsc_ci -snes_monitor_short -da_grid_x 20 -da_grid_y 20 -p 1.3 -lambda 1 -jtype PICARD -picard -precheck 1 -p 3 -alloc_star  > ex15_3_star.tmp 2> runex15_3_star.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex15_5.out ex15_5.tmp > diff-runex15_5.out 2> diff-runex15_5.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex15_mf.out ex15_fd_color_picard.tmp > diff-runex15_fd_color_picard.out 2> diff-runex15_fd_color_picard.out
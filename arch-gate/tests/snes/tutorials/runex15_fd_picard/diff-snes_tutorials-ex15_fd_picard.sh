@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex15_fd_picard.out ex15_fd_picard.tmp > diff-runex15_fd_picard.out 2> diff-runex15_fd_picard.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex15_lag_jac.out ex15_lag_jac.tmp > diff-runex15_lag_jac.out 2> diff-runex15_lag_jac.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex15_nleqerr.out ex15_nleqerr.tmp > diff-runex15_nleqerr.out 2> diff-runex15_nleqerr.out
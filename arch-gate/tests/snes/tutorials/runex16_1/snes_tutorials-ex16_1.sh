@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex16 -petsc_ci -da_refine 2 -pc_type mg -rad 10.0 -young 10. -ploading 0.0 -loading -1. -mg_levels_ksp_max_it 2 -snes_monitor_short -ksp_monitor_short  > ex16_1.tmp 2> runex16_1.err
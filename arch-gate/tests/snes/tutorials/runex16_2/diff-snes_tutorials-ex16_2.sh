@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex16_2.out ex16_2.tmp > diff-runex16_2.out 2> diff-runex16_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex16_3.out ex16_3.tmp > diff-runex16_3-0.out 2> diff-runex16_3-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex16_3_alt.out ex16_3.tmp > diff-runex16_3.out 2> diff-runex16_3.out
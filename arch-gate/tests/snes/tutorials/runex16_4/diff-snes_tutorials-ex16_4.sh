@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h -e "KSP Residual norm" -e "SNES Function norm" -e "Number of SNES iterations" -e "mu:"'  /root/repo/src/snes/tutorials/output/ex16_4.out ex16_4.tmp > diff-runex16_4.out 2> diff-runex16_4.out
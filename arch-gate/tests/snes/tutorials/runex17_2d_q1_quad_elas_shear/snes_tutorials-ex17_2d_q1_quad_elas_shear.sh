@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex17 -petsc_ci -dm_plex_box_faces 1,1,1 -sol_type elas_quad -dm_plex_simplex 0 -deform_type shear -displacement_petscspace_degree 1 -dm_refine 1 -convest_num_refine 3 -snes_convergence_estimate  > ex17_2d_q1_quad_elas_shear.tmp 2> runex17_2d_q1_quad_elas_shear.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex17_2d_q1_quad_vlap_step.out ex17_2d_q1_quad_vlap_step.tmp > diff-runex17_2d_q1_quad_vlap_step.out 2> diff-runex17_2d_q1_quad_vlap_step.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex17_2d_q1_uniform_elas_step.out ex17_2d_q1_uniform_elas_step.tmp > diff-runex17_2d_q1_uniform_elas_step.out 2> diff-runex17_2d_q1_uniform_elas_step.out
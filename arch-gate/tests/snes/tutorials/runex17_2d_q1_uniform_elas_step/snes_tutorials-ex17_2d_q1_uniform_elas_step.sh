@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex17 -petsc_ci -dm_plex_simplex 0 -dm_plex_box_faces 3,3 -deform_type step -displacement_petscspace_degree 1 -dmsnes_check .0001 -pc_type lu -sol_type elas_uniform_strain -dm_refine 2  > ex17_2d_q1_uniform_elas_step.tmp 2> runex17_2d_q1_uniform_elas_step.err
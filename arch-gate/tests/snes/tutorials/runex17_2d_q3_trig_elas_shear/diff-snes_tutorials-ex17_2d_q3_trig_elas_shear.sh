@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex17_2d_q3_trig_elas_shear.out ex17_2d_q3_trig_elas_shear.tmp > diff-runex17_2d_q3_trig_elas_shear.out 2> diff-runex17_2d_q3_trig_elas_shear.out
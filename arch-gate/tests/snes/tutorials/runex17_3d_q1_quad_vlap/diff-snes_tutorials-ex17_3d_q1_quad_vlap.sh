@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex17_3d_q1_quad_vlap.out ex17_3d_q1_quad_vlap.tmp > diff-runex17_3d_q1_quad_vlap.out 2> diff-runex17_3d_q1_quad_vlap.out
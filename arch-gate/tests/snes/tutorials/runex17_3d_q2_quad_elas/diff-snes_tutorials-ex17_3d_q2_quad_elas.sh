@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex17_3d_q2_quad_elas.out ex17_3d_q2_quad_elas.tmp > diff-runex17_3d_q2_quad_elas.out 2> diff-runex17_3d_q2_quad_elas.out
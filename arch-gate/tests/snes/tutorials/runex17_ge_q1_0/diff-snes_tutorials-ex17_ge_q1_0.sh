@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant HERMITIAN"'  /root/repo/src/snes/tutorials/output/ex17_ge_q1_0.out ex17_ge_q1_0.tmp > diff-runex17_ge_q1_0.out 2> diff-runex17_ge_q1_0.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant HERMITIAN"'  /root/repo/src/snes/tutorials/output/ex17_ge_q1_gdsw.out ex17_ge_q1_gdsw.tmp > diff-runex17_ge_q1_gdsw.out 2> diff-runex17_ge_q1_gdsw.out
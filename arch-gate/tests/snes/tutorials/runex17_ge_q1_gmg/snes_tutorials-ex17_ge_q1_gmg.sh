@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex17 -petsc_ci -dm_plex_dim 3 -dm_plex_simplex 0 -dm_plex_box_lower -5,-5,-0.25 -dm_plex_box_upper 5,5,0.25 -dm_plex_box_faces 5,5,2 -dm_plex_separate_marker -dm_refine 0 -petscpartitioner_type simple -sol_type elas_ge -displacement_petscspace_degree 1 -dm_plex_box_faces 2,2 -dm_refine_hierarchy 3 -snes_max_it 2 -snes_rtol 1.e-10 -ksp_type cg -ksp_rtol 1.e-10 -ksp_max_it 100 -ksp_norm_type unpreconditioned -pc_type mg -pc_mg_type full -mg_levels_ksp_max_it 4 -mg_levels_esteig_ksp_type cg -mg_levels_esteig_ksp_max_it 10 -mg_levels_ksp_chebyshev_esteig 0,0.1,0,1.1 -mg_levels_pc_type jacobi  > ex17_ge_q1_gmg.tmp 2> runex17_ge_q1_gmg.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex18 -petsc_ci -pc_type mg -ksp_type fgmres -da_refine 2 -pc_mg_galerkin pmat -snes_view  > ex18_1.tmp 2> runex18_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex19 -petsc_ci -da_refine 3 -snes_monitor_short -pc_type mg -ksp_type fgmres -pc_mg_type full  > ex19_1.tmp 2> runex19_1.err
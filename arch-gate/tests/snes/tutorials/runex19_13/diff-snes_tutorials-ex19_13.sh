@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_13.out ex19_13.tmp > diff-runex19_13.out 2> diff-runex19_13.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex19 -petsc_ci -snes_monitor_short -pc_type mg -dm_mat_type baij -mg_coarse_pc_type bjacobi -da_refine 3 -ksp_type fgmres  > ex19_14.tmp 2> runex19_14.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex19 -petsc_ci -snes_converged_reason -pc_type mg -dm_mat_type baij -mg_coarse_pc_type bjacobi -da_refine 3 -ksp_type fgmres -mat_fd_type ds  > ex19_14_ds.tmp 2> runex19_14_ds.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex19 -petsc_ci -snes_monitor_short -ksp_pc_side right  > ex19_17.tmp 2> runex19_17.err
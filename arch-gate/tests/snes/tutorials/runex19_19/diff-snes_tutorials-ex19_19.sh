@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_19.out ex19_19.tmp > diff-runex19_19.out 2> diff-runex19_19.out
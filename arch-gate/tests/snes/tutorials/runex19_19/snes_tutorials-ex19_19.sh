@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex19 -petsc_ci -da_refine 3 -snes_monitor_short -pc_type mg -ksp_type fgmres -pc_mg_type full -snes_type newtontrdc  > ex19_19.tmp 2> runex19_19.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex19 -petsc_ci -da_refine 3 -snes_converged_reason -pc_type mg -mat_fd_type ds  > ex19_2.tmp 2> runex19_2.err
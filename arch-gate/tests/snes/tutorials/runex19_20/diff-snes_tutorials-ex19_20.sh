@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_20.out ex19_20.tmp > diff-runex19_20.out 2> diff-runex19_20.out
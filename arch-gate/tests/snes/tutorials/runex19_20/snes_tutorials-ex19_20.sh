@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex19 -petsc_ci -da_refine 3 -snes_monitor_short -pc_type mg -ksp_type fgmres -pc_mg_type full -snes_type newtontrdc -snes_trdc_use_cauchy false  > ex19_20.tmp 2> runex19_20.err
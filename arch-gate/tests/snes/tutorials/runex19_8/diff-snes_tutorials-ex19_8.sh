@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_8.out ex19_8.tmp > diff-runex19_8.out 2> diff-runex19_8.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_9.out ex19_9.tmp > diff-runex19_9.out 2> diff-runex19_9.out
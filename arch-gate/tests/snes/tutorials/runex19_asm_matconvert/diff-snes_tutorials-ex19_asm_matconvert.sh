@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_asm_matconvert.out ex19_asm_matconvert.tmp > diff-runex19_asm_matconvert.out 2> diff-runex19_asm_matconvert.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex19 -petsc_ci -mat_type aij -pc_type asm -pc_asm_sub_mat_type dense -snes_view  > ex19_asm_matconvert.tmp 2> runex19_asm_matconvert.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex19 -petsc_ci -ksp_type bcgsl -ksp_monitor_short -da_refine 2 -ksp_bcgsl_ell 3 -snes_view  > ex19_bcgsl.tmp 2> runex19_bcgsl.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_1.out ex19_bcols1.tmp > diff-runex19_bcols1.out 2> diff-runex19_bcols1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_bjacobi.out ex19_bjacobi.tmp > diff-runex19_bjacobi.out 2> diff-runex19_bjacobi.out
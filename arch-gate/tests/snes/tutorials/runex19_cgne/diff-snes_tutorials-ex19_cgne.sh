@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v HERMITIAN'  /root/repo/src/snes/tutorials/output/ex19_cgne.out ex19_cgne.tmp > diff-runex19_cgne.out 2> diff-runex19_cgne.out
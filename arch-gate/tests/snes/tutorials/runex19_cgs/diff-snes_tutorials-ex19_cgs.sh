@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_cgs.out ex19_cgs.tmp > diff-runex19_cgs.out 2> diff-runex19_cgs.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex19 -petsc_ci -da_refine 1 -ksp_monitor_short -ksp_type cgs  > ex19_cgs.tmp 2> runex19_cgs.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_composite_gs_newton.out ex19_composite_gs_newton.tmp > diff-runex19_composite_gs_newton.out 2> diff-runex19_composite_gs_newton.out
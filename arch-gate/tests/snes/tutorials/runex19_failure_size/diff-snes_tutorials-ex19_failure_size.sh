@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -E -v "(memory block|leaked context|not freed before MPI_Finalize|Could be the program crashed)"'  /root/repo/src/snes/tutorials/output/ex19_failure_size.out ex19_failure_size.tmp > diff-runex19_failure_size.out 2> diff-runex19_failure_size.out
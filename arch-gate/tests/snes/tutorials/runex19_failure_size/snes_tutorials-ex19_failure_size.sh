@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex19 -petsc_ci -da_refine 100 -petsc_ci_portable_error_output -error_output_stdout  > ex19_failure_size.tmp 2> runex19_failure_size.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex19 -petsc_ci -da_refine 3 -snes_converged_reason -pc_type mg -mat_fd_type ds  > ex19_fdcoloring_ds.tmp 2> runex19_fdcoloring_ds.err
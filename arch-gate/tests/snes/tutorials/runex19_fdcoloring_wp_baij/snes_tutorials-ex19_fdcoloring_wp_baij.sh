@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex19 -petsc_ci -da_refine 3 -snes_monitor_short -pc_type mg -dm_mat_type baij  > ex19_fdcoloring_wp_baij.tmp 2> runex19_fdcoloring_wp_baij.err
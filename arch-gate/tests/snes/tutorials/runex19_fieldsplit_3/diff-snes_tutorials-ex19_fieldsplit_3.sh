@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_fieldsplit_3.out ex19_fieldsplit_3.tmp > diff-runex19_fieldsplit_3.out 2> diff-runex19_fieldsplit_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_fieldsplit_4.out ex19_fieldsplit_4.tmp > diff-runex19_fieldsplit_4.out 2> diff-runex19_fieldsplit_4.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_fs.out ex19_fs.tmp > diff-runex19_fs.out 2> diff-runex19_fs.out
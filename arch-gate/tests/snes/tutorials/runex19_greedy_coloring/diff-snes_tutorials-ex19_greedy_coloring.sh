@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_greedy_coloring.out ex19_greedy_coloring.tmp > diff-runex19_greedy_coloring.out 2> diff-runex19_greedy_coloring.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex19 -petsc_ci -ksp_type ibcgs -ksp_monitor_short -da_refine 2 -snes_view  > ex19_ibcgs.tmp 2> runex19_ibcgs.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_kaczmarz.out ex19_kaczmarz.tmp > diff-runex19_kaczmarz.out 2> diff-runex19_kaczmarz.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex19 -petsc_ci -pc_type kaczmarz -ksp_monitor_short -snes_monitor_short -snes_view  > ex19_kaczmarz.tmp 2> runex19_kaczmarz.err
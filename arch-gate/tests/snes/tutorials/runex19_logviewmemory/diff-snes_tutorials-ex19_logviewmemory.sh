@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep MatFDColorSetUp | wc -w | xargs -I % sh -c "expr % \> 21"'  /root/repo/src/snes/tutorials/output/ex19_logviewmemory.out ex19_logviewmemory.tmp > diff-runex19_logviewmemory.out 2> diff-runex19_logviewmemory.out
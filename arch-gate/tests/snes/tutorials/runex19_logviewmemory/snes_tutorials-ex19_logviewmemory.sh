@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex19 -petsc_ci -log_view -log_view_memory -da_refine 4  > ex19_logviewmemory.tmp 2> runex19_logviewmemory.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_ngmres_fas.out ex19_ngmres_fas.tmp > diff-runex19_ngmres_fas.out 2> diff-runex19_ngmres_fas.out
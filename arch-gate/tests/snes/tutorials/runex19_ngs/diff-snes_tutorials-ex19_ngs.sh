@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_ngs.out ex19_ngs.tmp > diff-runex19_ngs.out 2> diff-runex19_ngs.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex19 -petsc_ci -snes_type ngs -snes_view -snes_monitor -snes_rtol 1e-4  > ex19_ngs.tmp 2> runex19_ngs.err
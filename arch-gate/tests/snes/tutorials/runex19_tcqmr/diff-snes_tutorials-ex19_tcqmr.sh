@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_tcqmr.out ex19_tcqmr.tmp > diff-runex19_tcqmr.out 2> diff-runex19_tcqmr.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex19_tfqmr.out ex19_tfqmr.tmp > diff-runex19_tfqmr.out 2> diff-runex19_tfqmr.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex19 -petsc_ci -da_refine 1 -ksp_monitor_short -ksp_type tfqmr  > ex19_tfqmr.tmp 2> runex19_tfqmr.err
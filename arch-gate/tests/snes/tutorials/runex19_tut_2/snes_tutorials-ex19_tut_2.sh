@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex19 -petsc_ci -da_refine 5 -snes_monitor -ksp_monitor -snes_view -pc_type mg  > ex19_tut_2.tmp 2> runex19_tut_2.err
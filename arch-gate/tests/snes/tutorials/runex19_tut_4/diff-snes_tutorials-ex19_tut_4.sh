@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'head -n 2' -f $'head -n 2'  /root/repo/src/snes/tutorials/output/ex19_tut_4.out ex19_tut_4.tmp > diff-runex19_tut_4.out 2> diff-runex19_tut_4.out
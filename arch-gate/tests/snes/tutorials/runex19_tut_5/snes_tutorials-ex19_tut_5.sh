@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex19 -petsc_ci -da_refine 5 -log_view -pc_type mg  > ex19_tut_5.tmp 2> runex19_tut_5.err
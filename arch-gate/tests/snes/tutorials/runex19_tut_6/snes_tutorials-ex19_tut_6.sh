@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex19 -petsc_ci -da_refine 5 -log_view  > ex19_tut_6.tmp 2> runex19_tut_6.err
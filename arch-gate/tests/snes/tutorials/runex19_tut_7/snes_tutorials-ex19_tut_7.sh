@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex19 -petsc_ci -da_refine 5 -log_view -pc_type mg  > ex19_tut_7.tmp 2> runex19_tut_7.err
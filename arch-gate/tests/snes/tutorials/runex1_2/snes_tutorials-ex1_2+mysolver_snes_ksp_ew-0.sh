@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -prefix_push mysolver_ -snes_monitor_short -prefix_pop  -mysolver_snes_ksp_ew 0 > ex1_2.tmp 2> runex1_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex1_1.out ex1_6.tmp > diff-runex1_6.out 2> diff-runex1_6.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex22_1.out ex22_1.tmp > diff-runex22_1-0.out 2> diff-runex22_1-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex22_1_alt.out ex22_1.tmp > diff-runex22_1-1.out 2> diff-runex22_1-1.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex22_1_alt_2.out ex22_1.tmp > diff-runex22_1-2.out 2> diff-runex22_1-2.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex22_1_alt_3.out ex22_1.tmp > diff-runex22_1.out 2> diff-runex22_1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex24_2d_rt1_p0_bddc.out ex24_2d_rt1_p0_bddc.tmp > diff-runex24_2d_rt1_p0_bddc.out 2> diff-runex24_2d_rt1_p0_bddc.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 9  ../ex24 -petsc_ci -sol_type quadratic -potential_petscspace_degree 0 -potential_petscdualspace_lagrange_use_moments -potential_petscdualspace_lagrange_moment_order 2 -field_petscfe_default_quadrature_order 1 -field_petscspace_degree 1 -field_petscspace_type sum -field_petscspace_variables 2 -field_petscspace_components 2 -field_petscspace_sum_spaces 2 -field_petscspace_sum_concatenate true -field_sumcomp_0_petscspace_variables 2 -field_sumcomp_0_petscspace_type tensor -field_sumcomp_0_petscspace_tensor_spaces 2 -field_sumcomp_0_petscspace_tensor_uniform false -field_sumcomp_0_tensorcomp_0_petscspace_degree 1 -field_sumcomp_0_tensorcomp_1_petscspace_degree 0 -field_sumcomp_1_petscspace_variables 2 -field_sumcomp_1_petscspace_type tensor -field_sumcomp_1_petscspace_tensor_spaces 2 -field_sumcomp_1_petscspace_tensor_uniform false -field_sumcomp_1_tensorcomp_0_petscspace_degree 0 -field_sumcomp_1_tensorcomp_1_petscspace_degree 1 -field_petscdualspace_form_degree -1 -field_petscdualspace_order 1 -field_petscdualspace_lagrange_trimmed true -dm_plex_box_faces 3,3 dm_refine 1 -dm_plex_simplex 0 -dmsnes_check .001 -snes_error_if_not_converged -ksp_error_if_not_converged -ksp_type cg -petscpartitioner_type simple -dm_mat_type is -pc_type bddc -pc_bddc_use_local_mat_graph 0 -pc_bddc_benign_trick -pc_bddc_nonetflux -pc_bddc_detect_disconnected -pc_bddc_use_qr_single -pc_bddc_coarse_redundant_pc_type svd -pc_bddc_neumann_pc_type svd -pc_bddc_dirichlet_pc_type svd  > ex24_2d_rt1_p0_bddc.tmp 2> runex24_2d_rt1_p0_bddc.err
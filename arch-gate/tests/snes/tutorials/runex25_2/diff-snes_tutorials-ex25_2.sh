@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex25_2.out ex25_2.tmp > diff-runex25_2.out 2> diff-runex25_2.out
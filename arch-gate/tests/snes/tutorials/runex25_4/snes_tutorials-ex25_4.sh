@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex25 -petsc_ci -pc_type mg -da_refine 1 -ksp_type fgmres -snes_type newtontrdc  > ex25_4.tmp 2> runex25_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex26_3d_q1_conv.out ex26_3d_q1_conv.tmp > diff-runex26_3d_q1_conv.out 2> diff-runex26_3d_q1_conv.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex28_0.out ex28_0.tmp > diff-runex28_0.out 2> diff-runex28_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex28 -petsc_ci -u_da_grid_x 20 -snes_converged_reason -snes_monitor_short -problem_type 0  > ex28_0.tmp 2> runex28_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex28_1.out ex28_1.tmp > diff-runex28_1.out 2> diff-runex28_1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex28_2.out ex28_2.tmp > diff-runex28_2.out 2> diff-runex28_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex28 -petsc_ci -u_da_grid_x 20 -snes_converged_reason -snes_monitor_short -problem_type 2  > ex28_2.tmp 2> runex28_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex28_3.out ex28_3_std.tmp > diff-runex28_3_std.out 2> diff-runex28_3_std.out
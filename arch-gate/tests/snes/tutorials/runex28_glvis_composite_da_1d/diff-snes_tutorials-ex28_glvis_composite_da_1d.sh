@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex28_glvis_composite_da_1d.out ex28_glvis_composite_da_1d.tmp > diff-runex28_glvis_composite_da_1d.out 2> diff-runex28_glvis_composite_da_1d.out
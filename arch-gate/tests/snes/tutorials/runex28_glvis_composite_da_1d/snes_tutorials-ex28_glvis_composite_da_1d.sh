@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex28 -petsc_ci -u_da_grid_x 20 -problem_type 0 -snes_monitor_solution glvis:  > ex28_glvis_composite_da_1d.tmp 2> runex28_glvis_composite_da_1d.err
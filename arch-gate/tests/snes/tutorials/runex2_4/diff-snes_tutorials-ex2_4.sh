@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex2_4.out ex2_4.tmp > diff-runex2_4.out 2> diff-runex2_4.out
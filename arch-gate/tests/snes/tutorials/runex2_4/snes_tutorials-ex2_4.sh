@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -nox -snes_monitor_cancel -snes_monitor_short -snes_type newtontrdc -snes_view  > ex2_4.tmp 2> runex2_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v atol | sed -e "s/CONVERGED_ITS/DIVERGED_MAX_IT/g" | sed -e "s/CONVERGED_FNORM_RELATIVE/DIVERGED_MAX_IT/g"'  /root/repo/src/snes/tutorials/output/ex2_5.out ex2_5.tmp > diff-runex2_5.out 2> diff-runex2_5.out
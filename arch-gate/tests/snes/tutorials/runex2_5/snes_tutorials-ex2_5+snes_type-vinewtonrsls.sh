@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex2 -petsc_ci -nox -snes_max_it 1  -snes_type vinewtonrsls > ex2_5.tmp 2> runex2_5.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v Destination'  /root/repo/src/snes/tutorials/output/ex30_1.out ex30_1.tmp > diff-runex30_1.out 2> diff-runex30_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex30 -petsc_ci -ni 18 -fp_trap 0  > ex30_1.tmp 2> runex30_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex33_0.out ex33_0.tmp > diff-runex33_0.out 2> diff-runex33_0.out
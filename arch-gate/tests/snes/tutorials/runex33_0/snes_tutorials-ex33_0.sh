@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex33 -petsc_ci -snes_converged_reason -snes_monitor_short  > ex33_0.tmp 2> runex33_0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex35 -petsc_ci -snes_monitor_short -snes_type nrichardson  > ex35_1.tmp 2> runex35_1.err
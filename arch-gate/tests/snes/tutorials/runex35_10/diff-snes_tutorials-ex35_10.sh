@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex35_10.out ex35_10.tmp > diff-runex35_10.out 2> diff-runex35_10.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex35_4.out ex35_4.tmp > diff-runex35_4.out 2> diff-runex35_4.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex35_5.out ex35_5.tmp > diff-runex35_5.out 2> diff-runex35_5.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex35_6.out ex35_6.tmp > diff-runex35_6.out 2> diff-runex35_6.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex35 -petsc_ci -snes_monitor_short -ksp_type cg -ksp_monitor_short -pc_type none  > ex35_6.tmp 2> runex35_6.err
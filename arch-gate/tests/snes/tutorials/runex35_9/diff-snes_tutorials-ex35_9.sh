@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex35_9.out ex35_9.tmp > diff-runex35_9.out 2> diff-runex35_9.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex36_1d_p1_constant.out ex36_1d_p1_constant.tmp > diff-runex36_1d_p1_constant.out 2> diff-runex36_1d_p1_constant.out
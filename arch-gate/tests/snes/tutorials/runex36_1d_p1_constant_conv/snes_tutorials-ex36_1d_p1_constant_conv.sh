@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex36 -petsc_ci -dm_plex_dim 1 -dm_plex_box_faces 4 -potential_petscspace_degree 1 -snes_convergence_estimate -convest_num_refine 2  > ex36_1d_p1_constant_conv.tmp 2> runex36_1d_p1_constant_conv.err
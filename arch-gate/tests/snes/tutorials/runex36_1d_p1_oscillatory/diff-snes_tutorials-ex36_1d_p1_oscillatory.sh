@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex36_1d_p1_oscillatory.out ex36_1d_p1_oscillatory.tmp > diff-runex36_1d_p1_oscillatory.out 2> diff-runex36_1d_p1_oscillatory.out
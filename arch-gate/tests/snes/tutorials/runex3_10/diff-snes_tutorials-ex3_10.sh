@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex3_10.out ex3_10.tmp > diff-runex3_10.out 2> diff-runex3_10.out
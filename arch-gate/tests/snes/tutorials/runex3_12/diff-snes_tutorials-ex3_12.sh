@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "type:"'  /root/repo/src/snes/tutorials/output/ex3_12.out ex3_12.tmp > diff-runex3_12.out 2> diff-runex3_12.out
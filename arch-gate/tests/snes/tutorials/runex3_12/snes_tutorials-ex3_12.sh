@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -view_initial  > ex3_12.tmp 2> runex3_12.err
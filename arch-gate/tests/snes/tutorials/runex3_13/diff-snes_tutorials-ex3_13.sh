@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex3_13.out ex3_13.tmp > diff-runex3_13.out 2> diff-runex3_13.out
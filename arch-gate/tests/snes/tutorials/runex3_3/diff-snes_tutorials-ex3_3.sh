@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex3_3.out ex3_3.tmp > diff-runex3_3.out 2> diff-runex3_3.out
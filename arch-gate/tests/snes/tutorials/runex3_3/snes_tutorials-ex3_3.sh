@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex3 -petsc_ci -nox -snes_monitor_cancel -snes_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex3_3.tmp 2> runex3_3.err
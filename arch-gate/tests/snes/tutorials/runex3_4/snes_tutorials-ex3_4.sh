@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -nox -pre_check_iterates -post_check_iterates  > ex3_4.tmp 2> runex3_4.err
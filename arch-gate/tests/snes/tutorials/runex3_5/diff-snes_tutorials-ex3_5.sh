@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex3_5.out ex3_5.tmp > diff-runex3_5.out 2> diff-runex3_5.out
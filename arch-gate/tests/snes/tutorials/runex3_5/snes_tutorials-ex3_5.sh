@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex3 -petsc_ci -nox -snes_test_jacobian -snes_test_jacobian_view  > ex3_5.tmp 2> runex3_5.err
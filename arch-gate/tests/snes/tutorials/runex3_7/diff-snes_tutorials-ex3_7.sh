@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex3_7.out ex3_7.tmp > diff-runex3_7.out 2> diff-runex3_7.out
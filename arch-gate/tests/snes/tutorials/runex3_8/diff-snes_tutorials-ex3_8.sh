@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex3_8.out ex3_8.tmp > diff-runex3_8.out 2> diff-runex3_8.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex42 -petsc_ci -snes_monitor_short -snes_max_it 1000 -sol_view  > ex42_1.tmp 2> runex42_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex42_ghosts.out ex42_ghosts.tmp > diff-runex42_ghosts.out 2> diff-runex42_ghosts.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex42 -petsc_ci -snes_max_it 4 -test_ghost  -snes_type newtonls -nghost 1 > ex42_ghosts.tmp 2> runex42_ghosts.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex46 -petsc_ci -snes_view -snes_monitor_short -da_refine 1 -pc_type mg -ksp_type fgmres -pc_mg_type full -mg_levels_ksp_chebyshev_esteig 0.5,1.1  > ex46_1.tmp 2> runex46_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex46_ew_2.out ex46_ew_2.tmp > diff-runex46_ew_2.out 2> diff-runex46_ew_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex46_fm_rise_4.out ex46_fm_rise_4.tmp > diff-runex46_fm_rise_4.out 2> diff-runex46_fm_rise_4.out
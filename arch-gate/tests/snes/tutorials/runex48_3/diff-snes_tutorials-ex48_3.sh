@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex48_3.out ex48_3.tmp > diff-runex48_3.out 2> diff-runex48_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 6  ../ex48 -petsc_ci -M 12 -P 5 -snes_monitor_short -ksp_converged_reason -pc_type asm -pc_asm_type restrict  -dm_mat_type sbaij > ex48_5.tmp 2> runex48_5.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex4 -petsc_ci -snes_type qn -npc_snes_type nasm -snes_converged_reason -da_local_subdomains 4 -snes_npc_side left -use_objective 1  > ex4_qn_nasm_snes_npc_side-left_use_objective-1.tmp 2> runex4_qn_nasm_snes_npc_side-left_use_objective-1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/CONVERGED_FNORM_ABS/CONVERGED_FNORM_RELATIVE/g"'  /root/repo/src/snes/tutorials/output/ex4_qn_nasm_snes_npc_side-right_use_objective-1.out ex4_qn_nasm_snes_npc_side-right_use_objective-1.tmp > diff-runex4_qn_nasm_snes_npc_side-right_use_objective-1.out 2> diff-runex4_qn_nasm_snes_npc_side-right_use_objective-1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "type"'  /root/repo/src/snes/tutorials/output/ex55_1.out ex55_1.tmp > diff-runex55_1.out 2> diff-runex55_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex55 -petsc_ci -mms 1 -par 0.0 -snes_monitor_short -snes_converged_reason -ksp_rtol 1.0e-9 -ksp_monitor_short -ksp_type richardson -pc_type asm -pc_asm_blocks 2 -pc_asm_overlap 0 -pc_asm_local_type additive -sub_pc_type lu  -fd 0 > ex55_asm_0.tmp 2> runex55_asm_0.err
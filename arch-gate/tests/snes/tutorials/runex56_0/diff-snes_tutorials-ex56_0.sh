@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/Linear solve converged due to CONVERGED_RTOL iterations 7/Linear solve converged due to CONVERGED_RTOL iterations 8/g"'  /root/repo/src/snes/tutorials/output/ex56_0.out ex56_0.tmp > diff-runex56_0.out 2> diff-runex56_0.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex56_2.out ex56_2.tmp > diff-runex56_2.out 2> diff-runex56_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex56_attach_mat_nearnullspace-0_bddc_approx_gamg.out ex56_attach_mat_nearnullspace-0_bddc_approx_gamg.tmp > diff-runex56_attach_mat_nearnullspace-0_bddc_approx_gamg.out 2> diff-runex56_attach_mat_nearnullspace-0_bddc_approx_gamg.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex56_bddc.out ex56_bddc.tmp > diff-runex56_bddc.out 2> diff-runex56_bddc.out
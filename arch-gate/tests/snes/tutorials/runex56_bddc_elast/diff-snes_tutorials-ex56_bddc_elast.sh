@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex56_bddc_elast.out ex56_bddc_elast.tmp > diff-runex56_bddc_elast.out 2> diff-runex56_bddc_elast.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex56_fetidp.out ex56_fetidp.tmp > diff-runex56_fetidp.out 2> diff-runex56_fetidp.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex56_fetidp_elast.out ex56_fetidp_elast.tmp > diff-runex56_fetidp_elast.out 2> diff-runex56_fetidp_elast.out
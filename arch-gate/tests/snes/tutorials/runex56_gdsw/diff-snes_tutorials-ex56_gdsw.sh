@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex56_gdsw.out ex56_gdsw.tmp > diff-runex56_gdsw.out 2> diff-runex56_gdsw.out
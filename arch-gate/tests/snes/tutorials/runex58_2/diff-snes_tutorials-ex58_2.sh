@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex58_2.out ex58_2.tmp > diff-runex58_2-0.out 2> diff-runex58_2-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex58_2_alt.out ex58_2.tmp > diff-runex58_2.out 2> diff-runex58_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex59_1.out ex59_1.tmp > diff-runex59_1-0.out 2> diff-runex59_1-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex59_1_alt.out ex59_1.tmp > diff-runex59_1.out 2> diff-runex59_1.out
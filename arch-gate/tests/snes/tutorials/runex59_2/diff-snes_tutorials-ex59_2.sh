@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex59_2.out ex59_2.tmp > diff-runex59_2-0.out 2> diff-runex59_2-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex59_2_alt.out ex59_2.tmp > diff-runex59_2.out 2> diff-runex59_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex59_3.out ex59_3.tmp > diff-runex59_3-0.out 2> diff-runex59_3-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex59_3_alt.out ex59_3.tmp > diff-runex59_3.out 2> diff-runex59_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex59 -petsc_ci -n 14 -second_order -snes_monitor_short -snes_converged_reason  > ex59_3.tmp 2> runex59_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex5_2.out ex5_2.tmp > diff-runex5_2-0.out 2> diff-runex5_2-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex5_2_alt.out ex5_2.tmp > diff-runex5_2.out 2> diff-runex5_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "otal number of function evaluations"'  /root/repo/src/snes/tutorials/output/ex5_3.out ex5_3.tmp > diff-runex5_3-0.out 2> diff-runex5_3-0.out || /root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "otal number of function evaluations"'  /root/repo/src/snes/tutorials/output/ex5_3_alt.out ex5_3.tmp > diff-runex5_3.out 2> diff-runex5_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex5 -petsc_ci -snes_monitor_short -ksp_monitor_short -snes_converged_reason -da_refine 4 -da_overlap 3 -snes_type aspin -snes_view -npc_sub_pc_type lu -npc_sub_ksp_type preonly  > ex5_5_aspin.tmp 2> runex5_5_aspin.err
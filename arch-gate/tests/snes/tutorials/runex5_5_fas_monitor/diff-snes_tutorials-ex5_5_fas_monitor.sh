@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex5_5_fas_monitor.out ex5_5_fas_monitor.tmp > diff-runex5_5_fas_monitor.out 2> diff-runex5_5_fas_monitor.out
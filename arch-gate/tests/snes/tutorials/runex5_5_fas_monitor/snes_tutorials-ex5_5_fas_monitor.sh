@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -da_refine 1 -snes_type fas -snes_fas_monitor  > ex5_5_fas_monitor.tmp 2> runex5_5_fas_monitor.err
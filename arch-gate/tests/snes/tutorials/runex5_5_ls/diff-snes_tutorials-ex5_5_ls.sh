@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex5_5_ls.out ex5_5_ls.tmp > diff-runex5_5_ls-0.out 2> diff-runex5_5_ls-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex5_5_ls_alt.out ex5_5_ls.tmp > diff-runex5_5_ls.out 2> diff-runex5_5_ls.out
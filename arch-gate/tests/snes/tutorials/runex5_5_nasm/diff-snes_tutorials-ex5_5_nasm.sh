@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex5_5_nasm.out ex5_5_nasm.tmp > diff-runex5_5_nasm.out 2> diff-runex5_5_nasm.out
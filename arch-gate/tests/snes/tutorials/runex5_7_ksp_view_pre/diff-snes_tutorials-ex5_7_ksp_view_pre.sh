@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex5_7_ksp_view_pre.out ex5_7_ksp_view_pre.tmp > diff-runex5_7_ksp_view_pre.out 2> diff-runex5_7_ksp_view_pre.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -pc_type gamg -ksp_view_pre  > ex5_7_ksp_view_pre.tmp 2> runex5_7_ksp_view_pre.err
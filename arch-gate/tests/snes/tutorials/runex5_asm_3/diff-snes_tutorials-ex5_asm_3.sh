@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex5_asm_3.out ex5_asm_3.tmp > diff-runex5_asm_3.out 2> diff-runex5_asm_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex5_asm_5.out ex5_asm_5.tmp > diff-runex5_asm_5-0.out 2> diff-runex5_asm_5-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex5_asm_5_alt.out ex5_asm_5.tmp > diff-runex5_asm_5.out 2> diff-runex5_asm_5.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -pc_type gamg -ksp_view ::ascii_info_detail -pc_gamg_mat_coarsen_type hem  > ex5_hem_view_detailed.tmp 2> runex5_hem_view_detailed.err
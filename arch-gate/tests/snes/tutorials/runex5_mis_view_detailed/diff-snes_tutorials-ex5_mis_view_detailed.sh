@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex5_mis_view_detailed.out ex5_mis_view_detailed.tmp > diff-runex5_mis_view_detailed.out 2> diff-runex5_mis_view_detailed.out
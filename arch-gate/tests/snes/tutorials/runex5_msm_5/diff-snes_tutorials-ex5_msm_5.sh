@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex5_msm_5.out ex5_msm_5.tmp > diff-runex5_msm_5-0.out 2> diff-runex5_msm_5-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex5_msm_5_alt.out ex5_msm_5.tmp > diff-runex5_msm_5.out 2> diff-runex5_msm_5.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex62_2d_q1_p0_gmg_vanka.out ex62_2d_q1_p0_gmg_vanka.tmp > diff-runex62_2d_q1_p0_gmg_vanka.out 2> diff-runex62_2d_q1_p0_gmg_vanka.out
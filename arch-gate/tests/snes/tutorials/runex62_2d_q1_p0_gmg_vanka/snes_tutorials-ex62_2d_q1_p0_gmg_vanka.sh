@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex62 -petsc_ci -sol quadratic -dm_plex_simplex 0 -dm_refine_hierarchy 2 -vel_petscspace_degree 1 -pres_petscspace_degree 0 -petscds_jac_pre 0 -snes_rtol 1.0e-4 -ksp_type fgmres -ksp_atol 1e-5 -ksp_error_if_not_converged -pc_type mg -mg_levels_ksp_type gmres -mg_levels_ksp_max_it 30 -mg_levels_pc_type patch -mg_levels_pc_patch_partition_of_unity 0 -mg_levels_pc_patch_construct_codim 0 -mg_levels_pc_patch_construct_type vanka -mg_levels_sub_ksp_type preonly -mg_levels_sub_pc_type lu -mg_coarse_pc_type svd  > ex62_2d_q1_p0_gmg_vanka.tmp 2> runex62_2d_q1_p0_gmg_vanka.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex62 -petsc_ci -sol quadratic -dm_plex_simplex 0 -dm_refine 2 -vel_petscspace_degree 1 -pres_petscspace_degree 0 -petscds_jac_pre 0 -snes_rtol 1.0e-4 -ksp_type fgmres -ksp_atol 1e-5 -ksp_error_if_not_converged -pc_type patch -pc_patch_partition_of_unity 0 -pc_patch_construct_codim 0 -pc_patch_construct_type vanka -sub_ksp_type preonly -sub_pc_type lu  > ex62_2d_q1_p0_vanka.tmp 2> runex62_2d_q1_p0_vanka.err
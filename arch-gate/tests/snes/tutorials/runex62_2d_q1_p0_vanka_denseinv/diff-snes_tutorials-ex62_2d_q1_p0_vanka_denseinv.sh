@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex62_2d_q1_p0_vanka_denseinv.out ex62_2d_q1_p0_vanka_denseinv.tmp > diff-runex62_2d_q1_p0_vanka_denseinv.out 2> diff-runex62_2d_q1_p0_vanka_denseinv.out
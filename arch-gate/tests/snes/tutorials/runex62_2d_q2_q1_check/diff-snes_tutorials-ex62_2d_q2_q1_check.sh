@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex62_2d_q2_q1_check.out ex62_2d_q2_q1_check.tmp > diff-runex62_2d_q2_q1_check.out 2> diff-runex62_2d_q2_q1_check.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex62_2d_q2_q1_conv.out ex62_2d_q2_q1_conv.tmp > diff-runex62_2d_q2_q1_conv.out 2> diff-runex62_2d_q2_q1_conv.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex62_3d_q1_p0_conv.out ex62_3d_q1_p0_conv.tmp > diff-runex62_3d_q1_p0_conv.out 2> diff-runex62_3d_q1_p0_conv.out
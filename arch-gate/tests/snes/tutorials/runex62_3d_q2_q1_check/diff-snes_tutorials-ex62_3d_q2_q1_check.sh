@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex62_3d_q2_q1_check.out ex62_3d_q2_q1_check.tmp > diff-runex62_3d_q2_q1_check.out 2> diff-runex62_3d_q2_q1_check.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex69_q1p0_conv.out ex69_q1p0_conv.tmp > diff-runex69_q1p0_conv.out 2> diff-runex69_q1p0_conv.out
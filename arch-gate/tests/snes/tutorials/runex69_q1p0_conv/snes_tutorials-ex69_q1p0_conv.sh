@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex69 -petsc_ci -dm_plex_simplex 0 -dm_plex_separate_marker -vel_petscspace_degree 1 -pres_petscspace_degree 0 -snes_error_if_not_converged -snes_convergence_estimate -convest_num_refine 2 -ksp_rtol 1.e-9 -ksp_error_if_not_converged -pc_use_amat -pc_type fieldsplit -pc_fieldsplit_type schur -pc_fieldsplit_schur_factorization_type full -pc_fieldsplit_schur_precondition a11 -fieldsplit_velocity_pc_type lu -fieldsplit_pressure_ksp_rtol 1.e-9 -fieldsplit_pressure_pc_type lu  > ex69_q1p0_conv.tmp 2> runex69_q1p0_conv.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex69_q2p1fetidp_deluxe.out ex69_q2p1bddc_benign_card.tmp > diff-runex69_q2p1bddc_benign_card.out 2> diff-runex69_q2p1bddc_benign_card.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex69_q2p1fetidp.out ex69_q2p1fetidp_aij.tmp > diff-runex69_q2p1fetidp_aij.out 2> diff-runex69_q2p1fetidp_aij.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/CONVERGED_ATOL/CONVERGED_RTOL/g" -e "s/CONVERGED_FNORM_ABS/CONVERGED_FNORM_RELATIVE/g"'  /root/repo/src/snes/tutorials/output/ex6_2.out ex6_2.tmp > diff-runex6_2-0.out 2> diff-runex6_2-0.out || /root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/CONVERGED_ATOL/CONVERGED_RTOL/g" -e "s/CONVERGED_FNORM_ABS/CONVERGED_FNORM_RELATIVE/g"'  /root/repo/src/snes/tutorials/output/ex6_2_alt.out ex6_2.tmp > diff-runex6_2.out 2> diff-runex6_2.out
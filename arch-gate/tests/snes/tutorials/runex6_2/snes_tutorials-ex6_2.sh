@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -ksp_converged_reason_view_cancel  > ex6_2.tmp 2> runex6_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -ksp_converged_reason_view_cancel -ksp_converged_reason  > ex6_3.tmp 2> runex6_3.err
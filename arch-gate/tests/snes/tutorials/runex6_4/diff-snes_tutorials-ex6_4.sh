@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/CONVERGED_ATOL/CONVERGED_RTOL/g" -e "s/CONVERGED_FNORM_ABS/CONVERGED_FNORM_RELATIVE/g"'  /root/repo/src/snes/tutorials/output/ex6_4.out ex6_4.tmp > diff-runex6_4-0.out 2> diff-runex6_4-0.out || /root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/CONVERGED_ATOL/CONVERGED_RTOL/g" -e "s/CONVERGED_FNORM_ABS/CONVERGED_FNORM_RELATIVE/g"'  /root/repo/src/snes/tutorials/output/ex6_4_alt.out ex6_4.tmp > diff-runex6_4.out 2> diff-runex6_4.out
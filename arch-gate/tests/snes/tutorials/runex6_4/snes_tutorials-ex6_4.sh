@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -snes_converged_reason_view_cancel  > ex6_4.tmp 2> runex6_4.err
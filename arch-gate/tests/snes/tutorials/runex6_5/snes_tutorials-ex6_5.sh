@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -snes_converged_reason_view_cancel -snes_converged_reason  > ex6_5.tmp 2> runex6_5.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex70_2.out ex70_2.tmp > diff-runex70_2.out 2> diff-runex70_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex70_4.out ex70_4.tmp > diff-runex70_4.out 2> diff-runex70_4.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex70_5.out ex70_5.tmp > diff-runex70_5.out 2> diff-runex70_5.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex70_6.out ex70_6.tmp > diff-runex70_6.out 2> diff-runex70_6.out
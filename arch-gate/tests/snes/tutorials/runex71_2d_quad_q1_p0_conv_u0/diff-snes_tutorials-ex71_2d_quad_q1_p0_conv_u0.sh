@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex71_2d_quad_q1_p0_conv_u0.out ex71_2d_quad_q1_p0_conv_u0.tmp > diff-runex71_2d_quad_q1_p0_conv_u0.out 2> diff-runex71_2d_quad_q1_p0_conv_u0.out
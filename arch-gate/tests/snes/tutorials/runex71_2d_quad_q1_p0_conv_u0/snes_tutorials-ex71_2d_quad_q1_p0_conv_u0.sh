@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex71 -petsc_ci -dm_plex_simplex 0 -dm_plex_separate_marker -dm_refine 1 -u_0 0.125 -vel_petscspace_degree 1 -pres_petscspace_degree 0 -snes_convergence_estimate -convest_num_refine 2 -snes_error_if_not_converged -ksp_type fgmres -ksp_gmres_restart 10 -ksp_rtol 1.0e-9 -ksp_error_if_not_converged -pc_type fieldsplit -pc_fieldsplit_type schur -pc_fieldsplit_schur_factorization_type full -fieldsplit_velocity_pc_type lu -fieldsplit_pressure_ksp_rtol 1e-10 -fieldsplit_pressure_pc_type jacobi  > ex71_2d_quad_q1_p0_conv_u0.tmp 2> runex71_2d_quad_q1_p0_conv_u0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex78_1.out ex78_1.tmp > diff-runex78_1.out 2> diff-runex78_1.out
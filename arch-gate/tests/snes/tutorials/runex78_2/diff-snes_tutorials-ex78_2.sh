@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex78_2.out ex78_2.tmp > diff-runex78_2.out 2> diff-runex78_2.out
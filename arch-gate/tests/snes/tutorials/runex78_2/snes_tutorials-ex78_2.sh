@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex78 -petsc_ci -snes_monitor_short -ksp_monitor_short -pc_type sor -snes_converged_reason -da_refine 3 -snes_type newtontrdc  > ex78_2.tmp 2> runex78_2.err
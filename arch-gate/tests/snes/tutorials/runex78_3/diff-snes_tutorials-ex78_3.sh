@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex78_3.out ex78_3.tmp > diff-runex78_3.out 2> diff-runex78_3.out
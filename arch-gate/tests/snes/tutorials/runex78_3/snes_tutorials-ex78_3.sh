@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex78 -petsc_ci -snes_monitor_short -ksp_monitor_short -pc_type sor -snes_converged_reason -da_refine 3 -snes_type newtontrdc -snes_trdc_use_cauchy false  > ex78_3.tmp 2> runex78_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/CONVERGED_FNORM_ABS/CONVERGED_FNORM_RELATIVE/g"'  /root/repo/src/snes/tutorials/output/ex8_qn_nasm_snes_npc_side-right.out ex8_qn_nasm_snes_npc_side-right.tmp > diff-runex8_qn_nasm_snes_npc_side-right.out 2> diff-runex8_qn_nasm_snes_npc_side-right.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex99 -petsc_ci -snes_linesearch_type cp  > ex99_1.tmp 2> runex99_1.err
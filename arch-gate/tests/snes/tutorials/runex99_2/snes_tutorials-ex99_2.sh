@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex99 -petsc_ci -snes_linesearch_type basic  > ex99_2.tmp 2> runex99_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex99_3.out ex99_3.tmp > diff-runex99_3.out 2> diff-runex99_3.out
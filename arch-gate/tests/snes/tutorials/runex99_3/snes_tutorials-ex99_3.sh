@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex99 -petsc_ci   > ex99_3.tmp 2> runex99_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex99_4.out ex99_4.tmp > diff-runex99_4.out 2> diff-runex99_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex99 -petsc_ci -snes_type newtontrdc  > ex99_4.tmp 2> runex99_4.err
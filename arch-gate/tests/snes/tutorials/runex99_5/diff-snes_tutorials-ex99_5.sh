@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex99_5.out ex99_5.tmp > diff-runex99_5.out 2> diff-runex99_5.out
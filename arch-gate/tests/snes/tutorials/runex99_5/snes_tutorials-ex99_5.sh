@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex99 -petsc_ci -snes_type newtontrdc -snes_trdc_use_cauchy false  > ex99_5.tmp 2> runex99_5.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex9 -petsc_ci -snes_grid_sequence 2 -snes_vi_monitor -snes_type vinewtonrsls  > ex9_3.tmp 2> runex9_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex9 -petsc_ci -mat_is_symmetric  > ex9_4.tmp 2> runex9_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex9_5.out ex9_5.tmp > diff-runex9_5-0.out 2> diff-runex9_5-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex9_5_alt.out ex9_5.tmp > diff-runex9_5.out 2> diff-runex9_5.out
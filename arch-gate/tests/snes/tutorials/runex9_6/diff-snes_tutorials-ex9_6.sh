@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex9_6.out ex9_6.tmp > diff-runex9_6.out 2> diff-runex9_6.out
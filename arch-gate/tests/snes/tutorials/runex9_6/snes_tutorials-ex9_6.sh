@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex9 -petsc_ci -snes_grid_sequence 2 -pc_type mg -snes_monitor_short -ksp_converged_reason  > ex9_6.tmp 2> runex9_6.err
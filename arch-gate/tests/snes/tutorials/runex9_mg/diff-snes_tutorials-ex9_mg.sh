@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/snes/tutorials/output/ex9_mg.out ex9_mg.tmp > diff-runex9_mg.out 2> diff-runex9_mg.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex9 -petsc_ci -snes_grid_sequence 3 -snes_converged_reason -pc_type mg  > ex9_mg.tmp 2> runex9_mg.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -t 4 -log2d 7 -log2n 10  > ex3_1.tmp 2> runex3_1.err
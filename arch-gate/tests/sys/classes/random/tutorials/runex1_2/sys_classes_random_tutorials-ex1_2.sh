@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex1 -petsc_ci   > ex1_2.tmp 2> runex1_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci -view_randomvalues 0  > ex1_3.tmp 2> runex1_3.err
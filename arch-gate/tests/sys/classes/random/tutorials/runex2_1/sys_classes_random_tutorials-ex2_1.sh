@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex2 -petsc_ci   > ex2_1.tmp 2> runex2_1.err
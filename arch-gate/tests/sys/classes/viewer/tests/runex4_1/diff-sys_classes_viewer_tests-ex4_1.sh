@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'cat ex4w1.tmp'  /root/repo/src/sys/classes/viewer/tests/output/ex4w.out ex4_1.tmp > diff-runex4_1.out 2> diff-runex4_1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'cat ex4w2.tmp'  /root/repo/src/sys/classes/viewer/tests/output/ex4w.out ex4_2.tmp > diff-runex4_2.out 2> diff-runex4_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex4 -petsc_ci -myviewer ascii:ex4w3.tmp::write  > ex4_3.tmp 2> runex4_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex4 -petsc_ci -myviewer ascii:ex4a1.tmp::append  > ex4_4.tmp 2> runex4_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'cat daos:ex4a1.tmp'  /root/repo/src/sys/classes/viewer/tests/output/ex4a.out ex4_daos.tmp > diff-runex4_daos.out 2> diff-runex4_daos.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex4 -petsc_ci -myviewer ascii:daos:ex4a1.tmp::append  > ex4_daos.tmp 2> runex4_daos.err
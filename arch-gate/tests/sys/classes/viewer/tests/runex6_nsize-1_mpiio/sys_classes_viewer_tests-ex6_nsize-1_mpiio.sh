@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -viewer_view -viewer_binary_mpiio 1  > ex6_nsize-1_mpiio.tmp 2> runex6_nsize-1_mpiio.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/classes/viewer/tests/output/ex6_nsize-1_stdio.out ex6_nsize-1_stdio.tmp > diff-runex6_nsize-1_stdio.out 2> diff-runex6_nsize-1_stdio.out
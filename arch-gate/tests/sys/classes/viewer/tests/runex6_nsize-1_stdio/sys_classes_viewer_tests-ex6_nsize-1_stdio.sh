@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -viewer_view -viewer_binary_mpiio 0  > ex6_nsize-1_stdio.tmp 2> runex6_nsize-1_stdio.err
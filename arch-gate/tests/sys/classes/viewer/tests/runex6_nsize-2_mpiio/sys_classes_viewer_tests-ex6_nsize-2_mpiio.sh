@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex6 -petsc_ci -viewer_view -viewer_binary_mpiio 1  > ex6_nsize-2_mpiio.tmp 2> runex6_nsize-2_mpiio.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex6 -petsc_ci -viewer_view -viewer_binary_mpiio 0  > ex6_nsize-2_stdio.tmp 2> runex6_nsize-2_stdio.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/classes/viewer/tests/output/ex6_nsize-3_mpiio.out ex6_nsize-3_mpiio.tmp > diff-runex6_nsize-3_mpiio.out 2> diff-runex6_nsize-3_mpiio.out
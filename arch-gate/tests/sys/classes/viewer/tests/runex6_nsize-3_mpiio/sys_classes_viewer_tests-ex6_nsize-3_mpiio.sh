@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex6 -petsc_ci -viewer_view -viewer_binary_mpiio 1  > ex6_nsize-3_mpiio.tmp 2> runex6_nsize-3_mpiio.err
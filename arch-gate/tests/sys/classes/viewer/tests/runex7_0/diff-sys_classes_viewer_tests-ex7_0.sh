@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'cat viewer0.txt viewer1.txt'  /root/repo/src/sys/classes/viewer/tests/output/ex7_0.out ex7_0.tmp > diff-runex7_0.out 2> diff-runex7_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -test_view ascii:viewer0.txt,ascii:viewer1.txt  > ex7_0.tmp 2> runex7_0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci -test_view ,,,ascii:viewer3.txt,  > ex7_2.tmp 2> runex7_2.err
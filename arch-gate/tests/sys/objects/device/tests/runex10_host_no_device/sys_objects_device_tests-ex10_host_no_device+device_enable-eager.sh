@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex10 -petsc_ci   -device_enable eager > ex10_host_no_device.tmp 2> runex10_host_no_device.err
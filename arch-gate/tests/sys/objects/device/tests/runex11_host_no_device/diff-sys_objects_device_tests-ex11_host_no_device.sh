@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/objects/device/tests/./output/ExitSuccess.out ex11_host_no_device.tmp > diff-runex11_host_no_device.out 2> diff-runex11_host_no_device.out
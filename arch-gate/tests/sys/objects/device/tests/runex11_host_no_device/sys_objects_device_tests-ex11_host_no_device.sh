@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex11 -petsc_ci   > ex11_host_no_device.tmp 2> runex11_host_no_device.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/objects/device/tests/./output/ExitSuccess.out ex1_host_no_device.tmp > diff-runex1_host_no_device.out 2> diff-runex1_host_no_device.out
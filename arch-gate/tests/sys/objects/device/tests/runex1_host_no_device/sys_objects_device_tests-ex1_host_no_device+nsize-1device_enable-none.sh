@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex1 -petsc_ci   -device_enable none > ex1_host_no_device.tmp 2> runex1_host_no_device.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex1 -petsc_ci   -device_enable eager > ex1_host_no_device.tmp 2> runex1_host_no_device.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/objects/device/tests/./output/ExitSuccess.out ex2_host_no_device.tmp > diff-runex2_host_no_device.out 2> diff-runex2_host_no_device.out
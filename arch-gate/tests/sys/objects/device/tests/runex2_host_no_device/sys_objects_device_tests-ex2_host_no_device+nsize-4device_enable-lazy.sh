@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex2 -petsc_ci   -device_enable lazy > ex2_host_no_device.tmp 2> runex2_host_no_device.err
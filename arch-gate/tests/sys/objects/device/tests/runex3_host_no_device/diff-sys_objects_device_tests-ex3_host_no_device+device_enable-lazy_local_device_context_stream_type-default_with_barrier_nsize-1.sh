@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/objects/device/tests/./output/ExitSuccess.out ex3_host_no_device.tmp > diff-runex3_host_no_device.out 2> diff-runex3_host_no_device.out
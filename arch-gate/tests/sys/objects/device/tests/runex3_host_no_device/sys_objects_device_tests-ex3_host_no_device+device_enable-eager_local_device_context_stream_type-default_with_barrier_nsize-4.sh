@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex3 -petsc_ci   -device_enable eager -local_device_context_stream_type default_with_barrier > ex3_host_no_device.tmp 2> runex3_host_no_device.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex4 -petsc_ci   -device_enable eager -local_device_context_stream_type nonblocking > ex4_host_no_device.tmp 2> runex4_host_no_device.err
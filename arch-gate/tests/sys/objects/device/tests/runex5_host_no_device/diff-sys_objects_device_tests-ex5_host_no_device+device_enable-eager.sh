@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/objects/device/tests/./output/ExitSuccess.out ex5_host_no_device.tmp > diff-runex5_host_no_device.out 2> diff-runex5_host_no_device.out
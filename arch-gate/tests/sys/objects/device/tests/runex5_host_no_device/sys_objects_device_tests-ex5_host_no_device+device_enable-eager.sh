@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci   -device_enable eager > ex5_host_no_device.tmp 2> runex5_host_no_device.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -ve "ex6 on a" -ve "\[0\] "'  /root/repo/src/sys/objects/device/tests/output/ex6_root_device_context_stream_type-default_host_no_device.out ex6_root_device_context_stream_type-default_host_no_device.tmp > diff-runex6_root_device_context_stream_type-default_host_no_device.out 2> diff-runex6_root_device_context_stream_type-default_host_no_device.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex6 -petsc_ci -root_device_context_stream_type default_with_barrier  > ex6_root_device_context_stream_type-default_with_barrier_host_no_device.tmp 2> runex6_root_device_context_stream_type-default_with_barrier_host_no_device.err
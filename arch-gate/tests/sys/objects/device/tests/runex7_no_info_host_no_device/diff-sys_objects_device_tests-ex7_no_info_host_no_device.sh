@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "\[DEBUG OUTPUT\]"'  /root/repo/src/sys/objects/device/tests/./output/ExitSuccess.out ex7_no_info_host_no_device.tmp > diff-runex7_no_info_host_no_device.out 2> diff-runex7_no_info_host_no_device.out
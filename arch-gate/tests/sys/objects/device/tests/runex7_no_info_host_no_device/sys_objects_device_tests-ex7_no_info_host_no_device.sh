@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci   > ex7_no_info_host_no_device.tmp 2> runex7_no_info_host_no_device.err
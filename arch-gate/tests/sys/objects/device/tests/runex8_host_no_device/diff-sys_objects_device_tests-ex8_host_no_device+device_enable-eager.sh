@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/objects/device/tests/output/ex8_host_no_device.out ex8_host_no_device.tmp > diff-runex8_host_no_device.out 2> diff-runex8_host_no_device.out
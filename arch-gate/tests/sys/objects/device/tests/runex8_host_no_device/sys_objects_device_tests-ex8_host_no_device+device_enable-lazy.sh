@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex8 -petsc_ci   -device_enable lazy > ex8_host_no_device.tmp 2> runex8_host_no_device.err
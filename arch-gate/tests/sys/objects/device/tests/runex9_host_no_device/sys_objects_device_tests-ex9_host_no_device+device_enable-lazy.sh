@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex9 -petsc_ci   -device_enable lazy > ex9_host_no_device.tmp 2> runex9_host_no_device.err
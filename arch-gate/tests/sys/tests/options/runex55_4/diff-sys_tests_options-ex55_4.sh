@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/options/output/ex55_4.out ex55_4.tmp > diff-runex55_4.out 2> diff-runex55_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex55 -petsc_ci -options_left 0 -options_view -options_monitor  > ex55_4.tmp 2> runex55_4.err
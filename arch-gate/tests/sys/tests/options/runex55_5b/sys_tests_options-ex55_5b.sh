@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex55 -petsc_ci -options_left -options_view -options_monitor -help intro  > ex55_5b.tmp 2> runex55_5b.err
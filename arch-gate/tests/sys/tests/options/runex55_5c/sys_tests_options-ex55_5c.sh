@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex55 -petsc_ci -options_left -options_view -options_monitor -version  > ex55_5c.tmp 2> runex55_5c.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -E -e "(version|help|^See)"'  /root/repo/src/sys/tests/options/output/ex55_6a.out ex55_6a.tmp > diff-runex55_6a.out 2> diff-runex55_6a.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex55 -petsc_ci -skip_petscrc -options_left -options_view -options_monitor -options_file rc_help_intro  > ex55_6b.tmp 2> runex55_6b.err
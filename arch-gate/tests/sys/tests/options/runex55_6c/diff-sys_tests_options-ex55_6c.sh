@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -E -e "(version|help|^See)"'  /root/repo/src/sys/tests/options/output/ex55_6c.out ex55_6c.tmp > diff-runex55_6c.out 2> diff-runex55_6c.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex55 -petsc_ci -skip_petscrc -options_left -options_view -options_monitor -options_file rc_version  > ex55_6c.tmp 2> runex55_6c.err
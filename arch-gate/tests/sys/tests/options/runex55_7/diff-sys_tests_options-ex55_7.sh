@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/options/output/ex55_7.out ex55_7.tmp > diff-runex55_7.out 2> diff-runex55_7.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex55 -petsc_ci -options_monitor -options_left 0  > ex55_7.tmp 2> runex55_7.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex55 -petsc_ci -options_left 0 -options_view -options_monitor_viewer ascii -skip_petscrc 0 -options_monitor_cancel 0 -options_monitor  > ex55_skip_petscrc-0_options_monitor_cancel-0_2.tmp 2> runex55_skip_petscrc-0_options_monitor_cancel-0_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex55 -petsc_ci -options_left 0 -options_view -options_monitor_viewer ascii -skip_petscrc 1 -options_monitor_cancel 0  > ex55_skip_petscrc-1_options_monitor_cancel-0_1.tmp 2> runex55_skip_petscrc-1_options_monitor_cancel-0_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/options/output/ex55_skip_petscrc-1_options_monitor_cancel-0_3.out ex55_skip_petscrc-1_options_monitor_cancel-0_3.tmp > diff-runex55_skip_petscrc-1_options_monitor_cancel-0_3.out 2> diff-runex55_skip_petscrc-1_options_monitor_cancel-0_3.out
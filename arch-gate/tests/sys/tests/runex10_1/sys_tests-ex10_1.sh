@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex10 -petsc_ci   > ex10_1.tmp 2> runex10_1.err
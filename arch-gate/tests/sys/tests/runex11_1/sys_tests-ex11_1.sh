@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex11 -petsc_ci   > ex11_1.tmp 2> runex11_1.err
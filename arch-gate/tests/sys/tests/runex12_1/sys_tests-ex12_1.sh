@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex12 -petsc_ci -values_view  > ex12_1.tmp 2> runex12_1.err
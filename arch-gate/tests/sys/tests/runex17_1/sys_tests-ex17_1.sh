@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex17 -petsc_ci   > ex17_1.tmp 2> runex17_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex18 -petsc_ci   > ex18_1.tmp 2> runex18_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex1 -petsc_ci -petsc_ci_portable_error_output -error_output_stdout  > ex1_1.tmp 2> runex1_1.err
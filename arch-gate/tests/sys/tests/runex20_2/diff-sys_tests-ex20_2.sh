@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex20_2.out ex20_2.tmp > diff-runex20_2.out 2> diff-runex20_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex20_3.out ex20_3.tmp > diff-runex20_3.out 2> diff-runex20_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex20 -petsc_ci -str  > ex20_3.tmp 2> runex20_3.err
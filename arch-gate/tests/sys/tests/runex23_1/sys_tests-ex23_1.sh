@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex23 -petsc_ci -options_file_yaml ex23options  > ex23_1.tmp 2> runex23_1.err
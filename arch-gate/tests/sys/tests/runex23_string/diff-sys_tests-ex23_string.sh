@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex23_string.out ex23_string.tmp > diff-runex23_string.out 2> diff-runex23_string.out
@@ -0,0 +1,14 @@
+/usr/bin/mpiexec  -n 1  ../ex23 -petsc_ci -options_string_yaml "
+  foo: &foo
+    view: true
+    max: &foomax
+      steps: 3
+      time: 1.4
+  bar: &bar
+    max_it: 5
+  ts:
+    <<: *foo
+    max:
+      <<: *foomax
+      steps: 10
+  snes: *bar"  > ex23_string.tmp 2> runex23_string.err
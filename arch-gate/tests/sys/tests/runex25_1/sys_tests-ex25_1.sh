@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex25 -petsc_ci   > ex25_1.tmp 2> runex25_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex26 -petsc_ci   > ex26_2.tmp 2> runex26_2.err
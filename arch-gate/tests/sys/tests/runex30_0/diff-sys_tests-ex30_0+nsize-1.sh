@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex30_0.out ex30_0.tmp > diff-runex30_0.out 2> diff-runex30_0.out
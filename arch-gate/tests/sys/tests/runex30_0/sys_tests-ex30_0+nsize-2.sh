@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex30 -petsc_ci   > ex30_0.tmp 2> runex30_0.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex30 -petsc_ci -log_view ::ascii_flamegraph  > ex30_1.tmp 2> runex30_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex30 -petsc_ci -log_trace  > ex30_2.tmp 2> runex30_2.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex30 -petsc_ci -log_include_actions -log_include_objects -log_all  > ex30_3.tmp 2> runex30_3.err
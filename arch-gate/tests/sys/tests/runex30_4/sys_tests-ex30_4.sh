@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex30 -petsc_ci -log_view ::ascii_csv -log_sync  > ex30_4.tmp 2> runex30_4.err
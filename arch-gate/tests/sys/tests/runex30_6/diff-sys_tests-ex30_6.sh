@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep "\\(Main Stage\\|Event1\\|Event2\\|Event3\\|Stage1\\|Stage2\\)"'  /root/repo/src/sys/tests/output/ex30_6.out ex30_6.tmp > diff-runex30_6.out 2> diff-runex30_6.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex30 -petsc_ci -log_perfstubs  > ex30_6.tmp 2> runex30_6.err
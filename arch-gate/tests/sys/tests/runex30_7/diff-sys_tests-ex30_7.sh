@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep "Event[123]" | grep "\\(Main Stage\\|Stage[123]\\)"'  /root/repo/src/sys/tests/output/ex30_7.out ex30_7.tmp > diff-runex30_7.out 2> diff-runex30_7.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex30 -petsc_ci -log_view ::ascii_info_detail -log_handler_default_use_threadsafe_events  > ex30_7.tmp 2> runex30_7.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep "This program was run with logging synchronization"'  /root/repo/src/sys/tests/output/ex30_8.out ex30_8.tmp > diff-runex30_8.out 2> diff-runex30_8.out
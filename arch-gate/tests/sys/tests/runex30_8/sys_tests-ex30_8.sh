@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex30 -petsc_ci -log_view -log_sync  > ex30_8.tmp 2> runex30_8.err
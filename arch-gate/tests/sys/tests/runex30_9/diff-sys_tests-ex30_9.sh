@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'cat trace.log.0'  /root/repo/src/sys/tests/output/ex30_2.out ex30_9.tmp > diff-runex30_9.out 2> diff-runex30_9.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex30 -petsc_ci -log_trace trace.log  > ex30_9.tmp 2> runex30_9.err
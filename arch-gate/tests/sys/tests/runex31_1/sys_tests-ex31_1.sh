@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex31 -petsc_ci   > ex31_1.tmp 2> runex31_1.err
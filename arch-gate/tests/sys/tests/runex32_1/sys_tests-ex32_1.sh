@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex32 -petsc_ci -skip_petscrc -options_left 0 -use_gpu_aware_mpi 0  > ex32_1.tmp 2> runex32_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex34 -petsc_ci -fp_trap 0  > ex34_1.tmp 2> runex34_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex37 -petsc_ci   > ex37_1.tmp 2> runex37_1.err
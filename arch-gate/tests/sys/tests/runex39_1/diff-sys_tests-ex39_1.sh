@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex39.out ex39_1.tmp > diff-runex39_1.out 2> diff-runex39_1.out
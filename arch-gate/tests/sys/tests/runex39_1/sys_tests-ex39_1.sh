@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex39 -petsc_ci -fp_trap 0  > ex39_1.tmp 2> runex39_1.err
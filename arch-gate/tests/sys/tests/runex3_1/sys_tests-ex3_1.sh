@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex3 -petsc_ci -fp_trap -error_output_stdout  1> ex3_1.tmp  2>&1
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex40 -petsc_ci   > ex40_1.tmp 2> runex40_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex42_1.out ex42_1.tmp > diff-runex42_1.out 2> diff-runex42_1.out
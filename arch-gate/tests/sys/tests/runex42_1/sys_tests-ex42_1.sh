@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex42 -petsc_ci -N 32  > ex42_1.tmp 2> runex42_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex47 -petsc_ci -options_left false -f petsc.yml  > ex47_1.tmp 2> runex47_1.err
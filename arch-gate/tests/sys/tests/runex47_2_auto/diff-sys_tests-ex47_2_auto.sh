@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -E -v "(options_monitor)"'  /root/repo/src/sys/tests/output/ex47_2_auto.out ex47_2_auto.tmp > diff-runex47_2_auto.out 2> diff-runex47_2_auto.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex47 -petsc_ci -options_left false -options_monitor -options_file ex47-yaml_tag -options_file ex47-yaml_doc  > ex47_2_auto.tmp 2> runex47_2_auto.err
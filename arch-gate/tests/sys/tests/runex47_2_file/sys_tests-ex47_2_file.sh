@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex47 -petsc_ci -options_left false -options_file_yaml petsc.yml  > ex47_2_file.tmp 2> runex47_2_file.err
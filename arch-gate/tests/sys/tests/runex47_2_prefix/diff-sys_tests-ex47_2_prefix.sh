@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -E -v "(options_monitor)"'  /root/repo/src/sys/tests/output/ex47_2_prefix.out ex47_2_prefix.tmp > diff-runex47_2_prefix.out 2> diff-runex47_2_prefix.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex47 -petsc_ci -options_left false -options_monitor -options_file ex47-opt.txt -prefix_push p5_ -options_file ex47-opt.yml -prefix_pop -prefix_push p5_ -options_file ex47-opt.yml:yaml -prefix_pop -prefix_push p6_ -options_file_yaml ex47-opt.yml -prefix_pop -prefix_push p7_ -options_string_yaml "`cat ex47-opt.yml`" -prefix_pop -prefix_push p7_ -options_string_yaml "`cat ex47-opt.yml`" -prefix_pop -prefix_push p8_ -options_string_yaml "`cat ex47-opt.yml`" -prefix_pop -prefix_push p9_ -options_file ex47-opt.json -prefix_pop  > ex47_2_prefix.tmp 2> runex47_2_prefix.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -E -v "(options_monitor)"'  /root/repo/src/sys/tests/output/ex47_2_string.out ex47_2_string.tmp > diff-runex47_2_string.out 2> diff-runex47_2_string.out
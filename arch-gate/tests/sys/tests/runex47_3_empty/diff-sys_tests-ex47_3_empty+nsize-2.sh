@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex47_3_empty.out ex47_3_empty.tmp > diff-runex47_3_empty.out 2> diff-runex47_3_empty.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex47 -petsc_ci -yaml ex47-empty.yaml  > ex47_3_empty.tmp 2> runex47_3_empty.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex47 -petsc_ci -monitor  > ex47_3_env.tmp 2> runex47_3_env.err
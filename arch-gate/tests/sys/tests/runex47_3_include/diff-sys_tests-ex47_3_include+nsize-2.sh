@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex47_3_include.out ex47_3_include.tmp > diff-runex47_3_include.out 2> diff-runex47_3_include.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex47 -petsc_ci -yaml ex47-include.yaml  > ex47_3_include.tmp 2> runex47_3_include.err
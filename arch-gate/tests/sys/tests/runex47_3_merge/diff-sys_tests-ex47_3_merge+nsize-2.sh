@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex47_3_merge.out ex47_3_merge.tmp > diff-runex47_3_merge.out 2> diff-runex47_3_merge.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex47 -petsc_ci -yaml ex47-merge.yaml -monitor  > ex47_3_merge.tmp 2> runex47_3_merge.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex47 -petsc_ci -yaml ex47-multidoc.yaml  > ex47_3_multidoc.tmp 2> runex47_3_multidoc.err
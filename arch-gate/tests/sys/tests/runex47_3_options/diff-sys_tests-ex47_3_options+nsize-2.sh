@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex47_3_options.out ex47_3_options.tmp > diff-runex47_3_options.out 2> diff-runex47_3_options.out
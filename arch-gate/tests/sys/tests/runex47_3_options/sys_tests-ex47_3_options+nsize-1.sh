@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex47 -petsc_ci -yaml ex47-options.yaml  > ex47_3_options.tmp 2> runex47_3_options.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex47_3_prefix.out ex47_3_prefix.tmp > diff-runex47_3_prefix.out 2> diff-runex47_3_prefix.out
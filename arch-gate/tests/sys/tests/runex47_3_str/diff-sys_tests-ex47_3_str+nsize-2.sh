@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex47_3_str.out ex47_3_str.tmp > diff-runex47_3_str.out 2> diff-runex47_3_str.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex47 -petsc_ci -yamlstr "name: value" -monitor  > ex47_3_str.tmp 2> runex47_3_str.err
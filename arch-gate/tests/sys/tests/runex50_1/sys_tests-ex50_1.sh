@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex50 -petsc_ci -viewer  > ex50_1.tmp 2> runex50_1.err
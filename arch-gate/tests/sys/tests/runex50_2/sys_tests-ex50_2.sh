@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex50 -petsc_ci -viewer -psubcomm_type interlaced  > ex50_2.tmp 2> runex50_2.err
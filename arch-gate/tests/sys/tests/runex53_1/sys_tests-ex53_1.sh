@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex53 -petsc_ci   > ex53_1.tmp 2> runex53_1.err
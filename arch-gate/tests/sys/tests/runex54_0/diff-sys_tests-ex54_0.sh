@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex54_0.out ex54_0.tmp > diff-runex54_0.out 2> diff-runex54_0.out
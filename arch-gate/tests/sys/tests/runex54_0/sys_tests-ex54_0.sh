@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex54 -petsc_ci -options_left 0 -options_view  > ex54_0.tmp 2> runex54_0.err
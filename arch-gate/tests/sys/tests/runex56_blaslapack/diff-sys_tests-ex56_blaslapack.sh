@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex56_blaslapack.out ex56_blaslapack.tmp > diff-runex56_blaslapack.out 2> diff-runex56_blaslapack.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex56 -petsc_ci -pkg blaslapack  > ex56_blaslapack.tmp 2> runex56_blaslapack.err
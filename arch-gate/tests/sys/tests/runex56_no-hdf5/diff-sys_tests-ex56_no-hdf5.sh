@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex56_no-hdf5.out ex56_no-hdf5.tmp > diff-runex56_no-hdf5.out 2> diff-runex56_no-hdf5.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex56 -petsc_ci -pkg hdf5  > ex56_no-hdf5.tmp 2> runex56_no-hdf5.err
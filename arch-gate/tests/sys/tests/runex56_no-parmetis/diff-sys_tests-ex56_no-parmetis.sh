@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex56_no-parmetis.out ex56_no-parmetis.tmp > diff-runex56_no-parmetis.out 2> diff-runex56_no-parmetis.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex56 -petsc_ci -pkg parmetis  > ex56_no-parmetis.tmp 2> runex56_no-parmetis.err
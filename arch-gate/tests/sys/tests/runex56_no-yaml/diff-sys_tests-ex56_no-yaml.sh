@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex56_no-yaml.out ex56_no-yaml.tmp > diff-runex56_no-yaml.out 2> diff-runex56_no-yaml.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex56 -petsc_ci -pkg yaml  > ex56_no-yaml.tmp 2> runex56_no-yaml.err
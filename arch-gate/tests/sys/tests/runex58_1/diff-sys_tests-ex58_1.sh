@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex58_1.out ex58_1.tmp > diff-runex58_1.out 2> diff-runex58_1.out
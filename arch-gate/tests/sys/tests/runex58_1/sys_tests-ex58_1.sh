@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex58 -petsc_ci   > ex58_1.tmp 2> runex58_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex5_opt.out ex5_opt.tmp > diff-runex5_opt.out 2> diff-runex5_opt.out
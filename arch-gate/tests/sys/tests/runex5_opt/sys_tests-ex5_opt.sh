@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -unused_petsc_option_1 -unused_petsc_option_2 -get_an_integer 10 -options_left no  > ex5_opt.tmp 2> runex5_opt.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex61_env_not_set.out ex61_env_not_set.tmp > diff-runex61_env_not_set.out 2> diff-runex61_env_not_set.out
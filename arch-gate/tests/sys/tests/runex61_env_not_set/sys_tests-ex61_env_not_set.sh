@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex61 -petsc_ci   > ex61_env_not_set.tmp 2> runex61_env_not_set.err
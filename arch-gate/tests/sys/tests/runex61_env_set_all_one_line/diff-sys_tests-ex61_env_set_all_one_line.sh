@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex61_env_set_all_one_line.out ex61_env_set_all_one_line.tmp > diff-runex61_env_set_all_one_line.out 2> diff-runex61_env_set_all_one_line.out
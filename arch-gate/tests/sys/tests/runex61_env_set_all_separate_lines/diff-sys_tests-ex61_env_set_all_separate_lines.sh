@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex61_env_set_all_separate_lines.out ex61_env_set_all_separate_lines.tmp > diff-runex61_env_set_all_separate_lines.out 2> diff-runex61_env_set_all_separate_lines.out
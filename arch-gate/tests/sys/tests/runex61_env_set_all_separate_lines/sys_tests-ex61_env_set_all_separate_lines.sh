@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex61 -petsc_ci -env_vars_def FOO=1  > ex61_env_set_all_separate_lines.tmp 2> runex61_env_set_all_separate_lines.err
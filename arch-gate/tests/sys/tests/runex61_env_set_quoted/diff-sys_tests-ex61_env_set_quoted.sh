@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex61_env_set_quoted.out ex61_env_set_quoted.tmp > diff-runex61_env_set_quoted.out 2> diff-runex61_env_set_quoted.out
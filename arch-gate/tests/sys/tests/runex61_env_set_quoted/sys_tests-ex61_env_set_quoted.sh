@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex61 -petsc_ci -env_vars_def FOO=hello  > ex61_env_set_quoted.tmp 2> runex61_env_set_quoted.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex62_0.out ex62_0.tmp > diff-runex62_0.out 2> diff-runex62_0.out
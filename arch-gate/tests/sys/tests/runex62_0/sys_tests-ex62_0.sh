@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex62 -petsc_ci   > ex62_0.tmp 2> runex62_0.err
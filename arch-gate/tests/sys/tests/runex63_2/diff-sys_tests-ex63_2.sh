@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex63_2.out ex63_2.tmp > diff-runex63_2.out 2> diff-runex63_2.out
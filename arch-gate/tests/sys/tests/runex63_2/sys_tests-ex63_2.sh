@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex63 -petsc_ci   > ex63_2.tmp 2> runex63_2.err
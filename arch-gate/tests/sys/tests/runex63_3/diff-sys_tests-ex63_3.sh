@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex63_3.out ex63_3.tmp > diff-runex63_3.out 2> diff-runex63_3.out
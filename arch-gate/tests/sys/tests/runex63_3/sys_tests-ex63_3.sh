@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../ex63 -petsc_ci   > ex63_3.tmp 2> runex63_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex63_4.out ex63_4.tmp > diff-runex63_4.out 2> diff-runex63_4.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex63 -petsc_ci   > ex63_4.tmp 2> runex63_4.err
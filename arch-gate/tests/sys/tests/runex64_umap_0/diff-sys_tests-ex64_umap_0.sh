@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex64_umap_0.out ex64_umap_0.tmp > diff-runex64_umap_0.out 2> diff-runex64_umap_0.out
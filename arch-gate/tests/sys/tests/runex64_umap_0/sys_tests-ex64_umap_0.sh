@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex64 -petsc_ci   > ex64_umap_0.tmp 2> runex64_umap_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -E -v "(memory block|leaked context|not freed before MPI_Finalize|Could be the program crashed|PETSc Option Table entries|source: environment)"'  /root/repo/src/sys/tests/output/ex66_1.out ex66_1.tmp > diff-runex66_1.out 2> diff-runex66_1.out
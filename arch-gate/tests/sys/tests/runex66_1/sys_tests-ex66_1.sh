@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex66 -petsc_ci -petsc_ci_portable_error_output -error_output_stdout  > ex66_1.tmp 2> runex66_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex67_0.out ex67_0.tmp > diff-runex67_0.out 2> diff-runex67_0.out
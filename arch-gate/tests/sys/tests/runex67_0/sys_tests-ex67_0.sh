@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex67 -petsc_ci   > ex67_0.tmp 2> runex67_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -o "\\(External runtime initialization\\|Unrelated event\\)"'  /root/repo/src/sys/tests/output/ex68_0.out ex68_0.tmp > diff-runex68_0.out 2> diff-runex68_0.out
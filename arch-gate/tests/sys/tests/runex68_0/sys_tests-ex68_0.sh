@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex68 -petsc_ci -log_view -unrelated_visible  > ex68_0.tmp 2> runex68_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -o "\\(External runtime initialization\\|Unrelated event\\)"'  /root/repo/src/sys/tests/output/ex68_1.out ex68_1.tmp > diff-runex68_1.out 2> diff-runex68_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex68 -petsc_ci -log_view -main_visible  > ex68_1.tmp 2> runex68_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex71 -petsc_ci -petsc_ci 0  > ex71_0.tmp 2> runex71_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -E "s/ [0-9]+/ time_removed/g"'  /root/repo/src/sys/tests/output/ex72_0.out ex72_0.tmp > diff-runex72_0.out 2> diff-runex72_0.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex72 -petsc_ci -log_view ::ascii_flamegraph -info :loghandler  > ex72_0.tmp 2> runex72_0.err
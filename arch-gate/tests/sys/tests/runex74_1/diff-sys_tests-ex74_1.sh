@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex74_1.out ex74_1.tmp > diff-runex74_1.out 2> diff-runex74_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex7 -petsc_ci   > ex7_1.tmp 2> runex7_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex8 -petsc_ci -verbose -build_twosided allreduce  > ex8_1.tmp 2> runex8_1.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex8 -petsc_ci -verbose -build_twosided_f -build_twosided ibarrier  > ex8_f_ibarrier.tmp 2> runex8_f_ibarrier.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex8_1.out ex8_ibarrier.tmp > diff-runex8_ibarrier.out 2> diff-runex8_ibarrier.out
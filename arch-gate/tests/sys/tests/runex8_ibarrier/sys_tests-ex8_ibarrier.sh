@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex8 -petsc_ci -verbose -build_twosided ibarrier  > ex8_ibarrier.tmp 2> runex8_ibarrier.err
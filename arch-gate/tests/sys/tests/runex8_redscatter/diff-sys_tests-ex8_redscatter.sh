@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tests/output/ex8_1.out ex8_redscatter.tmp > diff-runex8_redscatter.out 2> diff-runex8_redscatter.out
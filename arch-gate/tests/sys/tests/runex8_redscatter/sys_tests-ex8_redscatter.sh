@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 4  ../ex8 -petsc_ci -verbose -build_twosided redscatter  > ex8_redscatter.tmp 2> runex8_redscatter.err
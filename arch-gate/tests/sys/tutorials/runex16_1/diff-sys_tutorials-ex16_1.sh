@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -E -v "(cuda_initialize|Total flops)"'  /root/repo/src/sys/tutorials/output/ex16_1.out ex16_1.tmp > diff-runex16_1.out 2> diff-runex16_1.out
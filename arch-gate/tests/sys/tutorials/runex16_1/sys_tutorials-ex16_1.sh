@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../ex16 -petsc_ci -options_view -get_total_flops  > ex16_1.tmp 2> runex16_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/sys/tutorials/output/ex19_1.out ex19_1.tmp > diff-runex19_1.out 2> diff-runex19_1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sort -b | grep -v saws_port_auto_selectcd' -f $'sort -b'  /root/repo/src/sys/tutorials/output/ex4_1.out ex4_1.tmp > diff-runex4_1.out 2> diff-runex4_1.out
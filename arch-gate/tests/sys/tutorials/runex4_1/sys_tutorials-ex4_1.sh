@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 5  ../ex4 -petsc_ci -options_left no  > ex4_1.tmp 2> runex4_1.err
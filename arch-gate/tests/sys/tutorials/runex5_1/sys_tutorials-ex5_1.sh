@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -pbag_rho 44 -pbag_do_output true  > ex5_1.tmp 2> runex5_1.err
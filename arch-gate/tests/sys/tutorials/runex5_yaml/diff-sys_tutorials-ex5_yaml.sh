@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -E -v "(options_view)"'  /root/repo/src/sys/tutorials/output/ex5_yaml.out ex5_yaml.tmp > diff-runex5_yaml.out 2> diff-runex5_yaml.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../ex5 -petsc_ci -options_file bag.yml -options_view  > ex5_yaml.tmp 2> runex5_yaml.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -E "s/:[^:]+:/:time_removed:/g"'  /root/repo/src/sys/tutorials/output/ex6_0.out ex6_0.tmp > diff-runex6_0.out 2> diff-runex6_0.out
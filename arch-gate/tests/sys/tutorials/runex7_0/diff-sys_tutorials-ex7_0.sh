@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -E "s/:[^:]+:/:time_removed:/g"'  /root/repo/src/sys/tutorials/output/ex7_0.out ex7_0.tmp > diff-runex7_0.out 2> diff-runex7_0.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_1.out jbearing2_1.tmp > diff-runjbearing2_1.out 2> diff-runjbearing2_1.out
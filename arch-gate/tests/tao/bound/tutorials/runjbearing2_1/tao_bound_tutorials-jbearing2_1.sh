@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../jbearing2 -petsc_ci -tao_monitor_short -mx 8 -my 12 -tao_type tron -tao_gatol 1.e-5  > jbearing2_1.tmp 2> runjbearing2_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_10.out jbearing2_10.tmp > diff-runjbearing2_10.out 2> diff-runjbearing2_10.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_11.out jbearing2_11.tmp > diff-runjbearing2_11.out 2> diff-runjbearing2_11.out
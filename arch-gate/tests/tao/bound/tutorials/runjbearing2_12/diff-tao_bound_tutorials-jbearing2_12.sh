@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_12.out jbearing2_12.tmp > diff-runjbearing2_12.out 2> diff-runjbearing2_12.out
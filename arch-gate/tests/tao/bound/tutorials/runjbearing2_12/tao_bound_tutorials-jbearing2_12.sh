@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../jbearing2 -petsc_ci -tao_monitor_short -mx 8 -my 12 -tao_type bntl -tao_gatol 1e-5 -tao_bnk_max_cg_its 3  > jbearing2_12.tmp 2> runjbearing2_12.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_13.out jbearing2_13.tmp > diff-runjbearing2_13.out 2> diff-runjbearing2_13.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_14.out jbearing2_14.tmp > diff-runjbearing2_14.out 2> diff-runjbearing2_14.out
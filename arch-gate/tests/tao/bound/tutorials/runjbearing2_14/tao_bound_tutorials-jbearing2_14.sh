@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../jbearing2 -petsc_ci -tao_monitor_short -mx 8 -my 12 -tao_gatol 1e-4 -tao_type blmvm  > jbearing2_14.tmp 2> runjbearing2_14.err
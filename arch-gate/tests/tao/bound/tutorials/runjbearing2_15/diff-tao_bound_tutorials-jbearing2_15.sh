@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_15.out jbearing2_15.tmp > diff-runjbearing2_15.out 2> diff-runjbearing2_15.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_16.out jbearing2_16.tmp > diff-runjbearing2_16.out 2> diff-runjbearing2_16.out
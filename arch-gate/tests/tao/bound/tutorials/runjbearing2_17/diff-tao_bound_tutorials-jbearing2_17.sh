@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_17.out jbearing2_17.tmp > diff-runjbearing2_17.out 2> diff-runjbearing2_17.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_18.out jbearing2_18.tmp > diff-runjbearing2_18.out 2> diff-runjbearing2_18.out
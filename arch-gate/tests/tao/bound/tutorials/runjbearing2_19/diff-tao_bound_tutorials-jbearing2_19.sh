@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_19.out jbearing2_19.tmp > diff-runjbearing2_19.out 2> diff-runjbearing2_19.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_2.out jbearing2_2.tmp > diff-runjbearing2_2.out 2> diff-runjbearing2_2.out
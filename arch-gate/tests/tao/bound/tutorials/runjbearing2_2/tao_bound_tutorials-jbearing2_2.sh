@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../jbearing2 -petsc_ci -tao_monitor_short -mx 50 -my 50 -ecc 0.99 -tao_type gpcg -tao_gatol 1.e-5  > jbearing2_2.tmp 2> runjbearing2_2.err
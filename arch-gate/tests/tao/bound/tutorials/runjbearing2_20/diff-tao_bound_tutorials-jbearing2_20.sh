@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_20.out jbearing2_20.tmp > diff-runjbearing2_20.out 2> diff-runjbearing2_20.out
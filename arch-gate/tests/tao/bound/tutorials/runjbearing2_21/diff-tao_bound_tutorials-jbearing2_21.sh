@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_21.out jbearing2_21.tmp > diff-runjbearing2_21.out 2> diff-runjbearing2_21.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_3.out jbearing2_3.tmp > diff-runjbearing2_3.out 2> diff-runjbearing2_3.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../jbearing2 -petsc_ci -tao_monitor_short -mx 10 -my 16 -ecc 0.9 -tao_type bqpip -tao_gatol 1.e-4  > jbearing2_3.tmp 2> runjbearing2_3.err
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../jbearing2 -petsc_ci -tao_monitor_short -mx 10 -my 16 -ecc 0.9 -tao_type bqpip -tao_gatol 1.e-4 -test_getdiagonal  > jbearing2_4.tmp 2> runjbearing2_4.err
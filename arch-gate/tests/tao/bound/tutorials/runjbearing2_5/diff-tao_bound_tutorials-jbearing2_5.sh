@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_5.out jbearing2_5.tmp > diff-runjbearing2_5.out 2> diff-runjbearing2_5.out
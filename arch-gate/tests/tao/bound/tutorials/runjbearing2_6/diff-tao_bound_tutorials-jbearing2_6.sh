@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_6.out jbearing2_6.tmp > diff-runjbearing2_6.out 2> diff-runjbearing2_6.out
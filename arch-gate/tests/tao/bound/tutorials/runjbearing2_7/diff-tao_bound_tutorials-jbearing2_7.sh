@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_7.out jbearing2_7.tmp > diff-runjbearing2_7.out 2> diff-runjbearing2_7.out
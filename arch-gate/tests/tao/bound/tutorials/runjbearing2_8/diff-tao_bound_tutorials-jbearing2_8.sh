@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_8.out jbearing2_8.tmp > diff-runjbearing2_8.out 2> diff-runjbearing2_8.out
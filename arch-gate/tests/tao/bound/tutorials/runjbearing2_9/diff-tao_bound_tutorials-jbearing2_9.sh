@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/jbearing2_9.out jbearing2_9.tmp > diff-runjbearing2_9.out 2> diff-runjbearing2_9.out
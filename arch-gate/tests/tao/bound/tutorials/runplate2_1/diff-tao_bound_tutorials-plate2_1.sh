@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_1.out plate2_1.tmp > diff-runplate2_1.out 2> diff-runplate2_1.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../plate2 -petsc_ci -tao_monitor_short -mx 8 -my 6 -bmx 3 -bmy 3 -bheight 0.2 -tao_type tron -tao_gatol 1.e-5  > plate2_1.tmp 2> runplate2_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_10.out plate2_10.tmp > diff-runplate2_10.out 2> diff-runplate2_10.out
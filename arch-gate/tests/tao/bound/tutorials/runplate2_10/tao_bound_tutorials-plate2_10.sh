@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 1  ../plate2 -petsc_ci -tao_monitor_short -mx 8 -my 6 -bmx 3 -bmy 3 -bheight 0.2 -tao_type bnls -tao_gatol 1e-5  > plate2_10.tmp 2> runplate2_10.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_11.out plate2_11.tmp > diff-runplate2_11.out 2> diff-runplate2_11.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_12.out plate2_12.tmp > diff-runplate2_12.out 2> diff-runplate2_12.out
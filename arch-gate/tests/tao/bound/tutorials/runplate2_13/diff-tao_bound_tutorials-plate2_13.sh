@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_13.out plate2_13.tmp > diff-runplate2_13.out 2> diff-runplate2_13.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_14.out plate2_14.tmp > diff-runplate2_14.out 2> diff-runplate2_14.out
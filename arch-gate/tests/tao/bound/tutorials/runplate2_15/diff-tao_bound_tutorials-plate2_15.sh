@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_15.out plate2_15.tmp > diff-runplate2_15.out 2> diff-runplate2_15.out
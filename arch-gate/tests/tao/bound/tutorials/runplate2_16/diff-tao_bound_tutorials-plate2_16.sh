@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_16.out plate2_16.tmp > diff-runplate2_16.out 2> diff-runplate2_16.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_17.out plate2_17.tmp > diff-runplate2_17.out 2> diff-runplate2_17.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_18.out plate2_18.tmp > diff-runplate2_18.out 2> diff-runplate2_18.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_19.out plate2_19.tmp > diff-runplate2_19.out 2> diff-runplate2_19.out
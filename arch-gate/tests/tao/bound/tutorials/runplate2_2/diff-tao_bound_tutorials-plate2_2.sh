@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_2.out plate2_2.tmp > diff-runplate2_2-0.out 2> diff-runplate2_2-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_2_alt.out plate2_2.tmp > diff-runplate2_2.out 2> diff-runplate2_2.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 2  ../plate2 -petsc_ci -tao_monitor_short -mx 8 -my 8 -bmx 2 -bmy 5 -bheight 0.3 -tao_type blmvm -tao_gatol 1.e-4  > plate2_2.tmp 2> runplate2_2.err
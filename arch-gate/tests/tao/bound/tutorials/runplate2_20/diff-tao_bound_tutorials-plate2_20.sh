@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_20.out plate2_20.tmp > diff-runplate2_20-0.out 2> diff-runplate2_20-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_20_alt.out plate2_20.tmp > diff-runplate2_20.out 2> diff-runplate2_20.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_3.out plate2_3.tmp > diff-runplate2_3.out 2> diff-runplate2_3.out
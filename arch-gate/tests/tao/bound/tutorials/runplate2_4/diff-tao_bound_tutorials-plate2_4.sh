@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_4.out plate2_4.tmp > diff-runplate2_4.out 2> diff-runplate2_4.out
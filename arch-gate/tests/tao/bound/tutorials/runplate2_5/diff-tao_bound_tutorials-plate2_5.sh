@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_5.out plate2_5.tmp > diff-runplate2_5.out 2> diff-runplate2_5.out
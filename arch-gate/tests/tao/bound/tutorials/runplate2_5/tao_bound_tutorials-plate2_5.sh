@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../plate2 -petsc_ci -tao_monitor_short -mx 8 -my 12 -bmx 4 -bmy 10 -bheight 0.1 -tao_subset_type matrixfree -matrixfree -pc_type none -tao_type tron -tao_gatol 1.e-5  > plate2_5.tmp 2> runplate2_5.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_6.out plate2_6.tmp > diff-runplate2_6-0.out 2> diff-runplate2_6-0.out || /root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_6_alt.out plate2_6.tmp > diff-runplate2_6.out 2> diff-runplate2_6.out
@@ -0,0 +1 @@
+/usr/bin/mpiexec  -n 3  ../plate2 -petsc_ci -tao_monitor_short -mx 8 -my 12 -bmx 4 -bmy 10 -bheight 0.1 -tao_subset_type matrixfree -matrixfree -tao_type blmvm -tao_gatol 1.e-4  > plate2_6.tmp 2> runplate2_6.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_7.out plate2_7.tmp > diff-runplate2_7.out 2> diff-runplate2_7.out
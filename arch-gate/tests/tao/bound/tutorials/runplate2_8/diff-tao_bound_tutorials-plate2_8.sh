@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_8.out plate2_8.tmp > diff-runplate2_8.out 2> diff-runplate2_8.out
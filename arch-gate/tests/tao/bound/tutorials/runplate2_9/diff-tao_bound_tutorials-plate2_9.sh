@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff   /root/repo/src/tao/bound/tutorials/output/plate2_9.out plate2_9.tmp > diff-runplate2_9.out 2> diff-runplate2_9.out